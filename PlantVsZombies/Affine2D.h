@@ -0,0 +1,103 @@
+#pragma once
+#ifndef _AFFINE_2D_H
+#define _AFFINE_2D_H
+
+#include <glm/glm.hpp>
+#include <cmath>
+
+/**
+ * 2D 仿射变换（6 个 float）：x' = a*x + c*y + tx，y' = b*x + d*y + ty。
+ *
+ * 分量顺序与 glm::mat4 的列主序一致：(a,b)=m[0].xy，(c,d)=m[1].xy，(tx,ty)=m[3].xy，
+ * 也与 InstanceRecord 的 tA/tB/tC/tD/tx/ty 一一对应。Graphics 变换栈与批处理路径全部
+ * 使用本类型，glm::mat4 只保留在公开 API 参数与 GPU 上传（SSBO 仍是 mat4 布局）两端。
+ */
+struct Affine2D {
+	float a = 1.0f, b = 0.0f;
+	float c = 0.0f, d = 1.0f;
+	float tx = 0.0f, ty = 0.0f;
+
+	static Affine2D Identity() { return Affine2D{}; }
+
+	static Affine2D Translation(float x, float y) {
+		Affine2D m;
+		m.tx = x; m.ty = y;
+		return m;
+	}
+
+	static Affine2D Scaling(float sx, float sy) {
+		Affine2D m;
+		m.a = sx; m.d = sy;
+		return m;
+	}
+
+	/** 绕 z 轴旋转（弧度），与 glm::rotate(..., vec3(0,0,1)) 同向。 */
+	static Affine2D Rotation(float radians) {
+		const float cs = std::cos(radians);
+		const float sn = std::sin(radians);
+		Affine2D m;
+		m.a = cs;  m.b = sn;
+		m.c = -sn; m.d = cs;
+		return m;
+	}
+
+	/**
+	 * 精灵矩形的局部变换：平移到 (x,y) → 缩放到 w×h → 绕单位 quad 中心旋转 rotationDeg 度。
+	 * 等价于原 DrawTexture 里 translate/scale/translate/rotate/translate 五次 mat4 相乘。
+	 */
+	static Affine2D Rect(float x, float y, float w, float h, float rotationDeg = 0.0f) {
+		Affine2D m;
+		m.a = w; m.d = h;
+		m.tx = x; m.ty = y;
+		if (rotationDeg != 0.0f) {
+			m = m * Translation(0.5f, 0.5f)
+				* Rotation(rotationDeg * 0.01745329251994329577f)
+				* Translation(-0.5f, -0.5f);
+		}
+		return m;
+	}
+
+	/** 截取 mat4 的 2D 仿射部分（丢弃 z 行/列与透视分量）。 */
+	static Affine2D FromMat4(const glm::mat4& m) {
+		Affine2D r;
+		r.a = m[0][0]; r.b = m[0][1];
+		r.c = m[1][0]; r.d = m[1][1];
+		r.tx = m[3][0]; r.ty = m[3][1];
+		return r;
+	}
+
+	glm::mat4 ToMat4() const {
+		glm::mat4 m(1.0f);
+		m[0][0] = a;  m[0][1] = b;
+		m[1][0] = c;  m[1][1] = d;
+		m[3][0] = tx; m[3][1] = ty;
+		return m;
+	}
+
+	bool IsIdentity() const {
+		return a == 1.0f && b == 0.0f && c == 0.0f && d == 1.0f && tx == 0.0f && ty == 0.0f;
+	}
+
+	glm::vec2 Apply(float x, float y) const {
+		return glm::vec2(a * x + c * y + tx, b * x + d * y + ty);
+	}
+
+	/** 复合：(*this * o) 先施加 o 再施加 *this，与 mat4 乘法顺序相同。 */
+	Affine2D operator*(const Affine2D& o) const {
+		Affine2D r;
+		r.a = a * o.a + c * o.b;
+		r.b = b * o.a + d * o.b;
+		r.c = a * o.c + c * o.d;
+		r.d = b * o.c + d * o.d;
+		r.tx = a * o.tx + c * o.ty + tx;
+		r.ty = b * o.tx + d * o.ty + ty;
+		return r;
+	}
+
+	bool operator==(const Affine2D& o) const {
+		return a == o.a && b == o.b && c == o.c && d == o.d && tx == o.tx && ty == o.ty;
+	}
+	bool operator!=(const Affine2D& o) const { return !(*this == o); }
+};
+
+#endif
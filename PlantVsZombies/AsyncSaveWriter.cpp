@@ -0,0 +1,158 @@
+#include "AsyncSaveWriter.h"
+#include "Logger.h"
+#include <algorithm>
+#include <cstdio>
+#include <exception>
+#include <filesystem>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace {
+	/** 写入、flush 并把数据刷到磁盘；仅 fflush 只进了系统缓存，断电仍可能留下空文件。 */
+	bool WriteAndSync(const std::filesystem::path& path, std::string_view bytes)
+	{
+#if defined(_WIN32)
+		FILE* file = _wfopen(path.c_str(), L"wb");
+#else
+		FILE* file = std::fopen(path.c_str(), "wb");
+#endif
+		if (!file) return false;
+		bool ok = bytes.empty() || std::fwrite(bytes.data(), 1, bytes.size(), file) == bytes.size();
+		ok = std::fflush(file) == 0 && ok;
+#if defined(_WIN32)
+		ok = ok && _commit(_fileno(file)) == 0;
+#else
+		ok = ok && fsync(fileno(file)) == 0;
+#endif
+		return std::fclose(file) == 0 && ok;
+	}
+
+	/** 用临时文件覆盖目标；同卷改名是原子的，读者只会看到旧文件或完整的新文件。 */
+	bool ReplaceFile(const std::filesystem::path& from, const std::filesystem::path& to)
+	{
+#if defined(_WIN32)
+		return MoveFileExW(from.c_str(), to.c_str(),
+			MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+		std::error_code ec;
+		std::filesystem::rename(from, to, ec);
+		return !ec;
+#endif
+	}
+}
+
+bool WriteFileAtomic(const std::string& path, std::string_view bytes, std::string& error)
+{
+	const std::filesystem::path target = std::filesystem::u8path(path);
+	const std::filesystem::path temporary = std::filesystem::u8path(path + ".tmp");
+	std::error_code ec;
+	if (!WriteAndSync(temporary, bytes)) {
+		std::filesystem::remove(temporary, ec);
+		error = "写入临时文件失败: " + path + ".tmp";
+		return false;
+	}
+	if (!ReplaceFile(temporary, target)) {
+		std::filesystem::remove(temporary, ec);
+		error = "临时文件改名覆盖失败: " + path;
+		return false;
+	}
+	return true;
+}
+
+AsyncSaveWriter::~AsyncSaveWriter()
+{
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mStopping = true;   // 已提交的任务照常写完再退出，关闭游戏不丢最后一次存档
+	}
+	mWake.notify_all();
+	if (mWorker.joinable()) mWorker.join();
+}
+
+void AsyncSaveWriter::Submit(const std::string& path, Encoder encode, Committed committed)
+{
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		auto existing = std::find_if(mQueue.begin(), mQueue.end(),
+			[&path](const Job& job) { return job.path == path; });
+		if (existing != mQueue.end()) {
+			existing->encode = std::move(encode);
+			existing->committed = std::move(committed);
+		}
+		else {
+			mQueue.push_back({ path, std::move(encode), std::move(committed) });
+		}
+		if (!mWorker.joinable()) {
+			mWorker = std::thread(&AsyncSaveWriter::WorkerLoop, this);
+		}
+	}
+	mWake.notify_one();
+}
+
+void AsyncSaveWriter::Cancel(const std::string& path)
+{
+	std::unique_lock<std::mutex> lock(mMutex);
+	mQueue.erase(std::remove_if(mQueue.begin(), mQueue.end(),
+		[&path](const Job& job) { return job.path == path; }), mQueue.end());
+	mIdle.wait(lock, [this, &path] { return mRunningPath != path; });
+}
+
+void AsyncSaveWriter::Flush()
+{
+	std::unique_lock<std::mutex> lock(mMutex);
+	mIdle.wait(lock, [this] { return mQueue.empty() && mRunningPath.empty(); });
+}
+
+bool AsyncSaveWriter::IsIdle() const
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	return mQueue.empty() && mRunningPath.empty();
+}
+
+int AsyncSaveWriter::GetFailureCount() const
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	return mFailures;
+}
+
+void AsyncSaveWriter::WorkerLoop()
+{
+	std::unique_lock<std::mutex> lock(mMutex);
+	while (true) {
+		mWake.wait(lock, [this] { return mStopping || !mQueue.empty(); });
+		if (mQueue.empty()) return;   // 只有 mStopping 且队列已空时才退出
+
+		Job job = std::move(mQueue.front());
+		mQueue.pop_front();
+		mRunningPath = job.path;
+		lock.unlock();
+
+		bool ok = false;
+		std::string error;
+		try {
+			ok = WriteFileAtomic(job.path, job.encode(), error);
+			if (ok && job.committed) job.committed();
+		}
+		catch (const std::exception& e) {
+			error = std::string("编码存档异常: ") + e.what();
+		}
+		catch (...) {
+			error = "编码存档时发生未知异常";
+		}
+		if (!ok) {
+			LOG_ERROR("AsyncSaveWriter") << "后台存档失败，原存档保持不变: " << error;
+		}
+
+		lock.lock();
+		if (!ok) ++mFailures;
+		mRunningPath.clear();
+		mIdle.notify_all();
+	}
+}
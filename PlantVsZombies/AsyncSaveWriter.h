@@ -0,0 +1,69 @@
+#pragma once
+#ifndef _ASYNC_SAVE_WRITER_H
+#define _ASYNC_SAVE_WRITER_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+
+/**
+ * 原子替换写文件：先写同目录的 path + ".tmp"，flush 并落盘后再改名覆盖 path。
+ * 任何一步失败都删除临时文件、返回 false 并写 error，原有的 path 保持不变；
+ * 进程在写入中途被杀时最多残留一个 .tmp，下次写入会直接覆盖它。
+ */
+bool WriteFileAtomic(const std::string& path, std::string_view bytes, std::string& error);
+
+/**
+ * 存档后台写入队列：单个常驻工作线程，按提交顺序执行"编码 → 原子写 → 提交后回调"。
+ *
+ * 主线程只负责捕获状态（把要写的东西整理成自包含的值），编码与磁盘 IO 都放到 Encoder 里，
+ * 在工作线程上执行。同一路径尚未开始的旧任务会被新任务顶替，连续存档只写最后一份。
+ * 线程在首次 Submit 时才启动，从不存档的运行（基准、AutoTest）不会多出线程。
+ */
+class AsyncSaveWriter {
+public:
+	/** 在工作线程上生成最终文件内容；抛异常视为本次写入失败，原文件不动。 */
+	using Encoder = std::function<std::string()>;
+	/** 新文件改名成功后在工作线程上执行，用于清理被取代的旧格式文件等。 */
+	using Committed = std::function<void()>;
+
+	AsyncSaveWriter() = default;
+	~AsyncSaveWriter();
+
+	AsyncSaveWriter(const AsyncSaveWriter&) = delete;
+	AsyncSaveWriter& operator=(const AsyncSaveWriter&) = delete;
+
+	void Submit(const std::string& path, Encoder encode, Committed committed = nullptr);
+	/** 丢弃 path 尚未开始的任务，并等正在写 path 的任务结束；返回后不会再有对 path 的写入。 */
+	void Cancel(const std::string& path);
+	/** 阻塞到队列清空且没有任务在执行。 */
+	void Flush();
+
+	bool IsIdle() const;
+	/** 累计失败次数（编码异常或写盘失败），失败原因已记日志。 */
+	int GetFailureCount() const;
+
+private:
+	struct Job {
+		std::string path;
+		Encoder encode;
+		Committed committed;
+	};
+
+	void WorkerLoop();
+
+	mutable std::mutex mMutex;
+	std::condition_variable mWake;
+	std::condition_variable mIdle;
+	std::deque<Job> mQueue;
+	std::string mRunningPath;   // 正在执行的任务路径；空表示工作线程空闲
+	bool mStopping = false;
+	int mFailures = 0;
+	std::thread mWorker;
+};
+
+#endif
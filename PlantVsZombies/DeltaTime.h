@@ -14,6 +14,8 @@ class DeltaTime {
 private:
 	static constexpr float kFixedStep = 1.0f / 60.0f;
 	static constexpr int kMaxCatchUpSteps = 3;
+	// 不限速快进时单个渲染帧最多跑的逻辑步数；实际由主线程按 kTurboFrameBudget 截断
+	static constexpr int kMaxUnboundedTurboSteps = 512;
 
 	inline static Uint64 lastTime = 0;
 	// 尚未折算成逻辑步的墙钟余量（秒）
@@ -25,6 +27,14 @@ private:
 	// 暂停前保存的时间缩放系数，恢复时还原（避免暂停后丢失用户选择的速度）
 	inline static float savedTimeScale = 1.0f;
 
+	// 快进倍数：每个墙钟固定步折算为 turboFactor 个逻辑步（1 = 关闭，0 = 不限速）。
+	// 与 timeScale 不同，快进不放大单步 dt，逻辑序列与 1 倍速逐步一致，只是单帧跑更多步。
+	inline static int turboFactor = 1;
+	// 当前逻辑步之后本渲染帧还要继续跑（中间步）：画面看不到这一步，粒子推进/一次性音效跳过
+	inline static bool intermediateStep = false;
+	// 渲染插值开关：关闭时 Draw 直接画最后一步的状态（AutoTest 截图需要逐像素稳定）
+	inline static bool interpolationEnabled = true;
+
 	// 游戏总时间统计
 	inline static double totalGameTime = 0.0;
 	inline static double unscaledTotalTime = 0.0;
@@ -51,7 +61,43 @@ public:
 		else {
 			accumulator -= steps * kFixedStep;
 		}
-		return steps;
+		if (turboFactor == 0) {
+			accumulator = 0.0f;   // 不限速：墙钟只决定何时呈现，步数交给帧预算
+			return kMaxUnboundedTurboSteps;
+		}
+		return steps * turboFactor;
+	}
+
+	// 不限速快进下每个渲染帧留给逻辑步的墙钟预算（秒）：约 4ms 留给 Draw 与 present
+	static constexpr float kTurboFrameBudget = 0.012f;
+
+	/** 设置快进倍数：1 关闭，2/4/8 为固定倍数，0 为不限速；其它值按 1 处理。 */
+	static void SetTurbo(int factor) {
+		turboFactor = (factor == 0 || factor == 2 || factor == 4 || factor == 8) ? factor : 1;
+	}
+
+	static int GetTurbo() { return turboFactor; }
+
+	static bool IsUnboundedTurbo() { return turboFactor == 0; }
+
+	// 主循环在每个逻辑步开头写入；本帧最后一步（被呈现的那一步）为 false
+	static void SetIntermediateStep(bool intermediate) { intermediateStep = intermediate; }
+
+	static bool IsIntermediateStep() { return intermediateStep; }
+
+	static void SetInterpolation(bool enabled) { interpolationEnabled = enabled; }
+
+	static bool IsInterpolationEnabled() { return interpolationEnabled; }
+
+	/**
+	 * 渲染插值系数：BeginFrame 折算后剩余的墙钟余量占一个逻辑步的比例（0..1）。
+	 * Draw 在"上一步开头"与"最后一步结束"两份状态之间按此系数插值，画面比逻辑滞后不足一步。
+	 * 快进时单帧多步、余量被丢弃，插值无意义，返回 1（直接画最新状态）。
+	 */
+	static float GetInterpolationAlpha() {
+		if (!interpolationEnabled || turboFactor != 1) return 1.0f;
+		const float alpha = accumulator / kFixedStep;
+		return alpha < 0.0f ? 0.0f : (alpha > 1.0f ? 1.0f : alpha);
 	}
 
 	// 每个逻辑步开头调用：装填本步的 deltaTime / unscaledDeltaTime。
@@ -135,6 +181,7 @@ public:
 		timeScale = 1.0f;
 		savedTimeScale = 1.0f;
 		isPaused = false;
+		intermediateStep = false;   // 快进倍数来自启动参数/玩家选择，不随时钟重置
 		totalGameTime = 0.0;
 		unscaledTotalTime = 0.0;
 	}
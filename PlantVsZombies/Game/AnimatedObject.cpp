@@ -1,4 +1,5 @@
 #include "AnimatedObject.h"
+#include "AnimationSystem.h"
 #include "Board.h"
 #include "../DeltaTime.h"
 #include "../GameRandom.h"
@@ -55,16 +56,17 @@ Vector AnimatedObject::GetVisualPosition() const {
 	return Vector::zero();
 }
 
-void AnimatedObject::UpdateParallel(std::vector<DeferredEvent>& outBuf) {
-	if (mAnimator) mAnimator->UpdateParallelDeferred(outBuf);
-	mAdvancedInParallel = true;
+void AnimatedObject::RegisterAnimators(AnimationSystem& system) {
+	if (mAnimator) system.Register(*mAnimator, this);
 }
 
 void AnimatedObject::Update() {
 	GameObject::Update();
 
 	if (mAnimator) {
-		if (mAdvancedInParallel) { mAdvancedInParallel = false; /* events 在 phase B drain 已处理；Animator 状态已就位 */ }
+		// 批量推进过的帧事件已在 phase B drain 处理；Animator 状态已就位，不再补推。
+		const bool batchAdvanced = mAnimator->ConsumeBatchAdvance();
+		if (mSkipAnimatorAdvance || batchAdvanced) { mSkipAnimatorAdvance = false; }
 		else { mAnimator->Update(); }
 
 		// 自动销毁逻辑（非循环动画且结束后自动销毁）
@@ -256,14 +258,31 @@ void AnimatedObject::SetClipSpeed(float speed)
 	}
 }
 
+bool AnimatedObject::PlayTrack(const TrackHandle& track, float speed, float blendTime) {
+	return mAnimator ? mAnimator->PlayTrack(track, speed, blendTime) : false;
+}
+
+bool AnimatedObject::PlayTrackOnce(const TrackHandle& track,
+	const TrackHandle& returnTrack, float speed, float blendTime, float returnSpeed,
+	float returnTrackBlendTime) {
+	return mAnimator
+		? mAnimator->PlayTrackOnce(track, returnTrack, speed, blendTime,
+			returnSpeed, returnTrackBlendTime)
+		: false;
+}
+
+bool AnimatedObject::IsPlayingTrack(const TrackHandle& track) const {
+	return mAnimator && mAnimator->IsPlayingTrack(track);
+}
+
 void AnimatedObject::SetFramesForLayer(const std::string& trackName) {
 	if (mAnimator) {
 		mAnimator->SetFrameRangeByTrackName(trackName);
 	}
 }
 
-std::string AnimatedObject::GetCurrentTrackName() const {
-	return mAnimator ? mAnimator->GetCurrentTrackName() : "";
+const std::string& AnimatedObject::GetCurrentTrackName() const {
+	return mAnimator ? mAnimator->GetCurrentTrackName() : InternRuntimeString("");
 }
 
 float AnimatedObject::GetCurrentFrame() const {
@@ -274,8 +293,8 @@ PlayState AnimatedObject::GetPlayingState() const {
 	return mAnimator ? mAnimator->GetPlayingState() : PlayState::PLAY_REPEAT;
 }
 
-std::string AnimatedObject::GetTargetTrack() const {
-	return mAnimator ? mAnimator->GetTargetTrack() : "";
+const std::string& AnimatedObject::GetTargetTrack() const {
+	return mAnimator ? mAnimator->GetTargetTrack() : InternRuntimeString("");
 }
 
 float AnimatedObject::GetTargetTrackSpeed() const {
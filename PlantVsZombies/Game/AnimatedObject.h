@@ -23,7 +23,7 @@ protected:
 	bool mIsPlaying = false;
 	PlayState mLoopType = PlayState::PLAY_REPEAT;
 	bool mAutoDestroy = true;
-	bool mAdvancedInParallel = false;   // 阶段二：本帧 animator 是否已在并行段推进过
+	bool mSkipAnimatorAdvance = false;   // 本帧串行 Update 跳过 animator 推进（宿主停机等）；批量推进改由 Animator::ConsumeBatchAdvance 告知
 
 public:
 	AnimatedObject(ObjectType type,
@@ -78,17 +78,27 @@ public:
 		float blendTime = 0.0f,
 		float returnSpeed = 0.0f,
 		float returnTrackBlendTime = 0.5f);
+	// 句柄版本：子类用 TrackNames.h 的共用句柄调用，逐帧路径不构造/比较字符串
+	bool PlayTrack(const TrackHandle& track, float speed = 0.0f, float blendTime = 0.0f);
+	bool PlayTrackOnce(const TrackHandle& track,
+		const TrackHandle& returnTrack = TrackHandle(),
+		float speed = 0.0f,
+		float blendTime = 0.0f,
+		float returnSpeed = 0.0f,
+		float returnTrackBlendTime = 0.5f);
+	/** 当前是否在播该轨道；只比较驻留指针，替代 GetCurrentTrackName() == "..." */
+	bool IsPlayingTrack(const TrackHandle& track) const;
 
 	void SetFramesForLayer(const std::string& trackName);
 
 	// 存档/读档辅助
-	std::string GetCurrentTrackName() const;
+	const std::string& GetCurrentTrackName() const;
 	float GetCurrentFrame() const;
 	void SetCurrentFrame(float frameIndex);
 
 	// 播放状态机 (供 GameInfoSaver 完整持久化 PlayTrackOnce，避免读档后一次性动画死循环)
 	PlayState GetPlayingState() const;
-	std::string GetTargetTrack() const;
+	const std::string& GetTargetTrack() const;
 	float GetTargetTrackSpeed() const;
 	float GetTargetTrackBlendTime() const;
 
@@ -103,7 +113,7 @@ public:
 	std::shared_ptr<Animator> GetAnimatorInternal() const;
 
 	void Update() override;
-	void UpdateParallel(std::vector<DeferredEvent>& outBuf) override;
+	void RegisterAnimators(AnimationSystem& system) override;
 	void Draw(Graphics* g) override;
 
 private:
@@ -0,0 +1,79 @@
+#include "AnimationSystem.h"
+#include "GameObject.h"
+#include "ThreadPool.h"
+#include "../Reanimation/Animator.h"
+#include <algorithm>
+
+void AnimationSystem::Register(Animator& animator, const GameObject* owner, AnimationGate gate) {
+	if (animator.mSystem == this) {
+		Entry& entry = mEntries[animator.mSystemSlot];
+		entry.owner = owner;
+		entry.gate = gate;
+		return;
+	}
+	animator.mSystem = this;
+	animator.mSystemSlot = static_cast<int>(mEntries.size());
+	animator.mBatchAdvanced = false;
+	mEntries.push_back(Entry{ &animator, owner, gate });
+}
+
+void AnimationSystem::Unregister(Animator& animator) {
+	const int slot = animator.mSystemSlot;
+	if (animator.mSystem != this || slot < 0 || slot >= static_cast<int>(mEntries.size())
+		|| mEntries[slot].animator != &animator) {
+		return;
+	}
+	const int last = static_cast<int>(mEntries.size()) - 1;
+	if (slot != last) {
+		mEntries[slot] = mEntries[last];
+		mEntries[slot].animator->mSystemSlot = slot;
+	}
+	mEntries.pop_back();
+	animator.mSystem = nullptr;
+	animator.mSystemSlot = -1;
+}
+
+void AnimationSystem::UnregisterOwners(const std::unordered_set<GameObject*>& owners) {
+	if (owners.empty() || mEntries.empty()) return;
+	int write = 0;
+	for (const Entry& entry : mEntries) {
+		if (owners.count(const_cast<GameObject*>(entry.owner)) != 0) {
+			entry.animator->mSystem = nullptr;
+			entry.animator->mSystemSlot = -1;
+			continue;
+		}
+		entry.animator->mSystemSlot = write;
+		mEntries[write++] = entry;
+	}
+	mEntries.resize(write);
+}
+
+void AnimationSystem::Clear() {
+	for (const Entry& entry : mEntries) {
+		entry.animator->mSystem = nullptr;
+		entry.animator->mSystemSlot = -1;
+	}
+	mEntries.clear();
+}
+
+void AnimationSystem::AdvanceAll(ThreadPool& pool, int numWorkers,
+	std::vector<std::vector<DeferredEvent>>& outBuffers) {
+	const int total = static_cast<int>(mEntries.size());
+	if (total <= 0 || numWorkers <= 0) return;
+	numWorkers = std::min(numWorkers, total);
+
+	// 切块与 ThreadPool 一致：start/chunkSize 即 worker 序号，保证每个 worker 独占一个缓冲。
+	Entry* entries = mEntries.data();
+	pool.Dispatch(total, [entries, total, numWorkers, &outBuffers](int start, int end) {
+		const int chunkSize = (total + numWorkers - 1) / numWorkers;
+		const int slot = (chunkSize > 0) ? (start / chunkSize) : 0;
+		auto& outBuf = outBuffers[slot];
+		for (int i = start; i < end; ++i) {
+			const Entry& entry = entries[i];
+			if (!entry.owner->IsActive()) continue;
+			if (entry.gate && !entry.gate(entry.owner)) continue;
+			entry.animator->Advance(&outBuf);
+			entry.animator->mBatchAdvanced = true;
+		}
+		});
+}
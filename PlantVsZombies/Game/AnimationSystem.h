@@ -0,0 +1,74 @@
+#pragma once
+#ifndef _ANIMATION_SYSTEM_H
+#define _ANIMATION_SYSTEM_H
+
+#include "DeferredEvent.h"
+#include <cstddef>
+#include <unordered_set>
+#include <vector>
+
+class Animator;
+class GameObject;
+class ThreadPool;
+
+/**
+ * 宿主级推进门控：返回 false 时本帧批量推进跳过该 Animator（例如植物停机）。
+ * 用普通函数指针而非虚函数，只有少数宿主类型设置，其余为 nullptr。
+ */
+using AnimationGate = bool (*)(const GameObject* owner);
+
+/**
+ * 集中推进全部在场根 Animator。
+ *
+ * GOM 并行阶段 A 不再逐对象虚调，而是由本系统在稠密数组上一次派发：每个 worker 连续
+ * 推进一段 Animator（附加子动画仍由父级递归推进），帧事件写入该 worker 自己的
+ * DeferredEvent 缓冲，主线程随后按 worker 序 drain。宿主串行 Update 通过
+ * Animator::ConsumeBatchAdvance 得知本帧已推进，不再补推一次。
+ *
+ * 登记时机与 CollisionSystem 对齐：对象进入 GOM 时经 GameObject::RegisterAnimators 登记，
+ * 移出 GOM 时整批注销；Animator 析构时自动注销。全部接口只在主线程调用。
+ */
+class AnimationSystem {
+private:
+	struct Entry {
+		Animator* animator;
+		const GameObject* owner;   ///< 只读 IsActive()；由 GOM 保证登记期间存活
+		AnimationGate gate;
+	};
+	std::vector<Entry> mEntries;   ///< 稠密数组，Animator::mSystemSlot 指向自身下标
+
+	AnimationSystem() { mEntries.reserve(2048); }
+	// 进程退出时可能先于 GOM 析构：先解除全部 Animator 的反向指针，避免其析构再回调本对象
+	~AnimationSystem() { Clear(); }
+
+public:
+	static AnimationSystem& GetInstance() {
+		static AnimationSystem instance;
+		return instance;
+	}
+
+	AnimationSystem(const AnimationSystem&) = delete;
+	AnimationSystem& operator=(const AnimationSystem&) = delete;
+
+	/** 登记根 Animator；重复登记只更新宿主与门控。 */
+	void Register(Animator& animator, const GameObject* owner, AnimationGate gate = nullptr);
+	/** 注销单个 Animator（换 Animator、析构时）；末尾元素填洞，O(1)。 */
+	void Unregister(Animator& animator);
+	/** GOM 移除对象时整批注销其全部 Animator；单趟稳定压缩，O(n)。 */
+	void UnregisterOwners(const std::unordered_set<GameObject*>& owners);
+	/** 清空登记表（切关 DestroyAllGameObjects）。 */
+	void Clear();
+
+	/**
+	 * @brief 阶段 A：并行推进全部登记 Animator
+	 * @param pool GOM 线程池
+	 * @param numWorkers 参与分发的 worker 数，须与线程池切块一致
+	 * @param outBuffers 每个 worker 一个事件缓冲，调用方负责 resize/clear 与 drain
+	 */
+	void AdvanceAll(ThreadPool& pool, int numWorkers,
+		std::vector<std::vector<DeferredEvent>>& outBuffers);
+
+	size_t GetAnimatorCount() const { return mEntries.size(); }
+};
+
+#endif
@@ -2,6 +2,7 @@
 #include "../Game/AdaptiveMusicPlayer.h"
 #include "../ResourceManager.h"
 #include "../Logger.h"
+#include "../DeltaTime.h"
 #include <algorithm>
 
 namespace
@@ -135,6 +136,8 @@ void AudioSystem::PlaySound(const std::string& soundKey, int loops)
 {
 	++gSoundPlayRequestCounts[soundKey];
 	if (!IsAudioAvailable()) return;
+	// 快进中间步画面不可见，一次性音效只计数不出声；循环音效仍要起播
+	if (loops == 0 && DeltaTime::IsIntermediateStep()) return;
 
 	Mix_Chunk* sound = ResourceManager::GetInstance().GetSound(soundKey);
 	if (sound)
@@ -155,6 +158,7 @@ void AudioSystem::PlaySound(const std::string& soundKey, float volume, int loops
 {
 	++gSoundPlayRequestCounts[soundKey];
 	if (!IsAudioAvailable()) return;
+	if (loops == 0 && DeltaTime::IsIntermediateStep()) return;
 
 	Mix_Chunk* sound = ResourceManager::GetInstance().GetSound(soundKey);
 	if (sound)
@@ -174,6 +178,7 @@ void AudioSystem::PlaySound(const std::string& soundKey, float volume, int loops
 {
 	++gSoundPlayRequestCounts[soundKey];
 	if (!IsAudioAvailable()) return;
+	if (loops == 0 && DeltaTime::IsIntermediateStep()) return;
 
 	Mix_Chunk* sound = ResourceManager::GetInstance().GetSound(soundKey);
 	if (sound)
@@ -0,0 +1,337 @@
+#include "Replay.h"
+#include "TestDriver.h"
+#include "../../GameApp.h"
+#include "../../GameRandom.h"
+#include "../../Graphics.h"
+#include "../../Logger.h"
+#include "../../UI/InputHandler.h"
+#include "../SceneManager.h"
+#include "../GameScene.h"
+#include "../Board.h"
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <unordered_set>
+
+namespace {
+	// 这些命令不改变对局状态（等待/断言/导出/截图/哈希日志），或本身只是推送 SDL 输入
+	// （click/key/move_mouse，其事件已作为输入录入）；quit 由尾行的总步数代替；
+	// vsync/全屏/快进只影响呈现节奏，无渲染回放中无意义。
+	bool IsReplayedCommand(const std::string& op)
+	{
+		static const std::unordered_set<std::string> kSkipped = {
+			"wait_frames", "wait_seconds", "wait_state",
+			"assert_state", "assert_can_plant", "assert_can_target", "assert_zombie_spawn_row",
+			"dump_state", "screenshot", "log_state_hash", "mark_state_hash",
+			"click", "key", "move_mouse", "quit",
+			"set_vsync", "set_fullscreen", "set_turbo",
+		};
+		return !op.empty() && kSkipped.count(op) == 0;
+	}
+
+	Board* CurrentBoard()
+	{
+		GameScene* gs = dynamic_cast<GameScene*>(SceneManager::GetInstance().GetCurrentScene());
+		return gs ? gs->GetBoard() : nullptr;
+	}
+
+	Sint32 LogicalToScreen(const Graphics& graphics, float logical, bool vertical)
+	{
+		const glm::vec2 offset = graphics.GetLetterboxOffset();
+		const float screen = logical * graphics.GetLetterboxScale() + (vertical ? offset.y : offset.x);
+		return static_cast<Sint32>(std::lround(screen));
+	}
+
+	// 只编码 InputHandler 实际消费的字段；鼠标坐标存逻辑坐标
+	bool EncodeEvent(const SDL_Event& event, const Graphics& graphics, nlohmann::json& out)
+	{
+		switch (event.type) {
+		case SDL_MOUSEMOTION: {
+			const glm::vec2 logical = graphics.ScreenToLogical(
+				static_cast<float>(event.motion.x), static_cast<float>(event.motion.y));
+			out = { { "type", "motion" }, { "x", logical.x }, { "y", logical.y } };
+			return true;
+		}
+		case SDL_MOUSEBUTTONDOWN:
+		case SDL_MOUSEBUTTONUP: {
+			const glm::vec2 logical = graphics.ScreenToLogical(
+				static_cast<float>(event.button.x), static_cast<float>(event.button.y));
+			out = {
+				{ "type", event.type == SDL_MOUSEBUTTONDOWN ? "down" : "up" },
+				{ "button", event.button.button },
+				{ "clicks", event.button.clicks },
+				{ "x", logical.x },
+				{ "y", logical.y },
+			};
+			return true;
+		}
+		case SDL_MOUSEWHEEL:
+			out = { { "type", "wheel" }, { "x", event.wheel.x }, { "y", event.wheel.y } };
+			return true;
+		case SDL_KEYDOWN:
+		case SDL_KEYUP:
+			out = {
+				{ "type", event.type == SDL_KEYDOWN ? "keydown" : "keyup" },
+				{ "key", static_cast<std::int32_t>(event.key.keysym.sym) },
+				{ "mod", event.key.keysym.mod },
+				{ "repeat", event.key.repeat },
+			};
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	bool DecodeEvent(const nlohmann::json& in, const Graphics& graphics, SDL_Event& event)
+	{
+		event = {};
+		const std::string type = in.value("type", "");
+		const float x = in.value("x", 0.0f);
+		const float y = in.value("y", 0.0f);
+		if (type == "motion") {
+			event.type = SDL_MOUSEMOTION;
+			event.motion.x = LogicalToScreen(graphics, x, false);
+			event.motion.y = LogicalToScreen(graphics, y, true);
+			return true;
+		}
+		if (type == "down" || type == "up") {
+			event.type = type == "down" ? SDL_MOUSEBUTTONDOWN : SDL_MOUSEBUTTONUP;
+			event.button.button = in.value("button", static_cast<Uint8>(SDL_BUTTON_LEFT));
+			event.button.clicks = in.value("clicks", static_cast<Uint8>(1));
+			event.button.state = type == "down" ? SDL_PRESSED : SDL_RELEASED;
+			event.button.x = LogicalToScreen(graphics, x, false);
+			event.button.y = LogicalToScreen(graphics, y, true);
+			return true;
+		}
+		if (type == "wheel") {
+			event.type = SDL_MOUSEWHEEL;
+			event.wheel.x = in.value("x", 0);
+			event.wheel.y = in.value("y", 0);
+			return true;
+		}
+		if (type == "keydown" || type == "keyup") {
+			event.type = type == "keydown" ? SDL_KEYDOWN : SDL_KEYUP;
+			event.key.state = type == "keydown" ? SDL_PRESSED : SDL_RELEASED;
+			event.key.keysym.sym = static_cast<SDL_Keycode>(in.value("key", 0));
+			event.key.keysym.mod = in.value("mod", static_cast<Uint16>(0));
+			event.key.repeat = in.value("repeat", static_cast<Uint8>(0));
+			return true;
+		}
+		return false;
+	}
+}
+
+// ==================== 录制 ====================
+
+ReplayRecorder& ReplayRecorder::GetInstance() {
+	static ReplayRecorder instance;
+	return instance;
+}
+
+bool ReplayRecorder::Open(const std::string& path, const std::string& source) {
+	std::error_code ec;
+	const std::filesystem::path parent = std::filesystem::path(path).parent_path();
+	if (!parent.empty()) std::filesystem::create_directories(parent, ec);
+	mOutput.open(path, std::ios::trunc);
+	if (!mOutput.is_open()) {
+		LOG_ERROR("Replay") << "无法创建回放文件: " << path;
+		return false;
+	}
+	mPath = path;
+	mTick = 0;
+
+	ReplayHeader header;
+	header.version = ReplayStream::kVersion;
+	header.seed = GameRandom::GetSeed();
+	header.autoTest = GameAPP::mAutoTestMode;
+	header.source = source;
+	mOutput << ReplayStream::HeaderLine(header) << '\n';
+	LOG_WARN("Replay") << "回放录制已启用: " << path << " seed=" << header.seed;
+	return true;
+}
+
+void ReplayRecorder::Write(const ReplayEntry& entry) {
+	mOutput << ReplayStream::EntryLine(entry) << '\n';
+}
+
+void ReplayRecorder::FlushPendingMotion() {
+	if (!mHasPendingMotion) return;
+	Write({ mTick + 1, ReplayEntryKind::INPUT, std::move(mPendingMotion) });
+	mHasPendingMotion = false;
+	mPendingMotion = nullptr;
+}
+
+void ReplayRecorder::RecordEvent(const SDL_Event& event, const Graphics& graphics) {
+	if (!IsActive()) return;
+	nlohmann::json encoded;
+	if (!EncodeEvent(event, graphics, encoded)) return;
+	if (event.type == SDL_MOUSEMOTION) {
+		mPendingMotion = std::move(encoded);
+		mHasPendingMotion = true;
+		return;
+	}
+	FlushPendingMotion();
+	Write({ mTick + 1, ReplayEntryKind::INPUT, std::move(encoded) });
+}
+
+void ReplayRecorder::BeginStep() {
+	if (!IsActive()) return;
+	FlushPendingMotion();
+	++mTick;
+}
+
+void ReplayRecorder::RecordCommand(const nlohmann::json& cmd) {
+	if (!IsActive() || !IsReplayedCommand(cmd.value("op", ""))) return;
+	Write({ mTick, ReplayEntryKind::COMMAND, cmd });
+}
+
+void ReplayRecorder::Close() {
+	if (!IsActive()) return;
+	// 尚未被任何逻辑步消费的移动事件直接丢弃：回放只跑到 mTick
+	mHasPendingMotion = false;
+
+	ReplayFooter footer;
+	footer.finalTick = mTick;
+	footer.cards = GameAPP::GetInstance().mLastSelectedCards;
+	if (const Board* board = CurrentBoard()) {
+		footer.hasStateHash = true;
+		footer.stateHash = board->ComputeStateHash().Combined();
+		footer.level = board->mLevel;
+	}
+	mOutput << ReplayStream::FooterLine(footer) << '\n';
+	mOutput.close();
+	LOG_WARN("Replay") << "回放录制完成: " << mPath << " ticks=" << mTick
+		<< (footer.hasStateHash ? " hash=" + FormatStateHash(footer.stateHash) : std::string());
+}
+
+// ==================== 回放 ====================
+
+ReplayPlayer& ReplayPlayer::GetInstance() {
+	static ReplayPlayer instance;
+	return instance;
+}
+
+bool ReplayPlayer::Load(const std::string& path) {
+	std::ifstream input(path);
+	if (!input) {
+		LOG_ERROR("Replay") << "无法打开回放文件: " << path;
+		return false;
+	}
+	std::string error;
+	if (!mStream.Parse(input, error)) {
+		LOG_ERROR("Replay") << "回放文件解析失败 " << path << ": " << error;
+		return false;
+	}
+
+	mPath = path;
+	const ReplayFooter& footer = mStream.GetFooter();
+	const auto& entries = mStream.GetEntries();
+	mFinalTick = footer.present ? footer.finalTick : (entries.empty() ? 0 : entries.back().tick);
+	if (!footer.present) {
+		LOG_WARN("Replay") << "回放缺少尾行（录制进程未正常退出），回放到最后一条记录的第 "
+			<< mFinalTick << " 步，不比对状态哈希";
+	}
+
+	mOutDir = (std::filesystem::path("./autotest/out") /
+		("replay_" + std::filesystem::path(path).stem().string())).string();
+	std::error_code ec;
+	std::filesystem::create_directories(mOutDir, ec);
+	if (ec) {
+		LOG_ERROR("Replay") << "无法创建输出目录 " << mOutDir << ": " << ec.message();
+		return false;
+	}
+	if (!TestDriver::GetInstance().BeginReplay(mOutDir)) return false;
+
+	const ReplayHeader& header = mStream.GetHeader();
+	GameRandom::SetSeed(header.seed);
+	// AutoTest 模式会改变动画/粒子/场景初始化等行为，必须与录制时一致
+	GameAPP::mAutoTestMode = header.autoTest;
+	GameAPP::mReplayPlayback = true;
+	mStepMs.reserve(static_cast<std::size_t>(mFinalTick));
+	mActive = true;
+	LOG_WARN("Replay") << "无渲染回放: " << path << " seed=" << header.seed << " ticks=" << mFinalTick
+		<< " entries=" << entries.size() << (header.autoTest ? " (AutoTest)" : " (玩家对局，依赖本机玩家存档)");
+	return true;
+}
+
+void ReplayPlayer::BeginStep(InputHandler& input, const Graphics& graphics) {
+	++mTick;
+	const auto& entries = mStream.GetEntries();
+	while (mCursor < entries.size() && entries[mCursor].tick <= mTick
+		&& entries[mCursor].kind == ReplayEntryKind::INPUT) {
+		SDL_Event event;
+		if (DecodeEvent(entries[mCursor].payload, graphics, event)) input.ProcessEvent(&event);
+		++mCursor;
+	}
+}
+
+void ReplayPlayer::ApplyCommands() {
+	const auto& entries = mStream.GetEntries();
+	TestDriver& driver = TestDriver::GetInstance();
+	while (mCursor < entries.size() && entries[mCursor].tick <= mTick
+		&& entries[mCursor].kind == ReplayEntryKind::COMMAND) {
+		if (!driver.ExecuteReplayCommand(entries[mCursor].payload, mTick)) return;   // 已 Fail 并停止主循环
+		++mCursor;
+	}
+}
+
+void ReplayPlayer::EndStep(double stepMs) {
+	mStepMs.push_back(stepMs);
+}
+
+void ReplayPlayer::Finish() {
+	if (!mActive) return;
+	mActive = false;
+
+	const ReplayTimingSummary timing = SummarizeReplayTiming(mStepMs, 10);
+	const ReplayFooter& footer = mStream.GetFooter();
+	const bool completed = mTick >= mFinalTick;
+
+	nlohmann::json report = {
+		{ "replay", mPath },
+		{ "seed", mStream.GetHeader().seed },
+		{ "autoTest", mStream.GetHeader().autoTest },
+		{ "source", mStream.GetHeader().source },
+		{ "recordedTicks", mFinalTick },
+		{ "completed", completed },
+		{ "timing", ReplayTimingToJson(timing) },
+		{ "level", footer.level },
+		{ "cards", footer.cards },
+	};
+
+	bool hashMatches = true;
+	const Board* board = CurrentBoard();
+	if (board) {
+		const uint64_t actual = board->ComputeStateHash().Combined();
+		report["stateHash"] = FormatStateHash(actual);
+		if (footer.hasStateHash) {
+			hashMatches = actual == footer.stateHash;
+			report["expectedStateHash"] = FormatStateHash(footer.stateHash);
+		}
+	}
+	else if (footer.hasStateHash) {
+		hashMatches = false;   // 录制结束时在对局中，回放结束时却不在：已分叉
+	}
+	report["stateHashMatches"] = hashMatches;
+
+	if (!completed || !hashMatches || TestDriver::GetInstance().ExitCode() != 0) mExitCode = 1;
+	report["exitCode"] = mExitCode;
+
+	std::ofstream output(mOutDir + "/replay_report.json", std::ios::trunc);
+	if (output) output << report.dump(2);
+
+	char summary[256];
+	std::snprintf(summary, sizeof(summary),
+		"回放 %llu/%llu 步 %.1fms: 平均 %.3f / p50 %.3f / p99 %.3f / 最大 %.3f ms",
+		static_cast<unsigned long long>(mTick), static_cast<unsigned long long>(mFinalTick),
+		timing.totalMs, timing.meanMs, timing.p50Ms, timing.p99Ms, timing.maxMs);
+	LOG_WARN("Replay") << summary;
+	if (!timing.slowest.empty()) {
+		LOG_WARN("Replay") << "最慢一步: tick=" << timing.slowest.front().first
+			<< " " << timing.slowest.front().second << "ms（前 10 见 " << mOutDir << "/replay_report.json）";
+	}
+	if (!hashMatches) {
+		LOG_ERROR("Replay") << "状态哈希不一致: 录制 " << FormatStateHash(footer.stateHash)
+			<< " 回放 " << report.value("stateHash", std::string("<不在对局中>"));
+	}
+}
@@ -0,0 +1,84 @@
+#pragma once
+#ifndef _REPLAY_H
+#define _REPLAY_H
+
+#include <SDL2/SDL.h>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include "ReplayStream.h"
+
+class Graphics;
+class InputHandler;
+
+// -RecordReplay <文件>：按逻辑步录制根种子、输入事件与 TestDriver 命令。
+// 输入在 pollEvents 处截取（TestDriver 的 click/key 合成事件也经此路径，天然被录入），
+// 鼠标坐标先换算成逻辑坐标再落盘，回放不受录制时窗口尺寸/全屏 letterbox 影响。
+class ReplayRecorder {
+public:
+	static ReplayRecorder& GetInstance();
+
+	// 写入头行。须在 -Seed 解析之后调用，头里记的是最终生效的根种子。
+	bool Open(const std::string& path, const std::string& source);
+	bool IsActive() const { return mOutput.is_open(); }
+
+	// pollEvents 内逐事件调用；事件归属于下一个将执行的逻辑步
+	void RecordEvent(const SDL_Event& event, const Graphics& graphics);
+	// 每个逻辑步开头（DeltaTime::BeginStep 之前）调用
+	void BeginStep();
+	// TestDriver 命令在当前逻辑步内完成时调用；纯等待/断言/截图类与合成输入类命令不落盘
+	void RecordCommand(const nlohmann::json& cmd);
+	// 主循环退出、场景释放前调用：写尾行（总步数、末步状态哈希、关卡与选卡）
+	void Close();
+
+private:
+	ReplayRecorder() = default;
+
+	void Write(const ReplayEntry& entry);
+	void FlushPendingMotion();
+
+	std::ofstream mOutput;
+	std::string mPath;
+	std::uint64_t mTick = 0;
+	// 同一批 poll 内连续的鼠标移动只保留最后一个；其它事件到来前先落盘，保持相对顺序
+	bool mHasPendingMotion = false;
+	nlohmann::json mPendingMotion;
+};
+
+// -Replay <文件>：按录制的逻辑步无渲染满速重放，逐步计时并比对末步状态哈希。
+// 报告写入 ./autotest/out/replay_<文件名>/replay_report.json；哈希不一致时进程退出码为 1。
+class ReplayPlayer {
+public:
+	static ReplayPlayer& GetInstance();
+
+	// 解析回放并应用头信息（根种子、AutoTest 模式）；须在 GameAPP::Run 之前调用
+	bool Load(const std::string& path);
+	bool IsActive() const { return mActive; }
+	bool IsFinished() const { return mTick >= mFinalTick; }
+	int ExitCode() const { return mExitCode; }
+
+	// 每个逻辑步开头：步号 +1，并把录制在本步之前的输入事件注入 InputHandler
+	void BeginStep(InputHandler& input, const Graphics& graphics);
+	// sceneManager.Update 之后：执行录制在本步内完成的命令
+	void ApplyCommands();
+	void EndStep(double stepMs);
+	// 回放结束（场景释放前）：汇总耗时、比对哈希、写报告
+	void Finish();
+
+private:
+	ReplayPlayer() = default;
+
+	ReplayStream mStream;
+	std::string mPath;
+	std::string mOutDir;
+	std::size_t mCursor = 0;
+	std::uint64_t mTick = 0;
+	std::uint64_t mFinalTick = 0;
+	std::vector<double> mStepMs;
+	bool mActive = false;
+	int mExitCode = 0;
+};
+
+#endif
@@ -0,0 +1,206 @@
+#include "ReplayStream.h"
+#include "../StateHash.h"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace {
+	bool ParseHashHex(const std::string& text, std::uint64_t& out)
+	{
+		if (text.empty() || text.size() > 16) return false;
+		std::uint64_t value = 0;
+		for (char c : text) {
+			int digit;
+			if (c >= '0' && c <= '9') digit = c - '0';
+			else if (c >= 'a' && c <= 'f') digit = c - 'a' + 10;
+			else return false;
+			value = (value << 4) | static_cast<std::uint64_t>(digit);
+		}
+		out = value;
+		return true;
+	}
+
+	double NearestRank(const std::vector<double>& sorted, double fraction)
+	{
+		const std::size_t rank = static_cast<std::size_t>(std::ceil(fraction * static_cast<double>(sorted.size())));
+		return sorted[std::clamp<std::size_t>(rank, 1, sorted.size()) - 1];
+	}
+}
+
+std::string ReplayStream::HeaderLine(const ReplayHeader& header)
+{
+	nlohmann::json line = {
+		{ "replay", header.version },
+		{ "seed", header.seed },
+		{ "autoTest", header.autoTest },
+	};
+	if (!header.source.empty()) line["source"] = header.source;
+	return line.dump();
+}
+
+std::string ReplayStream::EntryLine(const ReplayEntry& entry)
+{
+	nlohmann::json line = { { "t", entry.tick } };
+	line[entry.kind == ReplayEntryKind::INPUT ? "in" : "cmd"] = entry.payload;
+	return line.dump();
+}
+
+std::string ReplayStream::FooterLine(const ReplayFooter& footer)
+{
+	nlohmann::json line = {
+		{ "end", footer.finalTick },
+		{ "level", footer.level },
+		{ "cards", footer.cards },
+	};
+	if (footer.hasStateHash) line["hash"] = FormatStateHash(footer.stateHash);
+	return line.dump();
+}
+
+bool ReplayStream::Parse(std::istream& input, std::string& error)
+{
+	mHeader = {};
+	mFooter = {};
+	mEntries.clear();
+
+	std::string text;
+	int lineNumber = 0;
+	bool sawHeader = false;
+	std::uint64_t lastTick = 0;
+	while (std::getline(input, text)) {
+		++lineNumber;
+		if (text.empty() || text == "\r") continue;
+		const std::string where = "第 " + std::to_string(lineNumber) + " 行: ";
+		nlohmann::json line;
+		try {
+			line = nlohmann::json::parse(text);
+		}
+		catch (const std::exception& e) {
+			error = where + e.what();
+			return false;
+		}
+		if (!line.is_object()) {
+			error = where + "不是 JSON 对象";
+			return false;
+		}
+
+		if (!sawHeader) {
+			if (!line.contains("replay") || !line["replay"].is_number_integer()) {
+				error = where + "缺少 replay 版本头";
+				return false;
+			}
+			mHeader.version = line["replay"].get<int>();
+			if (mHeader.version != kVersion) {
+				error = "不支持的回放版本 " + std::to_string(mHeader.version);
+				return false;
+			}
+			mHeader.seed = line.value("seed", std::uint64_t{ 0 });
+			mHeader.autoTest = line.value("autoTest", false);
+			mHeader.source = line.value("source", "");
+			sawHeader = true;
+			continue;
+		}
+		if (mFooter.present) {
+			error = where + "尾行之后仍有内容";
+			return false;
+		}
+
+		if (line.contains("end")) {
+			mFooter.present = true;
+			mFooter.finalTick = line["end"].get<std::uint64_t>();
+			mFooter.level = line.value("level", 0);
+			if (line.contains("cards") && line["cards"].is_array()) {
+				for (const auto& card : line["cards"]) {
+					if (card.is_string()) mFooter.cards.push_back(card.get<std::string>());
+				}
+			}
+			if (line.contains("hash")) {
+				if (!line["hash"].is_string() || !ParseHashHex(line["hash"].get<std::string>(), mFooter.stateHash)) {
+					error = where + "hash 不是 16 位十六进制";
+					return false;
+				}
+				mFooter.hasStateHash = true;
+			}
+			if (mFooter.finalTick < lastTick) {
+				error = where + "总步数小于最后一条记录的步号";
+				return false;
+			}
+			continue;
+		}
+
+		if (!line.contains("t") || !line["t"].is_number_unsigned()) {
+			error = where + "缺少逻辑步号 t";
+			return false;
+		}
+		ReplayEntry entry;
+		entry.tick = line["t"].get<std::uint64_t>();
+		if (entry.tick == 0 || entry.tick < lastTick) {
+			error = where + "逻辑步号必须从 1 起且不倒退";
+			return false;
+		}
+		if (line.contains("in")) {
+			entry.kind = ReplayEntryKind::INPUT;
+			entry.payload = std::move(line["in"]);
+		}
+		else if (line.contains("cmd")) {
+			entry.kind = ReplayEntryKind::COMMAND;
+			entry.payload = std::move(line["cmd"]);
+		}
+		else {
+			error = where + "记录既不是 in 也不是 cmd";
+			return false;
+		}
+		lastTick = entry.tick;
+		mEntries.push_back(std::move(entry));
+	}
+
+	if (!sawHeader) {
+		error = "回放文件为空";
+		return false;
+	}
+	return true;
+}
+
+ReplayTimingSummary SummarizeReplayTiming(const std::vector<double>& stepMs, std::size_t slowestCount)
+{
+	ReplayTimingSummary summary;
+	summary.ticks = stepMs.size();
+	if (stepMs.empty()) return summary;
+
+	summary.totalMs = std::accumulate(stepMs.begin(), stepMs.end(), 0.0);
+	summary.meanMs = summary.totalMs / static_cast<double>(stepMs.size());
+
+	std::vector<double> sorted = stepMs;
+	std::sort(sorted.begin(), sorted.end());
+	summary.p50Ms = NearestRank(sorted, 0.50);
+	summary.p99Ms = NearestRank(sorted, 0.99);
+	summary.maxMs = sorted.back();
+
+	std::vector<std::size_t> order(stepMs.size());
+	std::iota(order.begin(), order.end(), std::size_t{ 0 });
+	const std::size_t keep = std::min(slowestCount, order.size());
+	std::partial_sort(order.begin(), order.begin() + keep, order.end(),
+		[&stepMs](std::size_t a, std::size_t b) {
+			return stepMs[a] != stepMs[b] ? stepMs[a] > stepMs[b] : a < b;
+		});
+	for (std::size_t i = 0; i < keep; ++i) {
+		summary.slowest.emplace_back(static_cast<std::uint64_t>(order[i] + 1), stepMs[order[i]]);
+	}
+	return summary;
+}
+
+nlohmann::json ReplayTimingToJson(const ReplayTimingSummary& summary)
+{
+	nlohmann::json slowest = nlohmann::json::array();
+	for (const auto& [tick, ms] : summary.slowest) {
+		slowest.push_back({ { "tick", tick }, { "ms", ms } });
+	}
+	return {
+		{ "ticks", summary.ticks },
+		{ "totalMs", summary.totalMs },
+		{ "meanMs", summary.meanMs },
+		{ "p50Ms", summary.p50Ms },
+		{ "p99Ms", summary.p99Ms },
+		{ "maxMs", summary.maxMs },
+		{ "slowest", slowest },
+	};
+}
@@ -0,0 +1,84 @@
+#pragma once
+#ifndef _REPLAY_STREAM_H
+#define _REPLAY_STREAM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+// 回放流的纯数据部分：JSON Lines 编解码与逐步耗时统计，不依赖 SDL / 场景，可单测。
+// 文件布局（一行一个对象）：
+//   {"replay":1,"seed":N,"autoTest":true,"source":"..."}     头：版本、根种子、录制模式
+//   {"t":12,"in":{...}}                                      第 12 个逻辑步之前注入的输入事件
+//   {"t":40,"cmd":{...}}                                     第 40 个逻辑步内完成的 TestDriver 命令
+//   {"end":5230,"hash":"...","level":1,"cards":[...]}        尾：总步数、末步状态哈希、关卡与选卡
+// 逻辑步从 1 计数；输入与命令各按录制顺序保存，同一步内先注入输入、场景更新后再执行命令。
+
+enum class ReplayEntryKind {
+	INPUT,
+	COMMAND
+};
+
+struct ReplayEntry {
+	std::uint64_t tick = 0;
+	ReplayEntryKind kind = ReplayEntryKind::INPUT;
+	nlohmann::json payload;
+};
+
+struct ReplayHeader {
+	int version = 0;
+	std::uint64_t seed = 0;
+	bool autoTest = false;
+	std::string source;   // 录制来源（AutoTest 脚本路径，玩家对局为空）
+};
+
+struct ReplayFooter {
+	bool present = false;  // 录制进程异常退出时没有尾行
+	std::uint64_t finalTick = 0;
+	bool hasStateHash = false;
+	std::uint64_t stateHash = 0;
+	int level = 0;
+	std::vector<std::string> cards;
+};
+
+class ReplayStream {
+public:
+	static constexpr int kVersion = 1;
+
+	static std::string HeaderLine(const ReplayHeader& header);
+	static std::string EntryLine(const ReplayEntry& entry);
+	static std::string FooterLine(const ReplayFooter& footer);
+
+	/** 解析整份回放；版本不符、行格式错误或步号倒退时返回 false 并写 error。 */
+	bool Parse(std::istream& input, std::string& error);
+
+	const ReplayHeader& GetHeader() const { return mHeader; }
+	const ReplayFooter& GetFooter() const { return mFooter; }
+	const std::vector<ReplayEntry>& GetEntries() const { return mEntries; }
+
+private:
+	ReplayHeader mHeader;
+	ReplayFooter mFooter;
+	std::vector<ReplayEntry> mEntries;
+};
+
+/** 回放结束时的逐步耗时汇总；slowest 按耗时降序，同耗时取较早的步。 */
+struct ReplayTimingSummary {
+	std::size_t ticks = 0;
+	double totalMs = 0.0;
+	double meanMs = 0.0;
+	double p50Ms = 0.0;
+	double p99Ms = 0.0;
+	double maxMs = 0.0;
+	std::vector<std::pair<std::uint64_t, double>> slowest;   // (逻辑步号, 毫秒)
+};
+
+/** stepMs[i] 为第 i+1 个逻辑步的耗时；分位数取最近秩。 */
+ReplayTimingSummary SummarizeReplayTiming(const std::vector<double>& stepMs, std::size_t slowestCount);
+
+nlohmann::json ReplayTimingToJson(const ReplayTimingSummary& summary);
+
+#endif
@@ -1,4 +1,5 @@
 #include "TestDriver.h"
+#include "Replay.h"
 #include "../../GameApp.h"
 #include "../../GameInfoSaver.h"
 #include "../../Renderer/VulkanRenderer.h"
@@ -90,6 +91,8 @@
 #include "../../Reanimation/Animator.h"   // dump_state 查询轨道可见性（如铁门僵尸手臂）
 #include "../../ResourceManager.h"
 #include "../../ParticleSystem/ParticleSystem.h"
+#include "../../Reanimation/TrackNames.h"
+#include <chrono>
 #include <filesystem>
 #include <algorithm>
 #include <array>
@@ -573,6 +576,15 @@ namespace {
 			});
 	}
 
+	// 快照格式：缺省 json（可读、可 diff）；binary 写正式关卡档的二进制容器，读回走流式恢复。
+	bool SnapshotExtension(const nlohmann::json& cmd, std::string& extension) {
+		const std::string format = cmd.value("format", "json");
+		if (format == "json") extension = ".json";
+		else if (format == "binary") extension = LevelSaveFormat::kBinaryExtension;
+		else return false;
+		return true;
+	}
+
 	// 用 error_code 完成最终落盘校验，避免文件系统异常越过 AutoTest 的 Fail 契约。
 	bool IsNonEmptyRegularFile(const std::filesystem::path& path) {
 		std::error_code ec;
@@ -629,6 +641,34 @@ bool TestDriver::LoadScript(const std::string& path) {
 	return true;
 }
 
+bool TestDriver::BeginReplay(const std::string& outDir) {
+	mOutDir = outDir;
+	mRunLog.open(mOutDir + "/run.log", std::ios::trunc);
+	if (!mRunLog.is_open()) {
+		LOG_ERROR("AutoTest") << "无法创建 " << mOutDir << "/run.log";
+		return false;
+	}
+	WriteStatus("running");
+	return true;
+}
+
+bool TestDriver::ExecuteReplayCommand(const nlohmann::json& cmd, uint64_t tick) {
+	mFrame = tick;
+	mCommands.push_back(cmd);
+	mIndex = mCommands.size() - 1;
+	mWaitAccum = 0.0f;
+	mFramesLeft = -1;
+	mTimeoutAccum = 0.0f;
+	mInputPhase = -1;
+	mCaptureTicket = 0;
+	if (ExecuteCurrent()) {
+		Log("replayed cmd#" + std::to_string(mIndex) + " (" + cmd.value("op", "?") + ")");
+		return true;
+	}
+	if (mExitCode == 0) Fail("回放命令未在录制时的同一逻辑步内完成（状态已分叉）");
+	return false;
+}
+
 void TestDriver::Log(const std::string& msg) {
 	if (mRunLog.is_open()) {
 		mRunLog << "[f" << mFrame << "] " << msg << "\n";
@@ -649,6 +689,20 @@ void TestDriver::WriteStatus(const char* status, const std::string& detail) {
 	if (output) output << value.dump(2);
 }
 
+void TestDriver::AppendStateHashLog() {
+	if (!mStateHashLog.is_open()) return;
+	GameScene* gs = dynamic_cast<GameScene*>(SceneManager::GetInstance().GetCurrentScene());
+	if (!gs || !gs->GetBoard()) return;
+	const BoardStateHash hash = gs->GetBoard()->ComputeStateHash();
+	// 列：驱动帧 节拍帧 总哈希 board plants zombies bullets collisions 实体数
+	mStateHashLog << mFrame << ' ' << hash.boardFrame << ' ' << FormatStateHash(hash.Combined())
+		<< ' ' << FormatStateHash(hash.board) << ' ' << FormatStateHash(hash.plants)
+		<< ' ' << FormatStateHash(hash.zombies) << ' ' << FormatStateHash(hash.bullets)
+		<< ' ' << FormatStateHash(hash.collisions)
+		<< ' ' << hash.plantCount << '/' << hash.zombieCount << '/' << hash.bulletCount
+		<< '/' << hash.collisionCount << '\n';
+}
+
 void TestDriver::Fail(const std::string& reason) {
 	const std::string op = (mIndex < mCommands.size())
 		? mCommands[mIndex].value("op", "?") : "?";
@@ -714,12 +768,14 @@ void TestDriver::Update() {
 #endif
 		}
 	}
+	AppendStateHashLog();
 	mBreakFrame = false;
 	int guard = 0;
 	while (mActive && !mBreakFrame && mIndex < mCommands.size()) {
 		if (!ExecuteCurrent()) break;          // 等待中，下帧重试
 		Log("done cmd#" + std::to_string(mIndex) + " (" +
 			mCommands[mIndex].value("op", "?") + ")");
+		ReplayRecorder::GetInstance().RecordCommand(mCommands[mIndex]);
 		++mIndex;
 		mWaitAccum = 0.0f;
 		mFramesLeft = -1;
@@ -778,6 +834,19 @@ bool TestDriver::ExecuteCurrent() {
 		DeltaTime::SetTimeScale(cmd.value("value", 1.0f));
 		return true;
 	}
+	if (op == "set_turbo") {
+		// value: 1（关）/ 2 / 4 / 8，或 "max" 不限速；只改每个渲染帧的步数，不改单步 dt
+		const auto& value = cmd.contains("value") ? cmd["value"] : nlohmann::json(1);
+		int factor = -1;
+		if (value.is_string() && value.get<std::string>() == "max") factor = 0;
+		else if (value.is_number_integer()) factor = value.get<int>();
+		if (factor != 0 && factor != 1 && factor != 2 && factor != 4 && factor != 8) {
+			Fail("set_turbo: value 必须是 1/2/4/8 或 \"max\"");
+			return false;
+		}
+		DeltaTime::SetTurbo(factor);
+		return true;
+	}
 	if (op == "set_difficulty") {
 		const int difficulty = cmd.value("value", 3);
 		if (difficulty < 1 || difficulty > 4) {
@@ -1567,33 +1636,43 @@ bool TestDriver::ExecuteCurrent() {
 		if (!gs || !gs->GetBoard()) { Fail("spawn_zombie: 不在 GameScene 或 Board 为空"); return false; }
 		auto it = kZombieNames.find(cmd.value("type", ""));
 		if (it == kZombieNames.end()) { Fail("未知僵尸类型: " + cmd.value("type", "")); return false; }
-		Zombie* z = gs->GetBoard()->CreateZombie(it->second,
-			cmd.value("row", 0), cmd.value("x", 900.0f));
-		if (!z) { Fail("CreateZombie 返回空"); return false; }
-		if (cmd.value("stationary", false)) {
-			// 测试靶只停基础 Animator；不伪造冻结/减速状态，也不改变受击链。
-			z->SetAnimationSpeed(0.0f);
-			if (auto* balloon = dynamic_cast<BalloonZombie*>(z)) {
-				balloon->SetFlightVelocity(0.0f);
-			}
-		}
-		if (cmd.value("slowed", false)) {
-			z->SetCooldown(cmd.value("slowDuration", 20.0f));
-		}
-		if (cmd.value("frozen", false) && !z->StartFrozen()) {
-			Fail("spawn_zombie: frozen=true 但目标不能进入冻结");
-			return false;
-		}
-		if (cmd.value("buttered", false) && !z->ApplyButter()) {
-			Fail("spawn_zombie: buttered=true 但目标不能进入黄油定身");
+		// count/xStep 与 spawn_bullet 对齐，用于一次铺开成批僵尸做渲染/剔除压力测试。
+		const int count = cmd.value("count", 1);
+		if (count < 1 || count > 4096) {
+			Fail("spawn_zombie: count 必须在 1..4096 范围内");
 			return false;
 		}
-		if (cmd.contains("paralyzedFor")) {
-			const float duration = cmd.value("paralyzedFor", 0.0f);
-			if (!z->ApplyParalysis(duration)) {
-				Fail("spawn_zombie: paralyzedFor 无效或目标不能进入麻痹");
+		const float startX = cmd.value("x", 900.0f);
+		const float xStep = cmd.value("xStep", 0.0f);
+		for (int i = 0; i < count; ++i) {
+			Zombie* z = gs->GetBoard()->CreateZombie(it->second,
+				cmd.value("row", 0), startX + xStep * i);
+			if (!z) { Fail("CreateZombie 返回空"); return false; }
+			if (cmd.value("stationary", false)) {
+				// 测试靶只停基础 Animator；不伪造冻结/减速状态，也不改变受击链。
+				z->SetAnimationSpeed(0.0f);
+				if (auto* balloon = dynamic_cast<BalloonZombie*>(z)) {
+					balloon->SetFlightVelocity(0.0f);
+				}
+			}
+			if (cmd.value("slowed", false)) {
+				z->SetCooldown(cmd.value("slowDuration", 20.0f));
+			}
+			if (cmd.value("frozen", false) && !z->StartFrozen()) {
+				Fail("spawn_zombie: frozen=true 但目标不能进入冻结");
 				return false;
 			}
+			if (cmd.value("buttered", false) && !z->ApplyButter()) {
+				Fail("spawn_zombie: buttered=true 但目标不能进入黄油定身");
+				return false;
+			}
+			if (cmd.contains("paralyzedFor")) {
+				const float duration = cmd.value("paralyzedFor", 0.0f);
+				if (!z->ApplyParalysis(duration)) {
+					Fail("spawn_zombie: paralyzedFor 无效或目标不能进入麻痹");
+					return false;
+				}
+			}
 		}
 		return true;
 	}
@@ -2192,8 +2271,13 @@ bool TestDriver::ExecuteCurrent() {
 			Fail("save_level_snapshot: GameScene、Board 或 CardSlotManager 无效");
 			return false;
 		}
+		std::string extension;
+		if (!SnapshotExtension(cmd, extension)) {
+			Fail("save_level_snapshot: format 只能是 json 或 binary");
+			return false;
+		}
 		const std::string path = (std::filesystem::path(mOutDir) / "snapshots"
-			/ (name + ".json")).string();
+			/ (name + extension)).string();
 		auto& saver = GameAPP::GetInstance().mGameInfoSaver;
 		if (!saver.SaveAutoTestLevelSnapshot(
 			gs->GetBoard(), gs->GetCardSlotManager(), path)) {
@@ -2218,10 +2302,17 @@ bool TestDriver::ExecuteCurrent() {
 			Fail("reload_level_snapshot: GameScene、Board 或 CardSlotManager 无效");
 			return false;
 		}
+		std::string extension;
+		if (!SnapshotExtension(cmd, extension)) {
+			Fail("reload_level_snapshot: format 只能是 json 或 binary");
+			return false;
+		}
 		const std::string path = (std::filesystem::path(mOutDir) / "snapshots"
-			/ (name + ".json")).string();
+			/ (name + extension)).string();
+		// 二进制快照的完整性由读档时的校验和把关，这里只确认文件存在
 		nlohmann::json snapshot;
-		if (!FileManager::LoadJsonFile(path, snapshot)) {
+		if (extension == ".json" ? !FileManager::LoadJsonFile(path, snapshot)
+			: !IsNonEmptyRegularFile(std::filesystem::u8path(path))) {
 			Fail("reload_level_snapshot: 快照缺失、为空或 JSON 损坏");
 			return false;
 		}
@@ -2253,6 +2344,69 @@ bool TestDriver::ExecuteCurrent() {
 		Log("snapshot reloaded into fresh GameScene: " + path);
 		return true;
 	}
+	if (op == "capture_memory_snapshot") {
+		const std::string name = cmd.value("name", "");
+		if (!IsSafeSnapshotName(name)) {
+			Fail("capture_memory_snapshot: name 只允许 ASCII 字母、数字、_、-，且不能为空");
+			return false;
+		}
+		GameScene* gs = CurrentGameScene();
+		if (!gs || !gs->GetBoard() || !gs->GetCardSlotManager()) {
+			Fail("capture_memory_snapshot: GameScene、Board 或 CardSlotManager 无效");
+			return false;
+		}
+		const auto start = std::chrono::steady_clock::now();
+		LevelSnapshot snapshot;
+		auto& saver = GameAPP::GetInstance().mGameInfoSaver;
+		if (!saver.CaptureLevelSnapshot(gs->GetBoard(), gs->GetCardSlotManager(), snapshot)) {
+			Fail("capture_memory_snapshot: 棋盘不在可存档状态或正式序列化失败");
+			return false;
+		}
+		const double ms = std::chrono::duration<double, std::milli>(
+			std::chrono::steady_clock::now() - start).count();
+		const size_t bytes = snapshot.document.size();
+		mMemorySnapshots[name] = std::move(snapshot);
+		Log("memory snapshot captured: " + name + " (" + std::to_string(bytes)
+			+ " bytes, " + std::to_string(ms) + " ms)");
+		return true;
+	}
+	if (op == "restore_memory_snapshot") {
+		const std::string name = cmd.value("name", "");
+		auto it = mMemorySnapshots.find(name);
+		if (it == mMemorySnapshots.end()) {
+			Fail("restore_memory_snapshot: 未捕获名为 " + name + " 的内存快照");
+			return false;
+		}
+		const LevelSnapshot& snapshot = it->second;
+		const auto start = std::chrono::steady_clock::now();
+		auto& saver = GameAPP::GetInstance().mGameInfoSaver;
+		if (!saver.QueueLevelSnapshotRestore(snapshot)) {
+			Fail("restore_memory_snapshot: 无法登记一次性内存快照");
+			return false;
+		}
+		auto& sm = SceneManager::GetInstance();
+		sm.SetGlobalData("EnterLevel", std::to_string(snapshot.level));
+		if (!sm.SwitchTo("GameScene")) {
+			saver.CancelAutoTestLevelSnapshotLoad();
+			Fail("restore_memory_snapshot: SwitchTo(GameScene) 失败");
+			return false;
+		}
+		std::string loadError;
+		if (!saver.ConsumeAutoTestLevelSnapshotLoadResult(loadError)) {
+			Fail("restore_memory_snapshot: " + loadError);
+			return false;
+		}
+		GameScene* newScene = CurrentGameScene();
+		if (!newScene || !newScene->GetBoard() || newScene->GetBoard()->mLevel != snapshot.level) {
+			Fail("restore_memory_snapshot: 新 GameScene 未确认加载同一关卡");
+			return false;
+		}
+		const double ms = std::chrono::duration<double, std::milli>(
+			std::chrono::steady_clock::now() - start).count();
+		Log("memory snapshot restored: " + name + " (" + std::to_string(ms) + " ms, deserialize "
+			+ std::to_string(saver.GetLastAutoTestSnapshotLoadMs()) + " ms)");
+		return true;
+	}
 	if (op == "screenshot") {
 		const std::string name = cmd.value("name", "shot.png");
 		auto* renderer = GameAPP::GetInstance().GetCaptureBackend();
@@ -2283,6 +2437,24 @@ bool TestDriver::ExecuteCurrent() {
 			+ " persisted: " + path.u8string());
 		return true;
 	}
+	if (op == "log_state_hash") {
+		// { "op":"log_state_hash", "value":true, "name":"state_hash.log" }：每个逻辑步追加一行
+		const bool enable = cmd.value("value", true);
+		if (mStateHashLog.is_open()) mStateHashLog.close();
+		if (!enable) return true;
+		const std::string name = cmd.value("name", "state_hash.log");
+		mStateHashLog.open(mOutDir + "/" + name, std::ios::trunc);
+		if (!mStateHashLog) { Fail("log_state_hash: 无法写 " + name); return false; }
+		return true;
+	}
+	if (op == "mark_state_hash") {
+		GameScene* gs = CurrentGameScene();
+		if (!gs || !gs->GetBoard()) { Fail("mark_state_hash: 不在 GameScene 或 Board 为空"); return false; }
+		mStateHashMark = gs->GetBoard()->ComputeStateHash().Combined();
+		mHasStateHashMark = true;
+		Log("state hash mark=" + FormatStateHash(mStateHashMark));
+		return true;
+	}
 	if (op == "dump_state") {
 		nlohmann::json out;
 		if (!BuildStateJson("dump_state", out)) return false;
@@ -3122,6 +3294,31 @@ bool TestDriver::BuildStateJson(const std::string& opName, nlohmann::json& out)
 	}
 	Board* board = gs->GetBoard();
 
+	// 分域哈希给十六进制串（JSON 数字装不下完整 uint64 的断言语义）；computeMicros 供性能回归观测。
+	{
+		const auto hashStart = std::chrono::steady_clock::now();
+		const BoardStateHash hash = board->ComputeStateHash();
+		const double hashMicros = std::chrono::duration<double, std::micro>(
+			std::chrono::steady_clock::now() - hashStart).count();
+		const uint64_t combined = hash.Combined();
+		out["stateHash"] = {
+			{ "boardFrame", hash.boardFrame },
+			{ "hex", FormatStateHash(combined) },
+			{ "board", FormatStateHash(hash.board) },
+			{ "plants", FormatStateHash(hash.plants) },
+			{ "zombies", FormatStateHash(hash.zombies) },
+			{ "bullets", FormatStateHash(hash.bullets) },
+			{ "collisions", FormatStateHash(hash.collisions) },
+			{ "plantCount", hash.plantCount },
+			{ "zombieCount", hash.zombieCount },
+			{ "bulletCount", hash.bulletCount },
+			{ "collisionCount", hash.collisionCount },
+			{ "computeMicros", static_cast<int>(std::lround(hashMicros)) },
+			{ "workers", hash.workers },
+			{ "matchesMark", mHasStateHashMark && combined == mStateHashMark },
+		};
+	}
+
 	out["boardState"] = BoardStateName(board->mBoardState);
 	out["cobCannonTargeting"] = board->IsCobCannonTargeting();
 	out["targetingCobCannonID"] = board->GetTargetingCobCannonID();
@@ -3282,6 +3479,8 @@ bool TestDriver::BuildStateJson(const std::string& opName, nlohmann::json& out)
 		{ "renderer", pvz::RendererBackendName(gameApp.GetSelectedRenderer()) },
 		{ "lastFrameDrawCalls", graphics.GetLastFrameDrawCallCount() },
 		{ "lastFrameScissorChanges", graphics.GetLastFrameScissorChangeCount() },
+		{ "lastFrameReanimCulled", graphics.GetLastFrameReanimCulledCount() },
+		{ "lastFrameReanimEmitted", graphics.GetLastFrameReanimEmittedCount() },
 		{ "vulkanApiMajor", vulkanContext
 			? static_cast<int>(VK_VERSION_MAJOR(vulkanContext->ApiVersion())) : 0 },
 		{ "vulkanApiMinor", vulkanContext
@@ -3377,6 +3576,7 @@ bool TestDriver::BuildStateJson(const std::string& opName, nlohmann::json& out)
 	out["devSelectedZombie"] = gameApp.mDeveloperSelectedZombie;
 	out["timeScaleOn1000"] =
 		static_cast<int>(std::lround(DeltaTime::GetTimeScale() * 1000.0f));
+	out["turbo"] = DeltaTime::GetTurbo();
 	out["adventureLevel"] = gameApp.mAdventureLevel;
 	out["haveCardCount"] = static_cast<int>(gameApp.mHaveCards.size());
 	out["haveCards"] = nlohmann::json::array();
@@ -3725,6 +3925,11 @@ bool TestDriver::BuildStateJson(const std::string& opName, nlohmann::json& out)
 			{ "drawRows", board->GetFogDrawRowCount() },
 			{ "visibleCells", board->GetVisibleFogCellCount() },
 			{ "maxAlpha", board->GetMaximumFogAlpha() },
+			{ "unsettledCells", board->GetFogUnsettledCellCount() },
+			{ "referenceMismatchCells", board->GetFogReferenceMismatchCellsForTesting() },
+			{ "referenceMismatchTicks", board->GetFogReferenceMismatchTicksForTesting() },
+			{ "drawQuads", gs->GetLastFogQuadCountForTesting() },
+			{ "drawSubmissions", gs->GetLastFogSubmitCountForTesting() },
 			{ "dispersalPct", static_cast<int>(std::lround(
 				board->GetFogDispersal() * 100.0f)) },
 			{ "offsetXInt", static_cast<int>(std::lround(board->GetFogVisualOffsetX())) },
@@ -3926,6 +4131,37 @@ bool TestDriver::BuildStateJson(const std::string& opName, nlohmann::json& out)
 			{ "failedForecastIntensity", RainIntensityName(gs->GetFailedForecastRainIntensity()) },
 			{ "actualForecastIntensity", RainIntensityName(gs->GetActualForecastRainIntensity()) },
 		};
+		// 雨场：容量按雨势固定，风向只改漂移；最新水花（寿命最短者）另给屋顶行内判定。
+		const RainField& rainField = board->GetRainField();
+		const RainField::Splashes& rainSplashes = rainField.GetSplashes();
+		out["weather"]["rainField"] = {
+			{ "spawning", rainField.IsSpawning() },
+			{ "drops", rainField.GetDropCount() },
+			{ "capacity", rainField.GetCapacity() },
+			{ "splashes", rainField.GetSplashCount() },
+			{ "driftXInt", static_cast<int>(std::lround(rainField.GetLayerDriftX(0))) },
+			{ "drawQuads", gs->GetLastRainQuadCountForTesting() },
+			{ "drawSubmissions", gs->GetLastRainSubmitCountForTesting() },
+		};
+		if (rainSplashes.count > 0) {
+			const int newest = static_cast<int>(std::min_element(rainSplashes.age.begin(),
+				rainSplashes.age.begin() + rainSplashes.count) - rainSplashes.age.begin());
+			const Vector splash(rainSplashes.posX[newest], rainSplashes.posY[newest]);
+			nlohmann::json lastSplash = {
+				{ "xInt", static_cast<int>(std::lround(splash.x)) },
+				{ "yInt", static_cast<int>(std::lround(splash.y)) },
+			};
+			if (board->IsRoofBackground()) {
+				float nearestOffset = std::numeric_limits<float>::max();
+				for (int row = 0; row < board->mRows; ++row) {
+					const float offset = splash.y - board->GetRowCenterYAtX(row, splash.x);
+					if (std::abs(offset) < std::abs(nearestOffset)) nearestOffset = offset;
+				}
+				lastSplash["roofTerrainInsideRow"] = std::abs(nearestOffset)
+					<= board->GetCellHeight() * 0.5f;
+			}
+			out["weather"]["rainField"]["lastSplash"] = std::move(lastSplash);
+		}
 		nlohmann::json runoffRows = nlohmann::json::array();
 		int firstRunoffRow = -1;
 		for (int row = 0; row < board->mRows; ++row) {
@@ -5237,7 +5473,7 @@ bool TestDriver::BuildStateJson(const std::string& opName, nlohmann::json& out)
 				plantState["headRenderScaleYPct"] =
 					static_cast<int>(head->GetRenderScaleY() * 100.0f + 0.5f);
 				if (head->IsPlaying() && head->GetPlayingState() == PlayState::PLAY_REPEAT
-					&& head->GetCurrentTrackName() == "anim_shooting") {
+					&& head->IsPlayingTrack(Tracks().shooting)) {
 					++repeatingShootingHeadCount;
 				}
 			}
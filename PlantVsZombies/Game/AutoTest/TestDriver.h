@@ -5,7 +5,9 @@
 #include <string>
 #include <vector>
 #include <fstream>
+#include <map>
 #include <nlohmann/json.hpp>
+#include "../../GameInfoSaver.h"
 
 // -AutoTest 脚本自动驾驶：解析 JSON 命令队列，挂在主循环每帧推进。
 // 设计文档：docs/superpowers/specs/2026-06-12-autotest-suite-design.md
@@ -24,6 +26,11 @@ public:
 
 	const std::string& OutDir() const { return mOutDir; }
 
+	// -Replay 回放：不加载脚本，只打开 outDir/run.log 供命令日志与失败记录使用。
+	bool BeginReplay(const std::string& outDir);
+	// 在录制时完成的同一逻辑步内执行一条命令；本步内未完成即视为分叉，Fail 并返回 false。
+	bool ExecuteReplayCommand(const nlohmann::json& cmd, uint64_t tick);
+
 private:
 	TestDriver() = default;
 
@@ -41,6 +48,8 @@ private:
 	void Finish();                          // 全部命令跑完，正常收尾
 	void Log(const std::string& msg);       // 写 run.log（带帧号）并 flush
 	void WriteStatus(const char* status, const std::string& detail = {});
+	/** log_state_hash 开启时每个逻辑步追加一行分域状态哈希；不在对局中时跳过。 */
+	void AppendStateHashLog();
 
 	bool mActive = false;
 	int  mExitCode = 0;
@@ -57,6 +66,14 @@ private:
 	bool  mBreakFrame = false;   // screenshot 等需要"本帧到此为止"的命令置位
 	int   mInputPhase = -1;      // click/key(press) 跨帧状态机阶段（-1 = 未初始化）
 	std::uint64_t mCaptureTicket = 0; // 当前 screenshot 等待的渲染器 ticket（0 = 未提交）
+
+	// 逐帧状态哈希：两次同种子运行的日志逐行 diff，首个不同行即分叉帧
+	std::ofstream mStateHashLog;
+	bool mHasStateHashMark = false;
+	std::uint64_t mStateHashMark = 0;  // mark_state_hash 记下的总哈希，供 stateHash.matchesMark 断言
+
+	// capture_memory_snapshot 按名保存的内存快照；std::map 节点地址稳定，还原期间可安全引用
+	std::map<std::string, LevelSnapshot> mMemorySnapshots;
 };
 
 #endif
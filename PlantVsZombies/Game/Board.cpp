@@ -25,7 +25,9 @@
 #include "MistFuel.h"
 
 #include "EntityRegistry.h"
+#include "CollisionSystem.h"
 #include "RenderOrder.h"
+#include "FogCellField.h"
 #include "AudioSystem.h"
 #include "./Plant/GameDataManager.h"
 #include "../GameApp.h"
@@ -35,6 +37,7 @@
 #include "../ParticleSystem/ParticleSystem.h"
 #include "../Graphics.h"
 #include "../Profiler.h"
+#include "../Reanimation/TrackNames.h"
 #include <unordered_set>
 #include <climits>
 #include <array>
@@ -43,6 +46,7 @@
 #include <cstdint>
 #include <chrono>
 #include <limits>
+#include <thread>
 
 namespace {
 	/** 集中保留地刺系的背景地形规则；屋顶必须拒绝无法放入花盆的地刺系。 */
@@ -127,11 +131,6 @@ namespace {
 	constexpr int kSmallFogColumnExpansion = 1;          // 小雾相对原版雾线向房屋方向额外覆盖的棋盘列数
 	constexpr int kNormalFogColumnExpansion = 2;         // 普通迷雾相对原版雾线向房屋方向额外覆盖的棋盘列数
 	constexpr int kDenseFogColumnExpansion = 3;          // 大雾相对原版雾线向房屋方向额外覆盖的棋盘列数
-	constexpr float kBaseFogEdgeAlpha = 200.0f;          // 小雾和普通迷雾最左边缘格的目标 alpha
-	constexpr float kDenseFogEdgeAlpha = 225.0f;         // 大雾最左边缘格的目标 alpha
-	constexpr float kFogInteriorAlpha = 255.0f;          // 雾区内部格的目标 alpha
-	constexpr float kFogFillRate = 180.0f;               // 雾生成或回流时每游戏秒最多增加的 alpha
-	constexpr float kFogClearRate = 320.0f;              // 台风驱散时每游戏秒最多减少的 alpha
 	constexpr float kFogTargetingAlphaThreshold = 96.0f; // 4-2 起远程索敌仍可接受的最大逐格雾 alpha
 	constexpr int kFogTargetingMarginColumns = 1;         // 植物可从当前可见边界额外看入薄雾的格数
 	constexpr float kFogCloseDetectionRange = 100.0f;    // 雾中不依赖照明的近身感知横向距离（像素）
@@ -142,20 +141,6 @@ namespace {
 	constexpr float kMistFuelLateBaseCarrierChance = 0.25f; // 最终波普通耐久僵尸加入保底累计器的基础份额
 	constexpr float kMistFuelEarlyHeavyCarrierBonus = 0.25f; // 首波高耐久僵尸相对普通僵尸最多追加的累计份额
 	constexpr float kMistFuelLateHeavyCarrierBonus = 0.15f; // 最终波高耐久僵尸相对普通僵尸最多追加的累计份额
-	constexpr int kPlanternLowBackRadius = 1;              // 一档向房屋侧照亮的格数
-	constexpr int kPlanternLowFrontRadius = 2;             // 一档向僵尸来向照亮的格数
-	constexpr int kPlanternLowVerticalRadius = 1;          // 一档向上下照亮的格数
-	constexpr int kPlanternMediumBaseRadiusX = 3;          // 二档原有主体向左右照亮的格数
-	constexpr int kPlanternMediumVerticalRadius = 2;       // 二档向上下照亮的格数
-	constexpr int kPlanternMediumManhattanLimit = 4;       // 二档主体裁去远角时允许的最大横纵格距和
-	constexpr int kPlanternMediumFrontExtension = 4;       // 二档向僵尸来向新增的最远列格距
-	constexpr int kPlanternMediumFrontHalfHeight = 1;      // 二档新增前沿列向上下延伸的格数
-	constexpr int kPlanternHighBaseRadiusX = 4;            // 三档原有主体向左右照亮的格数
-	constexpr int kPlanternHighVerticalRadius = 3;         // 三档向上下照亮的格数
-	constexpr int kPlanternHighManhattanLimit = 6;         // 三档主体裁去远角时允许的最大横纵格距和
-	constexpr int kPlanternHighFrontExtension = 5;         // 三档向僵尸来向新增的最远列格距
-	constexpr int kPlanternHighFrontHalfHeight = 2;        // 三档新增前沿列向上下延伸的格数
-	constexpr float kPlanternHighEdgeIllumination = 0.72f; // 三档最外圈保留的照明比例
 	constexpr float kSuperFogDispersalRate = 0.28f;      // 超强台风每游戏秒累积的雾驱散比例
 	constexpr float kFogReturnRate = 0.06f;              // 停风后基础雾每游戏秒恢复的驱散比例
 	constexpr float kFogMaximumDriftX = 180.0f;          // 持续台风把雾团推向当前风向的最大水平像素
@@ -1321,7 +1306,7 @@ void Board::ActivateStormyNight()
 	mWindGustTimer = RandomTyphoonGustInterval(mTyphoonStrength);
 	mWindParticleTimer = 0.0f;
 	RefreshZombieWeatherSpeeds();
-	RestartRainVisualForWindChange();
+	SyncRainField();
 }
 
 /**
@@ -1371,7 +1356,7 @@ void Board::EnforceStormyNightWeather()
 		mTyphoonGustsRemaining = 0;
 		mWindGustTimer = 0.0f;
 		mWindParticleTimer = 0.0f;
-		RestartRainVisualForWindChange();
+		SyncRainField();
 	}
 	mTyphoonStrengthTimer = kStormyNightLockedDuration;
 	if (mStormyNightFlashPattern < 1 || mStormyNightFlashPattern > 3
@@ -1436,8 +1421,7 @@ void Board::InitializeWeather()
 	mWeatherTransitionTimer = 0.0f;
 	mWeatherForecastReady = false;
 	ClearPendingHeavyRainWarning();
-	mRainVisualActive = false;
-	mRainVisualEffectName.clear();
+	mRainField.Clear();
 	mWeakWeatherPhasesSinceHeavy = 0;
 	mHeavyPhasesWithoutTyphoon = 0;
 	mRoofRunoffCharge = 0.0f;
@@ -1472,6 +1456,8 @@ void Board::InitializeFogWeather()
 	const int fogCellCount = supportsFog ? mColumns * (mRows + 1) : 0;
 	if (static_cast<int>(mFogCellAlpha.size()) != fogCellCount) {
 		mFogCellAlpha.assign(fogCellCount, 0.0f);
+		mFogReferenceAlpha.assign(fogCellCount, 0.0f);
+		mFogTargetsValid = false;
 	}
 	if (!supportsFog) {
 		mFogWeatherInitialized = false;
@@ -1623,9 +1609,40 @@ void Board::UpdateFogDispersal(float deltaTime)
 	}
 }
 
+/**
+ * 目标 alpha 只取决于雾线列、台风驱散、是否大雾与路灯花照明；输入与上次相同时直接沿用。
+ * 返回是否发生了重算。
+ */
+bool Board::RefreshFogTargets(int drawRows)
+{
+	const FogTargetInputs inputs = CollectFogTargetInputs();
+	if (mFogTargetsValid && inputs == mFogTargetInputs) return false;
+	mFogTargetInputs = inputs;
+	mFogTargetsValid = true;
+	FogCellField::BuildTargets(inputs, mColumns, drawRows, mFogTargetAlpha);
+	return true;
+}
+
+FogTargetInputs Board::CollectFogTargetInputs() const
+{
+	FogTargetInputs inputs;
+	inputs.leftColumn = GetEffectiveFogLeftColumn();
+	inputs.dispersal = mFogDispersal;
+	inputs.dense = IsDenseFogWeather();
+	const Plantern* plantern = SupportsPlanternMechanics() ? GetActivePlantern() : nullptr;
+	if (plantern && plantern->HasUsableLight()) {
+		inputs.planternRow = plantern->mRow;
+		inputs.planternColumn = plantern->mColumn;
+		inputs.planternGear = static_cast<int>(plantern->GetGear());
+	}
+	return inputs;
+}
+
 /**
  * 把关卡基准、三档增强雾势扩展和台风驱散合成为逐格 alpha。
- * 读档收尾可直接对齐终态，常规更新则继续按填充/消散速率平滑追赶。
+ * 读档收尾可直接对齐终态，常规更新则继续按填充/消散速率平滑追赶；
+ * 已停在目标上的格跳过，目标未变且全部就位时整帧不遍历。
+ * -AutoTest 下另按增量化之前的逐格全量算法并行推进一份对照 alpha，逐帧统计不一致的格数。
  */
 void Board::UpdateFogCellAlpha(float deltaTime, bool snapToTarget)
 {
@@ -1633,30 +1650,29 @@ void Board::UpdateFogCellAlpha(float deltaTime, bool snapToTarget)
 	const int fogCellCount = mColumns * drawRows;
 	if (static_cast<int>(mFogCellAlpha.size()) != fogCellCount) {
 		mFogCellAlpha.assign(fogCellCount, 0.0f);
+		mFogReferenceAlpha.assign(fogCellCount, 0.0f);
+		mFogTargetsValid = false;
 	}
 	if (fogCellCount <= 0) return;
 
-	const int leftColumn = GetEffectiveFogLeftColumn();
-	const float visibility = 1.0f - mFogDispersal;
-	const float edgeAlpha = IsDenseFogWeather()
-		? kDenseFogEdgeAlpha : kBaseFogEdgeAlpha;
-	for (int row = 0; row < drawRows; ++row) {
-		for (int col = 0; col < mColumns; ++col) {
-			float target = 0.0f;
-			if (col == leftColumn) target = edgeAlpha * visibility;
-			else if (col > leftColumn) target = kFogInteriorAlpha * visibility;
-			target *= 1.0f - GetPlanternIllumination(row, col);
-
-			float& alpha = mFogCellAlpha[row * mColumns + col];
-			if (snapToTarget) {
-				alpha = target;
-			}
-			else {
-				const float rate = target >= alpha ? kFogFillRate : kFogClearRate;
-				const float maxDelta = rate * deltaTime;
-				alpha += std::clamp(target - alpha, -maxDelta, maxDelta);
-			}
+	if (GameAPP::mAutoTestMode) {
+		FogCellField::StepReference(CollectFogTargetInputs(), mColumns, drawRows,
+			mFogReferenceAlpha, deltaTime, snapToTarget);
+	}
+
+	if (RefreshFogTargets(drawRows)) mFogUnsettledCells = fogCellCount;
+	if (mFogUnsettledCells > 0) {
+		mFogUnsettledCells = FogCellField::StepTowardTargets(
+			mFogTargetAlpha, mFogCellAlpha, deltaTime, snapToTarget);
+	}
+
+	if (GameAPP::mAutoTestMode) {
+		int mismatched = 0;
+		for (int index = 0; index < fogCellCount; ++index) {
+			if (mFogCellAlpha[index] != mFogReferenceAlpha[index]) ++mismatched;
 		}
+		mFogReferenceMismatchCells = mismatched;
+		if (mismatched > 0) ++mFogReferenceMismatchTicks;
 	}
 }
 
@@ -1691,6 +1707,8 @@ void Board::RestoreFogState(bool initialized, FogWeatherIntensity intensity,
 		? std::clamp(visualOffsetX, -kFogMaximumDriftX, kFogMaximumDriftX) : 0.0f;
 	mFogAnimationTime = 0.0f;
 	mFogCellAlpha.assign(SupportsStageFog() ? mColumns * (mRows + 1) : 0, 0.0f);
+	mFogReferenceAlpha.assign(mFogCellAlpha.size(), 0.0f);
+	mFogTargetsValid = false;
 }
 
 void Board::RefreshZombieWeatherSpeeds()
@@ -1701,36 +1719,26 @@ void Board::RefreshZombieWeatherSpeeds()
 	}
 }
 
-void Board::EmitRainEffect(float duration)
-{
-	if (!g_particleSystem || mRainIntensity == RainIntensity::CLEAR || duration <= 0.0f) return;
-	const std::string effectName = RainEffectName(mRainIntensity, mWindDirection);
-	if (effectName.empty()) return;
-	if (!mRainVisualEffectName.empty() && mRainVisualEffectName != effectName) {
-		// 风向或雨势切换时只停旧雨的发射器；在途雨丝保留到自然淡出。
-		g_particleSystem->StopEffect(mRainVisualEffectName);
-	}
-	// Box 发射器以屏幕上沿中央为基准铺满逻辑画面；运行期时长覆盖 XML 上限，
-	// 使随机雨长与读档剩余时间都能和玩法倍率同步结束。
-	g_particleSystem->EmitEffect(effectName,
-		Vector(static_cast<float>(SCENE_WIDTH) * 0.5f, -60.0f),
-		LAYER_EFFECTS_WORLD, duration);
-	mRainVisualActive = true;
-	mRainVisualEffectName = effectName;
-}
-
-/** 台风开始、结束或翻向后按剩余雨时无缝切换定向雨丝。 */
-void Board::RestartRainVisualForWindChange()
+/**
+ * 把当前雨势与实时风向交给雨场。雨势切换只改之后生成的雨丝，在途雨丝按各自寿命收尾；
+ * 台风开始、结束或翻向只改漂移参数，雨丝在约 0.25 秒内整体转向，不再停发重建特效。
+ * 每帧都会调用，两者都没变时直接返回；雨场 Clear 保留雨势/风向，配置名因此始终与雨场一致。
+ */
+void Board::SyncRainField()
 {
-	if (mRainIntensity != RainIntensity::HEAVY || mWeatherTimer <= 0.0f) return;
-	mRainVisualActive = false;
-	EmitRainEffect(mWeatherTimer);
+	const RainIntensity intensity = mWeatherInitialized ? mRainIntensity : RainIntensity::CLEAR;
+	if (intensity == mRainField.GetIntensity()
+		&& mWindDirection == mRainField.GetWindDirection()) return;
+	// 发射盒以屏幕上沿外中央为基准铺满逻辑画面，与原 Box 发射器位置一致
+	mRainField.SetOrigin(static_cast<float>(SCENE_WIDTH) * 0.5f, -60.0f);
+	mRainField.SetWeather(intensity, mWindDirection);
+	mRainVisualEffectName = RainEffectName(intensity, mWindDirection);
 }
 
 /** 在当前地形的逻辑网格内随机选择落点，播放短促的原版雨滴水花与扩散圆圈。 */
 void Board::TriggerRainGroundSplash()
 {
-	if (!g_particleSystem || mRows <= 0 || mColumns <= 0) return;
+	if (mRows <= 0 || mColumns <= 0) return;
 
 	// 用完整网格边界而非窗口随机值，既覆盖战场又给 33px 水花留下屏内余量。
 	const float minX = CELL_INITALIZE_POS_X + kRainSplashEdgePadding;
@@ -1751,8 +1759,7 @@ void Board::TriggerRainGroundSplash()
 			-halfHeight + kRainSplashEdgePadding,
 			halfHeight - kRainSplashEdgePadding);
 	}
-	g_particleSystem->EmitEffect("RainGroundSplash", Vector(splashX, splashY),
-		LAYER_EFFECTS_WORLD);
+	mRainField.AddSplash(splashX, splashY);
 }
 
 /** 推进地面水花节奏；计时器是纯视觉状态，雨势切换和读档后都会重新起拍。 */
@@ -1768,9 +1775,7 @@ void Board::UpdateRainGroundSplash(float deltaTime)
 
 bool Board::IsRainEffectEmitting() const
 {
-	return g_particleSystem && mRainIntensity != RainIntensity::CLEAR
-		&& g_particleSystem->IsEffectEmitting(
-			RainEffectName(mRainIntensity, mWindDirection));
+	return mRainIntensity != RainIntensity::CLEAR && mRainField.IsSpawning();
 }
 
 void Board::StartRainAudio()
@@ -2276,7 +2281,7 @@ void Board::WeakenTyphoon()
 
 	if (next == TyphoonStrength::NONE) {
 		StopTyphoon();
-		RestartRainVisualForWindChange();
+		SyncRainField();
 		if (mPresentation) mPresentation->ShowCurrentWeatherNotice();
 		return;
 	}
@@ -2422,7 +2427,7 @@ void Board::RerollWindDirection(int directionRoll)
 	if (mWindDirection == previousDirection) return;
 	// 下一帧立即发射新方向的风线；旧方向粒子会在自身不足 1.25 秒的寿命内自然淡出。
 	mWindParticleTimer = 0.0f;
-	RestartRainVisualForWindChange();
+	SyncRainField();
 }
 
 bool Board::RedirectTyphoonFromBlover(WindDirection direction)
@@ -2444,7 +2449,7 @@ bool Board::RedirectTyphoonFromBlover(WindDirection direction)
 	}
 	if (changed) {
 		mWindParticleTimer = 0.0f;
-		RestartRainVisualForWindChange();
+		SyncRainField();
 	}
 	return true;
 }
@@ -2870,10 +2875,9 @@ void Board::BeginRain(RainIntensity intensity, float duration, bool canIntensify
 	mLightningTimer = (intensity == RainIntensity::HEAVY)
 		? GameRandom::Range(kLightningDelayMin, kLightningDelayMax)
 		: 0.0f;
-	mRainVisualActive = false;
 	RefreshZombieWeatherSpeeds();
-	// 同档续期也新建发射器，让旧雨丝自然收尾并与新雨段无缝衔接。
-	EmitRainEffect(duration);
+	// 同档续期雨场不中断；换档后新雨丝按新参数生成，旧雨丝自然收尾。
+	SyncRainField();
 	StartRainAudio();
 	if (mPresentation) mPresentation->ShowCurrentWeatherNotice();
 }
@@ -2935,8 +2939,8 @@ void Board::EndRain()
 	mRainCanIntensify = false;
 	mRainCanHold = false;
 	mWeatherForecastReady = false;
-	mRainVisualActive = false;
-	mRainVisualEffectName.clear();
+	// 雨场停止生成，在途雨丝与水花照常落完
+	SyncRainField();
 	RefreshZombieWeatherSpeeds();
 	if (mWeatherTransitionTimer > 0.0f) StartRainAudio();
 	else StopRainAudio();
@@ -3248,7 +3252,7 @@ void Board::ChooseNightRoofChargeRoute(float warningSeconds)
 			if (!plant || !plant->IsActive() || plant->IsPreview()
 				|| plant->IsSquished() || plant->GetSleepState()
 				|| plant->mPlantType != PlantType::PLANT_ICESHROOM
-				|| plant->GetCurrentTrackName() != "anim_idle") continue;
+				|| !plant->IsPlayingTrack(Tracks().idle)) continue;
 			const float currentFrame = plant->GetCurrentFrame();
 			const float speed = plant->GetAnimationSpeed();
 			if (currentFrame >= 16.0f || speed <= 0.0f) continue;
@@ -3897,10 +3901,6 @@ void Board::UpdateWeather(float deltaTime)
 	if (IsStormyNightActive()) {
 		EnforceStormyNightWeather();
 		UpdateWeatherTransition(deltaTime);
-		if (!IsRainEffectEmitting()) {
-			mRainVisualActive = false;
-			EmitRainEffect(kStormyNightLockedDuration);
-		}
 		UpdateRainGroundSplash(deltaTime);
 		UpdateTyphoon(deltaTime);
 		UpdateStormyNightFlash(deltaTime);
@@ -3915,12 +3915,6 @@ void Board::UpdateWeather(float deltaTime)
 		PrepareWeatherForecast();
 	}
 	MaybeShowHeavyRainPrompt();
-	if (mRainIntensity != RainIntensity::CLEAR && mWeatherTimer > 0.0f
-		&& !IsRainEffectEmitting()) {
-		// 粒子系统若因场景清理或异常耗尽而与天气状态脱节，用剩余时长自动补发。
-		mRainVisualActive = false;
-		EmitRainEffect(mWeatherTimer);
-	}
 	if (mRainIntensity != RainIntensity::CLEAR && mWeatherTimer > 0.0f) {
 		UpdateRainGroundSplash(deltaTime);
 	}
@@ -3949,8 +3943,7 @@ void Board::SetRainForTesting(RainIntensity intensity, float duration, bool canI
 	mForecastRainIntensity = RainIntensity::CLEAR;
 	mActualForecastRainIntensity = RainIntensity::CLEAR;
 	mWeatherForecastReady = false;
-	mRainVisualActive = false;
-	mRainVisualEffectName.clear();
+	mRainField.Clear();
 	mHeavyPhasesWithoutTyphoon = 0;
 	StopTyphoon();
 
@@ -4066,8 +4059,7 @@ bool Board::AdvanceRainPhaseForTesting(int transitionRoll)
 
 	// 测试会在雨段尚未自然到期时强制切档；先清旧雨丝，模拟生产路径中旧发射器已到期。
 	if (g_particleSystem) g_particleSystem->ClearAll();
-	mRainVisualActive = false;
-	mRainVisualEffectName.clear();
+	mRainField.Clear();
 	if (total > 0) FinishRainPhase(transitionRoll);
 	else EndRain();
 	FinishWeatherTransitionImmediately();
@@ -4087,11 +4079,11 @@ bool Board::SetTyphoonForTesting(TyphoonStrength strength, WindDirection directi
 	if (mRainIntensity != RainIntensity::HEAVY) return false;
 	if (strength == TyphoonStrength::NONE) {
 		StopTyphoon();
-		RestartRainVisualForWindChange();
+		SyncRainField();
 		return true;
 	}
 	RestoreTyphoonState(strength, direction, decayIn, gustIn, directionIn, gustsRemaining);
-	RestartRainVisualForWindChange();
+	SyncRainField();
 	return HasTyphoon();
 }
 
@@ -4110,7 +4102,7 @@ bool Board::RollTyphoonForTesting(int chanceRoll, int strengthRoll, WindDirectio
 	if (mRainIntensity != RainIntensity::HEAVY || chanceRoll < 1 || chanceRoll > 100
 		|| strengthRoll < 1 || strengthRoll > totalWeight || !validDirection) return false;
 	StartTyphoonForHeavyPhase(chanceRoll, strengthRoll, direction);
-	RestartRainVisualForWindChange();
+	SyncRainField();
 	return true;
 }
 
@@ -4173,6 +4165,86 @@ void Board::TriggerRainGroundSplashForTesting()
 	TriggerRainGroundSplash();
 }
 
+BoardStateHash Board::ComputeStateHash() const
+{
+	PROFILE_SCOPE("StateHash");
+	BoardStateHash result;
+	result.boardFrame = mBoardFrame;
+
+	StateHashAccumulator board;
+	board.BeginEntity(static_cast<uint64_t>(mBoardState));
+	board.Add(mBoardFrame, mLevel);
+	board.Add(mSun, mZombieNumber);
+	board.Add(mCurrentWave, mSurvivalRound);
+	board.Add(mZombieCountDown, mHugeWaveCountDown);
+	board.Add(mSunCountDown, mPoolSunCountDown);
+	board.Add(static_cast<int32_t>(mRainIntensity), static_cast<int32_t>(mTyphoonStrength));
+	board.Add(static_cast<int32_t>(mWindDirection), static_cast<int32_t>(mFogWeatherIntensity));
+	board.Add(mWeatherTimer, mFogDispersal);
+	board.Add(mEntityRegistry.GetNextPlantID(), mEntityRegistry.GetNextZombieID());
+	board.Add(mEntityRegistry.GetNextBulletID(), mEntityRegistry.GetNextCoinID());
+	board.EndEntity();
+	result.board = board.Value();
+
+	// 只读字段、无锁遍历：对象归属 GOM，本步内不会被释放。上万僵尸时单线程主要耗在
+	// 逐对象缓存未命中上，按 GOM 同款切块分给线程池；各 worker 的部分和相加与切块无关。
+	GameObjectManager& gom = GameObjectManager::GetInstance();
+	const std::vector<std::shared_ptr<GameObject>>& objects = gom.GetAllGameObjects();
+	const int total = static_cast<int>(objects.size());
+	constexpr int kParallelStateHashThreshold = 2048;
+	ThreadPool* pool = gom.GetThreadPool();
+	int numWorkers = 1;
+	if (pool && total >= kParallelStateHashThreshold) {
+		numWorkers = std::clamp(static_cast<int>(std::thread::hardware_concurrency()), 1, total);
+	}
+	std::vector<std::array<StateHashAccumulator, 3>> partial(numWorkers);
+	auto hashRange = [&objects, &partial](int slot, int begin, int end) {
+		std::array<StateHashAccumulator, 3> out{}; // 栈上累加、末尾写回一次，避免相邻槽位伪共享
+		for (int i = begin; i < end; ++i) {
+			const GameObject* obj = objects[i].get();
+			if (!obj->IsActive()) continue;
+			switch (obj->GetObjectType()) {
+			case ObjectType::OBJECT_PLANT:  obj->AppendStateHash(out[0]); break;
+			case ObjectType::OBJECT_ZOMBIE: obj->AppendStateHash(out[1]); break;
+			case ObjectType::OBJECT_BULLET: obj->AppendStateHash(out[2]); break;
+			default: break;
+			}
+		}
+		partial[slot] = out;
+		};
+	if (numWorkers > 1) {
+		pool->Dispatch(total, [&hashRange, total, numWorkers](int start, int end) {
+			const int chunkSize = (total + numWorkers - 1) / numWorkers;
+			hashRange(chunkSize > 0 ? start / chunkSize : 0, start, end);
+			});
+	}
+	else {
+		hashRange(0, 0, total);
+	}
+	StateHashAccumulator plants;
+	StateHashAccumulator zombies;
+	StateHashAccumulator bullets;
+	for (const std::array<StateHashAccumulator, 3>& slot : partial) {
+		plants.Merge(slot[0]);
+		zombies.Merge(slot[1]);
+		bullets.Merge(slot[2]);
+	}
+	result.plants = plants.Value();
+	result.zombies = zombies.Value();
+	result.bullets = bullets.Value();
+	result.plantCount = plants.Count();
+	result.zombieCount = zombies.Count();
+	result.bulletCount = bullets.Count();
+	result.workers = numWorkers;
+
+	const CollisionSystem& collisions = CollisionSystem::GetInstance();
+	StateHashAccumulator pairs;
+	pairs.AddSummed(collisions.GetCollisionSetHash(), collisions.GetActiveCollisionCount());
+	result.collisions = pairs.Value();
+	result.collisionCount = pairs.Count();
+	return result;
+}
+
 bool Board::IsPoolBackground() const
 {
 	return mBackGround == Background::WATER_POOL
@@ -4344,46 +4416,8 @@ float Board::GetPlanternIllumination(int row, int col) const
 	if (!SupportsPlanternMechanics()) return 0.0f;
 	const Plantern* plantern = GetActivePlantern();
 	if (!plantern || !plantern->HasUsableLight()) return 0.0f;
-
-	const int relativeX = col - plantern->mColumn;
-	const int relativeY = row - plantern->mRow;
-	const int dx = std::abs(relativeX);
-	const int dy = std::abs(relativeY);
-	switch (plantern->GetGear()) {
-	case PlanternGear::OFF:
-		return 0.0f;
-	case PlanternGear::LOW:
-		return relativeX >= -kPlanternLowBackRadius
-			&& relativeX <= kPlanternLowFrontRadius
-			&& dy <= kPlanternLowVerticalRadius
-			? 1.0f : 0.0f;
-	case PlanternGear::MEDIUM:
-		return (dx <= kPlanternMediumBaseRadiusX
-				&& dy <= kPlanternMediumVerticalRadius
-				&& dx + dy <= kPlanternMediumManhattanLimit)
-			|| (relativeX == kPlanternMediumFrontExtension
-				&& dy <= kPlanternMediumFrontHalfHeight)
-			? 1.0f : 0.0f;
-	case PlanternGear::HIGH: {
-		const auto isInsideHighShape = [](int x, int y) {
-			const int shapeDx = std::abs(x);
-			const int shapeDy = std::abs(y);
-			return (shapeDx <= kPlanternHighBaseRadiusX
-					&& shapeDy <= kPlanternHighVerticalRadius
-					&& shapeDx + shapeDy <= kPlanternHighManhattanLimit)
-				|| (x == kPlanternHighFrontExtension
-					&& shapeDy <= kPlanternHighFrontHalfHeight);
-		};
-		if (!isInsideHighShape(relativeX, relativeY)) return 0.0f;
-		// 由四邻域实时识别扩展后轮廓，只有真正最外圈保留薄雾。
-		const bool isOuterEdge = !isInsideHighShape(relativeX - 1, relativeY)
-			|| !isInsideHighShape(relativeX + 1, relativeY)
-			|| !isInsideHighShape(relativeX, relativeY - 1)
-			|| !isInsideHighShape(relativeX, relativeY + 1);
-		return isOuterEdge ? kPlanternHighEdgeIllumination : 1.0f;
-	}
-	}
-	return 0.0f;
+	return FogCellField::GetPlanternIllumination(static_cast<int>(plantern->GetGear()),
+		col - plantern->mColumn, row - plantern->mRow);
 }
 
 bool Board::CanPlantAcquireZombie(const Plant* plant, const Zombie* zombie) const
@@ -7030,12 +7064,17 @@ void Board::Update()
 		mBoardFrameAccum -= 1.0f;
 		mBoardFrame++;
 	}
+	// 随机流按逻辑步取键，每步一个新键。GOM 先于 Board 更新，下一逻辑步的并行阶段读到的就是这里写入的值。
+	GameRandom::SetStreamFrame(++mLogicStep);
 	// 屏幕抖动倒计时：乘 dt 口径（暂停 dt=0 冻结，倍速等比加速），与弹坑计时一致
 	if (mShakeTimer > 0.0f) {
 		mShakeTimer -= DeltaTime::GetDeltaTime();
 	}
 	// 天气属于整片场景而非波次逻辑：生存轮间也自然推进；暂停时 dt=0 与粒子同步冻结。
 	UpdateWeather(DeltaTime::GetDeltaTime());
+	// 雨场同用游戏 dt；每帧同步雨势与风向，兜住存档恢复和测试入口直接改写天气状态的路径。
+	SyncRainField();
+	mRainField.Update(DeltaTime::GetDeltaTime());
 	// 夜间泳池迷雾与雨势正交，但同样使用游戏时间并消费更新后的台风强度和实时风向。
 	UpdateFog(DeltaTime::GetDeltaTime());
 	UpdateIceTrails(DeltaTime::GetDeltaTime());
@@ -7063,11 +7102,8 @@ void Board::StartGame()
 	InitializeWeather();
 	InitializeFogWeather();
 	EnforceStormyNightWeather();
-	// 读档恢复到一场雨中时，玩法状态已经由存档还原；粒子是瞬态资源，需按剩余时间重建一次。
-	if (mRainIntensity != RainIntensity::CLEAR && !mRainVisualActive)
-	{
-		EmitRainEffect(mWeatherTimer);
-	}
+	// 读档恢复到一场雨中时，玩法状态已经由存档还原；雨场是瞬态视觉，按读回的雨势与风向重新同步。
+	SyncRainField();
 	// 雨转晴途中读档时目标枚举已经是 CLEAR，但旧雨声仍应按剩余过渡时间淡出。
 	if (mRainIntensity != RainIntensity::CLEAR
 		|| (mWeatherTransitionTimer > 0.0f
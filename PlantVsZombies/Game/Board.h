@@ -12,11 +12,15 @@
 #include "CursorObjectManager.h"
 #include "Perk/SurvivalPerkManager.h"
 #include "WeatherTypes.h"
+#include "RainField.h"
+#include "FogCellField.h"
+#include "StateHash.h"
 #include <vector>
 #include <memory>
 #include <string>
 #include <array>
 #include <functional>
+#include <cstdint>
 
 class GameInfoSaver;
 class BoardPresentation;
@@ -161,6 +165,9 @@ public:
 	// 用途：舞王/伴舞全队共舞节拍源——所有舞者从同一计数推导动作，不互相通信也能整齐划一。
 	int mBoardFrame = 0;
 	float mBoardFrameAccum = 0.0f;	// 游戏时间→节拍帧的亚帧余量（不入存档，读档损失<1帧无感）
+	// 逻辑步计数：每次 Board::Update 恰好 +1（暂停、慢速也照加，入存档），作并行随机流的帧键。
+	// 节拍帧在 timescale<1 或暂停时会多步共用同一值，拿它取键会让同一实体连续几步掷出相同结果。
+	uint64_t mLogicStep = 0;
 
 	// 舞蹈节拍帧 0~22 循环，每拍 12 逻辑步(0.2s)，等价原版 100Hz 的 20cs/拍、23 拍一循环。
 	// 0~11 = 舞步段(anim_walk)，12~22 = 举手段(anim_armraise)；补充召唤只在节拍==12 触发。
@@ -257,6 +264,13 @@ private:
 	bool mFogWeatherInitialized = false; // 旧档缺雾势字段时由 StartGame 首次初始化
 	bool mFogWeatherForecastReady = false; // 已锁定公开/真实下一雾势，等待独立雾势倒计时揭晓
 	std::vector<float> mFogCellAlpha;   // 逐格平滑后的最终 alpha；行数为泳池六行再加一条底部收边
+	std::vector<float> mFogTargetAlpha; // 逐格目标 alpha 缓存；仅在 mFogTargetInputs 变化时整表重算，不入存档
+	FogTargetInputs mFogTargetInputs;   // 生成 mFogTargetAlpha 时的输入快照
+	bool mFogTargetsValid = false;      // 目标表与当前格数/输入是否对应；重置 mFogCellAlpha 时一并作废
+	int mFogUnsettledCells = 0;         // 尚未追上目标的格数；为 0 且目标未变时整帧跳过逐格更新
+	std::vector<float> mFogReferenceAlpha; // 仅 -AutoTest：按旧版逐格全量算法并行推进的对照 alpha
+	int mFogReferenceMismatchCells = 0;    // 仅 -AutoTest：最近一次更新与对照不一致的格数
+	int mFogReferenceMismatchTicks = 0;    // 仅 -AutoTest：累计出现不一致的更新次数
 	int mActivePlanternID = NULL_PLANT_ID; // 当前唯一可用路灯花 ID；由实体创建/死亡派生，不单独入存档
 	float mMistFuelDropAccumulator = 0.0f; // 正式波次雾火随机的保底累计值；影响未来抽取，进入存档
 	int mMistFuelAssignedThisWave = 0; // 当前波已分配的雾火总量；只作预算闸门与观测
@@ -271,8 +285,8 @@ private:
 	int mPendingHeavyTyphoonGustsRemaining = 0; // 待生效台风首档阵风预算
 	int mPendingHeavyRainPromptVariant = 0; // 同等级三句古风警报中的锁定编号（0～2）
 	bool mHeavyRainPromptShown = false; // 当前锁定且报准的大雨预报是否已经弹出过提前 5 秒警报
-	bool mRainVisualActive = false;     // 纯运行期标记，防读档/生存轮间重复发射同一场雨
-	std::string mRainVisualEffectName;  // 当前雨丝特效名；风向切换时只停止旧雨而不清空其他粒子
+	RainField mRainField;               // 雨丝与地面水花的专用 SoA 场；纯视觉瞬态，不入存档
+	std::string mRainVisualEffectName;  // 当前雨势 + 风向对应的雨丝配置名（原 Rain*.xml 名），供 AutoTest 断言；仅在二者变化时改写
 	float mWindParticleTimer = 0.0f;    // 距下一批风线粒子的游戏秒数；瞬态视觉不入存档
 	TyphoonStrength mTyphoonStrength = TyphoonStrength::NONE; // 大雨附加台风；离开大雨立即清空
 	WindDirection mWindDirection = WindDirection::NONE;       // 当前风实际吹向，台风期间分段独立重抽
@@ -376,6 +390,8 @@ private:
 	void UpdateFogWeather(float deltaTime);
 	void UpdateFogDispersal(float deltaTime);
 	void UpdateFogCellAlpha(float deltaTime, bool snapToTarget);
+	bool RefreshFogTargets(int drawRows);
+	FogTargetInputs CollectFogTargetInputs() const;
 	FogWeatherIntensity RollNextFogWeather(int forcedRoll = 0);
 	void PrepareFogWeatherForecast(int fogRoll = 0);
 	void ConsumeFogWeatherForecast();
@@ -455,8 +471,7 @@ private:
 	void UpdateActiveTyphoonGust(float deltaTime);
 	void EndTyphoonGust();
 	void TriggerTyphoonPlantMove(TyphoonStrength strength, WindDirection direction);
-	void EmitRainEffect(float duration);
-	void RestartRainVisualForWindChange();
+	void SyncRainField();
 	void UpdateRainGroundSplash(float deltaTime);
 	void TriggerRainGroundSplash();
 	void StartRainAudio();
@@ -621,6 +636,11 @@ public:
 	int GetFogDrawRowCount() const { return SupportsStageFog() ? mRows + 1 : 0; }
 	/** 返回指定雾格平滑后的 alpha（0～255）。 */
 	float GetFogCellAlpha(int row, int col) const;
+	/** 尚未追上目标 alpha 的雾格数；0 表示雾已稳定，逐格更新整帧跳过。 */
+	int GetFogUnsettledCellCount() const { return mFogUnsettledCells; }
+	/** 仅 -AutoTest：与旧版全量逐格算法对照的最近一次不一致格数 / 累计不一致更新次数。 */
+	int GetFogReferenceMismatchCellsForTesting() const { return mFogReferenceMismatchCells; }
+	int GetFogReferenceMismatchTicksForTesting() const { return mFogReferenceMismatchTicks; }
 	/** 4-2 起启用路灯花燃料、照明、产光加速与雾中远程索敌限制。 */
 	bool SupportsPlanternMechanics() const;
 	/** 返回当前未压扁的唯一路灯花；ID 失效时返回空。 */
@@ -735,10 +755,12 @@ public:
 	bool IsTyphoonGustWarning() const;
 	/** 当前公开预报是否属于此天气阶段真实允许出现的下一档。 */
 	bool IsWeatherForecastPlausible() const;
-	/** 当前雨势对应的粒子发射器是否仍在工作。 */
+	/** 雨场是否正在按当前雨势生成雨丝。 */
 	bool IsRainEffectEmitting() const;
-	/** 当前实际发射的雨丝配置名，供 AutoTest 精确断言风向切换。 */
+	/** 当前雨丝配置名，供 AutoTest 精确断言风向切换。 */
 	const std::string& GetRainVisualEffectName() const { return mRainVisualEffectName; }
+	/** 雨丝与地面水花，供 GameScene 一次实例化绘制。 */
+	const RainField& GetRainField() const { return mRainField; }
 
 	// AutoTest 专用：固定雨势并重启对应粒子，真实游戏只走随机天气状态机。
 	void SetRainForTesting(RainIntensity intensity, float duration = 30.0f, bool canIntensify = false);
@@ -779,6 +801,12 @@ public:
 		int row = -1, float phaseTimer = 0.0f, float overcharge = 0.0f);
 	/** 立即生成一次地面雨滴水花，供不同地形的落点闭环测试。 */
 	void TriggerRainGroundSplashForTesting();
+	/**
+	 * 当前逻辑步的分域状态哈希：Board 关键数值 + 活跃植物/僵尸/子弹 + 持续碰撞对集合。
+	 * 单次遍历 GOM 对象表、不锁 weak_ptr；碰撞对部分由 CollisionSystem 增量维护，取值 O(1)。
+	 * 碰撞体 ID 按注册顺序分配，读档后会重排，故只用于同种子同脚本的两次运行互比。
+	 */
+	BoardStateHash ComputeStateHash() const;
 	/** 正式波次与 AutoTest 共用的天气变异入口；mutationRoll=0 时随机，超额成功变异返回 NUM_ZOMBIE_TYPES。 */
 	ZombieType ResolveRainMutationType(ZombieType selected, int mutationRoll = 0);
 	/** 正式波次总解析入口；超过类型上限返回 NUM_ZOMBIE_TYPES，调用方必须跳过候选。 */
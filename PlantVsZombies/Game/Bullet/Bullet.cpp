@@ -3,10 +3,12 @@
 #include "../Plant/Plant.h"
 #include "Bullet.h"
 #include "../GameObjectManager.h"
+#include "../AnimationSystem.h"
 #include "../ObjectPool/BulletPool.h"
 #include "../ShadowComponent.h"
 #include "../AnimatedObject.h"
 #include "../Cell.h"
+#include "../StateHash.h"
 #include "../../GameApp.h"
 #include "../../Logger.h"
 #include <algorithm>
@@ -211,6 +213,36 @@ namespace {
 	private:
 		bool mToxicFlame = false;
 	};
+
+	const char* BulletHitEffectName(BulletType type)
+	{
+		switch (type) {
+		case BulletType::BULLET_SNOWPEA: return "SnowPeaBulletHit";
+		case BulletType::BULLET_PUFF: return "PuffShroomHit";
+		case BulletType::BULLET_TOXICPEA: return "ToxicPeaBulletHit";
+		case BulletType::BULLET_PEA: return "PeaBulletHit";
+		case BulletType::BULLET_STAR: return "StarSplat";
+		case BulletType::BULLET_CABBAGE: return "CabbageSplat";
+		case BulletType::BULLET_BUTTER: return "ButterSplat";
+		default: return nullptr;
+		}
+	}
+
+	// 命中特效随每发子弹触发：首次使用时按类型把配置名解析成 EffectId，之后只剩数组下标。
+	// 调用方已保证 g_particleSystem 存在且配置加载完毕（特效表只追加，id 长期有效）。
+	EffectId BulletHitEffectId(BulletType type)
+	{
+		static const std::array<EffectId, static_cast<std::size_t>(BulletType::NUM_BULLETS)> ids = [] {
+			std::array<EffectId, static_cast<std::size_t>(BulletType::NUM_BULLETS)> resolved{};
+			for (std::size_t i = 0; i < resolved.size(); ++i) {
+				if (const char* name = BulletHitEffectName(static_cast<BulletType>(i))) {
+					resolved[i] = g_particleSystem->ResolveEffect(name);
+				}
+			}
+			return resolved;
+		}();
+		return ids[static_cast<std::size_t>(type)];
+	}
 }
 
 struct Bullet::SpikeState {
@@ -285,7 +317,6 @@ void Bullet::Reset(Board* board, int row,
 	mTrajectory = TrajectoryState{};
 	mHitTorchwoodColumn = -1;
 	if (mSpikeState) mSpikeState->count = 0;
-	mAnimatorAdvancedInParallel = false;
 	ConfigurePresentation();
 	ConfigureCollisionTarget();
 
@@ -320,16 +351,23 @@ void Bullet::Die()
 	GameObjectManager::GetInstance().DestroyGameObject(this);
 }
 
+void Bullet::AppendStateHash(StateHashAccumulator& hash) const
+{
+	const Transform* transform = GetTransform();
+	const Vector position = transform ? transform->GetPosition() : Vector::zero();
+	hash.BeginEntity(0x200u + static_cast<uint64_t>(mBulletType));
+	hash.Add(mBulletID, mRow);
+	hash.Add(mDamage, (mHasHit ? 1 : 0) | (mTargetsFlying ? 2 : 0));
+	hash.Add(position.x, position.y);
+	hash.Add(mVelocityX, mVelocityY);
+	hash.EndEntity();
+}
+
 void Bullet::Update()
 {
 	GameObject::Update();
-	if (mProjectileAnimator) {
-		if (mAnimatorAdvancedInParallel) {
-			mAnimatorAdvancedInParallel = false;
-		}
-		else {
-			mProjectileAnimator->Update();
-		}
+	if (mProjectileAnimator && !mProjectileAnimator->ConsumeBatchAdvance()) {
+		mProjectileAnimator->Update();
 	}
 
 	auto* transform = GetTransform();
@@ -383,14 +421,9 @@ void Bullet::Update()
 	}
 }
 
-void Bullet::UpdateParallel(std::vector<DeferredEvent>& outBuf)
+void Bullet::RegisterAnimators(AnimationSystem& system)
 {
-	if (!mProjectileAnimator) {
-		mAnimatorAdvancedInParallel = false;
-		return;
-	}
-	mProjectileAnimator->UpdateParallelDeferred(outBuf);
-	mAnimatorAdvancedInParallel = true;
+	if (mProjectileAnimator) system.Register(*mProjectileAnimator, this);
 }
 
 void Bullet::Draw(Graphics* g)
@@ -551,18 +584,7 @@ void Bullet::HitRoofTerrain()
 			IsToxicFireball());
 	}
 	else if (g_particleSystem) {
-		const char* effectName = nullptr;
-		switch (mBulletType) {
-		case BulletType::BULLET_SNOWPEA: effectName = "SnowPeaBulletHit"; break;
-		case BulletType::BULLET_PUFF: effectName = "PuffShroomHit"; break;
-		case BulletType::BULLET_TOXICPEA: effectName = "ToxicPeaBulletHit"; break;
-		case BulletType::BULLET_PEA: effectName = "PeaBulletHit"; break;
-		case BulletType::BULLET_STAR: effectName = "StarSplat"; break;
-		case BulletType::BULLET_CABBAGE: effectName = "CabbageSplat"; break;
-		case BulletType::BULLET_BUTTER: effectName = "ButterSplat"; break;
-		default: break;
-		}
-		if (effectName) g_particleSystem->EmitEffect(effectName, position);
+		g_particleSystem->EmitEffect(BulletHitEffectId(mBulletType), position);
 	}
 	Die();
 }
@@ -645,47 +667,15 @@ void Bullet::BulletHitZombie(Zombie* zombie)
 		zombie->ApplyButter();
 	}
 
-	if (mBulletType == BulletType::BULLET_SNOWPEA) {
-		if (canBeChilled) {
-			if (playChillSound) {
-				AudioSystem::PlaySound(
-					ResourceKeys::Sounds::SOUND_COOLDOWNZOMBIE, 0.22f);
-			}
-			zombie->SetCooldown(7.5f, bypassShield);
-		}
-		if (g_particleSystem) {
-			g_particleSystem->EmitEffect("SnowPeaBulletHit", GetPosition());
-		}
-	}
-	else if (mBulletType == BulletType::BULLET_PUFF) {
-		if (g_particleSystem) {
-			g_particleSystem->EmitEffect("PuffShroomHit", GetPosition());
-		}
-	}
-	else if (mBulletType == BulletType::BULLET_TOXICPEA) {
-		if (g_particleSystem) {
-			g_particleSystem->EmitEffect("ToxicPeaBulletHit", GetPosition());
-		}
-	}
-	else if (mBulletType == BulletType::BULLET_PEA) {
-		if (g_particleSystem) {
-			g_particleSystem->EmitEffect("PeaBulletHit", GetPosition());
-		}
-	}
-	else if (mBulletType == BulletType::BULLET_STAR) {
-		if (g_particleSystem) {
-			g_particleSystem->EmitEffect("StarSplat", GetPosition());
-		}
-	}
-	else if (mBulletType == BulletType::BULLET_CABBAGE) {
-		if (g_particleSystem) {
-			g_particleSystem->EmitEffect("CabbageSplat", GetPosition());
+	if (canBeChilled) {
+		if (playChillSound) {
+			AudioSystem::PlaySound(
+				ResourceKeys::Sounds::SOUND_COOLDOWNZOMBIE, 0.22f);
 		}
+		zombie->SetCooldown(7.5f, bypassShield);
 	}
-	else if (mBulletType == BulletType::BULLET_BUTTER) {
-		if (g_particleSystem) {
-			g_particleSystem->EmitEffect("ButterSplat", GetPosition());
-		}
+	if (g_particleSystem) {
+		g_particleSystem->EmitEffect(BulletHitEffectId(mBulletType), GetPosition());
 	}
 }
 
@@ -769,8 +759,8 @@ void Bullet::HitMelonZombie(Zombie* zombie)
 void Bullet::ConfigurePresentation()
 {
 	mTexture = nullptr;
+	if (mProjectileAnimator) AnimationSystem::GetInstance().Unregister(*mProjectileAnimator);
 	mProjectileAnimator.reset();
-	mAnimatorAdvancedInParallel = false;
 	mScale = 0.9f;
 
 	ResourceManager& resources = ResourceManager::GetInstance();
@@ -871,6 +861,7 @@ void Bullet::ConfigurePresentation()
 			mProjectileAnimator->EnableOverlayEffect(true);
 		}
 		mProjectileAnimator->Play(PlayState::PLAY_REPEAT);
+		if (mInAnimationSystem) AnimationSystem::GetInstance().Register(*mProjectileAnimator, this);
 		break;
 	}
 	default:
@@ -72,8 +72,7 @@ protected:
 	BulletType mPoolType = BulletType::NUM_BULLETS; // 对象池槽位的固定类型；火炬树桩只改变当前表现类型
 	int mHitTorchwoodColumn = -1; // 最近处理过本子弹的火炬树桩列，防止同列反复转换
 	std::unique_ptr<SpikeState> mSpikeState; // 仅尖刺首次接触目标时分配，固定四槽且随池槽复用
-	std::shared_ptr<Animator> mProjectileAnimator;
-	bool mAnimatorAdvancedInParallel = false;
+	std::shared_ptr<Animator> mProjectileAnimator; // 火球等动画弹丸；随表现重建，在 GOM 内时同步登记 AnimationSystem
 
 	// 子弹击中僵尸的效果
 	void BulletHitZombie(Zombie* zombie);
@@ -130,8 +129,9 @@ public:
 
 	void Start() override;
 	void Update() override;
-	void UpdateParallel(std::vector<DeferredEvent>& outBuf) override;
+	void RegisterAnimators(AnimationSystem& system) override;
 	void Draw(Graphics* g) override;
+	void AppendStateHash(StateHashAccumulator& hash) const override;
 	// 由 BulletPool 的全局地面阴影阶段调用，保证阴影绘制在植物层之前。
 	void DrawShadow(Graphics* g);
 	/** 当前类型是否属于会响应台风的轻型植物子弹。 */
@@ -4,6 +4,7 @@
 
 #include "ColliderComponent.h"
 #include "ThreadPool.h"
+#include "StateHash.h"
 #include "../Profiler.h"   // 诊断：sweep 迭代/拒绝计数上报（-Profile 时才累加）
 #include <vector>
 #include <unordered_set>
@@ -16,6 +17,8 @@ class CollisionSystem {
 private:
 	std::vector<ColliderComponent*> colliders;
 	std::unordered_set<uint64_t> currentCollisions;
+	// currentCollisions 的增量哈希：成员 StateHashMix(key) 之和，随插入/删除同步加减，取值 O(1)
+	uint64_t mCollisionSetHash = 0;
 
 	std::unique_ptr<ThreadPool> mThreadPool;
 	static constexpr int PARALLEL_THRESHOLD = 100;
@@ -94,6 +97,7 @@ public:
 			}
 			for (auto key : toRemove) {
 				currentCollisions.erase(key);
+				mCollisionSetHash -= StateHashMix(key);
 			}
 			// 触发碰撞退出回调
 			for (auto* other : colliders) {
@@ -416,6 +420,10 @@ public:
 		return results;
 	}
 
+	/** 当前持续碰撞对集合的顺序无关哈希（增量维护）；供逐帧确定性比对。 */
+	uint64_t GetCollisionSetHash() const { return mCollisionSetHash; }
+	int GetActiveCollisionCount() const { return static_cast<int>(currentCollisions.size()); }
+
 	// 清空所有碰撞体
 	void ClearAll() {
 		for (auto* col : colliders) {
@@ -426,6 +434,7 @@ public:
 		}
 		colliders.clear();
 		currentCollisions.clear();
+		mCollisionSetHash = 0;
 		mNextColliderID = 1;
 	}
 
@@ -513,6 +522,7 @@ private:
 		if (currentCollisions.find(pairKey) == currentCollisions.end()) {
 			HandleCollisionEnter(a, b);
 			currentCollisions.insert(pairKey);
+			mCollisionSetHash += StateHashMix(pairKey);
 		}
 		else {
 			if (a->isTrigger && a->HasTriggerStayCallback()) {
@@ -548,6 +558,7 @@ private:
 			if (itA != idMap.end() && itB != idMap.end())
 				HandleCollisionExit(itA->second, itB->second);
 			currentCollisions.erase(key);
+			mCollisionSetHash -= StateHashMix(key);
 		}
 	}
 };
@@ -0,0 +1,185 @@
+#include "FogCellField.h"
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+
+namespace {
+	constexpr float kBaseFogEdgeAlpha = 200.0f;          // 小雾和普通迷雾最左边缘格的目标 alpha
+	constexpr float kDenseFogEdgeAlpha = 225.0f;         // 大雾最左边缘格的目标 alpha
+	constexpr float kFogInteriorAlpha = 255.0f;          // 雾区内部格的目标 alpha
+	constexpr float kFogFillRate = 180.0f;               // 雾生成或回流时每游戏秒最多增加的 alpha
+	constexpr float kFogClearRate = 320.0f;              // 台风驱散时每游戏秒最多减少的 alpha
+	constexpr int kPlanternLowBackRadius = 1;              // 一档向房屋侧照亮的格数
+	constexpr int kPlanternLowFrontRadius = 2;             // 一档向僵尸来向照亮的格数
+	constexpr int kPlanternLowVerticalRadius = 1;          // 一档向上下照亮的格数
+	constexpr int kPlanternMediumBaseRadiusX = 3;          // 二档原有主体向左右照亮的格数
+	constexpr int kPlanternMediumVerticalRadius = 2;       // 二档向上下照亮的格数
+	constexpr int kPlanternMediumManhattanLimit = 4;       // 二档主体裁去远角时允许的最大横纵格距和
+	constexpr int kPlanternMediumFrontExtension = 4;       // 二档向僵尸来向新增的最远列格距
+	constexpr int kPlanternMediumFrontHalfHeight = 1;      // 二档新增前沿列向上下延伸的格数
+	constexpr int kPlanternHighBaseRadiusX = 4;            // 三档原有主体向左右照亮的格数
+	constexpr int kPlanternHighVerticalRadius = 3;         // 三档向上下照亮的格数
+	constexpr int kPlanternHighManhattanLimit = 6;         // 三档主体裁去远角时允许的最大横纵格距和
+	constexpr int kPlanternHighFrontExtension = 5;         // 三档向僵尸来向新增的最远列格距
+	constexpr int kPlanternHighFrontHalfHeight = 2;        // 三档新增前沿列向上下延伸的格数
+	constexpr float kPlanternHighEdgeIllumination = 0.72f; // 三档最外圈保留的照明比例
+	constexpr int kPlanternGearCount = 4;                  // PlanternGear::OFF..HIGH
+
+	using FogCellField::kPlanternMaskRadius;
+	constexpr int kPlanternMaskSide = kPlanternMaskRadius * 2 + 1;
+	// 三档外圈判定还要看邻格，所以模板须比最远形状格再多一圈
+	static_assert(kPlanternMaskRadius > std::max({ kPlanternLowBackRadius, kPlanternLowFrontRadius,
+		kPlanternLowVerticalRadius, kPlanternMediumBaseRadiusX, kPlanternMediumVerticalRadius,
+		kPlanternMediumFrontExtension, kPlanternHighBaseRadiusX, kPlanternHighVerticalRadius,
+		kPlanternHighFrontExtension }), "路灯花照明模板半径不足以覆盖挡位形状");
+
+	/** 以路灯花为中心的相对格照明比例（0～1），按挡位预计算一次。 */
+	struct PlanternLightMask {
+		std::array<float, kPlanternMaskSide * kPlanternMaskSide> light{};
+
+		float At(int relativeX, int relativeY) const {
+			if (std::abs(relativeX) > kPlanternMaskRadius
+				|| std::abs(relativeY) > kPlanternMaskRadius) return 0.0f;
+			return light[(relativeY + kPlanternMaskRadius) * kPlanternMaskSide
+				+ relativeX + kPlanternMaskRadius];
+		}
+	};
+
+	const PlanternLightMask& GetPlanternLightMask(int gear)
+	{
+		static const std::array<PlanternLightMask, kPlanternGearCount> masks = [] {
+			std::array<PlanternLightMask, kPlanternGearCount> built{};
+			for (int gearIndex = 0; gearIndex < kPlanternGearCount; ++gearIndex) {
+				for (int y = -kPlanternMaskRadius; y <= kPlanternMaskRadius; ++y) {
+					for (int x = -kPlanternMaskRadius; x <= kPlanternMaskRadius; ++x) {
+						built[gearIndex].light[(y + kPlanternMaskRadius) * kPlanternMaskSide
+							+ x + kPlanternMaskRadius]
+							= FogCellField::EvaluatePlanternShape(gearIndex, x, y);
+					}
+				}
+			}
+			return built;
+		}();
+		return masks[gear >= 0 && gear < kPlanternGearCount ? gear : 0];
+	}
+
+	float ColumnTarget(const FogTargetInputs& inputs, int col)
+	{
+		const float visibility = 1.0f - inputs.dispersal;
+		if (col == inputs.leftColumn) {
+			return (inputs.dense ? kDenseFogEdgeAlpha : kBaseFogEdgeAlpha) * visibility;
+		}
+		return col > inputs.leftColumn ? kFogInteriorAlpha * visibility : 0.0f;
+	}
+
+	void StepCell(float& alpha, float target, float deltaTime, bool snapToTarget)
+	{
+		if (snapToTarget) {
+			alpha = target;
+			return;
+		}
+		const float rate = target >= alpha ? kFogFillRate : kFogClearRate;
+		const float maxDelta = rate * deltaTime;
+		alpha += std::clamp(target - alpha, -maxDelta, maxDelta);
+	}
+}
+
+float FogCellField::EvaluatePlanternShape(int gear, int relativeX, int relativeY)
+{
+	const int dx = std::abs(relativeX);
+	const int dy = std::abs(relativeY);
+	switch (gear) {
+	case 1: // LOW
+		return relativeX >= -kPlanternLowBackRadius
+			&& relativeX <= kPlanternLowFrontRadius
+			&& dy <= kPlanternLowVerticalRadius
+			? 1.0f : 0.0f;
+	case 2: // MEDIUM
+		return (dx <= kPlanternMediumBaseRadiusX
+				&& dy <= kPlanternMediumVerticalRadius
+				&& dx + dy <= kPlanternMediumManhattanLimit)
+			|| (relativeX == kPlanternMediumFrontExtension
+				&& dy <= kPlanternMediumFrontHalfHeight)
+			? 1.0f : 0.0f;
+	case 3: { // HIGH
+		const auto isInsideHighShape = [](int x, int y) {
+			const int shapeDx = std::abs(x);
+			const int shapeDy = std::abs(y);
+			return (shapeDx <= kPlanternHighBaseRadiusX
+					&& shapeDy <= kPlanternHighVerticalRadius
+					&& shapeDx + shapeDy <= kPlanternHighManhattanLimit)
+				|| (x == kPlanternHighFrontExtension
+					&& shapeDy <= kPlanternHighFrontHalfHeight);
+		};
+		if (!isInsideHighShape(relativeX, relativeY)) return 0.0f;
+		// 由四邻域识别扩展后轮廓，只有真正最外圈保留薄雾。
+		const bool isOuterEdge = !isInsideHighShape(relativeX - 1, relativeY)
+			|| !isInsideHighShape(relativeX + 1, relativeY)
+			|| !isInsideHighShape(relativeX, relativeY - 1)
+			|| !isInsideHighShape(relativeX, relativeY + 1);
+		return isOuterEdge ? kPlanternHighEdgeIllumination : 1.0f;
+	}
+	default: // OFF
+		return 0.0f;
+	}
+}
+
+float FogCellField::GetPlanternIllumination(int gear, int relativeX, int relativeY)
+{
+	return GetPlanternLightMask(gear).At(relativeX, relativeY);
+}
+
+/** 先按列铺基准雾，再把当前挡位的预计算照明模板合成进去。 */
+void FogCellField::BuildTargets(const FogTargetInputs& inputs, int columns, int rows,
+	std::vector<float>& targets)
+{
+	targets.resize(static_cast<size_t>(columns) * rows);
+	for (int row = 0; row < rows; ++row) {
+		for (int col = 0; col < columns; ++col) {
+			targets[row * columns + col] = ColumnTarget(inputs, col);
+		}
+	}
+
+	// 照明为 0 的格乘 1.0f 不改变目标，只需遍历模板覆盖到的棋盘格
+	if (inputs.planternRow < 0) return;
+	const PlanternLightMask& mask = GetPlanternLightMask(inputs.planternGear);
+	const int rowBegin = std::max(0, inputs.planternRow - kPlanternMaskRadius);
+	const int rowEnd = std::min(rows - 1, inputs.planternRow + kPlanternMaskRadius);
+	const int colBegin = std::max(0, inputs.planternColumn - kPlanternMaskRadius);
+	const int colEnd = std::min(columns - 1, inputs.planternColumn + kPlanternMaskRadius);
+	for (int row = rowBegin; row <= rowEnd; ++row) {
+		for (int col = colBegin; col <= colEnd; ++col) {
+			targets[row * columns + col] *= 1.0f
+				- mask.At(col - inputs.planternColumn, row - inputs.planternRow);
+		}
+	}
+}
+
+int FogCellField::StepTowardTargets(const std::vector<float>& targets, std::vector<float>& alpha,
+	float deltaTime, bool snapToTarget)
+{
+	int unsettled = 0;
+	const size_t count = std::min(targets.size(), alpha.size());
+	for (size_t index = 0; index < count; ++index) {
+		const float target = targets[index];
+		if (alpha[index] == target) continue;
+		StepCell(alpha[index], target, deltaTime, snapToTarget);
+		if (alpha[index] != target) ++unsettled;
+	}
+	return unsettled;
+}
+
+void FogCellField::StepReference(const FogTargetInputs& inputs, int columns, int rows,
+	std::vector<float>& alpha, float deltaTime, bool snapToTarget)
+{
+	alpha.resize(static_cast<size_t>(columns) * rows, 0.0f);
+	const bool lit = inputs.planternRow >= 0;
+	for (int row = 0; row < rows; ++row) {
+		for (int col = 0; col < columns; ++col) {
+			float target = ColumnTarget(inputs, col);
+			target *= 1.0f - (lit ? EvaluatePlanternShape(inputs.planternGear,
+				col - inputs.planternColumn, row - inputs.planternRow) : 0.0f);
+			StepCell(alpha[row * columns + col], target, deltaTime, snapToTarget);
+		}
+	}
+}
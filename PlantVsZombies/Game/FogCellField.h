@@ -0,0 +1,50 @@
+#pragma once
+#ifndef _FOG_CELL_FIELD_H
+#define _FOG_CELL_FIELD_H
+
+#include <vector>
+
+/** 生成逐格目标 alpha 的全部输入；与上次相同则目标表可直接沿用。 */
+struct FogTargetInputs {
+	int leftColumn = 0;
+	float dispersal = 0.0f;
+	bool dense = false;
+	int planternRow = -1;     // -1 = 无可用路灯花照明
+	int planternColumn = -1;
+	int planternGear = 0;     // PlanternGear 的整数值
+
+	bool operator==(const FogTargetInputs& o) const {
+		return leftColumn == o.leftColumn && dispersal == o.dispersal && dense == o.dense
+			&& planternRow == o.planternRow && planternColumn == o.planternColumn
+			&& planternGear == o.planternGear;
+	}
+	bool operator!=(const FogTargetInputs& o) const { return !(*this == o); }
+};
+
+/**
+ * 迷雾关卡逐格 alpha 的纯计算部分：路灯花照明形状、目标表合成与逐帧追赶。
+ *
+ * 不依赖 Board 与渲染，Board 负责收集 FogTargetInputs 并持有各数组；
+ * 增量路径（目标表缓存 + 跳过已就位格）与旧版逐格全量算法都在这里，供对照测试逐帧比较。
+ */
+namespace FogCellField {
+	/** 路灯花照明模板半径：覆盖全部挡位形状的最远相对格。 */
+	constexpr int kPlanternMaskRadius = 6;
+
+	/** 单格照明的原始形状定义（0～1）；gear 为 PlanternGear 的整数值。 */
+	float EvaluatePlanternShape(int gear, int relativeX, int relativeY);
+	/** 按挡位预计算的照明模板查表，结果与 EvaluatePlanternShape 相同。 */
+	float GetPlanternIllumination(int gear, int relativeX, int relativeY);
+
+	/** 按输入整表重算 columns × rows 的目标 alpha。 */
+	void BuildTargets(const FogTargetInputs& inputs, int columns, int rows,
+		std::vector<float>& targets);
+	/** 让 alpha 按填充/消散速率追赶 targets（snapToTarget 时直接对齐），跳过已就位格；返回仍未就位的格数。 */
+	int StepTowardTargets(const std::vector<float>& targets, std::vector<float>& alpha,
+		float deltaTime, bool snapToTarget);
+	/** 增量化之前的逐格全量算法：每格现算目标与路灯花形状，不缓存、不跳过。 */
+	void StepReference(const FogTargetInputs& inputs, int columns, int rows,
+		std::vector<float>& alpha, float deltaTime, bool snapToTarget);
+}
+
+#endif
@@ -27,6 +27,8 @@ enum class ObjectType {
 
 class ShadowComponent;
 class ClickableComponent;
+class AnimationSystem;
+class StateHashAccumulator;
 
 class GameObject {
 public:
@@ -46,6 +48,7 @@ protected:
 	const std::string* mTag = nullptr; // 指向进程期驻留字符串；高数量实体不再各带 32B std::string
 	const std::string* mName = nullptr; // 名称同样驻留；动态格子名仍按内容去重并保持稳定引用
 	int mSortingKey = -1; // 可选的行深度键；普通对象保持 -1，按行残影可在构造期继承来源行
+	bool mInAnimationSystem = false; // GOM 已把本对象的 Animator 登记进 AnimationSystem；运行期新建 Animator 时据此补登记
 
 private:
 	void RegisterColliderIfNeeded();
@@ -107,9 +110,25 @@ public:
 
 	virtual void Update();
 
-	// 阶段二并行：默认空。约定——只做对象本地工作，worker 线程安全；
-	//               遇到 deferred 操作 push 到 outBuf，主线程串行回放。
-	virtual void UpdateParallel(std::vector<DeferredEvent>& outBuf) {}
+	/**
+	 * @brief 把本对象持有的根 Animator 登记到 AnimationSystem，由其在 GOM 阶段 A 集中推进。
+	 * @details 默认无动画。GOM 在对象 Start 后调用一次（冷路径虚调）；移除时由 GOM 整批注销。
+	 */
+	virtual void RegisterAnimators(AnimationSystem& system) {}
+
+	/** @brief GOM 专用：标记进入/离开 AnimationSystem，进入时登记全部根 Animator。 */
+	void EnterAnimationSystem(AnimationSystem& system) {
+		mInAnimationSystem = true;
+		RegisterAnimators(system);
+	}
+	void LeaveAnimationSystem() { mInAnimationSystem = false; }
+
+	/**
+	 * @brief 把决定玩法走向的字段折叠进逐帧状态哈希（-Seed 确定性比对用）。
+	 * @details 默认不参与。Board 按 ObjectType 选分域后调用；覆盖者自行 BeginEntity/EndEntity，
+	 *          因此同为 OBJECT_ZOMBIE 的掉头/焦尸等纯表现对象不覆盖即不计入。
+	 */
+	virtual void AppendStateHash(StateHashAccumulator& hash) const {}
 
 	ObjectType GetObjectType() const { return mObjectType; }
 	int GetRenderOrder() const { return mRenderOrder; }
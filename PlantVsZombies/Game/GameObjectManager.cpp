@@ -1,7 +1,9 @@
 #include "GameObjectManager.h"
 #include "../Logger.h"
 #include "../Profiler.h"
+#include "../DeltaTime.h"
 #include "AnimatedObject.h"
+#include "AnimationSystem.h"
 #include <cstdio>
 #include <unordered_set>
 
@@ -24,6 +26,25 @@ namespace {
 		return LAYER_GAME_PLANT + key * kBattlefieldRowStride
 			+ (layer == LAYER_GAME_ZOMBIE ? SUBORDER_PER_KEY : 0);
 	}
+
+	RenderInterpolation::Pose CurrentPose(const Transform& transform)
+	{
+		const Vector position = transform.GetPosition();
+		return { position.x, position.y, transform.GetScale(), transform.GetRotation() };
+	}
+
+	RenderInterpolation::Pose PreviousPose(const Transform& transform)
+	{
+		const Vector position = transform.GetPreviousPosition();
+		return { position.x, position.y, transform.GetPreviousScale(), transform.GetPreviousRotation() };
+	}
+
+	void WritePose(Transform& transform, const RenderInterpolation::Pose& pose)
+	{
+		transform.SetPosition(pose.x, pose.y);
+		transform.SetScale(pose.scale);
+		transform.SetRotation(pose.rotation);
+	}
 }
 
 GameObjectManager::GameObjectManager() {
@@ -41,6 +62,10 @@ GameObjectManager::GameObjectManager() {
 	mBulletPool->Initialize(300, 600);  // 初始容量 300，警告阈值 600
 }
 
+void GameObjectManager::RegisterObjectAnimators(GameObject& obj) {
+	obj.EnterAnimationSystem(AnimationSystem::GetInstance());
+}
+
 void GameObjectManager::DestroyGameObject(std::shared_ptr<GameObject> obj) {
 	if (obj) {
 		RecycleRenderOrder(obj->GetRenderOrder(), obj->GetLayer(), obj->GetSortingKey());
@@ -69,11 +94,13 @@ void GameObjectManager::DestroyGameObject(GameObject* raw) {
 }
 
 void GameObjectManager::DestroyAllGameObjects() {
+	AnimationSystem::GetInstance().Clear();
 	mBulletPool->Clear();
 
 	for (auto& obj : mGameObjects) {
 		if (obj) {
 			obj->DestroyAttachments();
+			obj->LeaveAnimationSystem();
 		}
 	}
 	mGameObjects.clear();
@@ -117,9 +144,11 @@ void GameObjectManager::Update() {
 			auto obj = mObjectsToRemove[i];
 			if (obj) {
 				obj->DestroyAttachments();
+				obj->LeaveAnimationSystem();
 				toRemove.insert(obj.get());
 			}
 		}
+		AnimationSystem::GetInstance().UnregisterOwners(toRemove);
 		// remove_if 是稳定的：保留剩余元素相对顺序，不破坏按 renderOrder 升序的不变量
 		mGameObjects.erase(
 			std::remove_if(mGameObjects.begin(), mGameObjects.end(),
@@ -136,9 +165,16 @@ void GameObjectManager::Update() {
 		auto obj = mObjectsToAdd[i];
 		mGameObjects.push_back(obj);
 		obj->Start();
+		RegisterObjectAnimators(*obj);
 	}
 	mObjectsToAdd.clear();
 
+	// 插值起点取被呈现那一步的开头：追帧的中间步画面看不到，起点只需跟最后一步对齐。
+	// 新对象此时已入表，起点即其出生位置，不会从原点滑入。
+	if (!DeltaTime::IsIntermediateStep()) {
+		CaptureRenderHistory();
+	}
+
 	// 现有对象
 	{
 		PROFILE_SCOPE("2b.GOM_objUpdateLoop(serial)");
@@ -157,16 +193,13 @@ void GameObjectManager::Update() {
 				mDeferredEventBuffers.resize(numWorkers);
 			for (auto& buf : mDeferredEventBuffers) buf.clear();
 
-			// 阶段 A：并行推进（仅 animator 帧推进 + 事件入队，对象本地）
-			mThreadPool->Dispatch(total, [this, total, numWorkers](int start, int end) {
-				const int chunkSize = (total + numWorkers - 1) / numWorkers;
-				const int slot = (chunkSize > 0) ? (start / chunkSize) : 0;
-				auto& outBuf = mDeferredEventBuffers[slot];
-				for (int i = start; i < end; ++i) {
-					auto* obj = mGameObjects[i].get();
-					if (obj->IsActive()) obj->UpdateParallel(outBuf);
-				}
-				});
+			// 阶段 A：AnimationSystem 在稠密 Animator 数组上并行推进（仅帧推进 + 事件入队），
+			// 不再逐对象虚调；宿主串行 Update 经 ConsumeBatchAdvance 跳过重复推进。
+			{
+				PROFILE_SCOPE("2b.PhaseA_AnimationSystem");
+				AnimationSystem::GetInstance().AdvanceAll(
+					*mThreadPool, numWorkers, mDeferredEventBuffers);
+			}
 
 			// 阶段 B-1：主线程 drain deferred event buffers
 			{
@@ -197,7 +230,52 @@ void GameObjectManager::Update() {
 	}
 }
 
+void GameObjectManager::CaptureRenderHistory() {
+	for (auto& obj : mGameObjects) {
+		if (Transform* transform = obj->GetTransform()) {
+			transform->CapturePrevious();
+		}
+	}
+}
+
+void GameObjectManager::ApplyRenderInterpolation(float alpha) {
+	mInterpolatedTransforms.clear();
+	if (alpha >= 1.0f) return;
+	PROFILE_SCOPE("4.Draw_interpolate(serial)");
+	for (auto& obj : mGameObjects) {
+		// UI 层对象跟随光标等即时输入，插值只会平添一帧延迟
+		if (!obj->IsActive() || obj->GetRenderOrder() >= LAYER_UI) continue;
+		Transform* transform = obj->GetTransform();
+		if (!transform || !transform->HasPrevious()) continue;
+
+		InterpolatedTransform entry{ transform, {} };
+		if (!RenderInterpolation::Interpolate(PreviousPose(*transform), CurrentPose(*transform),
+			alpha, entry.poses)) {
+			continue;
+		}
+		WritePose(*transform, entry.poses.render);
+		mInterpolatedTransforms.push_back(entry);
+	}
+}
+
+void GameObjectManager::RestoreRenderInterpolation() {
+	// 个别 Draw 会顺手改写自身变换（贴附对象对齐宿主等）；被改过的分量保留 Draw 的写入
+	for (const auto& entry : mInterpolatedTransforms) {
+		WritePose(*entry.transform,
+			RenderInterpolation::Restore(entry.poses, CurrentPose(*entry.transform)));
+	}
+	mInterpolatedTransforms.clear();
+}
+
 void GameObjectManager::DrawAll(Graphics* g) {
+	// 逻辑步之间按累加器余量插值：Draw 期间所有读取变换的路径（阴影、碰撞调试框、
+	// 跨对象的位置查询）看到的都是同一份插值状态，绘制后还原为逻辑值
+	ApplyRenderInterpolation(DeltaTime::GetInterpolationAlpha());
+	DrawObjects(g);
+	RestoreRenderInterpolation();
+}
+
+void GameObjectManager::DrawObjects(Graphics* g) {
 	// 按渲染顺序排序（仅在有增删时重新排序）
 	{
 		PROFILE_SCOPE("4.Draw_sort(serial)");
@@ -14,6 +14,7 @@
 #include "ThreadPool.h"
 #include "ObjectPool/BulletPool.h"
 #include "DeferredEvent.h"
+#include "RenderInterpolation.h"
 
 const int SUBORDER_PER_KEY = 1000;  // 每个key最多同时存在的顺序数量
 
@@ -41,9 +42,19 @@ private:
 
 	std::vector<std::vector<DeferredEvent>> mDeferredEventBuffers;  // size = numWorkers，跨帧 capacity 复用
 
+	// 对象进入 mGameObjects 并 Start 后调用：把其根 Animator 登记进 AnimationSystem
+	void RegisterObjectAnimators(GameObject& obj);
+
 	// 对象池
 	std::unique_ptr<BulletPool> mBulletPool;
 
+	// 渲染插值期间被临时改写的变换：记下逻辑值与写入的插值，绘制后原样还原
+	struct InterpolatedTransform {
+		Transform* transform;
+		RenderInterpolation::Entry poses;
+	};
+	std::vector<InterpolatedTransform> mInterpolatedTransforms;  // 跨帧 capacity 复用
+
 public:
 	static GameObjectManager& GetInstance() {
 		static GameObjectManager instance;
@@ -86,6 +97,7 @@ public:
 		mGameObjects.push_back(obj);
 		mSortDirty = true;   // 直接加入 mGameObjects，需要重新排序
 		obj->Start();
+		RegisterObjectAnimators(*obj);
 		return obj;
 	}
 
@@ -121,6 +133,8 @@ public:
 
 	// 获取对象池
 	BulletPool* GetBulletPool() { return mBulletPool.get(); }
+	// 游戏 worker 池；粒子推进在 GOM 更新之前借用它（同一主线程串行调用，不会重入）
+	ThreadPool* GetThreadPool() { return mThreadPool.get(); }
 
 	// 打印对象池统计信息
 	void PrintPoolStats() const;
@@ -139,6 +153,16 @@ public:
 	void RecycleRenderOrder(int renderOrder, RenderLayer layer, int key = -1);
 
 private:
+	// 排序后按串行/并行路径提交全部对象；DrawAll 在其前后包上渲染插值
+	void DrawObjects(Graphics* g);
+
+	// 被呈现的逻辑步开头：把每个空间对象的变换记为插值起点
+	void CaptureRenderHistory();
+	// 绘制前串行把世界层对象的变换改写为插值结果；绘制后串行还原。
+	// 改写发生在并行 record 之外，worker 之间互读位置时看到的是同一份一致的插值状态
+	void ApplyRenderInterpolation(float alpha);
+	void RestoreRenderInterpolation();
+
 	// 只按对象当前 layer/key 分配新绘制号；调用方负责先回收旧号。
 	void AssignNewRenderOrder(GameObject* gameObject, RenderLayer layer);
 
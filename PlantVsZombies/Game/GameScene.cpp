@@ -52,6 +52,16 @@ namespace {
 		return (targetRight - kSeedBankX) / static_cast<float>(texture->width);
 	}
 
+	/** 倍速按钮文字：快进开启时在倍速后追加 ">>倍数"，不限速显示 ">>max"。 */
+	std::string FormatSpeedText(float scale, int turbo)
+	{
+		char buf[32];
+		if (turbo == 1) std::snprintf(buf, sizeof(buf), "x%.1f", scale);
+		else if (turbo == 0) std::snprintf(buf, sizeof(buf), "x%.1f>>max", scale);
+		else std::snprintf(buf, sizeof(buf), "x%.1f>>%d", scale, turbo);
+		return std::string(buf);
+	}
+
 	// 右下角关卡名/轮数显示。
 	// 冒险模式：沿用原左对齐（左端锚点 x=768，阴影 766），不改动既有观感。
 	// 生存模式：右对齐——右端锚点固定，文字越长越向左延伸，避免"第10面旗"等长文本撞到右侧"难度"文字。
@@ -140,6 +150,15 @@ namespace {
 		{ -31.0f, -23.0f, 0.58f },                       // 大雾补层：继续填补前两层剩余缝隙
 	}};
 
+	/** 与 Graphics::DrawTextureInstanced 相同的 RGBA8 打包：四舍五入并钳制到 0..255。 */
+	uint32_t PackTintRGBA8(const glm::vec4& tint)
+	{
+		const auto pack8 = [](float value) {
+			return static_cast<uint32_t>(std::clamp(static_cast<int>(value + 0.5f), 0, 255));
+		};
+		return pack8(tint.r) | (pack8(tint.g) << 8) | (pack8(tint.b) << 16) | (pack8(tint.a) << 24);
+	}
+
 	/** 解析进入关卡的背景；AutoTest 可显式覆盖，以继续验证尚未接入冒险流程的地图。 */
 	Background ResolveEnterBackground(int level)
 	{
@@ -429,9 +448,17 @@ void GameScene::DrawSpacePauseLabel(Graphics* g) const
 		glm::vec4(255.0f, 244.0f, 196.0f, 255.0f), centerX, kSpacePauseLabelY);
 }
 
-/** 绘制当前迷雾关卡的逐格雾场；玩法状态完全来自 Board，UI 继续位于雾层之上。 */
+/**
+ * 绘制当前迷雾关卡的逐格雾场；玩法状态完全来自 Board，UI 继续位于雾层之上。
+ * 实例路径下整层雾（底层、各补层与右缘收边）按原绘制顺序打包成一段 InstanceRecord，
+ * 逐格 alpha 与呼吸相位每帧只在这里求值一次，一次并入实例队列；-NoInstance / OpenGL 逐片 DrawTexture。
+ */
 void GameScene::DrawFog(Graphics* g) const
 {
+	if (GameAPP::mAutoTestMode) {
+		mLastFogQuadCount = 0;
+		mLastFogSubmitCount = 0;
+	}
 	if (!g || !mBoard || !mBoard->SupportsStageFog()) return;
 	static const std::array<std::string, 8> kFogTextureKeys = {
 		ResourceKeys::Textures::IMAGE_FOG_PART_0,
@@ -446,6 +473,39 @@ void GameScene::DrawFog(Graphics* g) const
 	auto& resources = ResourceManager::GetInstance();
 	const int drawRows = mBoard->GetFogDrawRowCount();
 	const int layerCount = mBoard->GetFogLayerCount();
+	const float animationTime = mBoard->GetFogAnimationTime();
+
+	const bool instanced = g->IsInstancePathEnabled();
+	const Affine2D& parent = g->GetCurrentTransform();
+	mFogInstanceScratch.clear();
+	int quadCount = 0;
+	int submitCount = 0;
+	const auto emitTile = [&](const Texture* texture, float x, float y, const glm::vec4& tint) {
+		++quadCount;
+		if (!instanced) {
+			g->DrawTexture(texture, x, y, kFogTileDrawWidth, kFogTileDrawHeight, 0.0f, tint);
+			++submitCount;
+			return;
+		}
+		const Texture* bindTexture = texture->atlasPage ? texture->atlasPage : texture;
+		const uint32_t texSlot = bindTexture->BindingId();
+		if (texSlot == 0) return;
+		const Affine2D m = parent * Affine2D::Rect(x, y, kFogTileDrawWidth, kFogTileDrawHeight);
+		InstanceRecord rec{};
+		rec.tA = m.a;
+		rec.tB = m.b;
+		rec.tC = m.c;
+		rec.tD = m.d;
+		rec.tx = m.tx;
+		rec.ty = m.ty;
+		rec.u0 = texture->aU0;
+		rec.v0 = texture->aV0;
+		rec.u1 = texture->aU1;
+		rec.v1 = texture->aV1;
+		rec.texSlot = texSlot;
+		rec.colorRGBA8 = PackTintRGBA8(tint);
+		mFogInstanceScratch.push_back(rec);
+	};
 
 	for (int row = 0; row < drawRows; ++row) {
 		for (int col = 0; col < mBoard->mColumns; ++col) {
@@ -459,19 +519,17 @@ void GameScene::DrawFog(Graphics* g) const
 				kFogTextureKeys[occlusionVariant], false)) {
 				const glm::vec4 occlusionTint(190.0f, 207.0f, 222.0f,
 					std::clamp(alpha * kFogOcclusionAlphaFactor, 0.0f, 255.0f));
-				g->DrawTexture(occlusionTexture,
+				emitTile(occlusionTexture,
 					position.x + kFogOcclusionOffsetX,
-					position.y + kFogOcclusionOffsetY,
-					kFogTileDrawWidth, kFogTileDrawHeight, 0.0f, occlusionTint);
+					position.y + kFogOcclusionOffsetY, occlusionTint);
 				if (col == mBoard->mColumns - 1) {
 					const int tailVariant = mBoard->GetFogTileVariant(
 						row + 19, col + mBoard->mColumns + 29);
 					if (const Texture* tailTexture = resources.GetTexture(
 						kFogTextureKeys[tailVariant], false)) {
-						g->DrawTexture(tailTexture,
+						emitTile(tailTexture,
 							position.x + kFogOcclusionOffsetX + kFogTailTileOffsetX,
-							position.y + kFogOcclusionOffsetY,
-							kFogTileDrawWidth, kFogTileDrawHeight, 0.0f, occlusionTint);
+							position.y + kFogOcclusionOffsetY, occlusionTint);
 					}
 				}
 			}
@@ -484,15 +542,13 @@ void GameScene::DrawFog(Graphics* g) const
 					kFogTextureKeys[variant], false);
 				if (!texture) continue;
 				const float pulse = 0.96f + 0.04f * std::sin(
-					mBoard->GetFogAnimationTime() * 0.9f
+					animationTime * 0.9f
 						+ static_cast<float>(row) * 0.7f
 						+ static_cast<float>(col) * 0.45f
 						+ static_cast<float>(layerIndex) * 1.35f);
 				const glm::vec4 tint(225.0f, 233.0f, 242.0f,
 					std::clamp(alpha * pulse * layer.alphaFactor, 0.0f, 255.0f));
-				g->DrawTexture(texture,
-					position.x + layer.offsetX, position.y + layer.offsetY,
-					kFogTileDrawWidth, kFogTileDrawHeight, 0.0f, tint);
+				emitTile(texture, position.x + layer.offsetX, position.y + layer.offsetY, tint);
 
 				if (col == mBoard->mColumns - 1) {
 					// 1100px 扩展区使用另一稳定帧收边，避免原版同帧复制造成透明洞重合。
@@ -502,21 +558,152 @@ void GameScene::DrawFog(Graphics* g) const
 					const Texture* tailTexture = resources.GetTexture(
 						kFogTextureKeys[tailVariant], false);
 					if (tailTexture) {
-						g->DrawTexture(tailTexture,
+						emitTile(tailTexture,
 							position.x + layer.offsetX + kFogTailTileOffsetX,
-							position.y + layer.offsetY,
-							kFogTileDrawWidth, kFogTileDrawHeight, 0.0f, tint);
+							position.y + layer.offsetY, tint);
 					}
 				}
 			}
 		}
 	}
+
+	if (instanced && !mFogInstanceScratch.empty()) {
+		// 记 Graphics 实际切出的 draw 数：整层被 chunk 上限切开或落到 worker 录制路径时都不再是 1
+		submitCount += g->AppendInstanceRun(mFogInstanceScratch.data(), mFogInstanceScratch.size(),
+			g->GetBlendMode());
+	}
+	if (GameAPP::mAutoTestMode) {
+		mLastFogQuadCount = quadCount;
+		mLastFogSubmitCount = submitCount;
+	}
+}
+
+/**
+ * 绘制 Board 雨场：雨丝、地面水花与扩散圆圈。实例路径整场雨打包成一段 InstanceRecord
+ * 一次提交；雨丝朝向由层基准角与自身偏角合成，逐条不再求三角函数。-NoInstance / OpenGL 逐条 DrawTexture。
+ */
+void GameScene::DrawRainField(Graphics* g) const
+{
+	if (GameAPP::mAutoTestMode) {
+		mLastRainQuadCount = 0;
+		mLastRainSubmitCount = 0;
+	}
+	if (!g || !mBoard) return;
+	const RainField& field = mBoard->GetRainField();
+	const RainField::Drops& drops = field.GetDrops();
+	const RainField::Splashes& splashes = field.GetSplashes();
+	if (drops.count == 0 && splashes.count == 0) return;
+
+	static const std::array<std::string, RainField::kSplashVariantCount> kSplashTextureKeys = {
+		ResourceKeys::Particles::PARTICLE_RAIN_SPLASH1,
+		ResourceKeys::Particles::PARTICLE_RAIN_SPLASH2,
+		ResourceKeys::Particles::PARTICLE_RAIN_SPLASH3,
+		ResourceKeys::Particles::PARTICLE_RAIN_SPLASH4,
+	};
+	auto& resources = ResourceManager::GetInstance();
+	const Texture* pixel = resources.GetTexture(ResourceKeys::Particles::PARTICLE_WHITEPIXEL, false);
+	const Texture* ripple = resources.GetTexture(ResourceKeys::Particles::PARTICLE_RAIN_CIRCLE, false);
+	std::array<const Texture*, RainField::kSplashVariantCount> splashTextures{};
+	for (int i = 0; i < RainField::kSplashVariantCount; ++i) {
+		splashTextures[i] = resources.GetTexture(kSplashTextureKeys[i], false);
+	}
+
+	const bool instanced = g->IsInstancePathEnabled();
+	const Affine2D& parent = g->GetCurrentTransform();
+	mRainInstanceScratch.clear();
+	int quadCount = 0;
+	int submitCount = 0;
+	const auto emitQuad = [&](const Texture* texture, const Affine2D& local, const glm::vec4& color) {
+		++quadCount;
+		if (!instanced) {
+			// 局部矩阵已含尺寸与旋转：压栈后按单位 quad 绘制
+			g->PushTransform(local);
+			g->DrawTexture(texture, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, color);
+			g->PopTransform();
+			++submitCount;
+			return;
+		}
+		const Texture* bindTexture = texture->atlasPage ? texture->atlasPage : texture;
+		const uint32_t texSlot = bindTexture->BindingId();
+		if (texSlot == 0) return;
+		const Affine2D m = parent * local;
+		InstanceRecord rec{};
+		rec.tA = m.a;
+		rec.tB = m.b;
+		rec.tC = m.c;
+		rec.tD = m.d;
+		rec.tx = m.tx;
+		rec.ty = m.ty;
+		rec.u0 = texture->aU0;
+		rec.v0 = texture->aV0;
+		rec.u1 = texture->aU1;
+		rec.v1 = texture->aV1;
+		rec.texSlot = texSlot;
+		rec.colorRGBA8 = PackTintRGBA8(color);
+		mRainInstanceScratch.push_back(rec);
+	};
+
+	if (pixel) {
+		const float pixelW = static_cast<float>(pixel->width);
+		const float pixelH = static_cast<float>(pixel->height);
+		for (int i = 0; i < drops.count; ++i) {
+			if (drops.alpha[i] <= 0.0f) continue;
+			// cos/sin(基准角 + 偏角) 用和角公式展开；局部矩阵 = 平移到中心 · 旋转 · 以中心为原点的 w×h 矩形
+			const int layer = static_cast<int>(drops.layer[i]);
+			const float baseCos = field.GetLayerCos(layer);
+			const float baseSin = field.GetLayerSin(layer);
+			const float cs = baseCos * drops.jitterCos[i] - baseSin * drops.jitterSin[i];
+			const float sn = baseSin * drops.jitterCos[i] + baseCos * drops.jitterSin[i];
+			const float w = pixelW * drops.width[i];
+			const float h = pixelH * drops.height[i];
+			Affine2D local;
+			local.a = cs * w;
+			local.b = sn * w;
+			local.c = -sn * h;
+			local.d = cs * h;
+			local.tx = drops.posX[i] - (local.a + local.c) * 0.5f;
+			local.ty = drops.posY[i] - (local.b + local.d) * 0.5f;
+			emitQuad(pixel, local,
+				glm::vec4(drops.colorR[i], drops.colorG[i], drops.colorB[i], drops.alpha[i]));
+		}
+	}
+	for (int i = 0; i < splashes.count; ++i) {
+		const Texture* splash = splashTextures[splashes.variant[i]];
+		if (splash && splashes.splashAlpha[i] > 0.0f) {
+			const float w = static_cast<float>(splash->width) * splashes.splashScale[i];
+			const float h = static_cast<float>(splash->height) * splashes.splashScale[i];
+			const float tint = splashes.splashBrightness[i];
+			emitQuad(splash, Affine2D::Rect(splashes.posX[i] - w * 0.5f, splashes.posY[i] - h * 0.5f, w, h),
+				glm::vec4(tint * 0.65f, tint * 0.85f, tint, splashes.splashAlpha[i]));
+		}
+		if (ripple && splashes.rippleAlpha[i] > 0.0f) {
+			const float w = static_cast<float>(ripple->width) * splashes.rippleScale[i];
+			const float h = static_cast<float>(ripple->height) * splashes.rippleScale[i];
+			const float tint = splashes.rippleBrightness[i];
+			emitQuad(ripple, Affine2D::Rect(splashes.posX[i] - w * 0.5f, splashes.posY[i] - h * 0.5f, w, h),
+				glm::vec4(tint * 0.58f, tint * 0.80f, tint, splashes.rippleAlpha[i]));
+		}
+	}
+
+	if (instanced && !mRainInstanceScratch.empty()) {
+		submitCount += g->AppendInstanceRun(mRainInstanceScratch.data(), mRainInstanceScratch.size(),
+			g->GetBlendMode());
+	}
+	if (GameAPP::mAutoTestMode) {
+		mLastRainQuadCount = quadCount;
+		mLastRainSubmitCount = submitCount;
+	}
 }
 
 void GameScene::DrawWorldOverlay(Graphics* g)
 {
 	if (!g || !mBoard) return;
-	// 雾先遮住战场与世界粒子，随后再统一接受雨天暗幕；闪电最后照亮雾层但仍不覆盖 UI。
+	// 雨丝紧接世界粒子绘制（原先即为世界层特效）；雾再遮住战场、粒子与雨，随后统一接受雨天暗幕；
+	// 闪电最后照亮雾层但仍不覆盖 UI。
+	{
+		PROFILE_SCOPE("8b0.Draw_rainField");
+		DrawRainField(g);
+	}
 	{
 		PROFILE_SCOPE("8b1.Draw_fog");
 		DrawFog(g);
@@ -1445,9 +1632,7 @@ void GameScene::OnEnter() {
 	auto button2 = mUIManager.CreateButton(Vector(990, 45), Vector(125 * 0.9f, 52 * 0.9f));
 	mSpeedSettingsButton = button2;
 	auto formatSpeedText = [](float scale) {
-		char buf[16];
-		std::snprintf(buf, sizeof(buf), "x%.1f", scale);
-		return std::string(buf);
+		return FormatSpeedText(scale, DeltaTime::GetTurbo());
 		};
 	button2->SetText(formatSpeedText(DeltaTime::GetSelectedTimeScale()));
 	button2->SetAsCheckbox(false);
@@ -1689,9 +1874,7 @@ void GameScene::Update() {
 
 	// 暂停时显示待恢复倍速，非暂停时显示实际倍速；两种状态都可由同一按钮更新。
 	if (auto btn = mSpeedSettingsButton.lock()) {
-		char buf[16];
-		std::snprintf(buf, sizeof(buf), "x%.1f", DeltaTime::GetSelectedTimeScale());
-		btn->SetText(buf);
+		btn->SetText(FormatSpeedText(DeltaTime::GetSelectedTimeScale(), DeltaTime::GetTurbo()));
 	}
 
 	if (mBoard && !mReadyToRestart && !mReadyToBackMenu)
@@ -1741,6 +1924,12 @@ void GameScene::Update() {
 			}
 		}
 
+		// F 键循环快进：关 → 2× → 4× → 8× → 不限速 → 关（只加每帧步数，不改单步 dt）
+		if (input.IsKeyPressed(SDLK_f)) {
+			const int turbo = DeltaTime::GetTurbo();
+			DeltaTime::SetTurbo(turbo == 1 ? 2 : turbo == 2 ? 4 : turbo == 4 ? 8 : turbo == 8 ? 0 : 1);
+		}
+
 		if (!devConsumedEsc && input.IsKeyPressed(SDLK_SPACE)) {
 			ToggleSpacePause();
 		}
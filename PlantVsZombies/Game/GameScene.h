@@ -5,6 +5,7 @@
 #include "BoardPresentation.h"
 #include "../Game/Board.h"
 #include "Perk/PerkType.h"
+#include "../Graphics.h"
 #include <cstdint>
 #include <unordered_map>
 #include <utility>
@@ -179,6 +180,12 @@ public:
 	RainIntensity GetFailedForecastRainIntensity() const { return mFailedForecastRainIntensity; }
 	RainIntensity GetActualForecastRainIntensity() const { return mActualForecastRainIntensity; }
 	int GetPoolEffectCounter() const { return mPoolEffectCounter; }
+	/** 仅 -AutoTest：上一帧雾层的贴片数与实际提交次数（实例路径整层 1 次，否则逐片）。 */
+	int GetLastFogQuadCountForTesting() const { return mLastFogQuadCount; }
+	int GetLastFogSubmitCountForTesting() const { return mLastFogSubmitCount; }
+	/** 仅 -AutoTest：上一帧雨场（雨丝 + 水花 + 圆圈）的贴片数与实际提交次数。 */
+	int GetLastRainQuadCountForTesting() const { return mLastRainQuadCount; }
+	int GetLastRainSubmitCountForTesting() const { return mLastRainSubmitCount; }
 	bool IsSpacePauseActiveForTesting() const { return mSpacePauseActive; }
 	bool IsPauseMenuOpenForTesting() const { return mOpenMenu; }
 	/** 返回当前屋脊督军及底部血条的纯派生展示状态。 */
@@ -223,6 +230,7 @@ private:
 	void DrawCobCannonTarget(Graphics* g) const;
 	void UpdateWeatherUi(float deltaTime);
 	void DrawFog(Graphics* g) const;
+	void DrawRainField(Graphics* g) const;
 	void DrawWeatherPanel(Graphics* g) const;
 	void DrawWeatherForecastFailure(Graphics* g) const;
 	void DrawLightningStrike(Graphics* g) const;
@@ -329,6 +337,12 @@ private:
 	// 平时不触碰相机，避免与开场动画的 SetCameraPosition(camX,0) 打架）
 	bool mShakeCameraApplied = false;
 	int mPoolEffectCounter = 0;        // 原版水面按 Update 递增的动画相位；不受游戏倍速影响
+	mutable std::vector<InstanceRecord> mFogInstanceScratch; // 雾层整层实例记录；跨帧复用容量
+	mutable int mLastFogQuadCount = 0;     // 仅 -AutoTest：上一帧雾层贴片数
+	mutable int mLastFogSubmitCount = 0;   // 仅 -AutoTest：上一帧雾层提交给 Graphics 的次数
+	mutable std::vector<InstanceRecord> mRainInstanceScratch; // 雨场整场实例记录；跨帧复用容量
+	mutable int mLastRainQuadCount = 0;    // 仅 -AutoTest：上一帧雨场贴片数
+	mutable int mLastRainSubmitCount = 0;  // 仅 -AutoTest：上一帧雨场提交给 Graphics 的次数
 
 	void OpenMenu();
 	void OpenRestartMenu();
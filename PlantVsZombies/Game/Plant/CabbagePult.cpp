@@ -5,6 +5,7 @@
 #include "../Bullet/Bullet.h"
 #include "../Zombie/Zombie.h"
 #include "../ShadowComponent.h"
+#include "../../Reanimation/TrackNames.h"
 
 #include <algorithm>
 #include <limits>
@@ -44,7 +45,7 @@ void CabbagePult::SetupPlant()
 	}
 
 	mAnimator->AddFrameEvent(kFireFrame, [this]() {
-		if (GetCurrentTrackName() == "anim_shooting") FireCabbage();
+		if (IsPlayingTrack(Tracks().shooting)) FireCabbage();
 	}, true);
 }
 
@@ -5,6 +5,7 @@
 #include "../Board.h"
 #include "../Bullet/Bullet.h"
 #include "../Zombie/Zombie.h"
+#include "../../Reanimation/TrackNames.h"
 
 #include <algorithm>
 
@@ -29,12 +30,12 @@ void Cactus::SetupPlant()
 	if (mIsPreview || !mAnimator) return;
 
 	mAnimator->AddFrameEvent(kGroundShootEventFrame, [this]() {
-		if (mPhase == Phase::LOW && GetCurrentTrackName() == "anim_shooting") {
+		if (mPhase == Phase::LOW && IsPlayingTrack(Tracks().shooting)) {
 			ShootSpike(false);
 		}
 	}, true);
 	mAnimator->AddFrameEvent(kFlyingShootEventFrame, [this]() {
-		if (mPhase == Phase::HIGH && GetCurrentTrackName() == "anim_shootinghigh") {
+		if (mPhase == Phase::HIGH && IsPlayingTrack(Tracks().shootingHigh)) {
 			ShootSpike(true);
 		}
 	}, true);
@@ -66,21 +67,20 @@ void Cactus::LoadExtraData(const nlohmann::json& j)
 void Cactus::PlantUpdate()
 {
 	UpdateTargetCache();
-	const std::string& track = GetCurrentTrackName();
 	const float attackSpeed = GetAttackSpeedMultiplier();
 	mShootTimer += DeltaTime::GetDeltaTime() * attackSpeed;
 
 	// 一次性伸缩轨结束后才提交稳定姿态，避免中途索敌抖动反复抢占动画。
-	if (mPhase == Phase::RISING && track == "anim_idlehigh") {
+	if (mPhase == Phase::RISING && IsPlayingTrack(Tracks().idleHigh)) {
 		mPhase = Phase::HIGH;
 		mShootTimer = kShootIntervalSeconds;
 		mAttackCheckTimer = kTargetCheckIntervalSeconds;
 	}
-	else if (mPhase == Phase::LOWERING && track == "anim_idle") {
+	else if (mPhase == Phase::LOWERING && IsPlayingTrack(Tracks().idle)) {
 		mPhase = Phase::LOW;
 	}
 
-	if (track == "anim_shooting" || track == "anim_shootinghigh"
+	if (IsPlayingTrack(Tracks().shooting) || IsPlayingTrack(Tracks().shootingHigh)
 		|| mPhase == Phase::RISING || mPhase == Phase::LOWERING) {
 		return;
 	}
@@ -89,12 +89,12 @@ void Cactus::PlantUpdate()
 	if (mPhase == Phase::LOW && mHasFlyingTarget) {
 		mPhase = Phase::RISING;
 		AudioSystem::PlaySound(ResourceKeys::Sounds::SOUND_PLANTGROW, kPlantGrowVolume);
-		PlayTrackOnce("anim_rise", "anim_idlehigh", 0.0f, kTransitionBlendSeconds);
+		PlayTrackOnce(Tracks().rise, Tracks().idleHigh, 0.0f, kTransitionBlendSeconds);
 		return;
 	}
 	if (mPhase == Phase::HIGH && !mHasFlyingTarget) {
 		mPhase = Phase::LOWERING;
-		PlayTrackOnce("anim_lower", "anim_idle", 0.0f, kTransitionBlendSeconds);
+		PlayTrackOnce(Tracks().lower, Tracks().idle, 0.0f, kTransitionBlendSeconds);
 		return;
 	}
 
@@ -110,11 +110,11 @@ void Cactus::PlantUpdate()
 
 	mShootTimer = 0.0f;
 	if (mPhase == Phase::HIGH) {
-		PlayTrackOnce("anim_shootinghigh", "anim_idlehigh",
+		PlayTrackOnce(Tracks().shootingHigh, Tracks().idleHigh,
 			kShootClipSpeed * attackSpeed, kTransitionBlendSeconds);
 	}
 	else {
-		PlayTrackOnce("anim_shooting", "anim_idle",
+		PlayTrackOnce(Tracks().shooting, Tracks().idle,
 			kShootClipSpeed * attackSpeed, kTransitionBlendSeconds);
 	}
 }
@@ -1,10 +1,11 @@
 #include "CherryBomb.h"
 #include "../Board.h"
+#include "../../Reanimation/TrackNames.h"
 
 void CherryBomb::SetupPlant()
 {
 	if (mIsPreview) return;
-	this->PlayTrack("anim_explode", GameRandom::Range(0.34f, 0.45f), 0);
+	this->PlayTrack(Tracks().explode, GameRandom::Range(0.34f, 0.45f), 0);
 	mAnimator->AddFrameEvent(13, [this]() {
 		Explode();
 		});
@@ -18,7 +19,7 @@ void CherryBomb::TakeDamage(int /*damage*/, DamageSource /*source*/)
 
 void CherryBomb::ResolveGargantuarSmash()
 {
-	if (GetCurrentTrackName() == "anim_explode") {
+	if (IsPlayingTrack(Tracks().explode)) {
 		Explode();
 		return;
 	}
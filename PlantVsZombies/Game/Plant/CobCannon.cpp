@@ -4,6 +4,7 @@
 #include "../Bullet/Bullet.h"
 #include "../ShadowComponent.h"
 #include "../../ResourceKeys.h"
+#include "../../Reanimation/TrackNames.h"
 
 #include <algorithm>
 
@@ -34,35 +35,34 @@ void CobCannon::SetupPlant()
 	if (!mAnimator) return;
 	mAnimator->AddFrameEvent(kLaunchFrame, [this]() {
 		if (mPhase == Phase::FIRING
-			&& GetCurrentTrackName() == "anim_shooting") LaunchCob();
+			&& IsPlayingTrack(Tracks().shooting)) LaunchCob();
 	}, true);
 
 	if (mIsPreview) {
 		mPhase = Phase::READY;
 		mArmingTime = 0.0f;
-		PlayTrack("anim_idle", 1.0f);
+		PlayTrack(Tracks().idle, 1.0f);
 		return;
 	}
 	mPhase = Phase::ARMING;
 	mArmingTime = kInitialArmingSeconds;
 	mShotLaunched = false;
-	PlayTrack("anim_unarmed_idle", 1.0f);
+	PlayTrack(Tracks().unarmedIdle, 1.0f);
 }
 
 void CobCannon::PlantUpdate()
 {
 	if (!mAnimator || mIsPreview) return;
-	const std::string track = GetCurrentTrackName();
 	if (mPhase == Phase::ARMING) {
 		mArmingTime = std::max(0.0f, mArmingTime - GetWeatherActionDeltaTime());
 		if (mArmingTime <= 0.0f) BeginCharge();
 		return;
 	}
-	if (mPhase == Phase::CHARGING && track == "anim_idle") {
+	if (mPhase == Phase::CHARGING && IsPlayingTrack(Tracks().idle)) {
 		mPhase = Phase::READY;
 		return;
 	}
-	if (mPhase == Phase::FIRING && track == "anim_unarmed_idle") {
+	if (mPhase == Phase::FIRING && IsPlayingTrack(Tracks().unarmedIdle)) {
 		mPhase = Phase::ARMING;
 		mArmingTime = kReloadArmingSeconds;
 		mPendingTargetRow = -1;
@@ -74,7 +74,7 @@ void CobCannon::BeginCharge()
 	mPhase = Phase::CHARGING;
 	const float speed = (kChargeFramesPerSecond / kReanimationFramesPerSecond)
 		* GetWeatherActionSpeedMultiplier();
-	PlayTrackOnce("anim_charge", "anim_idle", speed,
+	PlayTrackOnce(Tracks().charge, Tracks().idle, speed,
 		kTrackBlendSeconds, speed, kTrackBlendSeconds);
 	AudioSystem::PlaySound(ResourceKeys::Sounds::SOUND_SHOOP, kShoopVolume);
 }
@@ -89,7 +89,7 @@ bool CobCannon::FireAt(const Vector& target, int targetRow)
 	mPhase = Phase::FIRING;
 	const float speed = (kShootingFramesPerSecond / kReanimationFramesPerSecond)
 		* GetWeatherActionSpeedMultiplier();
-	if (PlayTrackOnce("anim_shooting", "anim_unarmed_idle", speed,
+	if (PlayTrackOnce(Tracks().shooting, Tracks().unarmedIdle, speed,
 		kTrackBlendSeconds, speed, kTrackBlendSeconds)) {
 		return true;
 	}
@@ -140,19 +140,18 @@ void CobCannon::LoadExtraData(const nlohmann::json& j)
 	mPendingTargetRow = j.value("targetRow", -1);
 	mShotLaunched = j.value("shotLaunched", false);
 
-	const std::string track = GetCurrentTrackName();
 	if (mPhase == Phase::CHARGING
-		&& track != "anim_charge" && track != "anim_idle") {
+		&& !IsPlayingTrack(Tracks().charge) && !IsPlayingTrack(Tracks().idle)) {
 		BeginCharge();
 	}
-	else if (mPhase == Phase::READY && track != "anim_idle") {
-		PlayTrack("anim_idle", 1.0f);
+	else if (mPhase == Phase::READY && !IsPlayingTrack(Tracks().idle)) {
+		PlayTrack(Tracks().idle, 1.0f);
 	}
 	else if (mPhase == Phase::FIRING
-		&& track != "anim_shooting" && track != "anim_unarmed_idle") {
+		&& !IsPlayingTrack(Tracks().shooting) && !IsPlayingTrack(Tracks().unarmedIdle)) {
 		mPhase = Phase::ARMING;
 		mArmingTime = kReloadArmingSeconds;
 		mShotLaunched = false;
-		PlayTrack("anim_unarmed_idle", 1.0f);
+		PlayTrack(Tracks().unarmedIdle, 1.0f);
 	}
 }
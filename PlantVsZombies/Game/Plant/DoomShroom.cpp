@@ -2,6 +2,7 @@
 #include "../Crater.h"
 #include "../AudioSystem.h"
 #include "../ShadowComponent.h"
+#include "../../Reanimation/TrackNames.h"
 #include <vector>
 
 void DoomShroom::SetupPlant()
@@ -36,7 +37,7 @@ void DoomShroom::OnWakeUp()
 void DoomShroom::StartCharging()
 {
 	AudioSystem::PlaySound(ResourceKeys::Sounds::SOUND_REVERSE_EXPLOSION, 0.5f);
-	PlayTrack("anim_explode", 23.0f / 12.0f, 0.0f);
+	PlayTrack(Tracks().explode, 23.0f / 12.0f, 0.0f);
 }
 
 void DoomShroom::TakeDamage(int damage, DamageSource source)
@@ -51,7 +52,7 @@ void DoomShroom::TakeDamage(int damage, DamageSource source)
 
 void DoomShroom::ResolveGargantuarSmash()
 {
-	if (!mIsSleeping && GetCurrentTrackName() == "anim_explode") {
+	if (!mIsSleeping && IsPlayingTrack(Tracks().explode)) {
 		Explode();
 		return;
 	}
@@ -3,6 +3,7 @@
 
 #include "../Board.h"
 #include "../Zombie/Zombie.h"
+#include "../../Reanimation/TrackNames.h"
 
 #include <algorithm>
 
@@ -22,6 +23,16 @@ namespace {
 	}
 }
 
+const TrackHandle& GoldMagnet::GetShootingTrack() const
+{
+	return Tracks().attract;
+}
+
+const TrackHandle& GoldMagnet::GetChargingTrack() const
+{
+	return Tracks().idle;
+}
+
 void GoldMagnet::SetSleepState(bool)
 {
 	MagnetShroom::SetSleepState(false);
@@ -17,8 +17,8 @@ public:
 
 protected:
 	float GetRechargeSeconds() const override;
-	const char* GetShootingTrackName() const override { return "anim_attract"; }
-	const char* GetChargingTrackName() const override { return "anim_idle"; }
+	const TrackHandle& GetShootingTrack() const override;
+	const TrackHandle& GetChargingTrack() const override;
 	void OnZombieMagneticItemExtracted(
 		const MagneticItem& item, const Vector& targetCenter, int targetRow) override;
 };
@@ -7,6 +7,7 @@
 #include "../Board.h"
 #include "../GameObjectManager.h"
 #include "../Zombie/Zombie.h"
+#include "../../Reanimation/TrackNames.h"
 
 namespace {
 	constexpr int kJalapenoIgniteFrame = 19;        // 主人指定的辣椒本体爆炸全局帧号
@@ -57,7 +58,7 @@ void Jalapeno::SetupPlant()
 	if (mIsPreview) return;
 
 	// 裁剪版 Jalapeno.reanim 的 anim_explode 为全局 7..19；12fps 下正好蓄力 1 秒。
-	PlayTrack("anim_explode", 1.0f);
+	PlayTrack(Tracks().explode, 1.0f);
 	mAnimator->AddFrameEvent(kJalapenoIgniteFrame, [this]() {
 		IgniteRow();
 		});
@@ -71,7 +72,7 @@ void Jalapeno::TakeDamage(int /*damage*/, DamageSource /*source*/)
 
 void Jalapeno::ResolveGargantuarSmash()
 {
-	if (GetCurrentTrackName() == "anim_explode") {
+	if (IsPlayingTrack(Tracks().explode)) {
 		IgniteRow();
 		return;
 	}
@@ -5,6 +5,7 @@
 #include "../Bullet/Bullet.h"
 #include "../Zombie/Zombie.h"
 #include "../ShadowComponent.h"
+#include "../../Reanimation/TrackNames.h"
 
 #include <algorithm>
 #include <limits>
@@ -50,7 +51,7 @@ void KernelPult::SetupPlant()
 	}
 
 	mAnimator->AddFrameEvent(kFireFrame, [this]() {
-		if (GetCurrentTrackName() == "anim_shooting") FireProjectile();
+		if (IsPlayingTrack(Tracks().shooting)) FireProjectile();
 	}, true);
 }
 
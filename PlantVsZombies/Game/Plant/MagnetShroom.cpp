@@ -8,6 +8,7 @@
 #include "../../Graphics.h"
 #include "../../ResourceKeys.h"
 #include "../../ResourceManager.h"
+#include "../../Reanimation/TrackNames.h"
 
 #include <algorithm>
 #include <cmath>
@@ -40,6 +41,16 @@ namespace {
 	}
 }
 
+const TrackHandle& MagnetShroom::GetShootingTrack() const
+{
+	return Tracks().shooting;
+}
+
+const TrackHandle& MagnetShroom::GetChargingTrack() const
+{
+	return Tracks().nonactiveIdle2;
+}
+
 const char* MagnetShroom::GetPhaseName() const
 {
 	switch (mPhase) {
@@ -83,7 +94,7 @@ void MagnetShroom::PlantUpdate()
 	mRechargeTime = std::max(0.0f, mRechargeTime
 		- DeltaTime::GetDeltaTime() * GetAttackSpeedMultiplier());
 	if (mPhase == Phase::SUCKING
-		&& GetCurrentTrackName() == GetChargingTrackName()) {
+		&& IsPlayingTrack(GetChargingTrack())) {
 		mPhase = Phase::CHARGING;
 	}
 	if (mPhase == Phase::CHARGING && mRechargeTime <= 0.0f) {
@@ -160,7 +171,7 @@ void MagnetShroom::BeginMagnetizing(MagneticItem item)
 	mHasCapturedItem = true;
 	mCapturedItem = std::move(item);
 	const float attackSpeed = GetAttackSpeedMultiplier();
-	PlayTrackOnce(GetShootingTrackName(), GetChargingTrackName(),
+	PlayTrackOnce(GetShootingTrack(), GetChargingTrack(),
 		kShootingFps / kReanimationFps * attackSpeed, 0.0f,
 		kChargingFps / kReanimationFps * attackSpeed, 0.0f);
 	AudioSystem::PlaySound(ResourceKeys::Sounds::SOUND_MAGNETSHROOM,
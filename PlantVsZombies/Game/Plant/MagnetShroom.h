@@ -39,8 +39,8 @@ protected:
 	void PlantUpdate() override;
 	/** 返回从成功吸取当帧开始计算的总充能秒数。 */
 	virtual float GetRechargeSeconds() const;
-	virtual const char* GetShootingTrackName() const { return "anim_shooting"; }
-	virtual const char* GetChargingTrackName() const { return "anim_nonactive_idle2"; }
+	virtual const TrackHandle& GetShootingTrack() const;
+	virtual const TrackHandle& GetChargingTrack() const;
 	/** 僵尸装备已原子剥离且由植物接管后触发；场景扶梯不调用。 */
 	virtual void OnZombieMagneticItemExtracted(
 		const MagneticItem&, const Vector&, int) {}
@@ -2,9 +2,11 @@
 #include "../Board.h"
 #include "../Zombie/Zombie.h"
 #include "../GameObjectManager.h"
+#include "../AnimationSystem.h"
 #include "../ShadowComponent.h"
 #include "GameDataManager.h"
 #include "PlantFootprint.h"
+#include "../StateHash.h"
 #include "../../GameApp.h"	// GameAPP::mShowPlantHP / Graphics / DrawText
 #include "../../Logger.h"
 #include <cmath>
@@ -117,22 +119,36 @@ void Plant::Start()
 	this->SetupPlant();
 }
 
+void Plant::AppendStateHash(StateHashAccumulator& hash) const
+{
+	const Transform* transform = GetTransform();
+	const Vector position = transform ? transform->GetPosition() : Vector::zero();
+	hash.BeginEntity(static_cast<uint64_t>(mPlantType));
+	hash.Add(mPlantID, mRow * 256 + mColumn);
+	hash.Add(mPlantHealth, mPlantMaxHealth);
+	hash.Add(position.x, position.y);
+	hash.Add(mEaterCount, (mIsSleeping ? 1 : 0) | (mIsSquished ? 2 : 0) | (mIsPreview ? 4 : 0));
+	hash.Add(mWakeUpTimer, mShutdownTimer);
+	hash.EndEntity();
+}
+
 /**
- * 通用停机和径流暂停必须在并行动画推进前判断；否则射击帧事件会先入队，随后串行阶段再停工已经太晚。
- * mAdvancedInParallel 仍置位，让串行 AnimatedObject::Update 只完成公共收尾而不补推进一遍动画。
+ * 通用停机和径流暂停必须在批量动画推进前判断；否则射击帧事件会先入队，随后串行阶段再停工已经太晚。
+ * 门控跳过时串行 Plant::Update 仍置位 mSkipAnimatorAdvance，只完成公共收尾而不补推进一遍动画。
  */
-void Plant::UpdateParallel(std::vector<DeferredEvent>& outBuf)
+void Plant::RegisterAnimators(AnimationSystem& system)
 {
-	if (IsActionPaused()) {
-		mAdvancedInParallel = true;
-		return;
-	}
-	AnimatedObject::UpdateParallel(outBuf);
+	if (mAnimator) system.Register(*mAnimator, this, &Plant::CanAdvanceAnimation);
 	if (mSleepIndicatorAnimator) {
-		mSleepIndicatorAnimator->UpdateParallelDeferred(outBuf);
+		system.Register(*mSleepIndicatorAnimator, this, &Plant::CanAdvanceAnimation);
 	}
 }
 
+bool Plant::CanAdvanceAnimation(const GameObject* owner)
+{
+	return !static_cast<const Plant*>(owner)->IsActionPaused();
+}
+
 void Plant::TakeDamage(int damage, DamageSource source) {
 	if (mIsPreview || mIsSquished || IsBungeeTargeted()) return;
 	// 僵尸增伤只放大僵尸来源；植物韧性则对所有实际承伤生效。两者均在 0 层返回单位元。
@@ -185,11 +201,11 @@ void Plant::Update()
 {
 	const bool actionPaused = IsActionPaused();
 	// 串行回退路径也直接跳过 Animator 推进；不要 Pause/Play，否则一次性轨道会被公共结束检查误判。
-	if (actionPaused) mAdvancedInParallel = true;
-	const bool animatedInParallel = mAdvancedInParallel;
+	if (actionPaused) mSkipAnimatorAdvance = true;
 	AnimatedObject::Update();   // 非冲刷时待机动画照常推进，让植物在选卡阶段仍"活着"
-	if (mSleepIndicatorAnimator && !animatedInParallel) {
-		mSleepIndicatorAnimator->Update();
+	if (mSleepIndicatorAnimator) {
+		const bool batchAdvanced = mSleepIndicatorAnimator->ConsumeBatchAdvance();
+		if (!actionPaused && !batchAdvanced) mSleepIndicatorAnimator->Update();
 	}
 	if (mIsSquished) {
 		if (!mIsPreview && mBoard && mBoard->mBoardState == BoardState::GAME) {
@@ -384,6 +400,7 @@ void Plant::RestoreSleepState(bool sleep, float wakeUpTimeRemaining)
 void Plant::SyncSleepIndicator()
 {
 	if (!mIsSleeping || mIsPreview || mIsSquished) {
+		if (mSleepIndicatorAnimator) AnimationSystem::GetInstance().Unregister(*mSleepIndicatorAnimator);
 		mSleepIndicatorAnimator.reset();
 		return;
 	}
@@ -408,6 +425,10 @@ void Plant::SyncSleepIndicator()
 		kSleepIndicatorMinFps / kSleepIndicatorReanimFps,
 		kSleepIndicatorMaxFps / kSleepIndicatorReanimFps));
 	mSleepIndicatorAnimator->Play(PlayState::PLAY_REPEAT);
+	if (mInAnimationSystem) {
+		AnimationSystem::GetInstance().Register(
+			*mSleepIndicatorAnimator, this, &Plant::CanAdvanceAnimation);
+	}
 }
 
 void Plant::DrawSleepIndicator(Graphics* g)
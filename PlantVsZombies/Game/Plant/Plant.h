@@ -70,10 +70,11 @@ public:
 
 	~Plant() = default;
 	void Start() override;
-	/** 并行动画阶段也遵守通用停机与屋顶径流暂停，避免帧事件先于串行行为守卫触发。 */
-	void UpdateParallel(std::vector<DeferredEvent>& outBuf) override;
+	/** 本体与睡眠标识都带停机门控登记，批量推进阶段也遵守通用停机与屋顶径流暂停。 */
+	void RegisterAnimators(AnimationSystem& system) override;
 	void Update() override;
 	void Draw(Graphics* g) override;	// 重写以叠加血量显示
+	void AppendStateHash(StateHashAccumulator& hash) const override;
 	Vector GetVisualPosition() const override;
 
 	int GetSortingKey() const override { return this->mRow; }
@@ -229,6 +230,8 @@ protected:
 	void UpdateWakeUp();
 	/** 返回是否应冻结本帧植物动画与行为；通用停机和环境冲刷共用。 */
 	bool IsActionPaused() const;
+	/** AnimationSystem 门控：停机时批量推进跳过，避免帧事件先于串行行为守卫入队。 */
+	static bool CanAdvanceAnimation(const GameObject* owner);
 	/** 按当前唤醒倒计时重建蘑菇纵向弹性表现；读档与逐帧更新共用。 */
 	void ApplyWakeUpPresentation();
 	/** 按权威睡眠状态创建或移除独立 Z Animator；读档只重建表现，不保存随机相位。 */
@@ -1,6 +1,7 @@
 #include "ScaredyShroom.h"
 #include "../Bullet/Bullet.h"
 #include "../ShadowComponent.h"
+#include "../../Reanimation/TrackNames.h"
 
 namespace {
 	constexpr float kTargetCheckIntervalSeconds = 0.1f; // 本行索敌缓存刷新间隔（秒），须短于精英最快射击间隔
@@ -36,33 +37,33 @@ void ScaredyShroom::PlantUpdate()
 {
 	// 吐弹帧之前不进害怕流程，避免把本发孢子拦腰打断；帧事件已经结算后立即允许受惊。
 	// 不能守卫整段 anim_shooting：精英在 0.2s 档会连续重启该轨道，从而永久免疫害怕。
-	const std::string curTrack = GetCurrentTrackName();
-	if (mShotPending && curTrack != "anim_shooting") {
+	const bool shooting = IsPlayingTrack(Tracks().shooting);
+	if (mShotPending && !shooting) {
 		// 理论上第 25 帧会先清掉 pending；若动画被外部切轨，则放开下一轮重试，避免永久哑火。
 		mShotPending = false;
 	}
-	if (curTrack != "anim_shooting" || !mShotPending) {
+	if (!shooting || !mShotPending) {
 		const bool scared = HasZombieNearby();
 		switch (mFearState) {
 		case FearState::READY:
 			if (scared) {
 				OnFearStarted();
 				mFearState = FearState::LOWERING;
-				PlayTrackOnce("anim_scared", "anim_scaredidle", 0.0f, 0.2f);
+				PlayTrackOnce(Tracks().scared, Tracks().scaredIdle, 0.0f, 0.2f);
 			}
 			break;
 		case FearState::LOWERING:
 			// PlayTrackOnce 播完自动接 anim_scaredidle，以轨道名切换为完成信号
-			if (curTrack == "anim_scaredidle") mFearState = FearState::SCARED;
+			if (IsPlayingTrack(Tracks().scaredIdle)) mFearState = FearState::SCARED;
 			break;
 		case FearState::SCARED:
 			if (!scared) {
 				mFearState = FearState::RAISING;
-				PlayTrackOnce("anim_grow", "anim_idle", 0.0f, 0.2f);
+				PlayTrackOnce(Tracks().grow, Tracks().idle, 0.0f, 0.2f);
 			}
 			break;
 		case FearState::RAISING:
-			if (curTrack == "anim_idle") mFearState = FearState::READY;
+			if (IsPlayingTrack(Tracks().idle)) mFearState = FearState::READY;
 			break;
 		}
 	}
@@ -86,7 +87,7 @@ void ScaredyShroom::PlantUpdate()
 		{
 			mShootTimer = 0;
 			// pending 保护保证下一轮不能在吐弹帧之前重播；高速阶段允许吐弹后立即从前摇重启。
-			mShotPending = PlayTrackOnce("anim_shooting", "anim_idle",
+			mShotPending = PlayTrackOnce(Tracks().shooting, Tracks().idle,
 				GetShootAnimationSpeed(mult), 0.2f);
 		}
 	}
@@ -157,6 +158,15 @@ bool ScaredyShroom::HasZombieNearby()
 	return found;
 }
 
+void ScaredyShroom::LoadExtraData(const nlohmann::json& j)
+{
+	mShootTimer = j.value("shootTimer", 1.0f);
+	int state = j.value("fearState", 0);
+	if (state < 0 || state > static_cast<int>(FearState::RAISING)) state = 0;
+	mFearState = static_cast<FearState>(state);
+	mShotPending = IsPlayingTrack(Tracks().shooting);
+}
+
 const char* ScaredyShroom::GetFearStateName() const
 {
 	switch (mFearState) {
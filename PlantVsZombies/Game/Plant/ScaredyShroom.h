@@ -20,13 +20,7 @@ public:
 		j["fearState"] = static_cast<int>(mFearState);
 	}
 
-	void LoadExtraData(const nlohmann::json& j) override {
-		mShootTimer = j.value("shootTimer", 1.0f);
-		int state = j.value("fearState", 0);
-		if (state < 0 || state > static_cast<int>(FearState::RAISING)) state = 0;
-		mFearState = static_cast<FearState>(state);
-		mShotPending = GetCurrentTrackName() == "anim_shooting";
-	}
+	void LoadExtraData(const nlohmann::json& j) override;
 
 	void PlantUpdate() override;
 	/** 返回稳定的害怕状态名，供诊断与 AutoTest 验证过渡态收敛。 */
@@ -4,6 +4,7 @@
 #include "../ShadowComponent.h"
 #include "../../DeltaTime.h"
 #include "../../ResourceKeys.h"
+#include "../../Reanimation/TrackNames.h"
 
 #include <algorithm>
 #include <cmath>
@@ -40,7 +41,7 @@ void UmbrellaLeaf::PlantUpdate()
 		}
 	}
 	else if (mDefenseState == AirborneDefenseState::REFLECTING
-		&& GetCurrentTrackName() == "anim_idle") {
+		&& IsPlayingTrack(Tracks().idle)) {
 		mDefenseState = AirborneDefenseState::INACTIVE;
 	}
 }
@@ -64,7 +65,7 @@ AirborneDefenseState UmbrellaLeaf::ActivateAirborneDefense()
 	mDefenseState = AirborneDefenseState::ACTIVATING;
 	mActivationTimer = kActivationSeconds;
 	// anim_block 的 15..29 包装窗完整播放后自动回到 idle；结算只看时间/轨道，不使用帧事件。
-	PlayTrackOnce("anim_block", "anim_idle", kBlockClipSpeed,
+	PlayTrackOnce(Tracks().block, Tracks().idle, kBlockClipSpeed,
 		0.0f, kIdleClipSpeed, 0.0f);
 	AudioSystem::PlaySound(
 		ResourceKeys::Sounds::SOUND_SHOOTER_SHOOT2, kUmbrellaSoundVolume);
@@ -96,7 +97,7 @@ void UmbrellaLeaf::NormalizeLoadedDefenseState()
 		mDefenseState = AirborneDefenseState::REFLECTING;
 	}
 	if (mDefenseState != AirborneDefenseState::INACTIVE
-		&& GetCurrentTrackName() == "anim_idle") {
+		&& IsPlayingTrack(Tracks().idle)) {
 		mDefenseState = AirborneDefenseState::INACTIVE;
 		mActivationTimer = 0.0f;
 	}
@@ -0,0 +1,374 @@
+#include "RainField.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+	constexpr float kDegToRad = 0.01745329251994329577f;
+	constexpr float kWindResponse = 4.0f;   // 漂移向目标缓动的速率（1/秒），约 0.25 秒完成转向
+
+	/** 单层雨丝参数，数值取自原 Rain*.xml 各发射器；capacity 为 SpawnMaxLaunched，只作上限。 */
+	struct RainLayerSpec {
+		int capacity = 0;
+		float spawnRate = 0.0f;                      // SpawnRate（条/秒），生成节拍同原发射器
+		float lifeMin = 0.0f, lifeMax = 0.0f;
+		float scaleMin = 0.0f, scaleMax = 0.0f;
+		float stretch = 1.0f;
+		float brightnessMin = 1.0f, brightnessMax = 1.0f;
+		float red = 1.0f, green = 1.0f, blue = 1.0f;
+		float alphaPeak = 0.0f, fadeIn = 0.0f;       // 0→peak 的淡入终点（归一化寿命）
+		float alphaHold = 0.0f, fadeOut = 1.0f;      // peak→hold 的保持终点，其后淡出到 0
+		float boxHalfWidth = 0.0f, boxHalfHeight = 0.0f;
+		float windBoxHalfWidth = 0.0f;               // 台风时加宽，给斜吹的雨丝留出入画余量
+		float windOffsetX = 0.0f;                    // 台风时发射盒逆风平移
+		float fallY = 0.0f;                          // 整个寿命内的竖直位移
+		float calmDriftX = 0.0f;                     // 无台风时的横向位移（负值向左）
+		float windDriftX = 0.0f;                     // 台风时的横向位移绝对值
+		float jitterDeg = 0.0f;                      // 相对风向基准角的随机偏角
+	};
+
+	struct RainProfile {
+		std::array<RainLayerSpec, RainField::kLayerCount> layers;
+	};
+
+	constexpr RainProfile kLightRain = { {{
+		{ 192, 80.0f, 0.95f, 1.10f, 0.65f, 0.95f, 16.0f, 0.80f, 1.0f, 0.38f, 0.65f, 1.0f,
+			0.25f, 0.12f, 0.21f, 0.78f, 600.0f, 15.0f, 600.0f, 0.0f,
+			720.0f, -220.0f, 220.0f, 2.0f },
+		{},
+	}} };
+	constexpr RainProfile kMediumRain = { {{
+		{ 160, 60.0f, 0.72f, 0.90f, 0.72f, 1.02f, 19.0f, 0.75f, 1.0f, 0.44f, 0.70f, 1.0f,
+			0.25f, 0.10f, 0.21f, 0.82f, 600.0f, 18.0f, 600.0f, 0.0f,
+			720.0f, -270.0f, 270.0f, 2.5f },
+		{},
+	}} };
+	constexpr RainProfile kHeavyRain = { {{
+		{ 160, 70.0f, 0.55f, 0.70f, 0.75f, 1.05f, 20.0f, 0.78f, 1.0f, 0.50f, 0.76f, 1.0f,
+			0.28f, 0.08f, 0.23f, 0.84f, 600.0f, 20.0f, 700.0f, 100.0f,
+			720.0f, -320.0f, 430.0f, 2.5f },
+		{ 96, 34.0f, 0.38f, 0.50f, 0.85f, 1.15f, 22.0f, 0.82f, 1.0f, 0.58f, 0.82f, 1.0f,
+			0.34f, 0.06f, 0.27f, 0.86f, 620.0f, 25.0f, 720.0f, 100.0f,
+			740.0f, -360.0f, 480.0f, 2.5f },
+	}} };
+	static_assert(kLightRain.layers[0].capacity + kLightRain.layers[1].capacity <= RainField::kMaxDrops,
+		"light rain exceeds drop storage");
+	static_assert(kMediumRain.layers[0].capacity + kMediumRain.layers[1].capacity <= RainField::kMaxDrops,
+		"medium rain exceeds drop storage");
+	static_assert(kHeavyRain.layers[0].capacity + kHeavyRain.layers[1].capacity <= RainField::kMaxDrops,
+		"heavy rain exceeds drop storage");
+
+	const RainProfile* ProfileFor(RainIntensity intensity)
+	{
+		switch (intensity) {
+		case RainIntensity::LIGHT:  return &kLightRain;
+		case RainIntensity::MEDIUM: return &kMediumRain;
+		case RainIntensity::HEAVY:  return &kHeavyRain;
+		case RainIntensity::CLEAR:  break;
+		}
+		return nullptr;
+	}
+
+	/** 雨势没有前景层时，残留的前景雨丝跟随主层参数。 */
+	const RainLayerSpec& LayerOrMain(const RainProfile& profile, int layer)
+	{
+		return profile.layers[layer].capacity > 0 ? profile.layers[layer] : profile.layers[0];
+	}
+
+	float TargetDriftX(const RainLayerSpec& spec, WindDirection direction)
+	{
+		switch (direction) {
+		case WindDirection::TOWARD_HOUSE: return -spec.windDriftX;
+		case WindDirection::TOWARD_FRONT: return spec.windDriftX;
+		case WindDirection::NONE:         break;
+		}
+		return spec.calmDriftX;
+	}
+
+	// RainGroundSplash.xml：水花 0.28 秒、圆圈 0.30 秒，二者同点同刻开始
+	constexpr float kSplashSpriteLifetime = 0.28f;
+	constexpr float kSplashPeakAlpha = 0.65f * 255.0f;
+	constexpr float kSplashHoldAlpha = 0.48f * 255.0f;
+	constexpr float kRipplePeakAlpha = 0.32f * 255.0f;
+	constexpr float kRippleScaleStart = 0.45f;
+	constexpr float kRippleScaleEnd = 1.0f;
+}
+
+RainField::RainField(std::uint32_t seed)
+	: mRngState(seed != 0 ? seed : 1u)
+{
+}
+
+float RainField::NextUnit()
+{
+	mRngState ^= mRngState << 13;
+	mRngState ^= mRngState >> 17;
+	mRngState ^= mRngState << 5;
+	return static_cast<float>(mRngState >> 8) * (1.0f / 16777216.0f);
+}
+
+float RainField::Range(float minValue, float maxValue)
+{
+	return minValue + (maxValue - minValue) * NextUnit();
+}
+
+void RainField::SetOrigin(float x, float y)
+{
+	mOriginX = x;
+	mOriginY = y;
+}
+
+void RainField::SetWeather(RainIntensity intensity, WindDirection direction)
+{
+	const bool startsFromClear = mIntensity == RainIntensity::CLEAR && mDrops.count == 0;
+	if (intensity != mIntensity) {
+		// 新雨势从零开始计时生成；旧雨势在途雨丝保留各自外观自然收尾
+		mSpawnTimer.fill(0.0f);
+	}
+	mIntensity = intensity;
+	mWindDirection = direction;
+	if (startsFromClear) {
+		// 从晴天起雨时漂移直接就位，避免首批雨丝还在"转向"
+		if (const RainProfile* profile = ProfileFor(intensity)) {
+			for (int layer = 0; layer < kLayerCount; ++layer) {
+				const RainLayerSpec& spec = LayerOrMain(*profile, layer);
+				mDriftX[layer] = TargetDriftX(spec, EffectiveWind());
+				mLayerFallY[layer] = spec.fallY;
+			}
+		}
+	}
+}
+
+WindDirection RainField::EffectiveWind() const
+{
+	// 台风只存在于大雨；小/中雨即便残留风向也按无风斜度下落，与原特效选择一致
+	return mIntensity == RainIntensity::HEAVY ? mWindDirection : WindDirection::NONE;
+}
+
+int RainField::GetCapacity() const
+{
+	const RainProfile* profile = ProfileFor(mIntensity);
+	if (!profile) return 0;
+	int capacity = 0;
+	for (const RainLayerSpec& spec : profile->layers) capacity += spec.capacity;
+	return capacity;
+}
+
+void RainField::Clear()
+{
+	mDrops.count = 0;
+	mSplashes.count = 0;
+	mLayerCount.fill(0);
+	mSpawnTimer.fill(0.0f);
+}
+
+void RainField::Update(float deltaTime)
+{
+	if (deltaTime <= 0.0f) return;
+
+	// 风向缓动：层漂移向当前雨势/风向的目标靠拢；晴天保持原值让余雨按原方向落完。
+	// 层基准角只依赖漂移与下落距离（斜率 = 横移/下落），与单条寿命无关，每层每帧算一次
+	const RainProfile* profile = ProfileFor(mIntensity);
+	const float blend = std::min(1.0f, deltaTime * kWindResponse);
+	for (int layer = 0; layer < kLayerCount; ++layer) {
+		if (profile) {
+			const RainLayerSpec& spec = LayerOrMain(*profile, layer);
+			mDriftX[layer] += (TargetDriftX(spec, EffectiveWind()) - mDriftX[layer]) * blend;
+			mLayerFallY[layer] = spec.fallY;
+		}
+		const float angle = std::atan2(-mDriftX[layer], mLayerFallY[layer]);
+		mLayerCos[layer] = std::cos(angle);
+		mLayerSin[layer] = std::sin(angle);
+	}
+
+	SpawnDrops(deltaTime);
+	IntegrateDrops(deltaTime);
+	IntegrateSplashes(deltaTime);
+	CompactDrops();
+	CompactSplashes();
+}
+
+void RainField::SpawnDrops(float deltaTime)
+{
+	const RainProfile* profile = ProfileFor(mIntensity);
+	if (!profile) return;
+	for (int layer = 0; layer < kLayerCount; ++layer) {
+		const RainLayerSpec& spec = profile->layers[layer];
+		if (spec.capacity <= 0) continue;
+		// 与原 ParticleEmitter::UpdateEmission 同一节拍：计时满一个间隔生成一条并清零余量，
+		// 每帧至多一条。60 帧下小/中/大雨稳态约 61/49/51 条，与旧粒子雨密度一致
+		mSpawnTimer[layer] += deltaTime;
+		if (mSpawnTimer[layer] < 1.0f / spec.spawnRate) continue;
+		mSpawnTimer[layer] = 0.0f;
+		if (mLayerCount[layer] < spec.capacity && mDrops.count < kMaxDrops) SpawnDrop(layer);
+	}
+}
+
+void RainField::SpawnDrop(int layer)
+{
+	const RainLayerSpec& spec = ProfileFor(mIntensity)->layers[layer];
+	const WindDirection wind = EffectiveWind();
+	const bool windy = wind != WindDirection::NONE;
+	const float halfWidth = windy ? spec.windBoxHalfWidth : spec.boxHalfWidth;
+	float offsetX = 0.0f;
+	if (windy) {
+		// 发射盒逆风平移：吹向房子时从右侧多补雨，反之从左侧
+		offsetX = wind == WindDirection::TOWARD_HOUSE ? spec.windOffsetX : -spec.windOffsetX;
+	}
+
+	const int i = mDrops.count++;
+	++mLayerCount[layer];
+	const float lifetime = Range(spec.lifeMin, spec.lifeMax);
+	const float scale = Range(spec.scaleMin, spec.scaleMax);
+	const float brightness = Range(spec.brightnessMin, spec.brightnessMax) * 255.0f;
+	const float jitter = Range(-spec.jitterDeg, spec.jitterDeg) * kDegToRad;
+
+	mDrops.posX[i] = mOriginX + offsetX + Range(-halfWidth, halfWidth);
+	mDrops.posY[i] = mOriginY + Range(-spec.boxHalfHeight, spec.boxHalfHeight);
+	mDrops.invLifetime[i] = 1.0f / lifetime;
+	mDrops.velY[i] = spec.fallY / lifetime;
+	mDrops.age[i] = 0.0f;
+	mDrops.layer[i] = static_cast<float>(layer);
+	mDrops.width[i] = scale;
+	mDrops.height[i] = scale * spec.stretch;
+	mDrops.colorR[i] = brightness * spec.red;
+	mDrops.colorG[i] = brightness * spec.green;
+	mDrops.colorB[i] = brightness * spec.blue;
+	mDrops.alphaPeak[i] = spec.alphaPeak * 255.0f;
+	mDrops.alphaHold[i] = spec.alphaHold * 255.0f;
+	mDrops.fadeIn[i] = spec.fadeIn;
+	mDrops.fadeOut[i] = spec.fadeOut;
+	mDrops.jitterCos[i] = std::cos(jitter);
+	mDrops.jitterSin[i] = std::sin(jitter);
+	mDrops.alpha[i] = 0.0f;
+}
+
+void RainField::IntegrateDrops(float deltaTime)
+{
+	const int n = mDrops.count;
+	if (n == 0) return;
+	// 直接按成员数组下标访问：各数组是同一对象的不同成员，编译器可证明互不别名
+	Drops& d = mDrops;
+	const float drift0 = mDriftX[0];
+	const float driftDelta = mDriftX[1] - mDriftX[0];
+
+	// 寿命与位置：横向速度 = 本层当前漂移 / 自身寿命，风向变化即刻作用于在途雨丝
+	for (int i = 0; i < n; ++i) {
+		d.age[i] += deltaTime;
+		d.posX[i] += (drift0 + driftDelta * d.layer[i]) * d.invLifetime[i] * deltaTime;
+		d.posY[i] += d.velY[i] * deltaTime;
+	}
+	// 三段 alpha 曲线：0→peak（淡入）→hold（保持）→0（淡出），三段都算、按 t 选一段
+	for (int i = 0; i < n; ++i) {
+		const float t = std::min(d.age[i] * d.invLifetime[i], 1.0f);
+		const float rise = d.alphaPeak[i] * t / d.fadeIn[i];
+		const float hold = d.alphaPeak[i] + (d.alphaHold[i] - d.alphaPeak[i])
+			* (t - d.fadeIn[i]) / (d.fadeOut[i] - d.fadeIn[i]);
+		const float fall = d.alphaHold[i] * (1.0f - t) / (1.0f - d.fadeOut[i]);
+		d.alpha[i] = t < d.fadeIn[i] ? rise : (t < d.fadeOut[i] ? hold : fall);
+	}
+}
+
+void RainField::IntegrateSplashes(float deltaTime)
+{
+	const int n = mSplashes.count;
+	if (n == 0) return;
+	Splashes& s = mSplashes;
+
+	for (int i = 0; i < n; ++i) {
+		s.age[i] += deltaTime;
+		// 水花：0→.65（8%）→.48（55%）→0
+		const float ts = std::min(s.age[i] * (1.0f / kSplashSpriteLifetime), 1.0f);
+		const float rise = kSplashPeakAlpha * ts * (1.0f / 0.08f);
+		const float hold = kSplashPeakAlpha
+			+ (kSplashHoldAlpha - kSplashPeakAlpha) * (ts - 0.08f) * (1.0f / 0.47f);
+		const float fall = kSplashHoldAlpha * (1.0f - ts) * (1.0f / 0.45f);
+		s.splashAlpha[i] = ts < 0.08f ? rise : (ts < 0.55f ? hold : fall);
+		// 圆圈：0→.32（8%）→0，同时从 0.45 倍放大到原尺寸
+		const float tr = std::min(s.age[i] * (1.0f / kSplashLifetime), 1.0f);
+		const float rippleRise = kRipplePeakAlpha * tr * (1.0f / 0.08f);
+		const float rippleFall = kRipplePeakAlpha * (1.0f - tr) * (1.0f / 0.92f);
+		s.rippleAlpha[i] = tr < 0.08f ? rippleRise : rippleFall;
+		s.rippleScale[i] = kRippleScaleStart + (kRippleScaleEnd - kRippleScaleStart) * tr;
+	}
+}
+
+void RainField::AddSplash(float x, float y)
+{
+	int i = mSplashes.count;
+	if (i >= kMaxSplashes) {
+		// 满员：顶替最老的水花（它本就最接近淡出）
+		i = static_cast<int>(std::max_element(mSplashes.age.begin(),
+			mSplashes.age.begin() + mSplashes.count) - mSplashes.age.begin());
+	}
+	else {
+		++mSplashes.count;
+	}
+	mSplashes.posX[i] = x;
+	mSplashes.posY[i] = y;
+	mSplashes.age[i] = 0.0f;
+	mSplashes.splashScale[i] = Range(0.65f, 0.90f);
+	mSplashes.splashBrightness[i] = Range(0.80f, 1.0f) * 255.0f;
+	mSplashes.rippleBrightness[i] = Range(0.75f, 0.95f) * 255.0f;
+	mSplashes.variant[i] = std::min(static_cast<int>(NextUnit() * kSplashVariantCount),
+		kSplashVariantCount - 1);
+	mSplashes.splashAlpha[i] = 0.0f;
+	mSplashes.rippleAlpha[i] = 0.0f;
+	mSplashes.rippleScale[i] = kRippleScaleStart;
+}
+
+void RainField::CompactDrops()
+{
+	// 雨丝同贴图同混合，绘制顺序无关：到期者与末尾交换即可
+	int i = 0;
+	while (i < mDrops.count) {
+		if (mDrops.age[i] * mDrops.invLifetime[i] < 1.0f) {
+			++i;
+			continue;
+		}
+		--mLayerCount[static_cast<int>(mDrops.layer[i])];
+		MoveDrop(--mDrops.count, i);
+	}
+}
+
+void RainField::CompactSplashes()
+{
+	int i = 0;
+	while (i < mSplashes.count) {
+		if (mSplashes.age[i] < kSplashLifetime) {
+			++i;
+			continue;
+		}
+		MoveSplash(--mSplashes.count, i);
+	}
+}
+
+void RainField::MoveDrop(int from, int to)
+{
+	if (from == to) return;
+	Drops& d = mDrops;
+	d.posX[to] = d.posX[from];               d.posY[to] = d.posY[from];
+	d.velY[to] = d.velY[from];
+	d.age[to] = d.age[from];                 d.invLifetime[to] = d.invLifetime[from];
+	d.layer[to] = d.layer[from];
+	d.width[to] = d.width[from];             d.height[to] = d.height[from];
+	d.colorR[to] = d.colorR[from];           d.colorG[to] = d.colorG[from];
+	d.colorB[to] = d.colorB[from];
+	d.alphaPeak[to] = d.alphaPeak[from];     d.alphaHold[to] = d.alphaHold[from];
+	d.fadeIn[to] = d.fadeIn[from];           d.fadeOut[to] = d.fadeOut[from];
+	d.jitterCos[to] = d.jitterCos[from];     d.jitterSin[to] = d.jitterSin[from];
+	d.alpha[to] = d.alpha[from];
+}
+
+void RainField::MoveSplash(int from, int to)
+{
+	if (from == to) return;
+	Splashes& s = mSplashes;
+	s.posX[to] = s.posX[from];               s.posY[to] = s.posY[from];
+	s.age[to] = s.age[from];
+	s.splashScale[to] = s.splashScale[from];
+	s.splashBrightness[to] = s.splashBrightness[from];
+	s.rippleBrightness[to] = s.rippleBrightness[from];
+	s.variant[to] = s.variant[from];
+	s.splashAlpha[to] = s.splashAlpha[from]; s.rippleAlpha[to] = s.rippleAlpha[from];
+	s.rippleScale[to] = s.rippleScale[from];
+}
@@ -0,0 +1,114 @@
+#pragma once
+#ifndef _RAIN_FIELD_H
+#define _RAIN_FIELD_H
+
+#include "WeatherTypes.h"
+#include <array>
+#include <cstdint>
+
+/**
+ * Board 天气专用雨场：雨丝与地面水花的 SoA 存储 + 积分，替代按名字发射的通用粒子特效。
+ *
+ * 生成节拍与上限沿用原 Rain*.xml 发射器（SpawnRate、每帧至多一条；SpawnMaxLaunched 为上限，
+ * 小/中/大雨 192/160/160+96 条），存储一次性按上限开好，整场雨不分配。
+ * 风向只是参数：切换后两层雨丝的横向漂移在 ~0.25 秒内缓动到新值，在途雨丝跟着转向，
+ * 不再停旧特效、发新特效。积分与 alpha 曲线逐条连续 float 数组、无分支，/arch:AVX2 下直接向量化。
+ *
+ * 只读自身状态、不碰 GameRandom：雨丝随机量用自带 xorshift，视觉不再扰动玩法随机序列。
+ * 绘制由 GameScene 读取只读数组后打包成一段实例记录。
+ */
+class RainField {
+public:
+	static constexpr int kMaxDrops = 256;
+	static constexpr int kMaxSplashes = 48;
+	static constexpr int kLayerCount = 2;           // 0 = 主雨层；1 = 大雨前景层
+	static constexpr int kSplashVariantCount = 4;   // PARTICLE_RAIN_SPLASH1..4
+	static constexpr float kSplashLifetime = 0.30f; // 扩散圆圈寿命；水花贴图 0.28 秒先收尾
+
+	/** 雨丝 SoA；存活雨丝紧凑占据 [0, count)。颜色已乘亮度与 255，alpha 为 0..255。 */
+	struct Drops {
+		int count = 0;
+		// 运动
+		std::array<float, kMaxDrops> posX, posY;
+		std::array<float, kMaxDrops> velY;
+		std::array<float, kMaxDrops> age, invLifetime;
+		std::array<float, kMaxDrops> layer;          // 0.0 / 1.0，写成 float 以便漂移插值不分支
+		// spawn 采样、整生命周期保持
+		std::array<float, kMaxDrops> width, height;
+		std::array<float, kMaxDrops> colorR, colorG, colorB;
+		std::array<float, kMaxDrops> alphaPeak, alphaHold, fadeIn, fadeOut;
+		std::array<float, kMaxDrops> jitterCos, jitterSin;  // 相对层基准角的随机偏角
+		// 每帧由曲线写入
+		std::array<float, kMaxDrops> alpha;
+	};
+
+	/** 地面水花 SoA：每个落点同时画水花贴图与扩散圆圈。 */
+	struct Splashes {
+		int count = 0;
+		std::array<float, kMaxSplashes> posX, posY;
+		std::array<float, kMaxSplashes> age;
+		std::array<float, kMaxSplashes> splashScale;
+		std::array<float, kMaxSplashes> splashBrightness, rippleBrightness;
+		std::array<int, kMaxSplashes> variant;
+		// 每帧由曲线写入
+		std::array<float, kMaxSplashes> splashAlpha, rippleAlpha, rippleScale;
+	};
+
+	explicit RainField(std::uint32_t seed = 0x2F6B3A1Du);
+
+	/** 雨丝发射盒中心（屏幕上沿外）；只影响之后生成的雨丝。 */
+	void SetOrigin(float x, float y);
+	/** 切换雨势与风向。CLEAR 只停止生成，在途雨丝与水花照常收尾。 */
+	void SetWeather(RainIntensity intensity, WindDirection direction);
+	/** 生成、积分、求 alpha 并剔除到期雨丝与水花；deltaTime<=0 不做任何事。 */
+	void Update(float deltaTime);
+	/** 在 (x, y) 登记一次地面水花；满员时顶替最老的一个。 */
+	void AddSplash(float x, float y);
+	/** 立即清空全部雨丝与水花，雨势/风向参数保留。 */
+	void Clear();
+
+	RainIntensity GetIntensity() const { return mIntensity; }
+	WindDirection GetWindDirection() const { return mWindDirection; }
+	bool IsSpawning() const { return mIntensity != RainIntensity::CLEAR; }
+	/** 当前雨势下雨丝数上限（各层之和）。 */
+	int GetCapacity() const;
+	int GetDropCount() const { return mDrops.count; }
+	int GetSplashCount() const { return mSplashes.count; }
+	/** 指定层当前横向漂移（像素/寿命），负值吹向房子。 */
+	float GetLayerDriftX(int layer) const { return mDriftX[layer]; }
+	/** 指定层基准倾角的 cos/sin；雨丝实际角度 = 基准角 + 自身偏角。 */
+	float GetLayerCos(int layer) const { return mLayerCos[layer]; }
+	float GetLayerSin(int layer) const { return mLayerSin[layer]; }
+
+	const Drops& GetDrops() const { return mDrops; }
+	const Splashes& GetSplashes() const { return mSplashes; }
+
+private:
+	WindDirection EffectiveWind() const;
+	float NextUnit();
+	float Range(float minValue, float maxValue);
+	void SpawnDrops(float deltaTime);
+	void SpawnDrop(int layer);
+	void IntegrateDrops(float deltaTime);
+	void IntegrateSplashes(float deltaTime);
+	void CompactDrops();
+	void CompactSplashes();
+	void MoveDrop(int from, int to);
+	void MoveSplash(int from, int to);
+
+	Drops mDrops;
+	Splashes mSplashes;
+	RainIntensity mIntensity = RainIntensity::CLEAR;
+	WindDirection mWindDirection = WindDirection::NONE;
+	float mOriginX = 0.0f;
+	float mOriginY = 0.0f;
+	std::array<int, kLayerCount> mLayerCount{};
+	std::array<float, kLayerCount> mSpawnTimer{};
+	std::array<float, kLayerCount> mDriftX{};
+	std::array<float, kLayerCount> mLayerFallY{ 720.0f, 720.0f };
+	std::array<float, kLayerCount> mLayerCos{ 1.0f, 1.0f };
+	std::array<float, kLayerCount> mLayerSin{};
+	std::uint32_t mRngState;
+};
+
+#endif
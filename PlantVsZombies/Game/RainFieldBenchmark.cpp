@@ -0,0 +1,172 @@
+#include "RainFieldBenchmark.h"
+#include "RainField.h"
+#include "../ParticleSystem/ParticleSystem.h"
+#include "../GameApp.h"
+#include "../Logger.h"
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+	constexpr float kBenchStep = 1.0f / 60.0f;
+	constexpr float kLegacyRainDuration = 3600.0f;   // 原暴风雨之夜锁定时长
+	constexpr int kWindFlipFrames = 150;             // 超强台风 2.5 秒翻一次风向（比实战更密，放大换向开销）
+	constexpr int kWaveEmitEveryFrames = 2;          // 大波僵尸：每秒约 30 个断肢/掉头/护具特效
+	constexpr float kSplashDelayMin = 0.01f;         // 与 Board 大雨地面水花节奏一致
+	constexpr float kSplashDelayMax = 0.02f;
+
+	enum class RainDriver {
+		NONE,
+		PARTICLES,
+		FIELD,
+	};
+
+	struct FrameStats {
+		double msPerFrame = 0.0;
+		double peakMs = 0.0;
+		double fieldUpdateUs = 0.0;
+		int peakParticles = 0;
+		int peakDrops = 0;
+		int peakSplashes = 0;
+	};
+
+	const char* HeavyRainName(WindDirection direction)
+	{
+		return direction == WindDirection::TOWARD_HOUSE ? "RainHeavyTowardHouse" : "RainHeavyTowardFront";
+	}
+
+	/** 背景特效取全部 Zombie* 配置；没有时退回除雨/风以外的全部配置。 */
+	std::vector<std::string> CollectWaveEffects(const ParticleSystem& system)
+	{
+		const std::vector<std::string> names = system.GetAllEffectNames();
+		std::vector<std::string> wave;
+		for (const std::string& name : names) {
+			if (name.rfind("Zombie", 0) == 0) wave.push_back(name);
+		}
+		if (!wave.empty()) return wave;
+		for (const std::string& name : names) {
+			if (name.rfind("Rain", 0) != 0 && name.rfind("Wind", 0) != 0) wave.push_back(name);
+		}
+		return wave;
+	}
+
+	/**
+	 * 三段共用同一脚本：背景发射、风向翻转与水花落点都由固定种子决定，
+	 * 只有雨的实现不同。返回逐帧统计；粒子数峰值为全系统存活数。
+	 */
+	FrameStats RunStorm(ParticleSystem& system, const std::vector<std::string>& wave,
+		RainDriver driver, int frames, int& waveEffects)
+	{
+		FrameStats stats;
+		system.ClearAll();
+		RainField field;
+		field.SetOrigin(static_cast<float>(SCENE_WIDTH) * 0.5f, -60.0f);
+		std::mt19937 rng(20261019u);
+		std::uniform_real_distribution<float> splashX(100.0f, 900.0f);
+		std::uniform_real_distribution<float> splashY(80.0f, 580.0f);
+		std::uniform_real_distribution<float> splashDelay(kSplashDelayMin, kSplashDelayMax);
+
+		WindDirection wind = WindDirection::TOWARD_HOUSE;
+		float splashTimer = 0.0f;
+		waveEffects = 0;
+		double totalMs = 0.0;
+		double fieldUs = 0.0;
+		using Clock = std::chrono::steady_clock;
+
+		for (int frame = 0; frame < frames; ++frame) {
+			const auto frameStart = Clock::now();
+			if (!wave.empty() && frame % kWaveEmitEveryFrames == 0) {
+				const float x = 250.0f + static_cast<float>((waveEffects * 37) % 650);
+				const float y = 100.0f + static_cast<float>((waveEffects * 53) % 450);
+				system.EmitEffect(wave[waveEffects % wave.size()], Vector(x, y), LAYER_EFFECTS_WORLD);
+				++waveEffects;
+			}
+
+			const bool flip = frame > 0 && frame % kWindFlipFrames == 0;
+			const WindDirection previousWind = wind;
+			if (flip) {
+				wind = wind == WindDirection::TOWARD_HOUSE
+					? WindDirection::TOWARD_FRONT : WindDirection::TOWARD_HOUSE;
+			}
+			splashTimer -= kBenchStep;
+			const bool splash = splashTimer <= 0.0f;
+			Vector splashPos;
+			if (splash) {
+				splashPos = Vector(splashX(rng), splashY(rng));
+				splashTimer = splashDelay(rng);
+			}
+
+			if (driver == RainDriver::PARTICLES) {
+				// 原 Board 路径：换向停旧发新；发射器耗尽即按名补发；每个水花一个特效实例
+				if (flip) system.StopEffect(HeavyRainName(previousWind));
+				if (!system.IsEffectEmitting(HeavyRainName(wind))) {
+					system.EmitEffect(HeavyRainName(wind),
+						Vector(static_cast<float>(SCENE_WIDTH) * 0.5f, -60.0f),
+						LAYER_EFFECTS_WORLD, kLegacyRainDuration);
+				}
+				if (splash) system.EmitEffect("RainGroundSplash", splashPos, LAYER_EFFECTS_WORLD);
+			}
+			else if (driver == RainDriver::FIELD) {
+				const auto fieldStart = Clock::now();
+				field.SetWeather(RainIntensity::HEAVY, wind);
+				if (splash) field.AddSplash(splashPos.x, splashPos.y);
+				field.Update(kBenchStep);
+				fieldUs += std::chrono::duration<double, std::micro>(Clock::now() - fieldStart).count();
+				stats.peakDrops = std::max(stats.peakDrops, field.GetDropCount());
+				stats.peakSplashes = std::max(stats.peakSplashes, field.GetSplashCount());
+			}
+
+			system.Step(kBenchStep, nullptr);
+			const double ms = std::chrono::duration<double, std::milli>(Clock::now() - frameStart).count();
+			totalMs += ms;
+			// 前 2 秒是雨与背景的爬升期，不计峰值
+			if (frame >= 120) stats.peakMs = std::max(stats.peakMs, ms);
+			stats.peakParticles = std::max(stats.peakParticles, system.GetTotalActiveParticleCount());
+		}
+		stats.msPerFrame = frames > 0 ? totalMs / frames : 0.0;
+		stats.fieldUpdateUs = frames > 0 ? fieldUs / frames : 0.0;
+		system.ClearAll();
+		return stats;
+	}
+}
+
+RainFieldBenchResult RunRainFieldBenchmark(ParticleSystem& system, int frames)
+{
+	RainFieldBenchResult result;
+	result.frames = frames;
+	const std::vector<std::string> wave = CollectWaveEffects(system);
+	if (wave.empty()) {
+		LOG_ERROR("RainBench") << "没有已加载的粒子配置，跳过基准";
+		return result;
+	}
+
+	const FrameStats baseline = RunStorm(system, wave, RainDriver::NONE, frames, result.waveEffects);
+	const FrameStats particles = RunStorm(system, wave, RainDriver::PARTICLES, frames, result.waveEffects);
+	const FrameStats field = RunStorm(system, wave, RainDriver::FIELD, frames, result.waveEffects);
+
+	result.baselineMsPerFrame = baseline.msPerFrame;
+	result.particleRainMsPerFrame = particles.msPerFrame;
+	result.particleRainPeakMs = particles.peakMs;
+	result.particleRainPeakParticles = std::max(0, particles.peakParticles - baseline.peakParticles);
+	result.rainFieldMsPerFrame = field.msPerFrame;
+	result.rainFieldPeakMs = field.peakMs;
+	result.rainFieldUpdateUsPerFrame = field.fieldUpdateUs;
+	result.rainFieldPeakDrops = field.peakDrops;
+	result.rainFieldPeakSplashes = field.peakSplashes;
+
+	LOG_WARN("RainBench") << "frames=" << frames << " waveEffects=" << result.waveEffects
+		<< " baseline=" << result.baselineMsPerFrame << "ms/frame peak=" << baseline.peakMs << "ms";
+	LOG_WARN("RainBench") << "particle rain: " << result.particleRainMsPerFrame << "ms/frame"
+		<< " (+" << (result.particleRainMsPerFrame - result.baselineMsPerFrame) << ")"
+		<< " peak=" << result.particleRainPeakMs << "ms"
+		<< " extraParticles(peak)=" << result.particleRainPeakParticles;
+	LOG_WARN("RainBench") << "rain field:    " << result.rainFieldMsPerFrame << "ms/frame"
+		<< " (+" << (result.rainFieldMsPerFrame - result.baselineMsPerFrame) << ")"
+		<< " peak=" << result.rainFieldPeakMs << "ms"
+		<< " update=" << result.rainFieldUpdateUsPerFrame << "us/frame"
+		<< " drops(peak)=" << result.rainFieldPeakDrops
+		<< " splashes(peak)=" << result.rainFieldPeakSplashes;
+	return result;
+}
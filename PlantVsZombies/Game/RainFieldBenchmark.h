@@ -0,0 +1,32 @@
+#pragma once
+#ifndef _RAIN_FIELD_BENCHMARK_H
+#define _RAIN_FIELD_BENCHMARK_H
+
+class ParticleSystem;
+
+struct RainFieldBenchResult {
+	int frames = 0;
+	int waveEffects = 0;                   ///< 背景"大波僵尸"特效发射数（三段相同）
+	double baselineMsPerFrame = 0.0;       ///< 只有僵尸波背景粒子
+	double particleRainMsPerFrame = 0.0;   ///< 背景 + 旧通用粒子雨（按名发射、换向停发重建、水花逐个发特效）
+	double particleRainPeakMs = 0.0;
+	double rainFieldMsPerFrame = 0.0;      ///< 背景 + 专用雨场
+	double rainFieldPeakMs = 0.0;
+	double rainFieldUpdateUsPerFrame = 0.0; ///< 雨场自身 Update 均摊耗时
+	int particleRainPeakParticles = 0;     ///< 旧路径比背景多出的峰值存活粒子
+	int rainFieldPeakDrops = 0;
+	int rainFieldPeakSplashes = 0;
+};
+
+/**
+ * -RainBench：复现暴风雨之夜（锁定大雨 + 超强台风频繁换向 + 每秒 50~100 次地面水花）叠加一大波僵尸
+ * 的特效背景，分别计时"背景""背景 + 旧粒子雨""背景 + 雨场"三段 frames 帧（单线程 Step），
+ * 结果经 LOG_WARN 打印。只测更新，不绘制。需在粒子配置加载完成后调用；结束时清空全部特效。
+ *
+ * 不建 Board：两种雨都不读写僵尸、植物或 GameRandom，真实关卡里其余逐帧更新在三段中完全相同，
+ * 雨的实现只改变 ParticleSystem::Step 与雨场 Update 这两段；这里按 Board 的节奏（风向翻转、
+ * 大雨水花间隔、雨丝发射位置）驱动它们，并用僵尸波特效把粒子池压到实战规模，差值即为换实现的收益。
+ */
+RainFieldBenchResult RunRainFieldBenchmark(ParticleSystem& system, int frames = 3600);
+
+#endif
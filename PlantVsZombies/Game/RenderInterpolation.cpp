@@ -0,0 +1,44 @@
+#include "RenderInterpolation.h"
+#include <cmath>
+
+namespace {
+	constexpr float kPi = 3.14159265358979f;
+}
+
+float RenderInterpolation::LerpAngle(float from, float to, float alpha)
+{
+	float delta = std::fmod(to - from, 2.0f * kPi);
+	if (delta > kPi) delta -= 2.0f * kPi;
+	else if (delta < -kPi) delta += 2.0f * kPi;
+	return from + delta * alpha;
+}
+
+bool RenderInterpolation::Interpolate(const Pose& previous, const Pose& current, float alpha, Entry& entry)
+{
+	if (previous.x == current.x && previous.y == current.y
+		&& previous.scale == current.scale && previous.rotation == current.rotation) {
+		return false;
+	}
+	const float dx = current.x - previous.x;
+	const float dy = current.y - previous.y;
+	if (dx * dx + dy * dy > kMaxInterpolatedDistance * kMaxInterpolatedDistance) return false;
+
+	entry.logic = current;
+	entry.render.x = previous.x + dx * alpha;
+	entry.render.y = previous.y + dy * alpha;
+	entry.render.scale = previous.scale + (current.scale - previous.scale) * alpha;
+	entry.render.rotation = LerpAngle(previous.rotation, current.rotation, alpha);
+	return true;
+}
+
+RenderInterpolation::Pose RenderInterpolation::Restore(const Entry& entry, const Pose& afterDraw)
+{
+	Pose restored = afterDraw;
+	if (afterDraw.x == entry.render.x && afterDraw.y == entry.render.y) {
+		restored.x = entry.logic.x;
+		restored.y = entry.logic.y;
+	}
+	if (afterDraw.scale == entry.render.scale) restored.scale = entry.logic.scale;
+	if (afterDraw.rotation == entry.render.rotation) restored.rotation = entry.logic.rotation;
+	return restored;
+}
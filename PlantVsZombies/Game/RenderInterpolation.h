@@ -0,0 +1,37 @@
+#pragma once
+#ifndef _RENDER_INTERPOLATION_H
+#define _RENDER_INTERPOLATION_H
+
+/**
+ * 逻辑步之间的渲染插值算术：不依赖 Transform/GameObject，GameObjectManager 负责读写变换。
+ *
+ * Draw 前把变换改写为 previous→current 的插值结果，Draw 后按 Restore 还原；
+ * 个别 Draw 会顺手改写自身变换（贴附对象对齐宿主等），被改过的分量保留 Draw 的写入。
+ */
+namespace RenderInterpolation {
+	// 单步位移超过此距离视为瞬移（换行、传送、撑杆落地），不插值，避免画出一帧拖影
+	constexpr float kMaxInterpolatedDistance = 64.0f;
+
+	/** 参与插值的变换分量；rotation 为弧度。 */
+	struct Pose {
+		float x = 0.0f;
+		float y = 0.0f;
+		float scale = 1.0f;
+		float rotation = 0.0f;
+	};
+
+	/** 一次改写：逻辑值与写入的插值结果。 */
+	struct Entry {
+		Pose logic;
+		Pose render;
+	};
+
+	/** 旋转按最短弧插值，跨越 ±π 时不会反向绕一整圈。 */
+	float LerpAngle(float from, float to, float alpha);
+	/** 两端完全相同或位移超过 kMaxInterpolatedDistance 时返回 false，不需要改写。 */
+	bool Interpolate(const Pose& previous, const Pose& current, float alpha, Entry& entry);
+	/** 绘制后应写回的变换：仍等于插值结果的分量回到逻辑值，其余保留 afterDraw。位置的 x/y 作为一个整体判断。 */
+	Pose Restore(const Entry& entry, const Pose& afterDraw);
+}
+
+#endif
@@ -74,7 +74,7 @@ void Scene::Update()
 		PROFILE_SCOPE("1.Particles_Update");
 		if (g_particleSystem)
 		{
-			g_particleSystem->UpdateAll();
+			g_particleSystem->UpdateAll(GameObjectManager::GetInstance().GetThreadPool());
 		}
 	}
 	auto input = &GameAPP::GetInstance().GetInputHandler();
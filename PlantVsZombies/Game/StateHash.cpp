@@ -0,0 +1,22 @@
+#include "StateHash.h"
+#include <initializer_list>
+
+uint64_t BoardStateHash::Combined() const
+{
+	uint64_t hash = StateHashMix(static_cast<uint64_t>(static_cast<uint32_t>(boardFrame)));
+	for (uint64_t part : { board, plants, zombies, bullets, collisions }) {
+		hash = StateHashMix(hash ^ part) + 0x9E3779B97F4A7C15ull;
+	}
+	return hash;
+}
+
+std::string FormatStateHash(uint64_t hash)
+{
+	static constexpr char kDigits[] = "0123456789abcdef";
+	std::string text(16, '0');
+	for (int i = 15; i >= 0; --i) {
+		text[i] = kDigits[hash & 0xF];
+		hash >>= 4;
+	}
+	return text;
+}
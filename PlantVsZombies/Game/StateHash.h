@@ -0,0 +1,91 @@
+#pragma once
+#ifndef _STATE_HASH_H
+#define _STATE_HASH_H
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+/** SplitMix64 终混；状态哈希各处（含碰撞对集合的增量和）统一用它打散。 */
+inline uint64_t StateHashMix(uint64_t z)
+{
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+	return z ^ (z >> 31);
+}
+
+/**
+ * 一类实体的状态哈希：实体内逐字段折叠（一次乘法），实体间按 64 位加法合并。
+ *
+ * 加法合并与遍历顺序无关，GOM 的绘制排序、注册表的哈希桶顺序或并行切块方式都不改变结果；
+ * 实体数也并入终值，避免"两只相同实体"与"零只"在加法下抵消。
+ * 实体内只做乘法折叠（奇数乘子可逆，不同输入序列不会并到同一中间值），雪崩交给 EndEntity 的终混。
+ * float 按位折叠：-Seed 确定性比较要的是逐位一致，不做容差。
+ */
+class StateHashAccumulator {
+public:
+	void BeginEntity(uint64_t kind) { mCurrent = (kind + kSeed) * kMultiplier; }
+
+	void Add(uint64_t value) { mCurrent = (mCurrent ^ value) * kMultiplier; }
+
+	// 两个 32 位字段拼成一次折叠，热路径上实体字段成对写入
+	void Add(int32_t high, int32_t low) {
+		Add((static_cast<uint64_t>(static_cast<uint32_t>(high)) << 32) | static_cast<uint32_t>(low));
+	}
+
+	void Add(float high, float low) { Add(FloatBits(high), FloatBits(low)); }
+
+	void EndEntity() {
+		mSum += StateHashMix(mCurrent);
+		++mCount;
+	}
+
+	// 直接并入一个已打散的成员（碰撞对集合等由外部增量维护的和）
+	void AddSummed(uint64_t sum, int count) {
+		mSum += sum;
+		mCount += count;
+	}
+
+	// 合并另一个 worker 的部分和
+	void Merge(const StateHashAccumulator& other) { AddSummed(other.mSum, other.mCount); }
+
+	uint64_t Value() const { return StateHashMix(mSum ^ StateHashMix(static_cast<uint64_t>(mCount))); }
+	int Count() const { return mCount; }
+
+	static int32_t FloatBits(float value) {
+		int32_t bits;
+		std::memcpy(&bits, &value, sizeof(bits));
+		return bits;
+	}
+
+private:
+	static constexpr uint64_t kSeed = 0x9E3779B97F4A7C15ull;
+	static constexpr uint64_t kMultiplier = 0xFF51AFD7ED558CCDull;
+
+	uint64_t mCurrent = 0;
+	uint64_t mSum = 0;
+	int mCount = 0;
+};
+
+/** Board 在一个逻辑步末的分域哈希；分域便于二分时先定位是哪一类状态先分叉。 */
+struct BoardStateHash {
+	int boardFrame = 0;
+	uint64_t board = 0;
+	uint64_t plants = 0;
+	uint64_t zombies = 0;
+	uint64_t bullets = 0;
+	uint64_t collisions = 0;
+	int plantCount = 0;
+	int zombieCount = 0;
+	int bulletCount = 0;
+	int collisionCount = 0;
+	int workers = 1;          ///< 本次遍历实体用的线程数，只供性能观测，不参与哈希
+
+	/** 按固定顺序合并各分域，得到单个 64 位总哈希。 */
+	uint64_t Combined() const;
+};
+
+/** 16 位小写十六进制，供 AutoTest 断言与逐帧日志比对。 */
+std::string FormatStateHash(uint64_t hash);
+
+#endif
@@ -44,10 +44,32 @@ public:
 		mPosition = position;
 		mScale = 1.0f;
 		mRotation = 0.0f;
+		mHasPrevious = false;   // 复用即瞬移，不能从上一任主人的位置滑过来
 	}
 
+	/** @brief 记录逻辑步开头的变换，作为渲染插值的起点。 */
+	void CapturePrevious() {
+		mPreviousPosition = mPosition;
+		mPreviousScale = mScale;
+		mPreviousRotation = mRotation;
+		mHasPrevious = true;
+	}
+	/** @brief 放弃本步插值（瞬移、换行等不连续移动），下一帧直接画当前变换。 */
+	void BreakInterpolation() { mHasPrevious = false; }
+
+	bool HasPrevious() const { return mHasPrevious; }
+	Vector GetPreviousPosition() const { return mPreviousPosition; }
+	float GetPreviousScale() const { return mPreviousScale; }
+	float GetPreviousRotation() const { return mPreviousRotation; }
+
 private:
 	Vector mPosition = Vector::zero();
 	float mScale = 1.0f;
 	float mRotation = 0.0f; // 世界旋转弧度
+
+	// 渲染插值起点：最近一次被呈现的逻辑步开头的变换
+	Vector mPreviousPosition = Vector::zero();
+	float mPreviousScale = 1.0f;
+	float mPreviousRotation = 0.0f;
+	bool mHasPrevious = false;
 };
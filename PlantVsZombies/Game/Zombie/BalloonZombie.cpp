@@ -5,6 +5,7 @@
 #include "../Board.h"
 #include "../../ParticleSystem/ParticleSystem.h"
 #include "../../ResourceManager.h"
+#include "../../Reanimation/TrackNames.h"
 
 #include <algorithm>
 #include <cstdint>
@@ -92,7 +93,7 @@ void BalloonZombie::Update()
 	// 自身始终按 propeller 轨道基础速度循环。
 	KeepPropellerIndependent();
 	Zombie::Update();
-	if (mIsDying && GetCurrentTrackName() == GetDeathTrackName()
+	if (mIsDying && IsPlayingTrack(GetDeathTrack())
 		&& std::abs(GetClipSpeed() - kDeathClipSpeed) > 0.001f) {
 		SetClipSpeed(kDeathClipSpeed);
 	}
@@ -154,7 +155,7 @@ void BalloonZombie::ZombieMove(float scaledDelta, Transform* transform)
 
 void BalloonZombie::ZombieUpdate(float)
 {
-	if (mPhase == Phase::POPPING && GetCurrentTrackName() == "anim_walk") {
+	if (mPhase == Phase::POPPING && IsPlayingTrack(Tracks().walk)) {
 		FinishLanding();
 	}
 }
@@ -8,6 +8,7 @@
 #include "../../GameApp.h"
 #include "../../ResourceManager.h"
 #include "../../ResourceKeys.h"
+#include "../../Reanimation/TrackNames.h"
 
 #include <algorithm>
 #include <array>
@@ -118,7 +119,7 @@ void BungeeZombie::ZombieUpdate(float scaledTime)
 		if (mPhaseTimer <= 0.0f) BeginGrab();
 		break;
 	case Phase::GRABBING:
-		if (GetCurrentTrackName() == "anim_hold") BeginRise();
+		if (IsPlayingTrack(Tracks().hold)) BeginRise();
 		break;
 	case Phase::RISING:
 		mAltitude += kRiseSpeed * scaledTime;
@@ -216,6 +217,8 @@ void BungeeZombie::ApplySelectedCell(const CellCandidate& candidate)
 	const Vector center = mBoard->GetCellCenterPosition(candidate.row, candidate.column);
 	SetPosition(Vector(center.x,
 		mBoard->GetZombieSpawnY(candidate.row, center.x)));
+	// 从生成点直接落到预订格上空，不插值
+	if (Transform* transform = GetTransform()) transform->BreakInterpolation();
 }
 
 Plant* BungeeZombie::ResolveBungeePlantAt(int row, int column) const
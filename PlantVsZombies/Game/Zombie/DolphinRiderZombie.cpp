@@ -4,6 +4,7 @@
 #include "../Plant/Plant.h"
 #include "../ShadowComponent.h"
 #include "../../ParticleSystem/ParticleSystem.h"
+#include "../../Reanimation/TrackNames.h"
 
 #include <algorithm>
 #include <cmath>
@@ -261,7 +262,7 @@ void DolphinRiderZombie::ZombieUpdate(float)
 			PlayPoolSplashVisual(GetPosition() + Vector(kEntrySplashOffsetX, 0.0f));
 			AudioSystem::PlaySound(ResourceKeys::Sounds::SOUND_ZOMBIE_ENTERING_WATER, 0.4f);
 		}
-		if (GetCurrentTrackName() == "anim_ride") FinishEnteringPool();
+		if (IsPlayingTrack(Tracks().ride)) FinishEnteringPool();
 		return;
 	}
 
@@ -287,9 +288,9 @@ void DolphinRiderZombie::ZombieUpdate(float)
 		PlayPoolSplashVisual(GetPosition() + Vector(kJumpSplashOffsetX, 0.0f));
 		AudioSystem::PlaySound(ResourceKeys::Sounds::SOUND_ZOMBIE_ENTERING_WATER, 0.4f);
 	}
-	const char* returnTrack =
-		mJumpRetainsDolphinOnLanding ? "anim_ride" : "anim_swim";
-	if (GetCurrentTrackName() == returnTrack) FinishJump(false);
+	const TrackHandle& returnTrack =
+		mJumpRetainsDolphinOnLanding ? Tracks().ride : Tracks().swim;
+	if (IsPlayingTrack(returnTrack)) FinishJump(false);
 }
 
 void DolphinRiderZombie::MoveManually(
@@ -11,6 +11,7 @@
 #include "../../ResourceKeys.h"
 #include "../../ResourceManager.h"
 #include "../ShadowComponent.h"
+#include "../../Reanimation/TrackNames.h"
 
 #include <algorithm>
 #include <array>
@@ -131,7 +132,7 @@ void GargantuarZombie::Update()
 			kOneShotVolume);
 		mDeathSoundPlayed = true;
 	}
-	if (mIsDying && GetCurrentTrackName() == "anim_death"
+	if (mIsDying && IsPlayingTrack(Tracks().death)
 		&& std::abs(GetClipSpeed() - kDeathClipSpeed) > 0.001f) {
 		SetClipSpeed(kDeathClipSpeed);
 	}
@@ -505,10 +506,10 @@ void GargantuarZombie::LoadExtraData(const nlohmann::json& j)
 	if (actionCannotContinue && mPhase != Phase::WALKING) {
 		AbortAction(!mIsDying && !mIsDead);
 	}
-	else if (mPhase == Phase::SMASHING && GetCurrentTrackName() != "anim_smash") {
+	else if (mPhase == Phase::SMASHING && !IsPlayingTrack(Tracks().smash)) {
 		AbortAction(true);
 	}
-	else if (mPhase == Phase::THROWING && GetCurrentTrackName() != "anim_throw") {
+	else if (mPhase == Phase::THROWING && !IsPlayingTrack(Tracks().throwing)) {
 		AbortAction(true);
 	}
 	ApplyHeldImpPresentation();
@@ -8,6 +8,7 @@
 #include "../../GameRandom.h"
 #include "../../ResourceKeys.h"
 #include "../../ResourceManager.h"
+#include "../../Reanimation/TrackNames.h"
 
 #include <algorithm>
 #include <cmath>
@@ -253,14 +254,14 @@ void ImpZombie::LoadExtraData(const nlohmann::json& j)
 		mAltitude = 0.0f;
 		mVerticalVelocity = 0.0f;
 	}
-	else if (mPhase == Phase::THROWN && GetCurrentTrackName() != "anim_thrown") {
-		PlayTrack("anim_thrown", kThrownClipSpeed);
+	else if (mPhase == Phase::THROWN && !IsPlayingTrack(Tracks().thrown)) {
+		PlayTrack(Tracks().thrown, kThrownClipSpeed);
 	}
-	else if (mPhase == Phase::LANDING && GetCurrentTrackName() != "anim_land") {
-		PlayTrackOnce("anim_land", "", kLandClipSpeed, 0.0f);
+	else if (mPhase == Phase::LANDING && !IsPlayingTrack(Tracks().land)) {
+		PlayTrackOnce(Tracks().land, TrackHandle(), kLandClipSpeed, 0.0f);
 	}
 	else if (mPhase == Phase::WALKING
-		&& (GetCurrentTrackName() == "anim_thrown" || GetCurrentTrackName() == "anim_land")) {
+		&& (IsPlayingTrack(Tracks().thrown) || IsPlayingTrack(Tracks().land))) {
 		PlayWalkAnimation(0.0f);
 	}
 	ApplyPhasePresentation();
@@ -158,6 +158,8 @@ void Polevaulter::EndJump()
 	JumpMove(kBakedVaultDistance + remainingExtraDistance);
 	mVaultExtraDistanceApplied = targetExtraDistance;
 	mLastVaultDistance = vaultDistance;
+	// 根运动在落地这一步一次性提交，渲染插值不能把身体从起跳点再滑一遍
+	if (Transform* transform = GetTransform()) transform->BreakInterpolation();
 
 	// 切换为走路动画和普通速度：跳跃后永久降速，写入动画 base（而非临时 clip）
 	SetAnimationSpeed(GameRandom::Range(0.9f, 1.7f));
@@ -297,6 +299,7 @@ void Polevaulter::FinishBlockedVault(Plant& blockingPlant)
 			SetPosition(position);
 		}
 	}
+	if (Transform* transform = GetTransform()) transform->BreakInterpolation();
 	mLastVaultDistance = 0.0f;
 	mVaultState = VaultState::WALKING;
 	mHasVaulted = true;
@@ -3,6 +3,7 @@
 #include "../AudioSystem.h"
 #include "../../ResourceKeys.h"
 #include "../../ResourceManager.h"
+#include "../../Reanimation/TrackNames.h"
 
 namespace {
 	constexpr int POOL_LAND_DEATH_FRAME = 216;     // 陆地死亡动画的结束帧
@@ -46,9 +47,9 @@ void PoolNormalZombie::OnStopEating()
 }
 
 /** 掉头流血致死时按当前介质选择对应死亡轨道。 */
-const char* PoolNormalZombie::GetDeathTrackName() const
+const TrackHandle& PoolNormalZombie::GetDeathTrack() const
 {
-	return mInPool ? "anim_waterdeath" : "anim_death";
+	return mInPool ? Tracks().waterDeath : Tracks().death;
 }
 
 /** 水中掉头只更新人物轨道并播放音效，不生成悬浮的陆地碎片。 */
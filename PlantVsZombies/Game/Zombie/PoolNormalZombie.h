@@ -19,7 +19,7 @@ public:
 protected:
 	void SetupZombie() override;
 	void RegisterFrameEvents() override;
-	const char* GetDeathTrackName() const override;
+	const TrackHandle& GetDeathTrack() const override;
 	void PlayWalkAnimation(float blendTime = 0.0f) override;
 	void OnStartEating() override;
 	void OnStopEating() override;
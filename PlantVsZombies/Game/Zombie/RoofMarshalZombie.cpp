@@ -439,6 +439,7 @@ bool RoofMarshalZombie::BeginLaneSwitchTo(int destination)
 	CommitRow(destination);
 	position.y = newTerrainY;
 	transform->SetPosition(position);
+	transform->BreakInterpolation();  // 换行平滑由 mLaneVisualOffsetY 负责，逻辑 Y 的跳变不再插值
 	mLaneVisualOffsetY = oldTerrainY - newTerrainY;
 	mLaneTransitionRemaining = kLaneTransitionDuration;
 	++mLaneSwitchCount;
@@ -8,9 +8,11 @@
 #include "../ShadowComponent.h"
 #include "../GameObjectManager.h"
 #include "../Plant/GameDataManager.h"
+#include "../StateHash.h"
 #include "../../ParticleSystem/ParticleSystem.h"
 #include "../../GameApp.h"
 #include "../../ResourceKeys.h"
+#include "../../Reanimation/TrackNames.h"
 #include <algorithm>
 #include <climits>
 #include <cmath>
@@ -230,6 +232,11 @@ void Zombie::RegisterFrameEvents()
 	mAnimator->AddFrameEvent(171, [this]() { this->EatTarget(); }, true);
 }
 
+const TrackHandle& Zombie::GetDeathTrack() const
+{
+	return Tracks().death;
+}
+
 void Zombie::ApplyHealthMultiplier(double multiplier)
 {
 	if (multiplier <= 0.0 || multiplier == 1.0) return;
@@ -542,6 +549,23 @@ void Zombie::WinGame() const
 	}
 }
 
+void Zombie::AppendStateHash(StateHashAccumulator& hash) const
+{
+	const Transform* transform = GetTransform();
+	const Vector position = transform ? transform->GetPosition() : Vector::zero();
+	const int flags = (mIsEating ? 1 : 0) | (mIsDying ? 2 : 0) | (mIsMindControlled ? 4 : 0)
+		| (mHasHead ? 8 : 0) | (mHasArm ? 16 : 0) | (mInPool ? 32 : 0) | (mIsPreview ? 64 : 0);
+	hash.BeginEntity(0x100u + static_cast<uint64_t>(mZombieType));
+	hash.Add(mZombieID, mRow);
+	hash.Add(mBodyHealth, mHelmHealth);
+	hash.Add(mShieldHealth, flags);
+	hash.Add(position.x, position.y);
+	hash.Add(mSpeed, mFrozenTimer);
+	hash.Add(mCooldownTimer, mButterTimer);
+	hash.Add(mEatPlantID, mEatZombieID);
+	hash.EndEntity();
+}
+
 void Zombie::Update()
 {
 	AnimatedObject::Update();
@@ -590,7 +614,7 @@ void Zombie::Update()
 			if (mButterTimer > 0.0f) ClearButter();
 			if (mParalysisTimer > 0.0f) ClearParalysis();
 			mDyingTimer += deltaTime;
-			if (GetCurrentTrackName() != GetDeathTrackName() && !mDbgAnomalyLogged) {
+			if (!IsPlayingTrack(GetDeathTrack()) && !mDbgAnomalyLogged) {
 				mDbgAnomalyLogged = true;
 			}
 			if (mDyingTimer >= 20.0f)
@@ -752,7 +776,7 @@ void Zombie::Update()
 						mEatZombieID = NULL_ZOMBIE_ID;
 						OnStopEating();
 					}
-					PlayTrack(GetDeathTrackName(), 1.3f, 0.3f);
+					PlayTrack(GetDeathTrack(), 1.3f, 0.3f);
 					if (mCollider) mCollider->mEnabled = false;
 					mIsDying = true;
 				}
@@ -961,6 +985,7 @@ void Zombie::CancelGarlicRedirect(bool stopEating)
 			if (targetY >= 0.0f) {
 				position.y = targetY;
 				transform->SetPosition(position);
+				transform->BreakInterpolation();
 			}
 		}
 	}
@@ -1306,7 +1331,7 @@ void Zombie::TakeHijackerExecution()
 	}
 
 	if (!ShouldPlayDeathAnimation()
-		|| !PlayTrack(GetDeathTrackName(), 1.3f, 0.1f)) {
+		|| !PlayTrack(GetDeathTrack(), 1.3f, 0.1f)) {
 		Die();
 		return;
 	}
@@ -150,6 +150,7 @@ public:
 	void Start() override;
 	void Update() override;
 	void Draw(Graphics* g) override;	// 重写以叠加血量显示
+	void AppendStateHash(StateHashAccumulator& hash) const override;
 	virtual void ZombieUpdate(float scaledTime) {}		// 子类重写Update用这个
 	// source 必填，使植物增伤只作用于植物来源。penetrateShield=true：穿透二类护盾（大喷菇喷雾）——护盾照常受损/掉落，
 	// 但全额伤害继续透到头盔+本体（还原原版 DoRowAreaDamage(20, 2U) 的位标志语义）。
@@ -578,8 +579,8 @@ protected:
 	virtual void SetupZombie();
 	/** 注册当前 reanim 时间轴上的死亡与啃食帧事件；帧布局不同的品种在此替换。 */
 	virtual void RegisterFrameEvents();
-	/** 返回掉头流血结束后应播放的死亡轨道名。 */
-	virtual const char* GetDeathTrackName() const { return "anim_death"; }
+	/** 返回掉头流血结束后应播放的死亡轨道；句柄来自各品种的 static 表，逐帧比较只比指针。 */
+	virtual const TrackHandle& GetDeathTrack() const;
 	/** 当前品种阶段是否播放倒地动画；骑乘载具等阶段可要求直接移除。 */
 	virtual bool ShouldPlayDeathAnimation() const { return true; }
 
@@ -18,12 +18,17 @@
 #include "./Game/AudioSystem.h"
 #include "./DeltaTime.h"
 #include "./ParticleSystem/ParticleSystem.h"
+#include "./ParticleSystem/ParticleBenchmark.h"
+#include "./Renderer/TextCacheBenchmark.h"
+#include "./Game/RainFieldBenchmark.h"
+#include "./LevelSaveBenchmark.h"
 #include "./Game/GameObjectManager.h"
 #include "./Game/CollisionSystem.h"
 #include "./Game/Plant/GameDataManager.h"
 #include "./Game/RenderOrder.h"
 
 #include "./Game/AutoTest/TestDriver.h"
+#include "./Game/AutoTest/Replay.h"
 
 #include "./Game/Zombie/Zombie.h"
 #include "./Game/Plant/Plant.h"
@@ -260,6 +265,8 @@ bool GameAPP::CreateWindowAndRenderer()
 		}
 	}
 
+	m_graphics->SetBatchReorderEnabled(mBatchReorder);
+
 	m_graphics->SetClearColor(0, 0, 0, 255);
 	m_graphics->RecomputeLetterbox();
 	LOG_WARN("Startup") << "Renderer selected=" << pvz::RendererBackendName(m_selectedRenderer);
@@ -426,7 +433,32 @@ int GameAPP::Run()
 	g_particleSystem = std::make_unique<ParticleSystem>(m_graphics.get());
 
 	if (g_particleSystem) {
-		g_particleSystem->LoadXMLConfigs("./resources/particles/config");
+		g_particleSystem->LoadXMLConfigs("./resources/particles/config", "./cache/particle_configs.bin");
+	}
+
+	if (mParticleBench && g_particleSystem) {
+		RunParticleBenchmark(*g_particleSystem, GameObjectManager::GetInstance().GetThreadPool());
+		Shutdown();
+		return 0;
+	}
+
+	if (mTextCacheBench) {
+		pvz::RunTextCacheBenchmark();
+		Shutdown();
+		return 0;
+	}
+
+	if (mRainBench && g_particleSystem) {
+		RunRainFieldBenchmark(*g_particleSystem);
+		Shutdown();
+		return 0;
+	}
+
+	if (mLevelSaveBench) {
+		const LevelSaveBenchResult bench = RunLevelSaveBenchmark("./cache/level_save_bench");
+		LOG_WARN("LevelSaveBench") << LevelSaveBenchToJson(bench).dump();
+		Shutdown();
+		return 0;
 	}
 
 	// 主体与 UI GameObject 之间依次合成世界粒子、天气覆盖层和 Scene UI 贴图。
@@ -469,12 +501,24 @@ int GameAPP::Run()
 	}
 
 	mRunning = true;
+
+	if (ReplayPlayer::GetInstance().IsActive()) {
+		RunReplayPlayback();
+		Shutdown();
+		return 0;
+	}
+
+	auto& recorder = ReplayRecorder::GetInstance();
 	SDL_Event event;
+	using Clock = std::chrono::steady_clock;
+	double lastStepSeconds = 0.0;   // 不限速快进用上一步耗时预测本步是否为本帧最后一步
 
 	while (mRunning && !sceneManager.IsEmpty())
 	{
-		// 固定步长：BeginFrame 折算本渲染帧应执行的逻辑步数（0..3，超出丢债=慢动作退化）
+		// 固定步长：BeginFrame 折算本渲染帧应执行的逻辑步数（0..3，超出丢债=慢动作退化；
+		// 快进时再乘以倍数，不限速时给上限、由下方帧预算截断）
 		const int logicSteps = DeltaTime::BeginFrame();
+		const auto frameStart = Clock::now();
 
 		// 处理事件（每渲染帧至少轮询一次，保证 0 步帧窗口消息也被泵送）
 		auto pollEvents = [&]() {
@@ -492,6 +536,7 @@ int GameAPP::Run()
 						m_graphics->RecomputeLetterbox();
 					}
 				}
+				if (recorder.IsActive()) recorder.RecordEvent(event, *m_graphics);
 				mInputHandler->ProcessEvent(&event);
 			}
 		};
@@ -506,6 +551,15 @@ int GameAPP::Run()
 				// 否则上一步内推送的合成输入（TestDriver key/click 跨步状态机）会与
 				// 其收尾事件挤进下帧同一批 poll，按下沿未被任何逻辑步观察就被改写湮灭
 				if (i > 0) pollEvents();
+				// 只有本帧最后一步会被画出来；之前的中间步跳过粒子推进与一次性音效
+				bool lastStep = (i == logicSteps - 1);
+				if (DeltaTime::IsUnboundedTurbo()) {
+					const double elapsed = std::chrono::duration<double>(Clock::now() - frameStart).count();
+					lastStep = lastStep || elapsed + lastStepSeconds >= DeltaTime::kTurboFrameBudget;
+				}
+				DeltaTime::SetIntermediateStep(!lastStep);
+				const auto stepStart = Clock::now();
+				recorder.BeginStep();
 				DeltaTime::BeginStep();
 				CursorManager::GetInstance().ResetHoverCount();
 				sceneManager.Update();
@@ -515,7 +569,10 @@ int GameAPP::Run()
 				// 逻辑步消费——追帧补 2~3 步时不会把同一次点击种成两棵植物；
 				// 本帧 0 步时边沿保留到下一步，点击不会丢
 				mInputHandler->Update();
+				lastStepSeconds = std::chrono::duration<double>(Clock::now() - stepStart).count();
+				if (lastStep) break;
 			}
+			DeltaTime::SetIntermediateStep(false);
 		}
 
 		// 渲染
@@ -539,12 +596,50 @@ int GameAPP::Run()
 		Profiler::Get().EndFrame();
 	}
 
+	// 尾行要算末步状态哈希，须在 Shutdown 释放场景之前
+	recorder.Close();
+
 	// 清理
 	Shutdown();
 
 	return 0;
 }
 
+void GameAPP::RunReplayPlayback()
+{
+	using Clock = std::chrono::steady_clock;
+	auto& sceneManager = SceneManager::GetInstance();
+	auto& player = ReplayPlayer::GetInstance();
+
+	// 无渲染：隐藏窗口、静音，主循环不再调用 Draw，也不再按墙钟折算步数
+	SDL_HideWindow(mWindow);
+	AudioSystem::SetMasterVolume(0.0f);
+
+	SDL_Event event;
+	while (mRunning && !sceneManager.IsEmpty() && !player.IsFinished())
+	{
+		// 仍需泵送窗口消息；真实键鼠输入不参与回放
+		while (SDL_PollEvent(&event)) {
+			if (event.type == SDL_QUIT) mRunning = false;
+		}
+
+		const auto stepStart = Clock::now();
+		player.BeginStep(*mInputHandler, *m_graphics);
+		DeltaTime::BeginStep();
+		CursorManager::GetInstance().ResetHoverCount();
+		sceneManager.Update();
+		CursorManager::GetInstance().Update();
+		player.ApplyCommands();
+		mInputHandler->Update();
+		player.EndStep(std::chrono::duration<double, std::milli>(Clock::now() - stepStart).count());
+
+		Profiler::Get().EndFrame();
+	}
+
+	player.Finish();
+	mRunning = false;
+}
+
 void GameAPP::Draw()
 {
 	// Phase 3b：Graphics 接管帧生命周期。BeginFrame 负责 acquire+begin+barrier+beginRendering，
@@ -644,6 +739,8 @@ void GameAPP::Shutdown()
 	g_particleSystem.reset();
 
 	SceneManager::GetInstance().ClearCurrentScene();
+	// 退出场景时 OnExit 刚把关卡档排进后台写入队列，等它落盘再继续拆除
+	mGameInfoSaver.FlushPendingSaves();
 
 	// 清理游戏对象和碰撞系统
 	GameObjectManager::GetInstance().ClearAll();
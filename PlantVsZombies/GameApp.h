@@ -98,12 +98,20 @@ private:
 	bool LoadAllResources();
 	void CleanupResources();
 	void Draw();
+	/** -Replay：隐藏窗口、跳过 Draw，逐逻辑步满速重放并计时。 */
+	void RunReplayPlayback();
 	void Shutdown();
 
 public:
 	inline static bool mDebugMode = false;        // 是否是调试模式
 	inline static bool mShowColliders = false;    // 显示碰撞框开关
 	inline static bool mDisableInstancePath = false;  // Task 7: -NoInstance 启动参数禁用 GPU instance path
+	inline static bool mBatchReorder = false;         // -BatchReorder：FlushBatch 前按纹理/混合模式做 z 安全重排
+	inline static bool mParticleBench = false;        // -ParticleBench：加载完成后跑粒子更新基准并直接退出
+	inline static bool mTextCacheBench = false;       // -TextCacheBench：回放生存模式 HUD 文字流，对比新旧文字缓存簿记后退出
+	inline static bool mRainBench = false;            // -RainBench：暴风雨之夜 + 大波僵尸背景下对比旧粒子雨与雨场更新开销后退出
+	inline static bool mLevelSaveBench = false;       // -LevelSaveBench：5000 僵尸合成关卡文档对比 JSON/二进制存读档后退出
+	inline static bool mLevelSaveJson = false;        // -LevelSaveJson：关卡档导出为可读 JSON（调试用），默认写二进制
 	inline static bool mForceVulkan12 = false;        // -Vulkan12：把 instance/device 能力协商限制到 Vulkan 1.2
 	inline static bool mForceLegacyRendering = false; // -VulkanLegacyRendering：屏蔽 dynamic rendering 路径
 	inline static bool mForceLegacySync = false;      // -VulkanLegacySync：屏蔽 synchronization2 路径
@@ -111,6 +119,7 @@ public:
 	inline static bool mTestForceVulkanInitFailure = false; // 显式测试开关，不影响正常玩家启动
 	inline static bool mAutoTestMode = false;         // -AutoTest 自动化测试模式：默认禁存档读写、由 TestDriver 驱动
 	inline static bool mAutoTestLoadSave = false;     // -AutoTestLoadSave：仅允许读取当前关卡存档，所有保存/删除仍短路
+	inline static bool mReplayPlayback = false;       // -Replay 无渲染回放：玩家/关卡存档只读不写不删
 	inline static bool mDevelopMode = false;          // -develop 开发者模式（RSHIFT 键面板）
 	inline static bool mDevNoCooldown = false;        // 开发者作弊：无冷却种植（面板内切换）
 	inline static bool mDevFreePlant = false;         // 开发者作弊：无视阳光种植（面板内切换）
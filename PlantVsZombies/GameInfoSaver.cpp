@@ -1,8 +1,11 @@
 #include "GameInfoSaver.h"
+#include "AsyncSaveWriter.h"
+#include "LevelSaveFormat.h"
 #include "SaveLocation.h"
 #include "SaveMigration.h"
 #include "SaveSchema.h"
 #include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <filesystem>
 #include "GameApp.h"
@@ -129,6 +132,12 @@ namespace {
 		return found && deletedAll;
 	}
 
+	// 关卡档按格式分文件名：正式档为二进制，-LevelSaveJson 导出为可读 JSON；同一关同时只保留一种
+	std::string LevelSaveFileName(int level, bool json) {
+		return "level" + std::to_string(level) + "_data"
+			+ (json ? ".json" : LevelSaveFormat::kBinaryExtension);
+	}
+
 	// ---- Animator 播放状态机的统一存读档 ----------------------------------------
 	// 历史上只持久化 animTrack(当前轨道) + animFrame(当前帧)，读档时一律 PlayTrack(track)。
 	// 但 PlayTrack 会把 mPlayingState 强制写成 PLAY_REPEAT，于是一只正在 PlayTrackOnce 的
@@ -182,7 +191,7 @@ namespace {
 // 命名加 Impl 后缀避免与同名公有方法构成无限递归调用。
 bool GameInfoSaver::SavePlayerInfoImpl()
 {
-	if (GameAPP::mAutoTestMode) return true;   // AutoTest：不碰玩家存档
+	if (GameAPP::mAutoTestMode || GameAPP::mReplayPlayback) return true;   // AutoTest / -Replay：不碰玩家存档
 	auto& gameApp = GameAPP::GetInstance();
 
 	FileManager::CreateDirectory(GetSaveRoot());
@@ -207,8 +216,13 @@ bool GameInfoSaver::SavePlayerInfoImpl()
 	j["musicVolume"] = AudioSystem::GetMusicVolume();
 	j["havecards"] = gameApp.mHaveCards;
 
-	return FileManager::SaveJsonFile(
-		FileManager::CombinePath(GetSaveRoot(), "PlayerInfo.json"), j);
+	// 玩家档很小，同步写；同样走临时文件 + 改名，写入中断不会截断旧档
+	std::string error;
+	if (!WriteFileAtomic(FileManager::CombinePath(GetSaveRoot(), "PlayerInfo.json"), j.dump(4), error)) {
+		LOG_ERROR("GameInfoSaver") << error;
+		return false;
+	}
+	return true;
 }
 
 bool GameInfoSaver::LoadPlayerInfoImpl()
@@ -257,14 +271,13 @@ bool GameInfoSaver::LoadPlayerInfoImpl()
 	return true;
 }
 
-bool GameInfoSaver::SerializeLevelDataToPath(Board* board, CardSlotManager* manager,
-	const std::string& filename)
+bool GameInfoSaver::BuildLevelDocument(Board* board, CardSlotManager* manager, nlohmann::json& j)
 {
 	const bool stateOk = (board->mBoardState == BoardState::GAME) ||
 		(board->mIsSurvival && board->mBoardState == BoardState::CHOOSE_CARD);
 	if (!stateOk) return false;
 
-	nlohmann::json j;
+	j = nlohmann::json::object();
 	j["schemaVersion"] = SaveSchema::kCurrentLevelVersion;
 
 	// Board 状态
@@ -292,6 +305,7 @@ bool GameInfoSaver::SerializeLevelDataToPath(Board* board, CardSlotManager* mana
 	j["poolSunCountDown"] = board->mPoolSunCountDown;
 	j["currentWave"] = board->mCurrentWave;
 	j["boardFrame"] = board->mBoardFrame;   // 舞王全队齐舞的节拍源，读档保节拍连续
+	j["logicStep"] = board->mLogicStep;     // 并行随机流帧键，读档后接着取新键
 	j["iceTrails"] = nlohmann::json::array();
 	for (int row = 0; row < board->mRows
 		&& row < static_cast<int>(board->mIceTimer.size()); ++row) {
@@ -649,34 +663,162 @@ bool GameInfoSaver::SerializeLevelDataToPath(Board* board, CardSlotManager* mana
 		j["survivalCardCooldowns"] = cooldownArr;
 	}
 
-	return FileManager::SaveJsonFile(filename, j);
+	return true;
+}
+
+bool GameInfoSaver::SerializeLevelDataToPath(Board* board, CardSlotManager* manager,
+	const std::string& filename)
+{
+	nlohmann::json j;
+	if (!BuildLevelDocument(board, manager, j)) return false;
+	// .json 路径（AutoTest 快照、-LevelSaveJson 导出）保留可读文本；其余写二进制容器
+	const bool json = std::filesystem::u8path(filename).extension() == ".json";
+	std::string error;
+	if (!WriteFileAtomic(filename, json ? j.dump(4) : LevelSaveFormat::Encode(j), error)) {
+		LOG_ERROR("GameInfoSaver") << error;
+		return false;
+	}
+	return true;
 }
 
 bool GameInfoSaver::SaveLevelDataImpl(Board* board, CardSlotManager* manager)
 {
-	if (GameAPP::mAutoTestMode) return true;   // AutoTest：不写关卡存档
+	if (GameAPP::mAutoTestMode || GameAPP::mReplayPlayback) return true;   // AutoTest / -Replay：不写关卡存档
 	FileManager::CreateDirectory(GetSaveRoot());
-	const std::string filename = FileManager::CombinePath(GetSaveRoot(),
-		"level" + std::to_string(board->mLevel) + "_data.json");
-	return SerializeLevelDataToPath(board, manager, filename);
+
+	// 主线程只做状态捕获：文档树是与 Board 无关的值，捕获完即可继续跑帧。
+	// 编码与写盘交给后台线程，大棋盘的 dump/Encode 与磁盘 IO 不再卡住这一帧。
+	const auto captureStart = std::chrono::steady_clock::now();
+	nlohmann::json j;
+	if (!BuildLevelDocument(board, manager, j)) return false;
+	LOG_DEBUG("GameInfoSaver") << "关卡状态捕获耗时 " << std::chrono::duration<double, std::milli>(
+		std::chrono::steady_clock::now() - captureStart).count() << "ms";
+
+	const bool json = GameAPP::mLevelSaveJson;
+	const int level = board->mLevel;
+	mLevelWriter.Submit(FileManager::CombinePath(GetSaveRoot(), LevelSaveFileName(level, json)),
+		[document = std::move(j), json]() {
+			return json ? document.dump(4) : LevelSaveFormat::Encode(document);
+		},
+		[level, json]() {
+			// 另一种格式的旧档此时已过期；留着会在本档被删除后"复活"。新档落盘后才删，中途失败不丢档
+			DeleteSaveFile(LevelSaveFileName(level, !json));
+		});
+	return true;
+}
+
+void GameInfoSaver::FlushPendingSaves()
+{
+	mLevelWriter.Flush();
 }
 
 bool GameInfoSaver::DeserializeLevelDataFromPath(Board* board, CardSlotManager* manager,
 	const std::string& filename)
 {
-	nlohmann::json j;
-	if (!FileManager::LoadJsonFile(filename, j))
+	const std::string content = FileManager::LoadFileAsString(filename);
+	if (content.empty()) return false;
+	// 按内容嗅探格式：二进制正式档边解码边建实体，不构建整棵文档树；
+	// JSON 旧档/导出档先解析成树再按同样顺序分发，两者共用同一套恢复与迁移逻辑
+	if (LevelSaveFormat::IsBinary(content)) {
+		return RestoreLevel(board, manager, filename,
+			[&content](const LevelSaveFormat::StreamCallbacks& callbacks, std::string& error) {
+				return LevelSaveFormat::DecodeStreaming(content, callbacks, error);
+			});
+	}
+	nlohmann::json j = nlohmann::json::parse(content, nullptr, false);
+	if (j.is_discarded()) {
+		LOG_WARN("Save") << "关卡存档 JSON 损坏: " << filename;
 		return false;
+	}
+	return ApplyLevelDocument(board, manager, j, filename);
+}
+
+/**
+ * 一次关卡恢复的跨阶段状态。头部先到，实体记录按 LevelArray 顺序逐条到来；
+ * 需要整组记录或要在某类实体全部就位后才能做的事，暂存在这里，到数组收尾时再做。
+ */
+struct GameInfoSaver::LevelRestoreState {
+	std::string source;
+	std::size_t nextArray = 0;                 // 尚未收尾的第一个实体数组
+	int schemaVersion = 0;                     // 头部升级前的原始版本，逐条记录按它迁移
+	bool hasEliteScaredyShroomCount = false;
+	std::vector<nlohmann::json> plants;        // 压扁残影须先于同格植物恢复，植物记录攒齐后分两遍创建
+	SurvivalCardCooldownMap legacyCardCooldowns;
+	nlohmann::json survivalCardCooldowns;
+};
+
+namespace {
+	/** 生存模式轮间选卡阶段：卡牌记录只迁移冷却，不进卡槽。 */
+	bool IsSurvivalCardSelect(const Board* board)
+	{
+		return board->mIsSurvival && board->mBoardState == BoardState::CHOOSE_CARD;
+	}
+}
+
+bool GameInfoSaver::ApplyLevelDocument(Board* board, CardSlotManager* manager,
+	nlohmann::json& j, const std::string& source)
+{
+	return RestoreLevel(board, manager, source,
+		[&j](const LevelSaveFormat::StreamCallbacks& callbacks, std::string& error) {
+			return LevelSaveFormat::StreamDocument(j, callbacks, error);
+		});
+}
+
+bool GameInfoSaver::RestoreLevel(Board* board, CardSlotManager* manager, const std::string& source,
+	const std::function<bool(const LevelSaveFormat::StreamCallbacks&, std::string&)>& stream)
+{
+	LevelRestoreState state;
+	state.source = source;
+	const LevelSaveFormat::StreamCallbacks callbacks{
+		[&](nlohmann::json& header) {
+			return RestoreLevelHeader(board, header, state);
+		},
+		[&](LevelSaveFormat::LevelArray array, nlohmann::json& record) {
+			RestoreLevelRecord(board, manager, array, record, state);
+			return true;
+		},
+	};
+	std::string error;
+	if (!stream(callbacks, error)) {
+		if (!error.empty()) LOG_WARN("Save") << "拒绝加载关卡存档 " << source << ": " << error;
+		return false;
+	}
+	FinishLevelArrays(board, static_cast<std::size_t>(LevelSaveFormat::LevelArray::Count), state);
+
+	// 恢复生存轮间冷却快照（见 SaveLevelData 同名字段注释）。必须在 ChooseCardComplete 还原冷却之前就位，
+	// 而本函数在 OnEnter 选卡分支之前执行，时序成立。旧版问题档的显式快照为空时，从被丢弃的
+	// 上一轮 cards 迁移冷却数据，既阻止重复卡牌，也不损失原本仍在冷却的进度。
+	if (board->mIsSurvival && board->GetPresentation()) {
+		SurvivalCardCooldownMap cooldowns;
+		for (auto& c : state.survivalCardCooldowns) {
+			PlantType type = static_cast<PlantType>(c["plantType"].get<int>());
+			cooldowns[type] = { c.value("cooldownTimer", 0.0f), c.value("cooldownTime", 0.0f) };
+		}
+		if (cooldowns.empty() && IsSurvivalCardSelect(board))
+			cooldowns = std::move(state.legacyCardCooldowns);
+		board->GetPresentation()->SetSurvivalCardCooldowns(std::move(cooldowns));
+	}
+
+	// 恢复旗子升起状态，并立刻对齐进度条滑块（跳过缓动动画）
+	if (board->mCurrentWave > 0 && board->GetPresentation()) {
+		board->GetPresentation()->RestoreWaveProgress();
+	}
+
+	return true;
+}
+
+bool GameInfoSaver::RestoreLevelHeader(Board* board, nlohmann::json& j, LevelRestoreState& state)
+{
 	std::string schemaError;
-	if (!SaveSchema::UpgradeLevelDocument(j, schemaError)) {
-		LOG_WARN("Save") << "拒绝加载关卡存档 " << filename << ": " << schemaError;
+	if (!SaveSchema::UpgradeLevelDocument(j, state.schemaVersion, schemaError)) {
+		LOG_WARN("Save") << "拒绝加载关卡存档 " << state.source << ": " << schemaError;
 		return false;
 	}
 	// 旧 3-1~3-9 存档使用五行或上移 40px 的泳池坐标；保留文件但拒绝加载，
 	// 避免绝对 Y 入档的清洁车、子弹等对象与新网格错层。
 	if (board->mLevel >= 19 && board->mLevel <= 27
 		&& j.value("poolGridVersion", 0) != kPoolGridSaveVersion) {
-		LOG_WARN("Save") << "忽略旧版泳池坐标存档: " << filename;
+		LOG_WARN("Save") << "忽略旧版泳池坐标存档: " << state.source;
 		return false;
 	}
 
@@ -725,6 +867,8 @@ bool GameInfoSaver::DeserializeLevelDataFromPath(Board* board, CardSlotManager*
 		0.0f, POOL_SUN_SPAWN_TIME);
 	board->mCurrentWave = j.value("currentWave", 0);
 	board->mBoardFrame = j.value("boardFrame", 0);
+	// 旧档没有逻辑步：从节拍帧起算，键值只需此后逐步递增
+	board->mLogicStep = j.value("logicStep", static_cast<uint64_t>(std::max(board->mBoardFrame, 0)));
 	{
 		const float iceRight = board->GetIceTrailRightX();
 		board->mIceMinX.fill(iceRight);
@@ -754,23 +898,13 @@ bool GameInfoSaver::DeserializeLevelDataFromPath(Board* board, CardSlotManager*
 				: iceRight;
 		}
 	}
-	if (j.contains("eliteScaredyShroomsPlanted")) {
+	// 旧档没有累计字段时要按存活植物推算，等植物记录到齐后在 FinishLevelArray 里补
+	state.hasEliteScaredyShroomCount = j.contains("eliteScaredyShroomsPlanted");
+	if (state.hasEliteScaredyShroomCount) {
 		board->mEliteScaredyShroomsPlanted = std::clamp(
 			j.value("eliteScaredyShroomsPlanted", 0),
 			0, board->GetEliteScaredyShroomPlantLimit());
 	}
-	else {
-		// 旧档没有累计字段，只能以仍存活的精英胆小菇数作保守下界，避免读档后凭空清零。
-		int legacyCount = 0;
-		for (const auto& plantData : j.value("plants", nlohmann::json::array())) {
-			if (plantData.value("type", -1)
-				== static_cast<int>(PlantType::PLANT_ELITE_SCAREDYSHROOM)) {
-				++legacyCount;
-			}
-		}
-		board->mEliteScaredyShroomsPlanted = std::min(
-			legacyCount, board->GetEliteScaredyShroomPlantLimit());
-	}
 	board->mMistFuelDropAccumulator = std::clamp(
 		j.value("mistFuelDropAccumulator", 0.0f), 0.0f, 1.0f);
 	board->mMistFuelAssignedThisWave = 0;
@@ -1002,7 +1136,7 @@ bool GameInfoSaver::DeserializeLevelDataFromPath(Board* board, CardSlotManager*
 		j.value("hijackerSpawnBlockedThisWave", false));
 	board->RestoreGroundingZombieWaveSpawnCount(
 		j.value("groundingZombiesSpawnedThisWave", 0));
-	board->mRainVisualActive = false;   // 粒子不入存档，StartGame 按剩余时间重建
+	board->mRainField.Clear();   // 雨丝不入存档，StartGame 按读回的雨势与风向重新同步
 	board->mMaxWave = j.value("maxWave", 10);
 	board->mZombieCountDown = j.value("zombieCountDown", 20.0f);
 	board->mTotalZombieHP = j.value("totalZombieHP", 0LL);
@@ -1016,57 +1150,27 @@ bool GameInfoSaver::DeserializeLevelDataFromPath(Board* board, CardSlotManager*
 	board->mEntityRegistry.SetNextCoinID(j.value("nextCoinID", 1));
 	board->mEntityRegistry.SetNextMowerID(j.value("nextMowerID", 1));
 
-	// 压扁残影与后来补种的植物可以同格共存。先恢复并释放残影占格，再恢复正常植物，
-	// 避免无序存档数组令残影的创建过程覆盖同格新植物 ID。
-	const auto savedPlants = j.value("plants", nlohmann::json::array());
-	auto restorePlant = [&](const nlohmann::json& p) {
-		PlantType type = static_cast<PlantType>(p["type"].get<int>());
-		int row = p["row"].get<int>();
-		int col = p["column"].get<int>();
-		int health = p["health"].get<int>();
-		int maxHealth = p["maxHealth"].get<int>();
-		bool isSleeping = p["isSleeping"].get<bool>();
-		int id = p.value("id", NULL_PLANT_ID);
-
-		Plant* plant = nullptr;
-		if (id != NULL_PLANT_ID) {
-			plant = board->CreatePlantWithID(type, row, col, id);
-		}
-		else {
-			plant = board->CreatePlant(type, row, col);
-		}
-
-		if (plant) {
-			plant->mPlantHealth = health;
-			plant->mPlantMaxHealth = maxHealth;
-			// 原始状态恢复不得重播咖啡豆唤醒音效或品种激活反馈；旧档缺字段时为中性 0。
-			plant->RestoreSleepState(isSleeping, p.value("wakeUpTimer", 0.0f));
-			// 通用停机是实体快照状态；读档只恢复剩余时间，不重新结算来源技能。
-			plant->RestoreShutdown(p.value("shutdownTimer", 0.0f));
-			RestoreAnimState(p, plant);
-			if (p.contains("extraData")) {
-				plant->LoadExtraData(p["extraData"]);
-			}
-			// 派生类读档可能重播专属轨道；最后恢复压扁态，确保终态仍暂停且不占格。
-			if (p.value("isSquished", false)) {
-				const Vector fallbackVisual = plant->GetVisualPosition();
-				plant->RestoreSquishState(
-					p.value("squishTimer", 0.0f),
-					Vector(p.value("squishVisualX", fallbackVisual.x),
-						p.value("squishVisualY", fallbackVisual.y)));
-			}
-		}
-	};
-	for (const bool squishedPass : { true, false }) {
-		for (const auto& p : savedPlants) {
-			if (p.value("isSquished", false) == squishedPass) {
-				restorePlant(p);
-			}
-		}
+	// 轮间冷却快照要等卡牌记录恢复完才能交给表现层，先从头部取出
+	if (auto it = j.find("survivalCardCooldowns"); it != j.end() && it->is_array()) {
+		state.survivalCardCooldowns = std::move(*it);
 	}
+	return true;
+}
 
+void GameInfoSaver::RestoreLevelRecord(Board* board, CardSlotManager* manager,
+	LevelSaveFormat::LevelArray array, nlohmann::json& record, LevelRestoreState& state)
+{
+	// 进入后面的数组说明前面的数组已全部到齐，先做它们的收尾
+	FinishLevelArrays(board, static_cast<std::size_t>(array), state);
+	SaveSchema::UpgradeLevelRecord(array, record, state.schemaVersion);
+
+	switch (array) {
+	case LevelSaveFormat::LevelArray::Plants:
+		state.plants.push_back(std::move(record));
+		break;
 	// 恢复小推车
-	for (auto& m : j.value("mowers", nlohmann::json::array())) {
+	case LevelSaveFormat::LevelArray::Mowers: {
+		nlohmann::json& m = record;
 		MowerType type = static_cast<MowerType>(m["type"].get<int>());
 		int row = m["row"].get<int>();
 		float x = m["x"].get<float>();
@@ -1094,10 +1198,11 @@ bool GameInfoSaver::DeserializeLevelDataFromPath(Board* board, CardSlotManager*
 				? static_cast<MowerHeight>(heightValue) : MowerHeight::LAND;
 			mower->RestorePoolVisualState(height, m.value("poolVisualOffsetY", 0.0f));
 		}
+		break;
 	}
-
 	// 恢复僵尸
-	for (auto& z : j.value("zombies", nlohmann::json::array())) {
+	case LevelSaveFormat::LevelArray::Zombies: {
+		nlohmann::json& z = record;
 		ZombieType type = static_cast<ZombieType>(z["type"].get<int>());
 		int   row = z["row"].get<int>();
 		float x = z["x"].get<float>();
@@ -1139,19 +1244,11 @@ bool GameInfoSaver::DeserializeLevelDataFromPath(Board* board, CardSlotManager*
 			zombie->ZombieItemUpdate();
 			zombie->FinalizeProtectedLoad();
 		}
+		break;
 	}
-
-	// 验证僵尸进食状态（防止植物不存在时崩溃）
-	for (int id : board->mEntityRegistry.GetAllZombieIDs()) {
-		auto zombie = board->mEntityRegistry.GetZombie(id);
-		if (!zombie) continue;
-		zombie->ValidateEatingState(board->mEntityRegistry);
-	}
-	// Board 的锁定 ID 要等全部僵尸按稳定 ID 恢复后才能校验，避免加载顺序触发重新随机。
-	board->FinalizeNightRoofHijackerLoad();
-
 	// 恢复子弹
-	for (auto& b : j.value("bullets", nlohmann::json::array())) {
+	case LevelSaveFormat::LevelArray::Bullets: {
+		nlohmann::json& b = record;
 		const BulletType type = static_cast<BulletType>(b["type"].get<int>());
 		const BulletType poolType = static_cast<BulletType>(
 			b.value("poolType", static_cast<int>(type)));
@@ -1205,10 +1302,11 @@ bool GameInfoSaver::DeserializeLevelDataFromPath(Board* board, CardSlotManager*
 					b.value("cobDuration", 1.4f));
 			}
 		}
+		break;
 	}
-
 	// 恢复太阳
-	for (auto& s : j.value("suns", nlohmann::json::array())) {
+	case LevelSaveFormat::LevelArray::Suns: {
+		nlohmann::json& s = record;
 		float x = s["x"].get<float>();
 		float y = s["y"].get<float>();
 		int  id = s.value("id", NULL_COIN_ID);
@@ -1227,35 +1325,35 @@ bool GameInfoSaver::DeserializeLevelDataFromPath(Board* board, CardSlotManager*
 		if (sun) {
 			RestoreAnimState(s, sun);
 		}
+		break;
 	}
-
 	// 恢复奖杯（旧存档带 "id" 字段，已不再使用，直接忽略）
-	for (auto& t : j.value("trophies", nlohmann::json::array())) {
+	case LevelSaveFormat::LevelArray::Trophies: {
+		nlohmann::json& t = record;
 		float x = t["x"].get<float>();
 		float y = t["y"].get<float>();
 		board->CreateTrophy(Vector(x, y));
+		break;
 	}
-
 	// 恢复弹坑（毁灭菇）；旧档无 craters 字段 → 空数组，天然兼容
-	for (auto& c : j.value("craters", nlohmann::json::array())) {
+	case LevelSaveFormat::LevelArray::Craters: {
+		nlohmann::json& c = record;
 		board->AddCrater(c.value("row", 0), c.value("column", 0),
 			c.value("timeLeft", Crater::CRATER_DURATION));
+		break;
 	}
-
 	// CHOOSE_CARD 存档中的 cards 来自旧版词条选择退出 bug：它们是上一轮卡组，不是下一轮
 	// 已提交选择。此时禁止恢复到卡槽；若显式冷却快照为空，则只迁移其中仍在冷却的进度。
-	const bool isSurvivalCardSelect = board->mIsSurvival
-		&& board->mBoardState == BoardState::CHOOSE_CARD;
-	std::unordered_map<PlantType, std::pair<float, float>> legacyCardCooldowns;
-	for (auto& c : j.value("cards", nlohmann::json::array())) {
-		if (isSurvivalCardSelect) {
+	case LevelSaveFormat::LevelArray::Cards: {
+		nlohmann::json& c = record;
+		if (IsSurvivalCardSelect(board)) {
 			if (c.value("isCooldown", false)) {
 				PlantType type = static_cast<PlantType>(c["plantType"].get<int>());
-				legacyCardCooldowns[type] = {
+				state.legacyCardCooldowns[type] = {
 					c.value("cooldownTimer", 0.0f), c.value("cooldownTime", 0.0f)
 				};
 			}
-			continue;
+			break;
 		}
 		if (manager) {
 			PlantType plantType = static_cast<PlantType>(c["plantType"].get<int>());
@@ -1268,7 +1366,7 @@ bool GameInfoSaver::DeserializeLevelDataFromPath(Board* board, CardSlotManager*
 
 			auto card = GameObjectManager::GetInstance().CreateGameObjectImmediate<Card>(
 				LAYER_UI, plantType, sunCost, cooldownTime, false);
-			if (!card) continue;
+			if (!card) break;
 
 			if (auto transform = card->GetTransform()) {
 				transform->SetPosition(Vector(posX, posY));
@@ -1286,52 +1384,133 @@ bool GameInfoSaver::DeserializeLevelDataFromPath(Board* board, CardSlotManager*
 			}
 			manager->AddCard(card);
 		}
+		break;
 	}
-
 	// 恢复已放置扶梯；旧档无 ladders 字段时保持空集合，缺 style 时恢复经典样式。
-	for (auto& ladder : j.value("ladders", nlohmann::json::array())) {
+	case LevelSaveFormat::LevelArray::Ladders: {
+		nlohmann::json& ladder = record;
 		const int savedStyle = std::clamp(ladder.value("style", 0), 0,
 			static_cast<int>(LadderStyle::ELITE));
 		board->AddLadder(ladder.value("row", 0), ladder.value("column", 0),
 			static_cast<LadderStyle>(savedStyle));
+		break;
+	}
+	default:
+		break;
 	}
+}
 
-	// 恢复生存轮间冷却快照（见 SaveLevelData 同名字段注释）。必须在 ChooseCardComplete 还原冷却之前就位，
-	// 而本函数在 OnEnter 选卡分支之前执行，时序成立。旧版问题档的显式快照为空时，从被丢弃的
-	// 上一轮 cards 迁移冷却数据，既阻止重复卡牌，也不损失原本仍在冷却的进度。
-	if (board->mIsSurvival && board->GetPresentation()) {
-		SurvivalCardCooldownMap cooldowns;
-		if (j.contains("survivalCardCooldowns") && j["survivalCardCooldowns"].is_array()) {
-			for (auto& c : j["survivalCardCooldowns"]) {
-				PlantType type = static_cast<PlantType>(c["plantType"].get<int>());
-				cooldowns[type] = { c.value("cooldownTimer", 0.0f), c.value("cooldownTime", 0.0f) };
+void GameInfoSaver::FinishLevelArrays(Board* board, std::size_t upTo, LevelRestoreState& state)
+{
+	for (; state.nextArray < upTo; ++state.nextArray) {
+		switch (static_cast<LevelSaveFormat::LevelArray>(state.nextArray)) {
+		case LevelSaveFormat::LevelArray::Plants: {
+			if (!state.hasEliteScaredyShroomCount) {
+				// 旧档没有累计字段，只能以仍存活的精英胆小菇数作保守下界，避免读档后凭空清零。
+				int legacyCount = 0;
+				for (const auto& plantData : state.plants) {
+					if (plantData.value("type", -1)
+						== static_cast<int>(PlantType::PLANT_ELITE_SCAREDYSHROOM)) {
+						++legacyCount;
+					}
+				}
+				board->mEliteScaredyShroomsPlanted = std::min(
+					legacyCount, board->GetEliteScaredyShroomPlantLimit());
 			}
+			// 压扁残影与后来补种的植物可以同格共存。先恢复并释放残影占格，再恢复正常植物，
+			// 避免无序存档数组令残影的创建过程覆盖同格新植物 ID。
+			auto restorePlant = [&](const nlohmann::json& p) {
+				PlantType type = static_cast<PlantType>(p["type"].get<int>());
+				int row = p["row"].get<int>();
+				int col = p["column"].get<int>();
+				int health = p["health"].get<int>();
+				int maxHealth = p["maxHealth"].get<int>();
+				bool isSleeping = p["isSleeping"].get<bool>();
+				int id = p.value("id", NULL_PLANT_ID);
+
+				Plant* plant = nullptr;
+				if (id != NULL_PLANT_ID) {
+					plant = board->CreatePlantWithID(type, row, col, id);
+				}
+				else {
+					plant = board->CreatePlant(type, row, col);
+				}
+
+				if (plant) {
+					plant->mPlantHealth = health;
+					plant->mPlantMaxHealth = maxHealth;
+					// 原始状态恢复不得重播咖啡豆唤醒音效或品种激活反馈；旧档缺字段时为中性 0。
+					plant->RestoreSleepState(isSleeping, p.value("wakeUpTimer", 0.0f));
+					// 通用停机是实体快照状态；读档只恢复剩余时间，不重新结算来源技能。
+					plant->RestoreShutdown(p.value("shutdownTimer", 0.0f));
+					RestoreAnimState(p, plant);
+					if (p.contains("extraData")) {
+						plant->LoadExtraData(p["extraData"]);
+					}
+					// 派生类读档可能重播专属轨道；最后恢复压扁态，确保终态仍暂停且不占格。
+					if (p.value("isSquished", false)) {
+						const Vector fallbackVisual = plant->GetVisualPosition();
+						plant->RestoreSquishState(
+							p.value("squishTimer", 0.0f),
+							Vector(p.value("squishVisualX", fallbackVisual.x),
+								p.value("squishVisualY", fallbackVisual.y)));
+					}
+				}
+			};
+			for (const bool squishedPass : { true, false }) {
+				for (const auto& p : state.plants) {
+					if (p.value("isSquished", false) == squishedPass) {
+						restorePlant(p);
+					}
+				}
+			}
+			state.plants.clear();
+			state.plants.shrink_to_fit();
+			break;
+		}
+		case LevelSaveFormat::LevelArray::Zombies: {
+			// 验证僵尸进食状态（防止植物不存在时崩溃）
+			for (int id : board->mEntityRegistry.GetAllZombieIDs()) {
+				auto zombie = board->mEntityRegistry.GetZombie(id);
+				if (!zombie) continue;
+				zombie->ValidateEatingState(board->mEntityRegistry);
+			}
+			// Board 的锁定 ID 要等全部僵尸按稳定 ID 恢复后才能校验，避免加载顺序触发重新随机。
+			board->FinalizeNightRoofHijackerLoad();
+			break;
+		}
+		default:
+			break;
 		}
-		if (cooldowns.empty() && isSurvivalCardSelect)
-			cooldowns = std::move(legacyCardCooldowns);
-		board->GetPresentation()->SetSurvivalCardCooldowns(std::move(cooldowns));
-	}
-
-	// 恢复旗子升起状态，并立刻对齐进度条滑块（跳过缓动动画）
-	if (board->mCurrentWave > 0 && board->GetPresentation()) {
-		board->GetPresentation()->RestoreWaveProgress();
 	}
-
-	return true;
 }
 
 bool GameInfoSaver::LoadLevelDataImpl(Board* board, CardSlotManager* manager)
 {
 	// 显式快照覆盖只消费一次：先清路径再解析，任何返回或异常都不会污染后续场景。
-	if (GameAPP::mAutoTestMode && !mAutoTestSnapshotLoadPath.empty()) {
+	if (GameAPP::mAutoTestMode && (!mAutoTestSnapshotLoadPath.empty() || mPendingMemorySnapshot)) {
 		const std::string filename = mAutoTestSnapshotLoadPath;
+		const LevelSnapshot* memorySnapshot = mPendingMemorySnapshot;
 		mAutoTestSnapshotLoadPath.clear();
+		mPendingMemorySnapshot = nullptr;
 		mAutoTestSnapshotLoadAttempted = true;
 		mAutoTestSnapshotLoadSucceeded = false;
 		mAutoTestSnapshotLoadError.clear();
+		const auto loadStart = std::chrono::steady_clock::now();
 		try {
-			mAutoTestSnapshotLoadSucceeded =
-				DeserializeLevelDataFromPath(board, manager, filename);
+			if (memorySnapshot) {
+				// 与正式二进制档同一条流式恢复：边解码边建实体，不构建整棵文档树
+				const std::string& bytes = memorySnapshot->document;
+				mAutoTestSnapshotLoadSucceeded = RestoreLevel(board, manager, "内存快照",
+					[&bytes](const LevelSaveFormat::StreamCallbacks& callbacks, std::string& error) {
+						return LevelSaveFormat::DecodeStreaming(bytes, callbacks, error);
+					});
+				if (mAutoTestSnapshotLoadSucceeded) mRestoredRandomState = &memorySnapshot->random;
+			}
+			else {
+				mAutoTestSnapshotLoadSucceeded =
+					DeserializeLevelDataFromPath(board, manager, filename);
+			}
 			if (!mAutoTestSnapshotLoadSucceeded) {
 				mAutoTestSnapshotLoadError = "正式反序列化返回失败";
 			}
@@ -1339,21 +1518,33 @@ bool GameInfoSaver::LoadLevelDataImpl(Board* board, CardSlotManager* manager)
 		catch (const std::exception& e) {
 			mAutoTestSnapshotLoadError = e.what();
 		}
+		mAutoTestSnapshotLoadMs = std::chrono::duration<double, std::milli>(
+			std::chrono::steady_clock::now() - loadStart).count();
 		return mAutoTestSnapshotLoadSucceeded;
 	}
 
 	// AutoTest 默认仍是确定性的全新关卡；仅显式 -AutoTestLoadSave 时读取当前 CWD 下的
 	// 关卡存档。写入和删除入口始终短路，因此问题存档在测试后保持逐字节不变。
 	if (GameAPP::mAutoTestMode && !GameAPP::mAutoTestLoadSave) return true;
-	const std::string filename = GetSaveFileForRead(
-		"level" + std::to_string(board->mLevel) + "_data.json");
+	// 上一场的后台存档可能还没写完（退出后立即重进同一关），先等它落盘再读
+	mLevelWriter.Flush();
+	// 二进制档优先；没有时回退 JSON（升级前的旧档或 -LevelSaveJson 导出档）
+	std::string filename = GetSaveFileForRead(LevelSaveFileName(board->mLevel, false));
+	if (!FileManager::FileExists(filename)) {
+		filename = GetSaveFileForRead(LevelSaveFileName(board->mLevel, true));
+	}
 	return DeserializeLevelDataFromPath(board, manager, filename);
 }
 
 bool GameInfoSaver::DeleteLevelData(Board* board)
 {
-	if (GameAPP::mAutoTestMode) return true;   // AutoTest（包括读档复现模式）绝不删除真实存档
-	return DeleteSaveFile("level" + std::to_string(board->mLevel) + "_data.json");
+	if (GameAPP::mAutoTestMode || GameAPP::mReplayPlayback) return true;   // AutoTest（包括读档复现模式）与 -Replay 绝不删除真实存档
+	// 排队中的存档若在删除之后才落盘，已结束的关卡会被重新读出
+	mLevelWriter.Cancel(FileManager::CombinePath(GetSaveRoot(), LevelSaveFileName(board->mLevel, false)));
+	mLevelWriter.Cancel(FileManager::CombinePath(GetSaveRoot(), LevelSaveFileName(board->mLevel, true)));
+	const bool binaryDeleted = DeleteSaveFile(LevelSaveFileName(board->mLevel, false));
+	const bool jsonDeleted = DeleteSaveFile(LevelSaveFileName(board->mLevel, true));
+	return binaryDeleted || jsonDeleted;
 }
 
 // ── 异常安全边界 ──────────────────────────────────────────────────────────────
@@ -1417,10 +1608,42 @@ bool GameInfoSaver::SaveAutoTestLevelSnapshot(Board* board, CardSlotManager* man
 	}
 }
 
+bool GameInfoSaver::CaptureLevelSnapshot(Board* board, CardSlotManager* manager,
+	LevelSnapshot& snapshot)
+{
+	if (!GameAPP::mAutoTestMode || !board || !manager) return false;
+	try {
+		nlohmann::json j;
+		if (!BuildLevelDocument(board, manager, j)) return false;
+		snapshot.level = board->mLevel;
+		snapshot.document = LevelSaveFormat::Encode(j);
+		snapshot.random = GameRandom::CaptureState();
+		return true;
+	}
+	catch (const std::exception& e) {
+		LOG_ERROR("GameInfoSaver") << "内存快照捕获失败: " << e.what();
+		return false;
+	}
+}
+
+bool GameInfoSaver::QueueLevelSnapshotRestore(const LevelSnapshot& snapshot)
+{
+	if (!GameAPP::mAutoTestMode || snapshot.document.empty() || !mAutoTestSnapshotLoadPath.empty()
+		|| mPendingMemorySnapshot || mAutoTestSnapshotLoadAttempted) {
+		return false;
+	}
+	mPendingMemorySnapshot = &snapshot;
+	mRestoredRandomState = nullptr;
+	mAutoTestSnapshotLoadAttempted = false;
+	mAutoTestSnapshotLoadSucceeded = false;
+	mAutoTestSnapshotLoadError.clear();
+	return true;
+}
+
 bool GameInfoSaver::QueueAutoTestLevelSnapshotLoad(const std::string& filename)
 {
 	if (!GameAPP::mAutoTestMode || filename.empty() || !mAutoTestSnapshotLoadPath.empty()
-		|| mAutoTestSnapshotLoadAttempted) {
+		|| mPendingMemorySnapshot || mAutoTestSnapshotLoadAttempted) {
 		return false;
 	}
 	mAutoTestSnapshotLoadPath = filename;
@@ -1434,11 +1657,17 @@ bool GameInfoSaver::ConsumeAutoTestLevelSnapshotLoadResult(std::string& error)
 {
 	if (!mAutoTestSnapshotLoadAttempted) {
 		mAutoTestSnapshotLoadPath.clear();
+		mPendingMemorySnapshot = nullptr;
 		error = "新 GameScene 未尝试加载快照";
 		return false;
 	}
 	const bool succeeded = mAutoTestSnapshotLoadSucceeded;
 	error = mAutoTestSnapshotLoadError;
+	// 随机数状态在新场景构建完毕后才还原：OnEnter 期间的初始化消耗不能挤占分支起点的序列
+	if (succeeded && mRestoredRandomState) {
+		GameRandom::RestoreState(*mRestoredRandomState);
+	}
+	mRestoredRandomState = nullptr;
 	mAutoTestSnapshotLoadAttempted = false;
 	mAutoTestSnapshotLoadSucceeded = false;
 	mAutoTestSnapshotLoadError.clear();
@@ -1448,6 +1677,8 @@ bool GameInfoSaver::ConsumeAutoTestLevelSnapshotLoadResult(std::string& error)
 void GameInfoSaver::CancelAutoTestLevelSnapshotLoad()
 {
 	mAutoTestSnapshotLoadPath.clear();
+	mPendingMemorySnapshot = nullptr;
+	mRestoredRandomState = nullptr;
 	mAutoTestSnapshotLoadAttempted = false;
 	mAutoTestSnapshotLoadSucceeded = false;
 	mAutoTestSnapshotLoadError.clear();
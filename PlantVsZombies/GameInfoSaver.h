@@ -1,20 +1,41 @@
 #pragma once
 #ifndef _GAMEINFOSAVER_H
 #define _GAMEINFOSAVER_H
+#include "AsyncSaveWriter.h"
 #include "FileManager.h"
+#include "GameRandom.h"
+#include "LevelSaveFormat.h"
+#include <cstddef>
+#include <functional>
 #include <string>
 
 class Board;
 class CardSlotManager;
 
+/**
+ * @brief 关卡的内存快照：正式关卡文档的二进制容器编码（LevelSaveFormat）+ 捕获时刻的随机数状态。
+ * @details 只在进程内流转，不落盘；同一快照可反复还原，供测试从一次昂贵的布局多次分支。
+ */
+struct LevelSnapshot {
+	int level = 0;
+	std::string document;
+	GameRandom::State random;
+};
+
 class GameInfoSaver {
 public:
 	bool SavePlayerInfo();
 	bool LoadPlayerInfo();
 
+	/**
+	 * @brief 在主线程捕获关卡文档，编码与写盘排入后台线程后立即返回。
+	 * @details 返回值只表示状态已捕获并排队；落盘走临时文件 + 改名，失败时原存档不变并记日志。
+	 */
 	bool SaveLevelData(Board* board, CardSlotManager* manager);
 	bool LoadLevelData(Board* board, CardSlotManager* manager);
 	bool DeleteLevelData(Board* board);
+	/** 阻塞到所有后台关卡存档写完；退出游戏前调用。 */
+	void FlushPendingSaves();
 
 	/**
 	 * @brief 将当前关卡用正式序列化逻辑写入显式 AutoTest 快照路径。
@@ -27,8 +48,20 @@ public:
 	 * @details 路径在加载尝试开始前即清除，成功或失败都不会影响后续普通 goto_level。
 	 */
 	bool QueueAutoTestLevelSnapshotLoad(const std::string& filename);
+	/**
+	 * @brief 用正式序列化逻辑把当前关卡捕获为内存快照，不触碰磁盘。
+	 * @details 与 SaveAutoTestLevelSnapshot 同一份状态覆盖（Board、实体、卡槽），另带随机数状态。
+	 */
+	bool CaptureLevelSnapshot(Board* board, CardSlotManager* manager, LevelSnapshot& snapshot);
+	/**
+	 * @brief 为下一次 GameScene 加载登记一次性内存快照；snapshot 须存活到加载结果被取走。
+	 * @details 随机数状态在 ConsumeAutoTestLevelSnapshotLoadResult 成功时还原，即新场景就绪的那一刻。
+	 */
+	bool QueueLevelSnapshotRestore(const LevelSnapshot& snapshot);
 	/** 取得并清除最近一次快照加载结果；失败原因写入 error。 */
 	bool ConsumeAutoTestLevelSnapshotLoadResult(std::string& error);
+	/** 最近一次快照加载中正式反序列化本身的耗时（毫秒），不含场景切换；用于和命令总耗时对照。 */
+	double GetLastAutoTestSnapshotLoadMs() const { return mAutoTestSnapshotLoadMs; }
 	void CancelAutoTestLevelSnapshotLoad();
 
 private:
@@ -36,12 +69,30 @@ private:
 	// 上面的公有接口只做一层 try/catch 包裹，详见 .cpp 的“异常安全边界”。
 	static bool SavePlayerInfoImpl();
 	static bool LoadPlayerInfoImpl();
-	static bool SaveLevelDataImpl(Board* board, CardSlotManager* manager);
+	bool SaveLevelDataImpl(Board* board, CardSlotManager* manager);
 	bool LoadLevelDataImpl(Board* board, CardSlotManager* manager);
-	/** 构建完整正式关卡 JSON，并写入调用方指定的已隔离路径。 */
+	/** 构建完整正式关卡 JSON 文档；棋盘不在可存档状态时返回 false。 */
+	static bool BuildLevelDocument(Board* board, CardSlotManager* manager, nlohmann::json& j);
+	/** 用正式反序列化流程把文档应用到新 Board；source 仅用于日志。 */
+	static bool ApplyLevelDocument(Board* board, CardSlotManager* manager,
+		nlohmann::json& j, const std::string& source);
+
+	// 关卡恢复按"头部 → 逐条实体记录 → 收尾"分阶段进行，整树文档与流式二进制档共用。
+	struct LevelRestoreState;
+	/** stream 负责把头部与实体记录按 LevelArray 顺序交给回调（整树分发或流式解码）。 */
+	static bool RestoreLevel(Board* board, CardSlotManager* manager, const std::string& source,
+		const std::function<bool(const LevelSaveFormat::StreamCallbacks&, std::string&)>& stream);
+	/** SaveSchema 升级、旧泳池档拦截与全部 Board 标量；返回 false 表示拒绝加载。 */
+	static bool RestoreLevelHeader(Board* board, nlohmann::json& j, LevelRestoreState& state);
+	/** 恢复一条实体记录；跨入后面的数组前先收尾前面的数组，再按头部原始版本迁移本条记录。 */
+	static void RestoreLevelRecord(Board* board, CardSlotManager* manager,
+		LevelSaveFormat::LevelArray array, nlohmann::json& record, LevelRestoreState& state);
+	/** 收尾 upTo 之前的数组：植物按压扁态分两遍创建，僵尸全部就位后校验进食与锁定 ID。 */
+	static void FinishLevelArrays(Board* board, std::size_t upTo, LevelRestoreState& state);
+	/** 构建完整正式关卡 JSON，并同步原子写入调用方指定的已隔离路径。 */
 	static bool SerializeLevelDataToPath(Board* board, CardSlotManager* manager,
 		const std::string& filename);
-	/** 从指定路径解析 JSON，并用正式反序列化流程应用到新 Board。 */
+	/** 从指定路径读档：二进制档流式恢复，JSON 档解析后恢复。 */
 	static bool DeserializeLevelDataFromPath(Board* board, CardSlotManager* manager,
 		const std::string& filename);
 
@@ -49,6 +100,10 @@ private:
 	bool mAutoTestSnapshotLoadAttempted = false;
 	bool mAutoTestSnapshotLoadSucceeded = false;
 	std::string mAutoTestSnapshotLoadError;
+	double mAutoTestSnapshotLoadMs = 0.0;
+	const LevelSnapshot* mPendingMemorySnapshot = nullptr;
+	const GameRandom::State* mRestoredRandomState = nullptr;
+	AsyncSaveWriter mLevelWriter;   // 放在最后：析构时先等后台存档写完，其余成员仍然有效
 };
 
 #endif
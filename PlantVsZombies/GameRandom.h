@@ -6,10 +6,16 @@
 #include <memory>
 #include <functional>
 #include <chrono>
+#include "RandomStream.h"
 
 class GameRandom {
 private:
-	static inline std::mt19937_64 engine{ std::random_device{}() };
+	// 根种子须先于 engine 定义：两者同在本头文件，按声明顺序初始化
+	static inline uint64_t rootSeed{ std::random_device{}() };
+	static inline uint64_t streamFrame = 0;
+	static inline std::mt19937_64 engine{ rootSeed };
+	// 表现流：粒子等纯视觉随机单独一条引擎，消耗多少都不影响模拟用的 engine
+	static inline std::mt19937_64 visualEngine{ rootSeed ^ 0x9E3779B97F4A7C15ull };
 
 	// 预定义分布
 	static inline std::uniform_real_distribution<float> floatDist{ 0.0f, 1.0f };
@@ -109,20 +115,78 @@ public:
 		}
 	}
 
-	// 设置随机种子
+	// ---- 表现随机：粒子发射等只影响画面的消费者专用 ----
+	// 快进跳过中间步的粒子推进、无渲染回放等场景下，表现层的随机消耗量会变；
+	// 走独立引擎后模拟序列不受影响，同一 -Seed 的对局结果与倍速/快进无关。
+
+	// [min, max) 随机浮点数（表现流）
+	static float VisualRange(float min, float max) {
+		std::uniform_real_distribution<float> dist(min, max);
+		return dist(visualEngine);
+	}
+
+	// [min, max] 随机整数（表现流）
+	static int VisualRange(int min, int max) {
+		std::uniform_int_distribution<int> dist(min, max);
+		return dist(visualEngine);
+	}
+
+	// 设置随机种子（同时作为随机流与表现流的根种子）
 	static void SetSeed(uint64_t seed) {
+		rootSeed = seed;
 		engine.seed(seed);
+		visualEngine.seed(seed ^ 0x9E3779B97F4A7C15ull);
+	}
+
+	// 完整随机状态：根种子、节拍帧、两条引擎的内部状态（内存快照随关卡一起保存）。
+	// normalDist 成对生成、缓存后一半，必须一起保存，否则还原后第一次 Gaussian 会错位
+	struct State {
+		uint64_t rootSeed = 0;
+		uint64_t streamFrame = 0;
+		std::mt19937_64 engine;
+		std::mt19937_64 visualEngine;
+		std::normal_distribution<float> normalDist{ 0.0f, 1.0f };
+	};
+
+	static State CaptureState() {
+		return { rootSeed, streamFrame, engine, visualEngine, normalDist };
 	}
 
-	// 获取当前种子
+	static void RestoreState(const State& state) {
+		rootSeed = state.rootSeed;
+		streamFrame = state.streamFrame;
+		engine = state.engine;
+		visualEngine = state.visualEngine;
+		normalDist = state.normalDist;
+	}
+
+	// 获取当前根种子
 	static uint64_t GetSeed() {
-		return engine.default_seed;
+		return rootSeed;
 	}
 
 	// 随机种子（基于时间）
 	static void RandomizeSeed() {
-		engine.seed(std::chrono::high_resolution_clock::now()
-			.time_since_epoch().count());
+		SetSeed(static_cast<uint64_t>(std::chrono::high_resolution_clock::now()
+			.time_since_epoch().count()));
+	}
+
+	// ---- 计数器随机流：并行阶段专用 ----
+	// 全局 engine 只能在串行阶段用；并行阶段按 (根种子, 棋盘帧, 用途域, 实体 id) 取独立流，
+	// 结果与 worker 数和调度顺序无关。id 应取存档稳定的编号（mPlantID / mZombieID 等），
+	// 不可取 worker 序号，否则换核数即换结果。同一实体同帧多处取流时用不同 domain 区分。
+
+	// 主线程在并行分发前写入（Board 每步推进节拍帧后调用），worker 只读
+	static void SetStreamFrame(uint64_t frame) {
+		streamFrame = frame;
+	}
+
+	static uint64_t GetStreamFrame() {
+		return streamFrame;
+	}
+
+	static RandomStream Stream(RandomDomain domain, uint64_t id) {
+		return RandomStream::Derive(rootSeed, streamFrame, static_cast<uint64_t>(domain), id);
 	}
 
 };
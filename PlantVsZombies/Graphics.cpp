@@ -13,6 +13,7 @@
 #include <array>
 #include <algorithm>
 #include <cmath>
+#include <limits>
 
 namespace {
 	// Phase 3b — BatchVertex 顶点输入描述（与 Graphics.h struct BatchVertex 对齐）
@@ -131,11 +132,6 @@ struct Graphics::VulkanGraphicsState {
 	bool frameOpen = false;
 };
 
-// 与 glm::mat4(1.0f) 精确比较：仅用于快路判定，假阴性只会多做一次乘法（结果仍正确），不会出错。
-static inline bool IsIdentityMat(const glm::mat4& m) {
-	return m == glm::mat4(1.0f);
-}
-
 // ==================== 多线程录制状态（thread_local） ====================
 //
 // 这些指针在主线程上始终为 nullptr，所以所有公开 DrawXxx 路径在主线程上保持原行为
@@ -144,7 +140,7 @@ static inline bool IsIdentityMat(const glm::mat4& m) {
 // 同一个 slot 上跑完一整段（slot = idx），所以指针在该线程内稳定。
 namespace {
 	thread_local WorkerRecord* tl_record = nullptr;
-	thread_local std::vector<glm::mat4>* tl_transformStack = nullptr;
+	thread_local std::vector<Affine2D>* tl_transformStack = nullptr;
 	thread_local std::vector<char>* tl_transformIsIdentity = nullptr;
 	thread_local std::vector<ClipRect>* tl_clipStack = nullptr;
 	thread_local std::vector<PackedClipRect>* tl_packedClipStack = nullptr;
@@ -203,7 +199,7 @@ namespace {
 }
 
 Graphics::Graphics() {
-	m_transformStack.push_back(glm::mat4(1.0f));
+	m_transformStack.push_back(Affine2D::Identity());
 	m_transformIsIdentity.push_back(1);
 	this->SetBlendMode(BlendMode::Alpha);
 }
@@ -229,6 +225,7 @@ void Graphics::SetWindowSize(int width, int height) {
 	m_windowHeight = height;
 	m_projection = glm::ortho(0.0f, (float)width, (float)height, 0.0f, -1.0f, 1.0f);
 	// 实际视口由当前后端处理，CPU 侧只维护逻辑投影矩阵。
+	RefreshVisibleWorldRect();
 }
 
 bool Graphics::IsWorldPointVisible(float worldX, float worldY, float marginPx) const {
@@ -241,6 +238,48 @@ bool Graphics::IsWorldPointVisible(float worldX, float worldY, float marginPx) c
 		&& clip.y >= -1.0f - my && clip.y <= 1.0f + my;
 }
 
+bool Graphics::IsWorldRectVisible(float minX, float minY, float maxX, float maxY) const {
+	// 闭区间相交：贴边对象宁可多画一帧，也不能因浮点误差提前消失。
+	return maxX >= m_visibleWorldMinX && minX <= m_visibleWorldMaxX
+		&& maxY >= m_visibleWorldMinY && minY <= m_visibleWorldMaxY;
+}
+
+void Graphics::RefreshVisibleWorldRect() {
+	// letterbox 只决定逻辑画面在帧缓冲里的位置，可见内容恒为逻辑视口 0..W×0..H；
+	// 把四角逆变换回世界空间取 AABB，旋转相机下同样保守。
+	if (m_windowWidth <= 0 || m_windowHeight <= 0) return;   // Initialize 之前投影尚未建立
+	const glm::vec2 corners[4] = {
+		LogicalToWorld(0.0f, 0.0f),
+		LogicalToWorld((float)m_windowWidth, 0.0f),
+		LogicalToWorld(0.0f, (float)m_windowHeight),
+		LogicalToWorld((float)m_windowWidth, (float)m_windowHeight),
+	};
+	m_visibleWorldMinX = m_visibleWorldMaxX = corners[0].x;
+	m_visibleWorldMinY = m_visibleWorldMaxY = corners[0].y;
+	for (int i = 1; i < 4; ++i) {
+		m_visibleWorldMinX = std::min(m_visibleWorldMinX, corners[i].x);
+		m_visibleWorldMinY = std::min(m_visibleWorldMinY, corners[i].y);
+		m_visibleWorldMaxX = std::max(m_visibleWorldMaxX, corners[i].x);
+		m_visibleWorldMaxY = std::max(m_visibleWorldMaxY, corners[i].y);
+	}
+}
+
+void Graphics::CountReanimCull(bool culled) {
+	// worker 录制期各自写本 slot 的计数，ReplayAndEndParallel 在主线程汇总，无需原子操作。
+	uint32_t& counter = tl_record
+		? (culled ? tl_record->reanimCulled : tl_record->reanimEmitted)
+		: (culled ? m_frameReanimCulled : m_frameReanimEmitted);
+	++counter;
+}
+
+void Graphics::PublishReanimCullStats() {
+	m_lastFrameReanimCulled = m_frameReanimCulled;
+	m_lastFrameReanimEmitted = m_frameReanimEmitted;
+	Profiler::Get().CountReanimCull(m_frameReanimCulled, m_frameReanimEmitted);
+	m_frameReanimCulled = 0;
+	m_frameReanimEmitted = 0;
+}
+
 // ==================== Phase 3b — Vulkan 接入 ====================
 
 bool Graphics::InitializeVulkan(pvz::VulkanContext* ctx,
@@ -670,6 +709,7 @@ bool Graphics::EndFrame() {
 		const bool succeeded = m_gl->EndFrame();
 		m_lastFrameDrawCallCount = m_gl->LastFrameStats().drawCallCount;
 		m_lastFrameScissorChangeCount = 0;
+		PublishReanimCullStats();
 		return succeeded;
 	}
 	if (!m_vk || !m_vk->frameOpen) return false;
@@ -714,24 +754,30 @@ bool Graphics::EndFrame() {
 
 	m_lastFrameDrawCallCount = m_frameDrawCallCount;
 	m_lastFrameScissorChangeCount = m_frameScissorChangeCount;
+	PublishReanimCullStats();
 	m_vk->frameOpen = false;
 	return m_vk->renderer->EndFrame();
 }
 
 void Graphics::PushTransform(const glm::mat4& transform) {
+	// mat4 只留在 API 边界：截取 xy 仿射部分后走 2D 栈
+	PushTransform(Affine2D::FromMat4(transform));
+}
+
+void Graphics::PushTransform(const Affine2D& transform) {
 	if (tl_record) {
 		// worker：只动 thread-local 栈，不进 record 流（每次 DrawXxx 已把 finalMatrix 烘到 record 里）
 		const bool curId = tl_transformIsIdentity->back() != 0;
-		const bool tId = IsIdentityMat(transform);
-		glm::mat4 newTop = curId ? transform : (tl_transformStack->back() * transform);
+		const bool tId = transform.IsIdentity();
+		const Affine2D newTop = curId ? transform : (tl_transformStack->back() * transform);
 		tl_transformStack->push_back(newTop);
 		tl_transformIsIdentity->push_back((curId && tId) ? 1 : 0);
 		return;
 	}
 	const bool curId = m_transformIsIdentity.back() != 0;
-	const bool tId = IsIdentityMat(transform);
-	// 栈顶为单位阵时无需相乘，直接取 transform（这本身也消除一次冗余乘法）
-	glm::mat4 newTop = curId ? transform : (m_transformStack.back() * transform);
+	const bool tId = transform.IsIdentity();
+	// 栈顶为单位阵时无需复合，直接取 transform（这本身也消除一次冗余乘法）
+	const Affine2D newTop = curId ? transform : (m_transformStack.back() * transform);
 	m_transformStack.push_back(newTop);
 	m_transformIsIdentity.push_back((curId && tId) ? 1 : 0);
 }
@@ -759,50 +805,70 @@ void Graphics::PopTransform() {
 void Graphics::SetIdentity() {
 	if (tl_record) {
 		if (!tl_transformStack->empty()) {
-			tl_transformStack->back() = glm::mat4(1.0f);
+			tl_transformStack->back() = Affine2D::Identity();
 			tl_transformIsIdentity->back() = 1;
 		}
 		return;
 	}
 	if (!m_transformStack.empty()) {
-		m_transformStack.back() = glm::mat4(1.0f);
+		m_transformStack.back() = Affine2D::Identity();
 		m_transformIsIdentity.back() = 1;
 	}
 }
 
 void Graphics::Translate(float x, float y, float z) {
+	(void)z;   // 2D 栈没有 z 分量；顶点 z 恒为 0，原 mat4 路径下 z 平移也不影响屏幕坐标
 	if (tl_record) {
 		if (tl_transformStack->empty()) return;
-		tl_transformStack->back() = glm::translate(tl_transformStack->back(), glm::vec3(x, y, z));
+		Affine2D& top = tl_transformStack->back();
+		// top * T(x,y)：只有平移列变化，省掉一次完整复合
+		top.tx += top.a * x + top.c * y;
+		top.ty += top.b * x + top.d * y;
 		tl_transformIsIdentity->back() = 0;
 		return;
 	}
 	if (m_transformStack.empty()) return;
-	m_transformStack.back() = glm::translate(m_transformStack.back(), glm::vec3(x, y, z));
+	Affine2D& top = m_transformStack.back();
+	top.tx += top.a * x + top.c * y;
+	top.ty += top.b * x + top.d * y;
 	m_transformIsIdentity.back() = 0;
 }
 
 void Graphics::Rotate(float angleDegrees, float x, float y, float z) {
+	// 常见的绕 Z 轴旋转直接构造 2D 旋转；其它轴按 mat4 计算后截取 xy 部分
+	Affine2D rot;
+	if (x == 0.0f && y == 0.0f) {
+		if (z == 0.0f) return;
+		rot = Affine2D::Rotation(glm::radians(z > 0.0f ? angleDegrees : -angleDegrees));
+	}
+	else {
+		rot = Affine2D::FromMat4(glm::rotate(glm::mat4(1.0f), glm::radians(angleDegrees), glm::vec3(x, y, z)));
+	}
 	if (tl_record) {
 		if (tl_transformStack->empty()) return;
-		tl_transformStack->back() = glm::rotate(tl_transformStack->back(), glm::radians(angleDegrees), glm::vec3(x, y, z));
+		tl_transformStack->back() = tl_transformStack->back() * rot;
 		tl_transformIsIdentity->back() = 0;
 		return;
 	}
 	if (m_transformStack.empty()) return;
-	m_transformStack.back() = glm::rotate(m_transformStack.back(), glm::radians(angleDegrees), glm::vec3(x, y, z));
+	m_transformStack.back() = m_transformStack.back() * rot;
 	m_transformIsIdentity.back() = 0;
 }
 
 void Graphics::Scale(float sx, float sy, float sz) {
+	(void)sz;
 	if (tl_record) {
 		if (tl_transformStack->empty()) return;
-		tl_transformStack->back() = glm::scale(tl_transformStack->back(), glm::vec3(sx, sy, sz));
+		Affine2D& top = tl_transformStack->back();
+		top.a *= sx; top.b *= sx;
+		top.c *= sy; top.d *= sy;
 		tl_transformIsIdentity->back() = 0;
 		return;
 	}
 	if (m_transformStack.empty()) return;
-	m_transformStack.back() = glm::scale(m_transformStack.back(), glm::vec3(sx, sy, sz));
+	Affine2D& top = m_transformStack.back();
+	top.a *= sx; top.b *= sx;
+	top.c *= sy; top.d *= sy;
 	m_transformIsIdentity.back() = 0;
 }
 
@@ -913,13 +979,17 @@ void Graphics::FlushBatch() {
 			clearCpu();
 			return;
 		}
+		if (m_batchReorderEnabled) {
+			PROFILE_SCOPE("FB0.reorder");
+			ReorderBatchForSubmit(true);
+		}
 
 		std::vector<pvz::OpenGLVertex> expanded;
 		expanded.reserve(vertCount);
 		for (const BatchVertex& source : m_batchVertices) {
-			const glm::mat4& matrix = source.matrixIndex < m_batchMatrices.size()
-				? m_batchMatrices[source.matrixIndex] : glm::mat4(1.0f);
-			const glm::vec4 transformed = matrix * glm::vec4(source.x, source.y, 0.0f, 1.0f);
+			const Affine2D matrix = source.matrixIndex < m_batchMatrices.size()
+				? m_batchMatrices[source.matrixIndex] : Affine2D::Identity();
+			const glm::vec2 transformed = matrix.Apply(source.x, source.y);
 			pvz::OpenGLVertex vertex{};
 			vertex.x = transformed.x;
 			vertex.y = transformed.y;
@@ -936,7 +1006,7 @@ void Graphics::FlushBatch() {
 			expanded.push_back(vertex);
 		}
 
-		// 上层几何由三角形组成；只在三角形边界按纹理/Blend 分段，不跨命令重排。
+		// 上层几何由三角形组成；只在三角形边界按纹理/Blend 分段（可选重排已在上面完成）。
 		const glm::mat4 projectionView = m_projection * m_viewMatrix;
 		std::size_t segmentStart = 0;
 		std::uint32_t segmentTexture = m_batchVertices[0].texIndex;
@@ -963,6 +1033,7 @@ void Graphics::FlushBatch() {
 			}
 		}
 		submit(vertCount - (vertCount % 3));
+		Profiler::Get().CountFlush(vertCount);
 		clearCpu();
 		return;
 	}
@@ -1002,14 +1073,25 @@ void Graphics::FlushBatch() {
 		return;
 	}
 
+	// 0) 可选重排：必须在下面把 matrixIndex 改成 SSBO 绝对槽位之前做（包围盒按 CPU 矩阵下标取仿射）。
+	//    Vulkan 纹理走 bindless，只有 blend 会切段，所以分组键不含纹理。
+	if (m_batchReorderEnabled) {
+		PROFILE_SCOPE("FB0.reorder");
+		ReorderBatchForSubmit(false);
+	}
+
 	// 1) 矩阵：本次 FlushBatch 的矩阵会从 ssboCursor 处开始写入；记下该位置对应的 mat4 下标，
 	//    后面把它加到每条顶点的 matrixIndex 上，让 shader 看到的是 SSBO 内的绝对槽位。
 	const uint32_t matrixBase = (uint32_t)(fr.ssboCursor / sizeof(glm::mat4));
 	{
 		PROFILE_SCOPE("FBa.copy");
 		if (matCount > 0) {
-			std::memcpy(static_cast<char*>(fr.ssbo->MappedPtr()) + fr.ssboCursor,
-				m_batchMatrices.data(), (size_t)matBytes);
+			// CPU 侧只存 6 float 仿射；shader 读 mat4，上传时逐个展开写进映射内存
+			glm::mat4* dst = reinterpret_cast<glm::mat4*>(
+				static_cast<char*>(fr.ssbo->MappedPtr()) + fr.ssboCursor);
+			for (size_t i = 0; i < matCount; ++i) {
+				dst[i] = m_batchMatrices[i].ToMat4();
+			}
 		}
 
 		// 2) 顶点：matrixIndex += matrixBase，然后 memcpy 进 VBO
@@ -1042,7 +1124,7 @@ void Graphics::FlushBatch() {
 	}
 
 	// 诊断：统计一次真实提交（含 replay 里逐行血量文字各自的 FlushBatch）。
-	// Profiler::Get().CountFlush(vertCount);
+	Profiler::Get().CountFlush(vertCount);
 
 	clearCpu();
 }
@@ -1104,8 +1186,50 @@ int Graphics::BindTexture(uint32_t textureID) {
 	return (int)textureID;
 }
 
-int Graphics::AddMatrix(const glm::mat4& matrix) {
-	// 矩阵先保留在 CPU 列表中：Vulkan 提交到 SSBO，OpenGL 在 FlushBatch 时展开到顶点。
+void Graphics::ReorderBatchForSubmit(bool textureSensitive) {
+	// 以 6 顶点 quad 为移动单位（Vulkan EmitDrawRange 也按 6 顶点分段）。混入 FillCircle 的
+	// 3 顶点三角扇后单位可能跨两个图元，此时整批保持原序。
+	const size_t vertCount = m_batchVertices.size();
+	if (vertCount < 12 || vertCount % 6 != 0) return;
+	const size_t quadCount = vertCount / 6;
+
+	m_reorderPrims.resize(quadCount);
+	for (size_t q = 0; q < quadCount; ++q) {
+		const BatchVertex* v = &m_batchVertices[q * 6];
+		if (v[3].texIndex != v[0].texIndex || v[3].blendMode != v[0].blendMode) return;
+
+		pvz::BatchPrimitive& prim = m_reorderPrims[q];
+		prim.texture = textureSensitive ? v[0].texIndex : 0u;
+		prim.blend = (v[0].blendMode >= 0.5f) ? 1u : 0u;
+		// 屏幕包围盒取 6 个顶点经各自仿射后的 AABB；裁剪矩形只会缩小覆盖，不影响次序判定。
+		prim.minX = prim.minY = std::numeric_limits<float>::max();
+		prim.maxX = prim.maxY = std::numeric_limits<float>::lowest();
+		for (int k = 0; k < 6; ++k) {
+			const Affine2D matrix = v[k].matrixIndex < m_batchMatrices.size()
+				? m_batchMatrices[v[k].matrixIndex] : Affine2D::Identity();
+			const glm::vec2 pt = matrix.Apply(v[k].x, v[k].y);
+			prim.minX = std::min(prim.minX, pt.x);
+			prim.minY = std::min(prim.minY, pt.y);
+			prim.maxX = std::max(prim.maxX, pt.x);
+			prim.maxY = std::max(prim.maxY, pt.y);
+		}
+	}
+
+	pvz::BatchReorderStats stats;
+	pvz::ReorderBatchPrimitives(m_reorderPrims, m_reorderOrder, &stats);
+	Profiler::Get().CountBatchSegments(stats.segmentsBefore, stats.segmentsAfter);
+	if (stats.segmentsAfter >= stats.segmentsBefore) return;
+
+	m_reorderScratch.resize(vertCount);
+	for (size_t q = 0; q < quadCount; ++q) {
+		std::memcpy(&m_reorderScratch[q * 6], &m_batchVertices[(size_t)m_reorderOrder[q] * 6],
+			6 * sizeof(BatchVertex));
+	}
+	m_batchVertices.swap(m_reorderScratch);
+}
+
+int Graphics::AddMatrix(const Affine2D& matrix) {
+	// 矩阵先以 2D 仿射保留在 CPU 列表中：Vulkan 提交时展开为 mat4 写入 SSBO，OpenGL 在 FlushBatch 时展开到顶点。
 	m_batchMatrices.push_back(matrix);
 	return (int)(m_batchMatrices.size() - 1);
 }
@@ -1169,15 +1293,8 @@ void Graphics::DrawTexture(const Texture* tex, float x, float y, float width, fl
 	int texIndex = BindTexture(tex->BindingId());
 
 	// 构建局部变换矩阵：平移 -> 缩放 -> 旋转（绕中心）
-	glm::mat4 local = glm::mat4(1.0f);
-	local = glm::translate(local, glm::vec3(x, y, 0.0f));
-	local = glm::scale(local, glm::vec3(width, height, 1.0f));
-	if (rotation != 0.0f) {
-		local = glm::translate(local, glm::vec3(0.5f, 0.5f, 0.0f));
-		local = glm::rotate(local, glm::radians(rotation), glm::vec3(0.0f, 0.0f, 1.0f));
-		local = glm::translate(local, glm::vec3(-0.5f, -0.5f, 0.0f));
-	}
-	glm::mat4 finalMatrix = m_transformStack.back() * local;
+	const Affine2D local = Affine2D::Rect(x, y, width, height, rotation);
+	const Affine2D finalMatrix = m_transformStack.back() * local;
 	int matrixIndex = AddMatrix(finalMatrix);
 
 	// 转换颜色为 0-1 格式
@@ -1207,26 +1324,19 @@ void Graphics::DrawTextureInstanced(const Texture* tex, float x, float y, float
 		return;
 	}
 
-	// 与 DrawTexture 使用完全相同的局部变换，随后把最终 2D 仿射矩阵压缩进 InstanceRecord。
-	glm::mat4 local = glm::mat4(1.0f);
-	local = glm::translate(local, glm::vec3(x, y, 0.0f));
-	local = glm::scale(local, glm::vec3(width, height, 1.0f));
-	if (rotation != 0.0f) {
-		local = glm::translate(local, glm::vec3(0.5f, 0.5f, 0.0f));
-		local = glm::rotate(local, glm::radians(rotation), glm::vec3(0.0f, 0.0f, 1.0f));
-		local = glm::translate(local, glm::vec3(-0.5f, -0.5f, 0.0f));
-	}
-	const glm::mat4& currentTransform = tl_record
+	// 与 DrawTexture 使用完全相同的局部变换，最终 2D 仿射直接逐分量写进 InstanceRecord。
+	const Affine2D local = Affine2D::Rect(x, y, width, height, rotation);
+	const Affine2D& currentTransform = tl_record
 		? tl_transformStack->back() : m_transformStack.back();
-	const glm::mat4 finalMatrix = currentTransform * local;
+	const Affine2D finalMatrix = currentTransform * local;
 
 	InstanceRecord rec{};
-	rec.tA = finalMatrix[0][0];
-	rec.tB = finalMatrix[0][1];
-	rec.tC = finalMatrix[1][0];
-	rec.tD = finalMatrix[1][1];
-	rec.tx = finalMatrix[3][0];
-	rec.ty = finalMatrix[3][1];
+	rec.tA = finalMatrix.a;
+	rec.tB = finalMatrix.b;
+	rec.tC = finalMatrix.c;
+	rec.tD = finalMatrix.d;
+	rec.tx = finalMatrix.tx;
+	rec.ty = finalMatrix.ty;
 
 	const Texture* bindTex = tex->atlasPage ? tex->atlasPage : tex;
 	rec.u0 = tex->aU0;
@@ -1272,7 +1382,7 @@ bool Graphics::DrawPoolEffect(const Texture* baseTex, const Texture* shadingTex,
 		constexpr int kIndexOffsetX[6] = { 0, 0, 1, 0, 1, 1 };
 		constexpr int kIndexOffsetY[6] = { 0, 1, 1, 0, 1, 0 };
 		std::array<pvz::OpenGLVertex, kPoolVerticesPerLayer> vertices{};
-		const glm::mat4 objectMatrix = m_transformStack.back();
+		const Affine2D objectMatrix = m_transformStack.back();
 		const glm::mat4 projectionView = m_projection * m_viewMatrix;
 
 		for (int layer = 0; layer < kPoolLayerCount; ++layer) {
@@ -1295,7 +1405,7 @@ bool Graphics::DrawPoolEffect(const Texture* baseTex, const Texture* shadingTex,
 							else if (isNight) color = 48.0f / 255.0f;
 							else color = gridX <= 7 ? 192.0f / 255.0f : 128.0f / 255.0f;
 						}
-						const glm::vec4 transformed = objectMatrix * glm::vec4(drawX, drawY, 0.0f, 1.0f);
+						const glm::vec2 transformed = objectMatrix.Apply(drawX, drawY);
 						auto& vertex = vertices[vertexIndex++];
 						vertex.x = transformed.x;
 						vertex.y = transformed.y;
@@ -1356,8 +1466,9 @@ bool Graphics::DrawPoolEffect(const Texture* baseTex, const Texture* shadingTex,
 
 	const uint32_t matrixIndex =
 		static_cast<uint32_t>(fr.ssboCursor / sizeof(glm::mat4));
+	const glm::mat4 objectMatrix = m_transformStack.back().ToMat4();
 	std::memcpy(static_cast<char*>(fr.ssbo->MappedPtr()) + fr.ssboCursor,
-		&m_transformStack.back(), matrixBytes);
+		&objectMatrix, matrixBytes);
 
 	const uint32_t firstVertex =
 		static_cast<uint32_t>(fr.vboCursor / sizeof(BatchVertex));
@@ -1480,7 +1591,7 @@ bool Graphics::InitializeOpenGL(pvz::OpenGLRenderer* renderer,
 void Graphics::DrawTextureMatrix(const Texture* tex, const glm::mat4& transform,
 	float pivotX, float pivotY, const glm::vec4& tint, BlendMode blendMode) {
 	if (!tex) return;
-	if (tl_record) { RecordDrawTextureMatrix(*tl_record, tex, transform, pivotX, pivotY, tint, blendMode); return; }
+	if (tl_record) { RecordDrawTextureMatrix(*tl_record, tex, Affine2D::FromMat4(transform), pivotX, pivotY, tint, blendMode); return; }
 
 	// 图集重映射：若该纹理已被打进图集页，则改绑图集页并把 UV 收窄到子矩形
 	const Texture* bindTex = tex;
@@ -1491,18 +1602,13 @@ void Graphics::DrawTextureMatrix(const Texture* tex, const glm::mat4& transform,
 	}
 	int texIndex = BindTexture(bindTex->BindingId());
 
-	glm::mat4 pivotTransform;
+	Affine2D pivotTransform = Affine2D::FromMat4(transform);
 	if (pivotX != 0.0f || pivotY != 0.0f) {
-		glm::vec3 pivot(pivotX, pivotY, 0.0f);
-		pivotTransform = glm::translate(glm::mat4(1.0f), pivot) *
-			transform *
-			glm::translate(glm::mat4(1.0f), -pivot);
-	}
-	else {
-		pivotTransform = transform;
+		pivotTransform = Affine2D::Translation(pivotX, pivotY) * pivotTransform
+			* Affine2D::Translation(-pivotX, -pivotY);
 	}
-	// 栈顶为单位阵时跳过 mat4×mat4（Animator::Draw 压入单位阵，~9万 sprite/帧的串行热点）
-	glm::mat4 finalMatrix = m_transformIsIdentity.back()
+	// 栈顶为单位阵时跳过仿射复合（Animator::Draw 压入单位阵，~9万 sprite/帧的串行热点）
+	const Affine2D finalMatrix = m_transformIsIdentity.back()
 		? pivotTransform
 		: (m_transformStack.back() * pivotTransform);
 	int matrixIndex = AddMatrix(finalMatrix);
@@ -1590,6 +1696,45 @@ void Graphics::AppendReanimInstance(const InstanceRecord& rec, BlendMode blendMo
 	m_batchInstances.push_back(clippedRec);
 }
 
+int Graphics::AppendInstanceRun(const InstanceRecord* records, size_t count, BlendMode blendMode) {
+	if (!records || count == 0) return 0;
+	if (tl_record) {
+		for (size_t i = 0; i < count; ++i) {
+			AppendReanimInstance(records[i], blendMode);
+		}
+		return 0;
+	}
+
+	// 与 AppendReanimInstance 主线程路径相同的两条保序规则：先 flush 已积累的 batch，
+	// blend 变化时先 flush 旧实例段。之后整段只剩 chunk 上限一个切点。
+	if (!m_batchVertices.empty()) {
+		FlushBatch();
+	}
+	if (blendMode != m_queuedInstanceBlend) {
+		FlushInstances();
+		m_queuedInstanceBlend = blendMode;
+	}
+	const PackedClipRect clip = CurrentPackedClipRect();
+	size_t done = 0;
+	int draws = 1;
+	while (done < count) {
+		if ((int)m_batchInstances.size() >= m_batchInstancesLimit) {
+			FlushInstances();
+			if (done > 0) ++draws;   // 本段已有记录随这次 flush 提交，余下记录另起一次 draw
+		}
+		const size_t room = static_cast<size_t>(m_batchInstancesLimit) - m_batchInstances.size();
+		const size_t take = std::min(room, count - done);
+		const size_t base = m_batchInstances.size();
+		m_batchInstances.insert(m_batchInstances.end(), records + done, records + done + take);
+		for (size_t i = base; i < base + take; ++i) {
+			m_batchInstances[i].clipMinXY = clip.minXY;
+			m_batchInstances[i].clipMaxXY = clip.maxXY;
+		}
+		done += take;
+	}
+	return draws;
+}
+
 void Graphics::DrawTextureRegion(const Texture* tex,
 	float srcX, float srcY, float srcW, float srcH,
 	float dstX, float dstY, float dstW, float dstH,
@@ -1605,17 +1750,10 @@ void Graphics::DrawTextureRegion(const Texture* tex,
 	float v1 = (srcY + srcH) / tex->height;
 
 	// 构建局部变换矩阵（平移 -> 缩放 -> 绕中心旋转）
-	glm::mat4 local = glm::mat4(1.0f);
-	local = glm::translate(local, glm::vec3(dstX, dstY, 0.0f));
-	local = glm::scale(local, glm::vec3(dstW, dstH, 1.0f));
-	if (rotation != 0.0f) {
-		local = glm::translate(local, glm::vec3(0.5f, 0.5f, 0.0f));
-		local = glm::rotate(local, glm::radians(rotation), glm::vec3(0.0f, 0.0f, 1.0f));
-		local = glm::translate(local, glm::vec3(-0.5f, -0.5f, 0.0f));
-	}
+	const Affine2D local = Affine2D::Rect(dstX, dstY, dstW, dstH, rotation);
 
 	int texIndex = BindTexture(tex->BindingId());
-	glm::mat4 finalMatrix = m_transformStack.back() * local;
+	const Affine2D finalMatrix = m_transformStack.back() * local;
 	int matrixIndex = AddMatrix(finalMatrix);
 
 	// 转换颜色为 0-1 格式
@@ -1636,7 +1774,7 @@ void Graphics::DrawTextureRegion(const Texture* tex,
 
 // UTF-8 解码：从 s[i] 起解一个码点，前进 i。非法字节返回 0xFFFD 并前进 1。
 // HP 字符集（数字/标点/CJK 本体一类二类）全在 BMP，但仍按通用 UTF-8 正确解多字节。
-static uint32_t DecodeUtf8(const std::string& s, size_t& i) {
+static uint32_t DecodeUtf8(std::string_view s, size_t& i) {
 	const unsigned char c = (unsigned char)s[i];
 	uint32_t cp; int extra;
 	if (c < 0x80)             { cp = c;        extra = 0; }
@@ -1660,6 +1798,11 @@ static int ComputeTextRasterSize(int fontSize, float letterboxScale, float& outS
 	return phys;
 }
 
+// 字形图集键：高 32 位字体驻留 id，低 32 位逻辑字号。
+static uint64_t GlyphAtlasKey(pvz::FontFaceId font, int fontSize) {
+	return ((uint64_t)font.index << 32) | (uint32_t)fontSize;
+}
+
 glm::vec2 Graphics::MeasureTextSize(const std::string& text, const std::string& fontKey,
 	int fontSize, float scale) const {
 	if (text.empty() || fontSize <= 0 || scale <= 0.0f) return glm::vec2(0.0f);
@@ -1688,22 +1831,19 @@ uint32_t Graphics::GetOrCreateTextTexture(const std::string& text, const std::st
 	const int physSize = ComputeTextRasterSize(fontSize, m_letterboxScale, superSample);
 	outSuperSample = superSample;
 
-	// 生成缓存键
-	std::stringstream ss;
-	ss << text << "|" << fontKey << "|" << physSize << "|"
-		<< (int)color.r << "," << (int)color.g << "," << (int)color.b << "," << (int)color.a;
-	std::string key = ss.str();
+	// 缓存键：(字体 id, 光栅字号, 打包颜色, 文字) 的 64 位哈希；命中只置 CLOCK 引用位，不分配
+	const SDL_Color sdlColor = ToSDLColor(color);
+	const uint32_t packedColor = (uint32_t)sdlColor.r | ((uint32_t)sdlColor.g << 8)
+		| ((uint32_t)sdlColor.b << 16) | ((uint32_t)sdlColor.a << 24);
+	const pvz::TextCacheKey key = pvz::MakeTextCacheKey(text, m_fontFaces.Intern(fontKey), physSize, packedColor);
 
-	auto it = m_textCache.find(key);
-	if (it != m_textCache.end()) {
-		// 命中缓存：移到链表头部（最近使用）
+	const uint32_t hitSlot = m_textCacheIndex.Find(key);
+	if (hitSlot != pvz::TextCacheIndex::kNoSlot) {
 		Profiler::Get().CountText(/*miss*/false);
-		m_textCacheOrder.erase(it->second.second);
-		m_textCacheOrder.push_front(key);
-		it->second.second = m_textCacheOrder.begin();
-		outWidth = it->second.first.width;
-		outHeight = it->second.first.height;
-		return it->second.first.BindingId();
+		const CachedText& hit = m_textCacheEntries[hitSlot];
+		outWidth = hit.width;
+		outHeight = hit.height;
+		return hit.BindingId();
 	}
 
 	// 未命中：TTF 光栅化 + 格式转换 + GPU 上传（+ 满载时淘汰旧纹理）。这段是串行 replay 里
@@ -1719,22 +1859,16 @@ uint32_t Graphics::GetOrCreateTextTexture(const std::string& text, const std::st
 	outWidth = entry.width;
 	outHeight = entry.height;
 
-	// 超出容量时淘汰最久未使用的条目
-	if ((int)m_textCache.size() >= TEXT_CACHE_MAX_SIZE) {
-		const std::string& lruKey = m_textCacheOrder.back();
-		auto lruIt = m_textCache.find(lruKey);
-		if (lruIt != m_textCache.end()) {
-			if (m_textureBackend && lruIt->second.first.texture) {
-				m_textureBackend->DestroyTexture(lruIt->second.first.texture);
-			}
-			m_textCache.erase(lruIt);
+	bool evicted = false;
+	const uint32_t slot = m_textCacheIndex.Insert(key, evicted);
+	CachedText& stored = m_textCacheEntries[slot];
+	if (evicted) {
+		Profiler::Get().CountTextEvict();
+		if (m_textureBackend && stored.texture) {
+			m_textureBackend->DestroyTexture(stored.texture);
 		}
-		m_textCacheOrder.pop_back();
 	}
-
-	// 插入新条目到链表头部
-	m_textCacheOrder.push_front(key);
-	m_textCache[key] = { entry, m_textCacheOrder.begin() };
+	stored = entry;
 	return entry.BindingId();
 }
 
@@ -1896,10 +2030,9 @@ void Graphics::BuildGlyphAtlas(const std::string& fontKey, int fontSize, GlyphAt
 	atlas.superSample = superSample;
 }
 
-GlyphAtlas& Graphics::GetOrBuildGlyphAtlas(const std::string& fontKey, int fontSize,
+GlyphAtlas& Graphics::GetOrBuildGlyphAtlas(pvz::FontFaceId font, int fontSize,
 	const std::vector<uint32_t>& needed) {
-	const std::string key = fontKey + "|" + std::to_string(fontSize);
-	GlyphAtlas& atlas = m_glyphAtlases[key];
+	GlyphAtlas& atlas = m_glyphAtlases[GlyphAtlasKey(font, fontSize)];
 
 	float ss;
 	const int curPhys = ComputeTextRasterSize(fontSize, m_letterboxScale, ss);
@@ -1908,7 +2041,7 @@ GlyphAtlas& Graphics::GetOrBuildGlyphAtlas(const std::string& fontKey, int fontS
 	for (uint32_t cp : needed)
 		if (atlas.covered.insert(cp).second) needRebuild = true;
 
-	if (needRebuild) BuildGlyphAtlas(fontKey, fontSize, atlas);
+	if (needRebuild) BuildGlyphAtlas(m_fontFaces.Key(font), fontSize, atlas);
 	return atlas;
 }
 
@@ -1961,12 +2094,10 @@ void Graphics::DrawCachedText(const CachedText& handle, float x, float y, float
 	if (tl_record) { RecordDrawCachedText(*tl_record, handle, x, y, scale); return; }
 
 	int texIndex = BindTexture(handle.BindingId());
-	glm::mat4 local = glm::mat4(1.0f);
-	local = glm::translate(local, glm::vec3(x, y, 0.0f));
 	// 超采样纹理：除回逻辑尺寸保证屏幕布局不变（handle.superSample=1 时等价）。
 	const float inv = scale / handle.superSample;
-	local = glm::scale(local, glm::vec3(handle.width * inv, handle.height * inv, 1.0f));
-	glm::mat4 finalMatrix = m_transformStack.back() * local;
+	const Affine2D local = Affine2D::Rect(x, y, handle.width * inv, handle.height * inv);
+	const Affine2D finalMatrix = m_transformStack.back() * local;
 	int matrixIndex = AddMatrix(finalMatrix);
 
 	BatchVertex vertices[6] = {
@@ -2010,12 +2141,10 @@ void Graphics::DrawText(const std::string& text, const std::string& fontKey, int
 	if (texID == 0) return;
 
 	int texIndex = BindTexture(texID);
-	glm::mat4 local = glm::mat4(1.0f);
-	local = glm::translate(local, glm::vec3(x, y, 0.0f));
 	// 纹理按物理像素超采样，除回逻辑尺寸保证屏幕布局不变（superSample=1 时等价）。
 	const float inv = scale / superSample;
-	local = glm::scale(local, glm::vec3(w * inv, h * inv, 1.0f));
-	glm::mat4 finalMatrix = m_transformStack.back() * local;
+	const Affine2D local = Affine2D::Rect(x, y, w * inv, h * inv);
+	const Affine2D finalMatrix = m_transformStack.back() * local;
 	int matrixIndex = AddMatrix(finalMatrix);
 
 	BatchVertex vertices[6] = {
@@ -2048,6 +2177,11 @@ void Graphics::DrawGlyphRun(const std::string& text, const std::string& fontKey,
 	const glm::vec4& color, float x, float y, float scale) {
 	// worker：defer 到主线程 replay 就地发射字形 quad（零光栅化，无 TTF/上传/LRU）；与对象同 z-order。
 	if (tl_record) { RecordDrawGlyphRun(*tl_record, text, fontKey, fontSize, color, x, y, scale); return; }
+	EmitGlyphRun(text, m_fontFaces.Intern(fontKey), fontSize, color, x, y, scale);
+}
+
+void Graphics::EmitGlyphRun(std::string_view text, pvz::FontFaceId font, int fontSize,
+	const glm::vec4& color, float x, float y, float scale) {
 	if (text.empty()) return;
 
 	// 1. 解码本串全部码点。
@@ -2063,10 +2197,10 @@ void Graphics::DrawGlyphRun(const std::string& text, const std::string& fontKey,
 
 	// 3. 取/建图集（当帧把缺码点并入并重建 → 此后所有字形必在）。
 	PROFILE_SCOPE("7b0.glyph_body");
-	GlyphAtlas& atlas = GetOrBuildGlyphAtlas(fontKey, fontSize, cps);
+	GlyphAtlas& atlas = GetOrBuildGlyphAtlas(font, fontSize, cps);
 	if (atlas.BindingId() == 0) {  // 建失败 → fallback 整串 DrawText，保证不消失
 		Profiler::Get().CountGlyphFallback(true);
-		DrawText(text, fontKey, fontSize, color, x, y, scale);
+		DrawText(std::string(text), m_fontFaces.Key(font), fontSize, color, x, y, scale);
 		return;
 	}
 
@@ -2076,7 +2210,7 @@ void Graphics::DrawGlyphRun(const std::string& text, const std::string& fontKey,
 	for (uint32_t cp : cps) {
 		if (atlas.glyphs.find(cp) == atlas.glyphs.end()) {
 			Profiler::Get().CountGlyphFallback(false);
-			DrawText(text, fontKey, fontSize, color, x, y, scale);
+			DrawText(std::string(text), m_fontFaces.Key(font), fontSize, color, x, y, scale);
 			return;
 		}
 	}
@@ -2097,9 +2231,8 @@ void Graphics::DrawGlyphRun(const std::string& text, const std::string& fontKey,
 			const float gy = y + (ascent - gi.bearingY) * invSS;
 			const float gw = gi.pxW * invSS;
 			const float gh = gi.pxH * invSS;
-			glm::mat4 local = glm::translate(glm::mat4(1.0f), glm::vec3(gx, gy, 0.0f));
-			local = glm::scale(local, glm::vec3(gw, gh, 1.0f));
-			const glm::mat4 finalMatrix = m_transformStack.back() * local;
+			const Affine2D local = Affine2D::Rect(gx, gy, gw, gh);
+			const Affine2D finalMatrix = m_transformStack.back() * local;
 			const int matrixIndex = AddMatrix(finalMatrix);
 			const BatchVertex verts[6] = {
 				{0.0f, 1.0f, gi.u0, gi.v1, (uint32_t)texIndex, (uint32_t)matrixIndex, nc.r, nc.g, nc.b, nc.a, 0.0f},
@@ -2118,12 +2251,12 @@ void Graphics::DrawGlyphRun(const std::string& text, const std::string& fontKey,
 
 void Graphics::ClearTextCache() {
 	if (m_textureBackend) {
-		for (auto& kv : m_textCache) {
-			if (kv.second.first.texture) m_textureBackend->DestroyTexture(kv.second.first.texture);
+		for (uint32_t slot = 0; slot < m_textCacheIndex.Size(); ++slot) {
+			if (m_textCacheEntries[slot].texture) m_textureBackend->DestroyTexture(m_textCacheEntries[slot].texture);
 		}
 	}
-	m_textCache.clear();
-	m_textCacheOrder.clear();
+	std::fill(m_textCacheEntries.begin(), m_textCacheEntries.end(), CachedText{});
+	m_textCacheIndex.Clear();
 	ClearGlyphAtlases();
 }
 
@@ -2162,6 +2295,7 @@ void Graphics::UpdateViewMatrix() {
 	if (m_cameraRotation != 0.0f)
 		m_viewMatrix = glm::rotate(m_viewMatrix, glm::radians(-m_cameraRotation), glm::vec3(0.0f, 0.0f, 1.0f));
 	m_viewMatrix = glm::translate(m_viewMatrix, glm::vec3(-m_cameraPos.x, -m_cameraPos.y, 0.0f));
+	RefreshVisibleWorldRect();
 }
 
 void Graphics::SetCameraPosition(float x, float y) {
@@ -2189,6 +2323,7 @@ void Graphics::ResetCamera() {
 	m_cameraZoom = 1.0f;
 	m_cameraRotation = 0.0f;
 	m_viewMatrix = glm::mat4(1.0f);
+	RefreshVisibleWorldRect();
 }
 
 void Graphics::RecomputeLetterbox() {
@@ -2262,9 +2397,9 @@ void Graphics::DrawLine(float x1, float y1, float x2, float y2, const glm::vec4&
 	float r = nc.r, g = nc.g, b = nc.b, a = nc.a;
 
 	// 线段转为 1px 宽四边形，走纹理批次（1×1 白纹理）保证绘制顺序
-	const glm::mat4& transform = m_transformStack.back();
-	glm::vec4 p0 = transform * glm::vec4(x1, y1, 0.0f, 1.0f);
-	glm::vec4 p1 = transform * glm::vec4(x2, y2, 0.0f, 1.0f);
+	const Affine2D& transform = m_transformStack.back();
+	glm::vec2 p0 = transform.Apply(x1, y1);
+	glm::vec2 p1 = transform.Apply(x2, y2);
 
 	float dx = p1.x - p0.x, dy = p1.y - p0.y;
 	float len = sqrtf(dx * dx + dy * dy);
@@ -2272,7 +2407,7 @@ void Graphics::DrawLine(float x1, float y1, float x2, float y2, const glm::vec4&
 	float nx = -dy / len * 0.5f, ny = dx / len * 0.5f;
 
 	int texIndex = BindTexture(m_whiteTexture);
-	int matIndex = AddMatrix(glm::mat4(1.0f));
+	int matIndex = AddMatrix(Affine2D::Identity());
 	float bm = (m_currentBlendMode == BlendMode::Add) ? 1.0f : 0.0f;
 
 	BatchVertex verts[6] = {
@@ -2294,16 +2429,16 @@ void Graphics::DrawRect(float x, float y, float width, float height, const glm::
 	float r = nc.r, g = nc.g, b = nc.b, a = nc.a;
 
 	// 4 条边各转为 1px 宽四边形，走纹理批次
-	const glm::mat4& transform = m_transformStack.back();
-	glm::vec4 p[4] = {
-		transform * glm::vec4(x,         y,          0.0f, 1.0f),
-		transform * glm::vec4(x + width, y,          0.0f, 1.0f),
-		transform * glm::vec4(x + width, y + height, 0.0f, 1.0f),
-		transform * glm::vec4(x,         y + height, 0.0f, 1.0f),
+	const Affine2D& transform = m_transformStack.back();
+	glm::vec2 p[4] = {
+		transform.Apply(x,         y),
+		transform.Apply(x + width, y),
+		transform.Apply(x + width, y + height),
+		transform.Apply(x,         y + height),
 	};
 
 	int texIndex = BindTexture(m_whiteTexture);
-	int matIndex = AddMatrix(glm::mat4(1.0f));
+	int matIndex = AddMatrix(Affine2D::Identity());
 	float bm = (m_currentBlendMode == BlendMode::Add) ? 1.0f : 0.0f;
 
 	for (int i = 0; i < 4; ++i) {
@@ -2333,10 +2468,8 @@ void Graphics::FillRect(float x, float y, float width, float height, const glm::
 	// 使用 1×1 白色纹理加入纹理批次，保证与其他纹理的绘制顺序正确
 	int texIndex = BindTexture(m_whiteTexture);
 
-	glm::mat4 local = glm::mat4(1.0f);
-	local = glm::translate(local, glm::vec3(x, y, 0.0f));
-	local = glm::scale(local, glm::vec3(width, height, 1.0f));
-	glm::mat4 finalMatrix = m_transformStack.back() * local;
+	const Affine2D local = Affine2D::Rect(x, y, width, height);
+	const Affine2D finalMatrix = m_transformStack.back() * local;
 	int matrixIndex = AddMatrix(finalMatrix);
 
 	glm::vec4 nc = NormalizeColor(color);
@@ -2360,17 +2493,17 @@ void Graphics::DrawCircle(float cx, float cy, float radius, const glm::vec4& col
 	float r = nc.r, g = nc.g, b = nc.b, a = nc.a;
 
 	// 每段弧转为 1px 宽四边形，走纹理批次
-	const glm::mat4& transform = m_transformStack.back();
+	const Affine2D& transform = m_transformStack.back();
 
 	int texIndex = BindTexture(m_whiteTexture);
-	int matIndex = AddMatrix(glm::mat4(1.0f));
+	int matIndex = AddMatrix(Affine2D::Identity());
 	float bm = (m_currentBlendMode == BlendMode::Add) ? 1.0f : 0.0f;
 
 	for (int i = 0; i < segments; ++i) {
 		float angle0 = 2.0f * glm::pi<float>() * i / segments;
 		float angle1 = 2.0f * glm::pi<float>() * (i + 1) / segments;
-		glm::vec4 p0 = transform * glm::vec4(cx + radius * cosf(angle0), cy + radius * sinf(angle0), 0.0f, 1.0f);
-		glm::vec4 p1 = transform * glm::vec4(cx + radius * cosf(angle1), cy + radius * sinf(angle1), 0.0f, 1.0f);
+		glm::vec2 p0 = transform.Apply(cx + radius * cosf(angle0), cy + radius * sinf(angle0));
+		glm::vec2 p1 = transform.Apply(cx + radius * cosf(angle1), cy + radius * sinf(angle1));
 
 		float dx = p1.x - p0.x, dy = p1.y - p0.y;
 		float len = sqrtf(dx * dx + dy * dy);
@@ -2397,18 +2530,18 @@ void Graphics::FillCircle(float cx, float cy, float radius, const glm::vec4& col
 	float r = nc.r, g = nc.g, b = nc.b, a = nc.a;
 
 	// 展开三角扇，走纹理批次
-	const glm::mat4& transform = m_transformStack.back();
-	glm::vec4 center = transform * glm::vec4(cx, cy, 0.0f, 1.0f);
+	const Affine2D& transform = m_transformStack.back();
+	glm::vec2 center = transform.Apply(cx, cy);
 
 	int texIndex = BindTexture(m_whiteTexture);
-	int matIndex = AddMatrix(glm::mat4(1.0f));
+	int matIndex = AddMatrix(Affine2D::Identity());
 	float bm = (m_currentBlendMode == BlendMode::Add) ? 1.0f : 0.0f;
 
 	for (int i = 0; i < segments; ++i) {
 		float angle0 = 2.0f * glm::pi<float>() * i / segments;
 		float angle1 = 2.0f * glm::pi<float>() * (i + 1) / segments;
-		glm::vec4 p0 = transform * glm::vec4(cx + radius * cosf(angle0), cy + radius * sinf(angle0), 0.0f, 1.0f);
-		glm::vec4 p1 = transform * glm::vec4(cx + radius * cosf(angle1), cy + radius * sinf(angle1), 0.0f, 1.0f);
+		glm::vec2 p0 = transform.Apply(cx + radius * cosf(angle0), cy + radius * sinf(angle0));
+		glm::vec2 p1 = transform.Apply(cx + radius * cosf(angle1), cy + radius * sinf(angle1));
 
 		BatchVertex verts[3] = {
 			{center.x, center.y, 0.5f, 0.5f, (uint32_t)texIndex, (uint32_t)matIndex, r,g,b,a, bm},
@@ -2449,7 +2582,7 @@ void Graphics::BeginParallelRecord(int numWorkers) {
 	if ((int)m_workerStates.size() < numWorkers) m_workerStates.resize(numWorkers);
 
 	// 当前 Graphics 状态作为每个 worker 的初始基线
-	const glm::mat4& curTop = m_transformStack.back();
+	const Affine2D&  curTop = m_transformStack.back();
 	const bool       curId = m_transformIsIdentity.back() != 0;
 
 	// 默认把所有 slot 的切片置为"零容量 / 空指针"——SliceHasRoom 会直接拒绝写入，
@@ -2660,6 +2793,11 @@ void Graphics::ReplayAndEndParallel() {
 	// SetBlend cmd 必定先于受影响的 vert 出现。
 
 	if (m_numActiveWorkers == 0) return;
+	// 剔除计数与 GPU 提交无关，先于任何早退汇总，避免无活动帧时丢失统计。
+	for (int slot = 0; slot < m_numActiveWorkers; ++slot) {
+		m_frameReanimCulled += m_workerRecords[slot].reanimCulled;
+		m_frameReanimEmitted += m_workerRecords[slot].reanimEmitted;
+	}
 	if (!m_vk || !m_vk->frameOpen) {
 		m_numActiveWorkers = 0;
 		return;
@@ -2716,7 +2854,11 @@ void Graphics::ReplayAndEndParallel() {
 	// DeferredText 渲染策略（按 cmd 的 onTop 标志区分）：
 	//   onTop=false → 在该 cmd 记录的几何位置就地交错渲染（与对象同 z-order，如血量显示）；
 	//   onTop=true  → 收集到此，待所有 slot 几何 emit 完后统一渲染（绝对顶层）。
-	std::vector<const DeferredTextCmd*> pendingTopText;
+	struct PendingTopText {
+		const DeferredTextCmd* cmd;
+		std::string_view text;   // 指向所属 slot 的 textArena，回放结束前有效
+	};
+	std::vector<PendingTopText> pendingTopText;
 
 	// 把帧游标提前推到 post-parallel 预留区：下面 onTop=false 的内联渲染会走 FlushBatch 写顶点，
 	// 必须落在 BeginParallelRecord 保留的余量内，不能与各 slot 切片数据撞车。
@@ -2785,7 +2927,7 @@ void Graphics::ReplayAndEndParallel() {
 				const DeferredTextCmd& t = r.textCmds[cmd.payloadIdx];
 				if (t.onTop) {
 					// 绝对顶层：留到所有几何 emit 完后统一画。
-					pendingTopText.push_back(&t);
+					pendingTopText.push_back({ &t, r.textArena.View(t.text) });
 				}
 				else {
 					// 当前层：emitUpTo 已把本对象 sprite（记录在该 cmd 之前）emit 完，此处就地画文字，
@@ -2796,7 +2938,8 @@ void Graphics::ReplayAndEndParallel() {
 					if (t.hasClipRect) {
 						PushClipRect(t.clipRect.x, t.clipRect.y, t.clipRect.w, t.clipRect.h);
 					}
-					DrawText(t.text, t.fontKey, t.fontSize, t.color, t.x, t.y, t.scale);
+					DrawText(std::string(r.textArena.View(t.text)), m_fontFaces.Key(t.font),
+						t.fontSize, t.color, t.x, t.y, t.scale);
 					FlushBatch();
 					if (t.hasClipRect) {
 						PopClipRect();
@@ -2815,7 +2958,7 @@ void Graphics::ReplayAndEndParallel() {
 					if (t.hasClipRect) {
 						PushClipRect(t.clipRect.x, t.clipRect.y, t.clipRect.w, t.clipRect.h);
 					}
-					DrawGlyphRun(t.text, t.fontKey, t.fontSize, t.color, t.x, t.y, t.scale);
+					EmitGlyphRun(r.textArena.View(t.text), t.font, t.fontSize, t.color, t.x, t.y, t.scale);
 				}
 				{
 					PROFILE_SCOPE("7c.replay_inlineGlyphFlush");
@@ -2863,8 +3006,9 @@ void Graphics::ReplayAndEndParallel() {
 	//   后续 overlay 串行绘制继续从当前游标累加。）
 	if (!pendingTopText.empty()) {
 		PROFILE_SCOPE("7d.replay_topText");
-		for (const DeferredTextCmd* t : pendingTopText) {
-			DrawText(t->text, t->fontKey, t->fontSize, t->color, t->x, t->y, t->scale);
+		for (const PendingTopText& top : pendingTopText) {
+			const DeferredTextCmd* t = top.cmd;
+			DrawText(std::string(top.text), m_fontFaces.Key(t->font), t->fontSize, t->color, t->x, t->y, t->scale);
 		}
 		FlushBatch();
 	}
@@ -2896,9 +3040,10 @@ namespace {
 
 	// 把一个矩阵推进切片 SSBO，返回它在整帧 SSBO 中的绝对下标。
 	// 调用方必须先 SliceHasRoom 通过。
-	inline uint32_t PushSliceMatrix(VkWorkerSlice& sl, const glm::mat4& m) {
+	// SSBO 仍是 mat4 布局（shader 不变），仿射在写入映射内存时展开。
+	inline uint32_t PushSliceMatrix(VkWorkerSlice& sl, const Affine2D& m) {
 		const uint32_t abs = sl.ssboBaseMat + sl.ssboCount;
-		sl.ssboPtr[sl.ssboCount++] = m;
+		sl.ssboPtr[sl.ssboCount++] = m.ToMat4();
 		return abs;
 	}
 
@@ -2957,16 +3102,9 @@ void Graphics::RecordDrawTexture(WorkerRecord& r,
 	VkWorkerSlice& sl = r.slice;
 	if (!SliceHasRoom(sl, 6, 1)) return;
 
-	glm::mat4 local = glm::mat4(1.0f);
-	local = glm::translate(local, glm::vec3(x, y, 0.0f));
-	local = glm::scale(local, glm::vec3(width, height, 1.0f));
-	if (rotation != 0.0f) {
-		local = glm::translate(local, glm::vec3(0.5f, 0.5f, 0.0f));
-		local = glm::rotate(local, glm::radians(rotation), glm::vec3(0.0f, 0.0f, 1.0f));
-		local = glm::translate(local, glm::vec3(-0.5f, -0.5f, 0.0f));
-	}
+	const Affine2D local = Affine2D::Rect(x, y, width, height, rotation);
 	const bool curId = tl_transformIsIdentity->back() != 0;
-	const glm::mat4 finalMatrix = curId ? local : (tl_transformStack->back() * local);
+	const Affine2D finalMatrix = curId ? local : (tl_transformStack->back() * local);
 	const uint32_t matAbs = PushSliceMatrix(sl, finalMatrix);
 
 	const glm::vec4 nt = NormalizeColor(tint);
@@ -2975,7 +3113,7 @@ void Graphics::RecordDrawTexture(WorkerRecord& r,
 }
 
 void Graphics::RecordDrawTextureMatrix(WorkerRecord& r,
-	const Texture* tex, const glm::mat4& transform,
+	const Texture* tex, const Affine2D& transform,
 	float pivotX, float pivotY, const glm::vec4& tint, BlendMode blendMode)
 {
 	// Animator 最热路径（~9 万次/帧）。镜像公开 DrawTextureMatrix 的批处理段，但写进切片。
@@ -3005,19 +3143,14 @@ void Graphics::RecordDrawTextureMatrix(WorkerRecord& r,
 		u0 = tex->aU0; v0 = tex->aV0; u1 = tex->aU1; v1 = tex->aV1;
 	}
 
-	glm::mat4 pivotTransform;
+	Affine2D pivotTransform = transform;
 	if (pivotX != 0.0f || pivotY != 0.0f) {
-		const glm::vec3 pivot(pivotX, pivotY, 0.0f);
-		pivotTransform = glm::translate(glm::mat4(1.0f), pivot)
-			* transform
-			* glm::translate(glm::mat4(1.0f), -pivot);
-	}
-	else {
-		pivotTransform = transform;
+		pivotTransform = Affine2D::Translation(pivotX, pivotY) * transform
+			* Affine2D::Translation(-pivotX, -pivotY);
 	}
-	// 单位阵快速路径——Animator 通常压入单位阵作为基线，跳过 mat4×mat4 节省大量浮点。
+	// 单位阵快速路径——Animator 通常压入单位阵作为基线，跳过仿射复合节省浮点。
 	const bool curId = tl_transformIsIdentity->back() != 0;
-	const glm::mat4 finalMatrix = curId ? pivotTransform
+	const Affine2D finalMatrix = curId ? pivotTransform
 		: (tl_transformStack->back() * pivotTransform);
 	const uint32_t matAbs = PushSliceMatrix(sl, finalMatrix);
 
@@ -3046,16 +3179,9 @@ void Graphics::RecordDrawTextureRegion(WorkerRecord& r,
 	const float u1 = (srcX + srcW) / tex->width;
 	const float v1 = (srcY + srcH) / tex->height;
 
-	glm::mat4 local = glm::mat4(1.0f);
-	local = glm::translate(local, glm::vec3(dstX, dstY, 0.0f));
-	local = glm::scale(local, glm::vec3(dstW, dstH, 1.0f));
-	if (rotation != 0.0f) {
-		local = glm::translate(local, glm::vec3(0.5f, 0.5f, 0.0f));
-		local = glm::rotate(local, glm::radians(rotation), glm::vec3(0.0f, 0.0f, 1.0f));
-		local = glm::translate(local, glm::vec3(-0.5f, -0.5f, 0.0f));
-	}
+	const Affine2D local = Affine2D::Rect(dstX, dstY, dstW, dstH, rotation);
 	const bool curId = tl_transformIsIdentity->back() != 0;
-	const glm::mat4 finalMatrix = curId ? local : (tl_transformStack->back() * local);
+	const Affine2D finalMatrix = curId ? local : (tl_transformStack->back() * local);
 	const uint32_t matAbs = PushSliceMatrix(sl, finalMatrix);
 
 	const glm::vec4 nt = NormalizeColor(tint);
@@ -3074,13 +3200,11 @@ void Graphics::RecordDrawCachedText(WorkerRecord& r,
 	VkWorkerSlice& sl = r.slice;
 	if (!SliceHasRoom(sl, 6, 1)) return;
 
-	glm::mat4 local = glm::mat4(1.0f);
-	local = glm::translate(local, glm::vec3(x, y, 0.0f));
 	// 超采样纹理：除回逻辑尺寸保证屏幕布局不变（handle.superSample=1 时等价）。
 	const float inv = scale / handle.superSample;
-	local = glm::scale(local, glm::vec3(handle.width * inv, handle.height * inv, 1.0f));
+	const Affine2D local = Affine2D::Rect(x, y, handle.width * inv, handle.height * inv);
 	const bool curId = tl_transformIsIdentity->back() != 0;
-	const glm::mat4 finalMatrix = curId ? local : (tl_transformStack->back() * local);
+	const Affine2D finalMatrix = curId ? local : (tl_transformStack->back() * local);
 	const uint32_t matAbs = PushSliceMatrix(sl, finalMatrix);
 
 	const float bm = (tl_blend == BlendMode::Add) ? 1.0f : 0.0f;
@@ -3095,8 +3219,8 @@ void Graphics::RecordDrawText(WorkerRecord& r,
 	// onTop=false：ReplayAndEndParallel 在该 cmd 记录的几何位置就地渲染（对象同 z-order）。
 	// onTop=true ：收集到所有 slot 几何之后统一渲染（绝对顶层）。
 	DeferredTextCmd t;
-	t.text = text;
-	t.fontKey = fontKey;
+	t.text = r.textArena.Append(text);
+	t.font = m_fontFaces.Intern(fontKey);
 	t.fontSize = fontSize;
 	t.color = color;
 	t.x = x;
@@ -3128,8 +3252,10 @@ void Graphics::RecordDrawGlyphRun(WorkerRecord& r,
 	// 线程安全前提：并行录制期主线程不绘制、不触碰 m_glyphAtlases（只读并发 find 安全）；
 	// 图集缺失/缺码点/letterbox 变化走下面的 defer 慢路径，由主线程在 replay 中构建，下帧
 	// 起自动回到快路径。
+	const pvz::FontFaceId font = m_fontFaces.Find(fontKey);
 	do {
-		const auto itA = m_glyphAtlases.find(fontKey + "|" + std::to_string(fontSize));
+		if (!font.IsValid()) break;
+		const auto itA = m_glyphAtlases.find(GlyphAtlasKey(font, fontSize));
 		if (itA == m_glyphAtlases.end()) break;
 		const GlyphAtlas& atlas = itA->second;
 		if (atlas.BindingId() == 0) break;
@@ -3173,7 +3299,7 @@ void Graphics::RecordDrawGlyphRun(WorkerRecord& r,
 		const uint32_t colorRGBA8 = pack8(color.r) | (pack8(color.g) << 8)
 			| (pack8(color.b) << 16) | (pack8(color.a) << 24);
 
-		const glm::mat4& top = tl_transformStack->back();
+		const Affine2D& top = tl_transformStack->back();
 		const bool topIsId = tl_transformIsIdentity->back() != 0;
 		const float invSS = scale / atlas.superSample;
 		const float ascent = (float)atlas.ascent;
@@ -3198,10 +3324,10 @@ void Graphics::RecordDrawGlyphRun(WorkerRecord& r,
 					else {
 						// final = top * T(gx,gy) * S(gw,gh)：线性部分 = top 前两列各乘 gw/gh，
 						// 平移 = top 作用于 (gx,gy)。
-						rec.tA = top[0].x * gw; rec.tB = top[0].y * gw;
-						rec.tC = top[1].x * gh; rec.tD = top[1].y * gh;
-						rec.tx = top[0].x * gx + top[1].x * gy + top[3].x;
-						rec.ty = top[0].y * gx + top[1].y * gy + top[3].y;
+						rec.tA = top.a * gw; rec.tB = top.b * gw;
+						rec.tC = top.c * gh; rec.tD = top.d * gh;
+						rec.tx = top.a * gx + top.c * gy + top.tx;
+						rec.ty = top.b * gx + top.d * gy + top.ty;
 					}
 					rec.u0 = gi.u0; rec.v0 = gi.v0;
 					rec.u1 = gi.u1; rec.v1 = gi.v1;
@@ -3223,8 +3349,8 @@ void Graphics::RecordDrawGlyphRun(WorkerRecord& r,
 	// 慢路径（首帧图集未建 / 新码点 / 建失败 / letterbox 变化 / 超长串）：只打包参数，
 	// 图集构建 + 字形 quad 发射 defer 到主线程 replay（就地、当前层 z-order）。
 	DeferredGlyphRunCmd t;
-	t.text = text;
-	t.fontKey = fontKey;
+	t.text = r.textArena.Append(text);
+	t.font = font.IsValid() ? font : m_fontFaces.Intern(fontKey);
 	t.fontSize = fontSize;
 	t.color = color;
 	t.x = x;
@@ -3250,11 +3376,9 @@ void Graphics::RecordFillRect(WorkerRecord& r,
 	VkWorkerSlice& sl = r.slice;
 	if (!SliceHasRoom(sl, 6, 1)) return;
 
-	glm::mat4 local = glm::mat4(1.0f);
-	local = glm::translate(local, glm::vec3(x, y, 0.0f));
-	local = glm::scale(local, glm::vec3(width, height, 1.0f));
+	const Affine2D local = Affine2D::Rect(x, y, width, height);
 	const bool curId = tl_transformIsIdentity->back() != 0;
-	const glm::mat4 finalMatrix = curId ? local : (tl_transformStack->back() * local);
+	const Affine2D finalMatrix = curId ? local : (tl_transformStack->back() * local);
 	const uint32_t matAbs = PushSliceMatrix(sl, finalMatrix);
 
 	const glm::vec4 nc = NormalizeColor(color);
@@ -3269,12 +3393,12 @@ void Graphics::RecordDrawLine(WorkerRecord& r,
 	// 单段线：6 顶点 + 1 单位矩阵
 	if (!SliceHasRoom(sl, 6, 1)) return;
 
-	const glm::mat4& transform = tl_transformStack->back();
-	const glm::vec4 p0 = transform * glm::vec4(x1, y1, 0.0f, 1.0f);
-	const glm::vec4 p1 = transform * glm::vec4(x2, y2, 0.0f, 1.0f);
+	const Affine2D& transform = tl_transformStack->back();
+	const glm::vec2 p0 = transform.Apply(x1, y1);
+	const glm::vec2 p1 = transform.Apply(x2, y2);
 
 	// 顶点本身已经是世界坐标，所以矩阵走单位阵（shader 用它做 model 变换会等价 no-op）。
-	const uint32_t matAbs = PushSliceMatrix(sl, glm::mat4(1.0f));
+	const uint32_t matAbs = PushSliceMatrix(sl, Affine2D::Identity());
 	const glm::vec4 nc = NormalizeColor(color);
 	const float bm = (tl_blend == BlendMode::Add) ? 1.0f : 0.0f;
 	EmitEdgeQuad(sl, p0.x, p0.y, p1.x, p1.y, m_whiteTexture, matAbs, nc.r, nc.g, nc.b, nc.a, bm);
@@ -3287,14 +3411,14 @@ void Graphics::RecordDrawRect(WorkerRecord& r,
 	// 矩形边：4 个边段，每段 6 顶点 = 24 顶点 + 1 共享单位矩阵
 	if (!SliceHasRoom(sl, 24, 1)) return;
 
-	const glm::mat4& transform = tl_transformStack->back();
-	const glm::vec4 p[4] = {
-		transform * glm::vec4(x,         y,          0.0f, 1.0f),
-		transform * glm::vec4(x + width, y,          0.0f, 1.0f),
-		transform * glm::vec4(x + width, y + height, 0.0f, 1.0f),
-		transform * glm::vec4(x,         y + height, 0.0f, 1.0f),
+	const Affine2D& transform = tl_transformStack->back();
+	const glm::vec2 p[4] = {
+		transform.Apply(x,         y),
+		transform.Apply(x + width, y),
+		transform.Apply(x + width, y + height),
+		transform.Apply(x,         y + height),
 	};
-	const uint32_t matAbs = PushSliceMatrix(sl, glm::mat4(1.0f));
+	const uint32_t matAbs = PushSliceMatrix(sl, Affine2D::Identity());
 	const glm::vec4 nc = NormalizeColor(color);
 	const float bm = (tl_blend == BlendMode::Add) ? 1.0f : 0.0f;
 
@@ -3313,16 +3437,16 @@ void Graphics::RecordDrawCircle(WorkerRecord& r,
 	// segments 个边段，每段 6 顶点 + 1 共享矩阵
 	if (!SliceHasRoom(sl, (uint32_t)segments * 6, 1)) return;
 
-	const glm::mat4& transform = tl_transformStack->back();
-	const uint32_t matAbs = PushSliceMatrix(sl, glm::mat4(1.0f));
+	const Affine2D& transform = tl_transformStack->back();
+	const uint32_t matAbs = PushSliceMatrix(sl, Affine2D::Identity());
 	const glm::vec4 nc = NormalizeColor(color);
 	const float bm = (tl_blend == BlendMode::Add) ? 1.0f : 0.0f;
 
 	for (int i = 0; i < segments; ++i) {
 		const float a0 = 2.0f * glm::pi<float>() * i / segments;
 		const float a1 = 2.0f * glm::pi<float>() * (i + 1) / segments;
-		const glm::vec4 p0 = transform * glm::vec4(cx + radius * std::cos(a0), cy + radius * std::sin(a0), 0.0f, 1.0f);
-		const glm::vec4 p1 = transform * glm::vec4(cx + radius * std::cos(a1), cy + radius * std::sin(a1), 0.0f, 1.0f);
+		const glm::vec2 p0 = transform.Apply(cx + radius * std::cos(a0), cy + radius * std::sin(a0));
+		const glm::vec2 p1 = transform.Apply(cx + radius * std::cos(a1), cy + radius * std::sin(a1));
 		EmitEdgeQuad(sl, p0.x, p0.y, p1.x, p1.y,
 			m_whiteTexture, matAbs, nc.r, nc.g, nc.b, nc.a, bm);
 	}
@@ -3339,9 +3463,9 @@ void Graphics::RecordFillCircle(WorkerRecord& r,
 	// 行为与原实现一致（不会有人在并行 record 路径里画大量 FillCircle）。
 	if (!SliceHasRoom(sl, (uint32_t)segments * 3, 1)) return;
 
-	const glm::mat4& transform = tl_transformStack->back();
-	const glm::vec4 center = transform * glm::vec4(cx, cy, 0.0f, 1.0f);
-	const uint32_t matAbs = PushSliceMatrix(sl, glm::mat4(1.0f));
+	const Affine2D& transform = tl_transformStack->back();
+	const glm::vec2 center = transform.Apply(cx, cy);
+	const uint32_t matAbs = PushSliceMatrix(sl, Affine2D::Identity());
 	const glm::vec4 nc = NormalizeColor(color);
 	const float bm = (tl_blend == BlendMode::Add) ? 1.0f : 0.0f;
 	const PackedClipRect clip = CurrentPackedClipRect();
@@ -3349,8 +3473,8 @@ void Graphics::RecordFillCircle(WorkerRecord& r,
 	for (int i = 0; i < segments; ++i) {
 		const float a0 = 2.0f * glm::pi<float>() * i / segments;
 		const float a1 = 2.0f * glm::pi<float>() * (i + 1) / segments;
-		const glm::vec4 p0 = transform * glm::vec4(cx + radius * std::cos(a0), cy + radius * std::sin(a0), 0.0f, 1.0f);
-		const glm::vec4 p1 = transform * glm::vec4(cx + radius * std::cos(a1), cy + radius * std::sin(a1), 0.0f, 1.0f);
+		const glm::vec2 p0 = transform.Apply(cx + radius * std::cos(a0), cy + radius * std::sin(a0));
+		const glm::vec2 p1 = transform.Apply(cx + radius * std::cos(a1), cy + radius * std::sin(a1));
 
 		BatchVertex* v = sl.vboPtr + sl.vboCount;
 		v[0] = { center.x, center.y, 0.5f, 0.5f, m_whiteTexture, matAbs, nc.r, nc.g, nc.b, nc.a, bm, clip.minXY, clip.maxXY };
@@ -15,13 +15,16 @@
 #include <iostream>
 #include <sstream>
 #include <algorithm>
-#include <list>
 #include <memory>
 #include <cstdint>
 #include <set>
 
 #include "ResourceManager.h"
+#include "Affine2D.h"
 #include "Renderer/RenderBackend.h"
+#include "Renderer/BatchReorder.h"
+#include "Renderer/TextRecord.h"
+#include "Renderer/TextCacheIndex.h"
 
 namespace pvz {
 	class VulkanContext;
@@ -206,10 +209,11 @@ static_assert(sizeof(RecordCmd) == 16, "RecordCmd should pack to 16 bytes");
 /**
  * @brief 延迟执行的 DrawText 参数。worker 不能触碰 LRU 与纹理上传，所以把整
  *        条 DrawText 调用打包，主线程回放时再走原 DrawText 路径。
+ *        文字字节拷进本 slot 的 TextArena、字体存驻留 id，录制期不做堆分配。
  */
 struct DeferredTextCmd {
-	std::string text;
-	std::string fontKey;
+	pvz::TextSpan   text;           ///< WorkerRecord::textArena 内的 UTF-8 字节
+	pvz::FontFaceId font;
 	int         fontSize = 0;
 	glm::vec4   color = glm::vec4(255.0f);
 	float       x = 0.0f;
@@ -225,8 +229,8 @@ struct DeferredTextCmd {
  *        就地调 DrawGlyphRun 发射字形 quad（与对象同 z-order）。血量只需当前层，无 onTop 变体。
  */
 struct DeferredGlyphRunCmd {
-	std::string text;
-	std::string fontKey;
+	pvz::TextSpan   text;           ///< WorkerRecord::textArena 内的 UTF-8 字节
+	pvz::FontFaceId font;
 	int         fontSize = 0;
 	glm::vec4   color = glm::vec4(255.0f);
 	float       x = 0.0f;
@@ -275,9 +279,12 @@ struct WorkerRecord {
 	std::vector<BlendMode>       blendModes;     ///< SetBlend 的 payload
 	std::vector<DeferredTextCmd> textCmds;       ///< DeferredText 的 payload
 	std::vector<DeferredGlyphRunCmd> glyphRunCmds;  ///< DeferredGlyphRun 的 payload
+	pvz::TextArena               textArena;      ///< 两类延迟文字的字节，每帧 Reset、容量复用
+	uint32_t                     reanimCulled = 0;   ///< 本帧视口剔除的 reanim 根对象数
+	uint32_t                     reanimEmitted = 0;  ///< 本帧实际提交的 reanim 根对象数
 
 	// 初始状态快照（BeginParallelRecord 时由主线程填充，SetWorkerSlot 时给 worker 用）
-	glm::mat4              initialTopTransform = glm::mat4(1.0f);
+	Affine2D               initialTopTransform;
 	bool                   initialTopIsIdentity = true;
 	std::vector<ClipRect>  initialClipStack;
 	std::vector<PackedClipRect> initialPackedClipStack;
@@ -290,6 +297,9 @@ struct WorkerRecord {
 		blendModes.clear();
 		textCmds.clear();
 		glyphRunCmds.clear();
+		textArena.Reset();
+		reanimCulled = 0;
+		reanimEmitted = 0;
 		initialClipStack.clear();
 		initialPackedClipStack.clear();
 	}
@@ -300,7 +310,7 @@ struct WorkerRecord {
  *        thread_local 指针指向这里，clip / transform 栈在这里增删，结束时不释放。
  */
 struct WorkerThreadState {
-	std::vector<glm::mat4> transformStack;
+	std::vector<Affine2D>  transformStack;
 	std::vector<char>      transformIsIdentity;
 	std::vector<ClipRect>  clipStack;
 	std::vector<PackedClipRect> packedClipStack;
@@ -355,6 +365,17 @@ public:
 	/// 上一完整帧动态 scissor 变更次数；通用 shader ClipRect 路径下应恒为 0。
 	uint32_t GetLastFrameScissorChangeCount() const { return m_lastFrameScissorChangeCount; }
 
+	/// 上一完整帧 reanim 实例化路径被视口剔除 / 实际提交的根对象数，供剔除回归测试使用。
+	uint32_t GetLastFrameReanimCulledCount() const { return m_lastFrameReanimCulled; }
+	uint32_t GetLastFrameReanimEmittedCount() const { return m_lastFrameReanimEmitted; }
+
+	/**
+	 * @brief 记录一次 reanim 根对象的视口剔除结果。
+	 *        并行录制期写入当前 worker 的 WorkerRecord，ReplayAndEndParallel 在主线程汇总；
+	 *        EndFrame 发布为上一帧统计并上报 Profiler。
+	 */
+	void CountReanimCull(bool culled);
+
 	/**
 	 * @brief 设置窗口尺寸，更新投影矩阵和视口。
 	 * @param width  新宽度
@@ -370,6 +391,12 @@ public:
 	 */
 	void PushTransform(const glm::mat4& transform = glm::mat4(1.0f));
 
+	/**
+	 * @brief 以 2D 仿射形式压栈，省去 mat4 → 仿射的截取；语义同 mat4 版本。
+	 * @param transform 要叠加的 2D 仿射变换
+	 */
+	void PushTransform(const Affine2D& transform);
+
 	/**
 	 * @brief 弹出栈顶变换矩阵。若栈中只剩一个矩阵，则弹出失败并输出错误。
 	 */
@@ -384,7 +411,7 @@ public:
 	 * @brief 对当前变换矩阵应用平移变换。
 	 * @param x X 轴平移量
 	 * @param y Y 轴平移量
-	 * @param z Z 轴平移量（默认为0）
+	 * @param z Z 轴平移量（2D 变换栈忽略，保留参数兼容旧调用）
 	 */
 	void Translate(float x, float y, float z = 0.0f);
 
@@ -394,6 +421,7 @@ public:
 	 * @param x            旋转轴 X 分量
 	 * @param y            旋转轴 Y 分量
 	 * @param z            旋转轴 Z 分量（默认为1，即绕Z轴）
+	 * @note 变换栈是 2D 仿射：非 Z 轴旋转先按 mat4 计算再截取 xy 部分（投影到屏幕平面）。
 	 */
 	void Rotate(float angleDegrees, float x = 0.0f, float y = 0.0f, float z = 1.0f);
 
@@ -401,15 +429,15 @@ public:
 	 * @brief 对当前变换矩阵应用缩放变换。
 	 * @param sx X 轴缩放系数
 	 * @param sy Y 轴缩放系数
-	 * @param sz Z 轴缩放系数（默认为1）
+	 * @param sz Z 轴缩放系数（2D 变换栈忽略）
 	 */
 	void Scale(float sx, float sy, float sz = 1.0f);
 
 	/**
-	 * @brief 获取当前变换矩阵（栈顶矩阵）。
-	 * @return 当前变换矩阵的常量引用
+	 * @brief 获取当前变换（栈顶 2D 仿射）。需要 mat4 时调用 ToMat4()。
+	 * @return 当前变换的常量引用
 	 */
-	const glm::mat4& GetCurrentTransform() const { return m_transformStack.back(); }
+	const Affine2D& GetCurrentTransform() const { return m_transformStack.back(); }
 
 	// ==================== 裁剪栈（屏幕像素矩形，类似 Unity RectMask2D） ====================
 
@@ -586,6 +614,16 @@ public:
 	 */
 	void AppendReanimInstance(const InstanceRecord& rec, BlendMode blendMode);
 
+	/**
+	 * @brief 批量追加一段同 blend 的 InstanceRecord（粒子发射器整段提交）。
+	 *        主线程：裁剪框只取一次，整段按 chunk 上限直接并入 m_batchInstances，
+	 *        与逐条 AppendReanimInstance 的 flush 顺序等价；worker 线程逐条走 slice 路径。
+	 *        调用方负责仅在实例路径启用时使用。
+	 * @return 主线程上为这段记录实际落入的实例 draw 数（被 chunk 上限切开时 >1）；
+	 *         worker 线程录制时 draw 要到回放才切分，返回 0。
+	 */
+	int AppendInstanceRun(const InstanceRecord* records, size_t count, BlendMode blendMode);
+
 	/**
  * @brief 绘制纹理的指定区域到目标矩形。
  * @param tex    纹理指针
@@ -731,6 +769,14 @@ public:
 	void SetInstancePathEnabled(bool e) { m_useInstancePath = e; }
 	bool IsInstancePathEnabled() const { return m_useInstancePath; }
 
+	/**
+	 * @brief 可选的批次重排：FlushBatch 提交前在 z 安全窗口内按纹理/混合模式聚合 quad，
+	 *        减少状态段（= draw 次数）。画面不变，只省提交。默认关闭，main.cpp 的
+	 *        -BatchReorder 开启；-Profile 报告 batchSegs(order)/batchSegs(reorder) 对比。
+	 */
+	void SetBatchReorderEnabled(bool e) { m_batchReorderEnabled = e; }
+	bool IsBatchReorderEnabled() const { return m_batchReorderEnabled; }
+
 	/**
 	 * @brief 清除颜色缓冲和深度缓冲。
 	 */
@@ -768,6 +814,13 @@ public:
 	 */
 	bool IsWorldPointVisible(float worldX, float worldY, float marginPx = 128.0f) const;
 
+	/**
+	 * @brief 世界空间 AABB 是否与当前相机可见区域相交。
+	 *        可见区域 = 逻辑视口（letterbox 内 0..W×0..H）逆变换回世界空间的包围盒，
+	 *        随相机/窗口尺寸变化缓存，判定只有 4 次比较，可在 worker 录制期并发调用。
+	 */
+	bool IsWorldRectVisible(float minX, float minY, float maxX, float maxY) const;
+
 	/**
 	 * @brief 重置摄像机到默认状态（位置归零、缩放1、旋转0）。
 	 */
@@ -894,18 +947,22 @@ private:
 	float     m_cameraZoom = 1.0f;              ///< 缩放倍率
 	float     m_cameraRotation = 0.0f;              ///< 旋转角度（度）
 
-	std::vector<glm::mat4> m_transformStack;   ///< 变换矩阵栈
-	std::vector<char>      m_transformIsIdentity; ///< 与 m_transformStack 平行：该层是否为单位阵（用于跳过冗余 mat4 乘法）
+	std::vector<Affine2D>  m_transformStack;   ///< 变换栈（2D 仿射，6 float/层）
+	std::vector<char>      m_transformIsIdentity; ///< 与 m_transformStack 平行：该层是否为单位阵（用于跳过冗余仿射复合）
 
 	std::vector<ClipRect> m_clipStack;          ///< 裁剪矩形栈（屏幕像素，已经过嵌套交集）
 	std::vector<PackedClipRect> m_packedClipStack; ///< 与 m_clipStack 平行的帧缓冲像素 shader 数据
 
 	// 批处理数据缓冲区
 	std::vector<BatchVertex> m_batchVertices;   ///< 批处理顶点列表
-	std::vector<glm::mat4> m_batchMatrices;     ///< 当前批次使用的变换矩阵列表
+	std::vector<Affine2D>  m_batchMatrices;     ///< 当前批次使用的变换列表（FlushBatch 时才展开为 mat4 / 顶点）
 	std::vector<InstanceRecord> m_batchInstances;   ///< 主线程串行 instance 缓冲（worker 走 slice 不经此处）
 	int m_batchInstancesLimit = 32768;              ///< 单次 flush 上限，~1.8 MB 一次 vkCmdDraw（仅切分 draw 段数，不影响总字节；逐帧 inst 缓冲 grow-on-demand，见 Graphics.cpp）
 	bool m_useInstancePath = true;   ///< Task 7: false强制走 slow path 做 A/B baseline
+	bool m_batchReorderEnabled = false;              ///< FlushBatch 前是否做 z 安全重排
+	std::vector<pvz::BatchPrimitive> m_reorderPrims;  ///< 重排临时：每 quad 的状态键 + 屏幕包围盒（跨帧复用 capacity）
+	std::vector<uint32_t> m_reorderOrder;             ///< 重排临时：新顺序下的原 quad 下标
+	std::vector<BatchVertex> m_reorderScratch;        ///< 重排临时：按新顺序拷出的顶点，与 m_batchVertices 交换
 
 	size_t m_batchBufferCapacity = 0;             ///< 当前 VBO 容量（顶点个数）
 
@@ -914,6 +971,16 @@ private:
 	uint32_t m_lastFrameDrawCallCount = 0;         ///< 上一完整帧实际 draw 次数
 	uint32_t m_frameScissorChangeCount = 0;        ///< ClipRect 动态 scissor 回归计数（shader 裁剪下应恒为 0）
 	uint32_t m_lastFrameScissorChangeCount = 0;    ///< 上一完整帧的动态 scissor 回归计数
+	uint32_t m_frameReanimCulled = 0;              ///< 当前帧主线程 + 已汇总 worker 的 reanim 剔除数
+	uint32_t m_frameReanimEmitted = 0;             ///< 当前帧主线程 + 已汇总 worker 的 reanim 提交数
+	uint32_t m_lastFrameReanimCulled = 0;          ///< 上一完整帧的 reanim 剔除数
+	uint32_t m_lastFrameReanimEmitted = 0;         ///< 上一完整帧的 reanim 提交数
+
+	// 相机可见区域的世界空间 AABB，由 RefreshVisibleWorldRect 在相机/投影变化时更新。
+	float m_visibleWorldMinX = 0.0f;
+	float m_visibleWorldMinY = 0.0f;
+	float m_visibleWorldMaxX = 0.0f;
+	float m_visibleWorldMaxY = 0.0f;
 
 	uint32_t m_whiteTexture = 0;   ///< 当前后端的 1×1 纯白纹理 binding，用于几何批处理
 	pvz::RenderTexture* m_whiteTextureHandle = nullptr;
@@ -929,13 +996,13 @@ private:
 	pvz::TextureBackend* m_textureBackend = nullptr;
 	pvz::RendererBackend m_backend = pvz::RendererBackend::Vulkan;
 
-	static const int TEXT_CACHE_MAX_SIZE = 1024;  ///< 文字缓存最大条目数（LRU 淘汰）
-	std::list<std::string> m_textCacheOrder;     ///< LRU 顺序链表（front = 最近使用）
-	std::unordered_map<std::string,
-		std::pair<CachedText, std::list<std::string>::iterator>> m_textCache;  ///< 文字纹理 LRU 缓存
+	static const int TEXT_CACHE_MAX_SIZE = 1024;  ///< 文字缓存最大条目数（CLOCK 淘汰）
+	pvz::TextCacheIndex m_textCacheIndex{ TEXT_CACHE_MAX_SIZE };  ///< 文字纹理缓存：哈希键 → 槽位
+	std::vector<CachedText> m_textCacheEntries = std::vector<CachedText>(TEXT_CACHE_MAX_SIZE);  ///< 按槽位存放的文字纹理
 	std::unordered_map<std::string, CachedText> m_pinnedTextCache;  ///< 常驻文字纹理缓存（AcquireTextTexture 使用，不淘汰）
 	uint32_t m_textGeneration = 0;  ///< pinned 缓存代际号；ClearPinnedTextCache 递增，用于失效持有方的旧句柄
-	std::unordered_map<std::string, GlyphAtlas> m_glyphAtlases;  ///< HUD 字形图集，键 = "fontKey|fontSize"
+	pvz::FontFaceRegistry m_fontFaces;  ///< fontKey 驻留表：录制命令与字形图集按 FontFaceId 索引
+	std::unordered_map<uint64_t, GlyphAtlas> m_glyphAtlases;  ///< HUD 字形图集，键 = GlyphAtlasKey(字体 id, 字号)
 
 	// ==================== 多线程录制状态 ====================
 	std::vector<WorkerRecord>      m_workerRecords;       ///< 每个 worker slot 一份的录制缓冲
@@ -974,6 +1041,10 @@ private:
 	 * @brief 根据摄像机状态重新计算视图矩阵。
 	 */
 	void UpdateViewMatrix();
+	/** 重新计算 m_visibleWorld*，须在 m_projection / m_viewMatrix 任一变化后调用。 */
+	void RefreshVisibleWorldRect();
+	/** EndFrame 收尾：把本帧 reanim 剔除计数发布为上一帧统计并上报 Profiler。 */
+	void PublishReanimCullStats();
 
 	/**
 	 * @brief 求两个屏幕像素矩形的交集（左上原点）。无交集时返回 w/h 为 0 的退化矩形。
@@ -998,11 +1069,11 @@ private:
 	int BindTexture(uint32_t textureID);
 
 	/**
-	 * @brief 将变换矩阵添加到批处理矩阵列表，返回矩阵索引。
-	 * @param matrix 变换矩阵
+	 * @brief 将变换添加到批处理矩阵列表，返回矩阵索引。
+	 * @param matrix 2D 仿射变换（Vulkan 上传 SSBO 时展开为 mat4）
 	 * @return 矩阵索引
 	 */
-	int AddMatrix(const glm::mat4& matrix);
+	int AddMatrix(const Affine2D& matrix);
 
 	/**
 	 * @brief 向批处理顶点列表中添加多个顶点。
@@ -1039,12 +1110,19 @@ private:
 		int fontSize, const glm::vec4& color, CachedText& out);
 
 	/**
-	 * @brief 取/建 (fontKey,fontSize) 的字形图集，并确保 needed 里的码点全部已烘入（当帧收敛）。
+	 * @brief 取/建 (font,fontSize) 的字形图集，并确保 needed 里的码点全部已烘入（当帧收敛）。
 	 *        physSize 变化（letterbox）或有新码点时整张重建。返回引用恒有效（unordered_map 引用稳定）。
 	 */
-	GlyphAtlas& GetOrBuildGlyphAtlas(const std::string& fontKey, int fontSize,
+	GlyphAtlas& GetOrBuildGlyphAtlas(pvz::FontFaceId font, int fontSize,
 		const std::vector<uint32_t>& needed);
 
+	/**
+	 * @brief DrawGlyphRun 的主线程主体：按驻留字体 id 取图集并就地发射字形 quad。
+	 *        串行调用与并行 replay 共用；text 可直接指向 worker 的 TextArena。
+	 */
+	void EmitGlyphRun(std::string_view text, pvz::FontFaceId font, int fontSize,
+		const glm::vec4& color, float x, float y, float scale);
+
 	/**
 	 * @brief 按 atlas.covered 全集（重新）烘焙图集：逐字形 TTF 度量+渲染→单行打包→上传一张纹理。
 	 *        旧纹理先还给当前后端。失败时令 atlas.texture=nullptr（上层 fallback）。
@@ -1067,6 +1145,13 @@ private:
 	 */
 	void ResizeBatchBuffer(size_t newCapacity);
 
+	/**
+	 * @brief FlushBatch 提交前的可选重排：按 6 顶点 quad 计算屏幕包围盒，调用
+	 *        pvz::ReorderBatchPrimitives 并就地改写 m_batchVertices 顺序（矩阵按下标引用，不动）。
+	 * @param textureSensitive 后端是否按纹理切段（OpenGL=true；Vulkan bindless=false）
+	 */
+	void ReorderBatchForSubmit(bool textureSensitive);
+
 	// ==================== Record 路径辅助函数 ====================
 	// 这些函数把对应的 DrawXxx 调用录制到当前 worker 的 WorkerRecord 中，不调任何
 	// 渲染后端 API。每个函数对应一个公开 DrawXxx，做的事情是公开版批处理路径里"BindTexture
@@ -1078,7 +1163,7 @@ private:
 		float rotation, const glm::vec4& tint);
 
 	void RecordDrawTextureMatrix(WorkerRecord& r,
-		const Texture* tex, const glm::mat4& transform,
+		const Texture* tex, const Affine2D& transform,
 		float pivotX, float pivotY, const glm::vec4& tint, BlendMode blendMode);
 
 	void RecordDrawTextureRegion(WorkerRecord& r,
@@ -0,0 +1,190 @@
+#include "LevelSaveBenchmark.h"
+#include "LevelSaveFormat.h"
+#include "SaveSchema.h"
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+namespace {
+	using Clock = std::chrono::steady_clock;
+
+	double ElapsedMs(Clock::time_point start)
+	{
+		return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+	}
+
+	double Median(std::vector<double> samples)
+	{
+		if (samples.empty()) return 0.0;
+		std::sort(samples.begin(), samples.end());
+		return samples[samples.size() / 2];
+	}
+
+	void AddAnimState(nlohmann::json& j, const char* track, float frame)
+	{
+		j["animTrack"] = track;
+		j["animFrame"] = frame;
+		j["animSpeed"] = 1.0f;
+		j["animClipSpeed"] = 0.0f;
+		j["animPlayState"] = 0;
+		j["animTargetTrack"] = "";
+		j["animTargetTrackSpeed"] = 0.0f;
+		j["animTargetTrackBlendTime"] = 0.5f;
+	}
+
+	bool WriteFile(const std::filesystem::path& path, const std::string& content)
+	{
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
+		file.write(content.data(), static_cast<std::streamsize>(content.size()));
+		return static_cast<bool>(file);
+	}
+
+	std::string ReadFile(const std::filesystem::path& path)
+	{
+		std::ifstream file(path, std::ios::binary);
+		return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	}
+}
+
+nlohmann::json MakeSyntheticLevelDocument(int zombieCount, int plantCount)
+{
+	nlohmann::json j;
+	j["schemaVersion"] = SaveSchema::kCurrentLevelVersion;
+	j["boardState"] = 1;
+	j["isSurvival"] = true;
+	j["survivalRound"] = 12;
+	j["sun"] = 4250;
+	j["sunCountDown"] = 6.5f;
+	j["currentWave"] = 18;
+	j["maxWave"] = 20;
+	j["boardFrame"] = 123456;
+	j["nextPlantID"] = plantCount + 1;
+	j["nextZombieID"] = zombieCount + 1;
+
+	nlohmann::json plants = nlohmann::json::array();
+	for (int i = 0; i < plantCount; ++i) {
+		nlohmann::json p;
+		p["id"] = i + 1;
+		p["type"] = i % 40;
+		p["row"] = i % 6;
+		p["column"] = (i / 6) % 9;
+		p["health"] = 300 - (i % 7) * 25;
+		p["maxHealth"] = 300;
+		p["isSleeping"] = false;
+		p["wakeUpTimer"] = 0.0f;
+		p["shutdownTimer"] = 0.0f;
+		p["isSquished"] = false;
+		AddAnimState(p, "anim_idle", static_cast<float>(i % 24) + 0.25f);
+		if (i % 3 == 0) p["extraData"] = { { "shootTimer", 0.75f + 0.01f * (i % 50) } };
+		plants.push_back(std::move(p));
+	}
+	j["plants"] = std::move(plants);
+
+	nlohmann::json zombies = nlohmann::json::array();
+	for (int i = 0; i < zombieCount; ++i) {
+		nlohmann::json z;
+		z["id"] = i + 1;
+		z["type"] = i % 30;
+		z["row"] = i % 6;
+		z["x"] = 180.0f + static_cast<float>((i * 37) % 700) + 0.125f * (i % 8);
+		z["y"] = 95.0f + 100.0f * (i % 6);
+		z["bodyHealth"] = 270 - (i % 11) * 10;
+		z["bodyMaxHealth"] = 270;
+		z["helmType"] = i % 4;
+		z["helmHealth"] = (i % 4) ? 370 : 0;
+		z["helmMaxHealth"] = (i % 4) ? 370 : 0;
+		z["shieldType"] = (i % 9 == 0) ? 1 : 0;
+		z["shieldHealth"] = (i % 9 == 0) ? 1100 : 0;
+		z["shieldMaxHealth"] = (i % 9 == 0) ? 1100 : 0;
+		z["spawnWave"] = i % 20;
+		z["attackDamage"] = 100;
+		z["needDropArm"] = true;
+		z["needDropHead"] = true;
+		z["slowTimer"] = (i % 5 == 0) ? 3.5f : 0.0f;
+		z["frozenTimer"] = 0.0f;
+		z["butterTimer"] = 0.0f;
+		z["mindControlled"] = false;
+		AddAnimState(z, (i % 4 == 0) ? "anim_eat" : "anim_walk", static_cast<float>(i % 47) + 0.5f);
+		if (i % 10 == 0) z["extraData"] = { { "phase", i % 3 }, { "timer", 1.25f } };
+		zombies.push_back(std::move(z));
+	}
+	j["zombies"] = std::move(zombies);
+	j["bullets"] = nlohmann::json::array();
+	j["suns"] = nlohmann::json::array();
+	j["mowers"] = nlohmann::json::array();
+	j["cards"] = nlohmann::json::array();
+	return j;
+}
+
+LevelSaveBenchResult RunLevelSaveBenchmark(const std::string& directory, int zombieCount, int repeats)
+{
+	LevelSaveBenchResult result;
+	result.zombies = zombieCount;
+	result.repeats = std::max(1, repeats);
+
+	const nlohmann::json document = MakeSyntheticLevelDocument(zombieCount, 45);
+	std::error_code ec;
+	const std::filesystem::path dir = std::filesystem::u8path(directory);
+	std::filesystem::create_directories(dir, ec);
+	const std::filesystem::path jsonPath = dir / "level_save_bench.json";
+	const std::filesystem::path binaryPath = dir / ("level_save_bench" + std::string(LevelSaveFormat::kBinaryExtension));
+
+	std::vector<double> jsonSave, jsonLoad, binarySave, binaryLoad;
+	nlohmann::json jsonLoaded, binaryLoaded;
+	std::string error;
+	for (int i = 0; i < result.repeats; ++i) {
+		auto start = Clock::now();
+		const std::string text = document.dump(4);
+		WriteFile(jsonPath, text);
+		jsonSave.push_back(ElapsedMs(start));
+		result.jsonBytes = text.size();
+
+		// 上一轮读回的文档先释放，析构不计入读档耗时
+		jsonLoaded = nlohmann::json();
+		start = Clock::now();
+		jsonLoaded = nlohmann::json::parse(ReadFile(jsonPath), nullptr, false);
+		SaveSchema::UpgradeLevelDocument(jsonLoaded, error);
+		jsonLoad.push_back(ElapsedMs(start));
+
+		start = Clock::now();
+		const std::string bytes = LevelSaveFormat::Encode(document);
+		WriteFile(binaryPath, bytes);
+		binarySave.push_back(ElapsedMs(start));
+		result.binaryBytes = bytes.size();
+
+		binaryLoaded = nlohmann::json();
+		start = Clock::now();
+		if (LevelSaveFormat::Decode(ReadFile(binaryPath), binaryLoaded, error)) {
+			SaveSchema::UpgradeLevelDocument(binaryLoaded, error);
+		}
+		binaryLoad.push_back(ElapsedMs(start));
+	}
+
+	result.jsonSaveMs = Median(jsonSave);
+	result.jsonLoadMs = Median(jsonLoad);
+	result.binarySaveMs = Median(binarySave);
+	result.binaryLoadMs = Median(binaryLoad);
+	result.roundTripEqual = (jsonLoaded == document) && (binaryLoaded == document);
+
+	std::filesystem::remove(jsonPath, ec);
+	std::filesystem::remove(binaryPath, ec);
+	return result;
+}
+
+nlohmann::json LevelSaveBenchToJson(const LevelSaveBenchResult& result)
+{
+	return {
+		{ "zombies", result.zombies },
+		{ "repeats", result.repeats },
+		{ "jsonBytes", result.jsonBytes },
+		{ "binaryBytes", result.binaryBytes },
+		{ "jsonSaveMs", result.jsonSaveMs },
+		{ "jsonLoadMs", result.jsonLoadMs },
+		{ "binarySaveMs", result.binarySaveMs },
+		{ "binaryLoadMs", result.binaryLoadMs },
+		{ "roundTripEqual", result.roundTripEqual },
+	};
+}
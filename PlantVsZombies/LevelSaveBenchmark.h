@@ -0,0 +1,37 @@
+#pragma once
+#ifndef _LEVEL_SAVE_BENCHMARK_H
+#define _LEVEL_SAVE_BENCHMARK_H
+
+#include <cstddef>
+#include <string>
+#include <nlohmann/json.hpp>
+
+struct LevelSaveBenchResult {
+	int zombies = 0;
+	int repeats = 0;
+	std::size_t jsonBytes = 0;
+	std::size_t binaryBytes = 0;
+	double jsonSaveMs = 0.0;      ///< dump(4) + 写盘，与 FileManager::SaveJsonFile 同口径
+	double jsonLoadMs = 0.0;      ///< 读盘 + parse + SaveSchema 升级
+	double binarySaveMs = 0.0;    ///< LevelSaveFormat::Encode + 写盘
+	double binaryLoadMs = 0.0;    ///< 读盘 + 校验解码 + SaveSchema 升级
+	bool roundTripEqual = false;  ///< 两种格式读回的文档与原文档逐值相等
+};
+
+/**
+ * 生成一份当前版本的合成关卡文档：字段名与正式序列化一致，
+ * 僵尸/植物按固定公式铺满，结果与平台、种子无关。
+ */
+nlohmann::json MakeSyntheticLevelDocument(int zombieCount, int plantCount);
+
+/**
+ * -LevelSaveBench：在 directory 下对同一合成文档分别以 JSON 与二进制格式存读 repeats 次，
+ * 取每段中位耗时。不依赖 SDL 与场景，可在资源加载前运行；结束时删除临时文件。
+ */
+LevelSaveBenchResult RunLevelSaveBenchmark(const std::string& directory,
+	int zombieCount = 5000, int repeats = 5);
+
+/** -LevelSaveBench 的输出：全部字段压成一行 JSON，便于日志里直接摘取比较。 */
+nlohmann::json LevelSaveBenchToJson(const LevelSaveBenchResult& result);
+
+#endif
@@ -0,0 +1,582 @@
+#include "LevelSaveFormat.h"
+#include <array>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+	constexpr char kMagic[4] = { 'P', 'V', 'Z', 'L' };
+	constexpr int kMaxDepth = 64;   // 正式文档最深不过 5 层；损坏档不能把解码递归拖进栈溢出
+
+	// 值标签。浮点能无损收窄为 float 时只写 4 字节（存档里的浮点几乎都来自 float 成员）。
+	enum Tag : unsigned char {
+		TAG_NULL = 0,
+		TAG_FALSE,
+		TAG_TRUE,
+		TAG_INT,      // zigzag varint
+		TAG_UINT,     // varint
+		TAG_F32,
+		TAG_F64,
+		TAG_STRING,   // varint 长度 + 字节
+		TAG_ARRAY,    // varint 元素数 + 元素
+		TAG_OBJECT,   // varint 键数 + (键编号, 值)...
+	};
+
+	/** 根对象键名是否为流式恢复的实体数组；返回 LevelArray 下标，否则 -1。 */
+	int FindLevelArray(std::string_view key)
+	{
+		for (std::size_t i = 0; i < std::size(LevelSaveFormat::kLevelArrayNames); ++i) {
+			if (key == LevelSaveFormat::kLevelArrayNames[i]) return static_cast<int>(i);
+		}
+		return -1;
+	}
+
+	std::uint64_t Fnv1a64(std::string_view bytes)
+	{
+		std::uint64_t hash = 0xCBF29CE484222325ull;
+		for (unsigned char c : bytes) {
+			hash ^= c;
+			hash *= 0x100000001B3ull;
+		}
+		return hash;
+	}
+
+	void WriteLittle(std::string& out, std::uint64_t value, int byteCount)
+	{
+		for (int i = 0; i < byteCount; ++i) {
+			out.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+		}
+	}
+
+	std::uint64_t ReadLittle(std::string_view bytes, std::size_t offset, int byteCount)
+	{
+		std::uint64_t value = 0;
+		for (int i = 0; i < byteCount; ++i) {
+			value |= static_cast<std::uint64_t>(static_cast<unsigned char>(bytes[offset + i])) << (8 * i);
+		}
+		return value;
+	}
+
+	/**
+	 * 键名按首次出现顺序编号：首次写"编号 + 字符串"，之后只写编号。
+	 * 上千个同构实体的字段名因此只落盘一次，解码端同样边读边建表，不需要单独的表头。
+	 */
+	class Encoder {
+	public:
+		explicit Encoder(std::string& out) : mOut(out) {}
+
+		/** 根对象：头字段在前，实体数组按恢复顺序殿后，读档端在第一条记录之前就拿到完整头部。 */
+		void Root(const nlohmann::json& document)
+		{
+			if (!document.is_object()) {
+				Value(document);
+				return;
+			}
+			Byte(TAG_OBJECT);
+			Varint(document.size());
+			for (const auto& [key, element] : document.items()) {
+				if (FindLevelArray(key) >= 0) continue;
+				Key(key);
+				Value(element);
+			}
+			for (const char* name : LevelSaveFormat::kLevelArrayNames) {
+				const auto it = document.find(name);
+				if (it == document.end()) continue;
+				Key(name);
+				Value(*it);
+			}
+		}
+
+		void Value(const nlohmann::json& value)
+		{
+			switch (value.type()) {
+			case nlohmann::json::value_t::null:
+				Byte(TAG_NULL);
+				break;
+			case nlohmann::json::value_t::boolean:
+				Byte(value.get<bool>() ? TAG_TRUE : TAG_FALSE);
+				break;
+			case nlohmann::json::value_t::number_integer: {
+				const std::int64_t v = value.get<std::int64_t>();
+				Byte(TAG_INT);
+				Varint((static_cast<std::uint64_t>(v) << 1) ^ static_cast<std::uint64_t>(v >> 63));
+				break;
+			}
+			case nlohmann::json::value_t::number_unsigned:
+				Byte(TAG_UINT);
+				Varint(value.get<std::uint64_t>());
+				break;
+			case nlohmann::json::value_t::number_float: {
+				const double d = value.get<double>();
+				const float f = static_cast<float>(d);
+				if (static_cast<double>(f) == d) {
+					Byte(TAG_F32);
+					std::uint32_t bits;
+					std::memcpy(&bits, &f, sizeof(bits));
+					WriteLittle(mOut, bits, 4);
+				}
+				else {
+					Byte(TAG_F64);
+					std::uint64_t bits;
+					std::memcpy(&bits, &d, sizeof(bits));
+					WriteLittle(mOut, bits, 8);
+				}
+				break;
+			}
+			case nlohmann::json::value_t::string:
+				Byte(TAG_STRING);
+				String(value.get_ref<const std::string&>());
+				break;
+			case nlohmann::json::value_t::array:
+				Byte(TAG_ARRAY);
+				Varint(value.size());
+				for (const auto& element : value) Value(element);
+				break;
+			case nlohmann::json::value_t::object:
+				Byte(TAG_OBJECT);
+				Varint(value.size());
+				for (const auto& [key, element] : value.items()) {
+					Key(key);
+					Value(element);
+				}
+				break;
+			default:
+				// binary / discarded 不会出现在关卡文档里，按 null 落盘保持结构完整
+				Byte(TAG_NULL);
+				break;
+			}
+		}
+
+	private:
+		void Byte(unsigned char b) { mOut.push_back(static_cast<char>(b)); }
+
+		void Varint(std::uint64_t v)
+		{
+			while (v >= 0x80) {
+				Byte(static_cast<unsigned char>(v | 0x80));
+				v >>= 7;
+			}
+			Byte(static_cast<unsigned char>(v));
+		}
+
+		void String(const std::string& s)
+		{
+			Varint(s.size());
+			mOut.append(s);
+		}
+
+		void Key(const std::string& key)
+		{
+			auto [it, inserted] = mKeyIds.try_emplace(key, mKeyIds.size());
+			Varint(it->second);
+			if (inserted) String(key);
+		}
+
+		std::string& mOut;
+		std::unordered_map<std::string, std::uint64_t> mKeyIds;
+	};
+
+	class Decoder {
+	public:
+		explicit Decoder(std::string_view bytes) : mBytes(bytes) {}
+
+		bool Value(nlohmann::json& out, int depth)
+		{
+			if (depth > kMaxDepth) return Fail("嵌套过深");
+			unsigned char tag;
+			if (!Byte(tag)) return false;
+			switch (tag) {
+			case TAG_NULL: out = nullptr; return true;
+			case TAG_FALSE: out = false; return true;
+			case TAG_TRUE: out = true; return true;
+			case TAG_INT: {
+				std::uint64_t z;
+				if (!Varint(z)) return false;
+				out = static_cast<std::int64_t>((z >> 1) ^ (~(z & 1) + 1));
+				return true;
+			}
+			case TAG_UINT: {
+				std::uint64_t v;
+				if (!Varint(v)) return false;
+				out = v;
+				return true;
+			}
+			case TAG_F32: {
+				if (!Need(4)) return false;
+				const auto bits = static_cast<std::uint32_t>(ReadLittle(mBytes, mPos, 4));
+				mPos += 4;
+				float f;
+				std::memcpy(&f, &bits, sizeof(f));
+				out = static_cast<double>(f);
+				return true;
+			}
+			case TAG_F64: {
+				if (!Need(8)) return false;
+				const std::uint64_t bits = ReadLittle(mBytes, mPos, 8);
+				mPos += 8;
+				double d;
+				std::memcpy(&d, &bits, sizeof(d));
+				out = d;
+				return true;
+			}
+			case TAG_STRING: {
+				std::string s;
+				if (!String(s)) return false;
+				out = std::move(s);
+				return true;
+			}
+			case TAG_ARRAY: {
+				std::uint64_t count;
+				if (!Count(count)) return false;
+				out = nlohmann::json::array();
+				auto& array = out.get_ref<nlohmann::json::array_t&>();
+				array.reserve(static_cast<std::size_t>(count));
+				for (std::uint64_t i = 0; i < count; ++i) {
+					array.emplace_back();
+					if (!Value(array.back(), depth + 1)) return false;
+				}
+				return true;
+			}
+			case TAG_OBJECT: {
+				std::uint64_t count;
+				if (!Count(count)) return false;
+				out = nlohmann::json::object();
+				auto& object = out.get_ref<nlohmann::json::object_t&>();
+				for (std::uint64_t i = 0; i < count; ++i) {
+					const std::string* key;
+					if (!Key(key)) return false;
+					// 编码端按 object_t 的有序遍历写出（根对象除外），尾部提示让插入均摊 O(1)
+					auto it = object.emplace_hint(object.end(), *key, nlohmann::json());
+					if (!Value(it->second, depth + 1)) return false;
+				}
+				return true;
+			}
+			default:
+				return Fail("未知值标签 " + std::to_string(tag));
+			}
+		}
+
+		/** 与 Value 同样的结构检查，但不建任何值；流式解码先用它把整份载荷校验一遍。 */
+		bool Skip(int depth)
+		{
+			if (depth > kMaxDepth) return Fail("嵌套过深");
+			unsigned char tag;
+			if (!Byte(tag)) return false;
+			switch (tag) {
+			case TAG_NULL:
+			case TAG_FALSE:
+			case TAG_TRUE:
+				return true;
+			case TAG_INT:
+			case TAG_UINT: {
+				std::uint64_t v;
+				return Varint(v);
+			}
+			case TAG_F32:
+			case TAG_F64: {
+				const std::size_t size = tag == TAG_F32 ? 4 : 8;
+				if (!Need(size)) return false;
+				mPos += size;
+				return true;
+			}
+			case TAG_STRING: {
+				std::uint64_t length;
+				if (!Varint(length) || !Need(length)) return false;
+				mPos += static_cast<std::size_t>(length);
+				return true;
+			}
+			case TAG_ARRAY: {
+				std::uint64_t count;
+				if (!Count(count)) return false;
+				for (std::uint64_t i = 0; i < count; ++i) {
+					if (!Skip(depth + 1)) return false;
+				}
+				return true;
+			}
+			case TAG_OBJECT: {
+				std::uint64_t count;
+				if (!Count(count)) return false;
+				for (std::uint64_t i = 0; i < count; ++i) {
+					const std::string* key;
+					if (!Key(key) || !Skip(depth + 1)) return false;
+				}
+				return true;
+			}
+			default:
+				return Fail("未知值标签 " + std::to_string(tag));
+			}
+		}
+
+		/**
+		 * v2 根对象的流式遍历：头字段收进一个小对象，遇到第一个实体数组时交出，之后逐条交出记录。
+		 * callbacks 为空时只校验结构（含头字段在前、实体数组有序），不建任何值。
+		 */
+		bool Root(const LevelSaveFormat::StreamCallbacks* callbacks)
+		{
+			unsigned char tag;
+			if (!Byte(tag)) return false;
+			if (tag != TAG_OBJECT) return Fail("根节点不是对象");
+			std::uint64_t count;
+			if (!Count(count)) return false;
+
+			nlohmann::json header = nlohmann::json::object();
+			nlohmann::json record;
+			bool headerSent = false;
+			int lastArray = -1;
+			for (std::uint64_t i = 0; i < count; ++i) {
+				const std::string* key;
+				if (!Key(key)) return false;
+				const int array = FindLevelArray(*key);
+				if (array < 0) {
+					if (headerSent) return Fail("头字段 " + *key + " 出现在实体数组之后");
+					if (!callbacks) {
+						if (!Skip(1)) return false;
+						continue;
+					}
+					auto& object = header.get_ref<nlohmann::json::object_t&>();
+					auto it = object.emplace_hint(object.end(), *key, nlohmann::json());
+					if (!Value(it->second, 1)) return false;
+					continue;
+				}
+
+				if (array <= lastArray) return Fail("实体数组重复或顺序错误: " + *key);
+				lastArray = array;
+				if (!headerSent) {
+					headerSent = true;
+					if (callbacks && !callbacks->header(header)) return Reject();
+					header = nlohmann::json();
+				}
+				if (!Byte(tag)) return false;
+				if (tag != TAG_ARRAY) return Fail(std::string(LevelSaveFormat::kLevelArrayNames[array]) + " 不是数组");
+				std::uint64_t records;
+				if (!Count(records)) return false;
+				for (std::uint64_t r = 0; r < records; ++r) {
+					if (!callbacks) {
+						if (!Skip(2)) return false;
+						continue;
+					}
+					if (!Value(record, 2)) return false;
+					if (!callbacks->record(static_cast<LevelSaveFormat::LevelArray>(array), record)) return Reject();
+				}
+			}
+			if (!headerSent && callbacks && !callbacks->header(header)) return Reject();
+			return true;
+		}
+
+		bool AtEnd() const { return mPos == mBytes.size(); }
+		bool Rejected() const { return mRejected; }
+		const std::string& Error() const { return mError; }
+
+	private:
+		bool Reject()
+		{
+			mRejected = true;
+			return false;
+		}
+
+		bool Fail(const std::string& message)
+		{
+			if (mError.empty()) mError = "二进制关卡档载荷损坏: " + message;
+			return false;
+		}
+
+		bool Need(std::uint64_t n)
+		{
+			return n <= mBytes.size() - mPos ? true : Fail("数据被截断");
+		}
+
+		bool Byte(unsigned char& b)
+		{
+			if (!Need(1)) return false;
+			b = static_cast<unsigned char>(mBytes[mPos++]);
+			return true;
+		}
+
+		bool Varint(std::uint64_t& v)
+		{
+			v = 0;
+			for (int shift = 0; shift < 64; shift += 7) {
+				unsigned char b;
+				if (!Byte(b)) return false;
+				v |= static_cast<std::uint64_t>(b & 0x7F) << shift;
+				if ((b & 0x80) == 0) return true;
+			}
+			return Fail("varint 过长");
+		}
+
+		// 每个元素至少占 1 字节：元素数超过剩余字节即为损坏，也防止按伪造长度预留内存
+		bool Count(std::uint64_t& count)
+		{
+			if (!Varint(count)) return false;
+			return count <= mBytes.size() - mPos ? true : Fail("元素数超出剩余数据");
+		}
+
+		bool String(std::string& s)
+		{
+			std::uint64_t length;
+			if (!Varint(length) || !Need(length)) return false;
+			s.assign(mBytes.data() + mPos, static_cast<std::size_t>(length));
+			mPos += static_cast<std::size_t>(length);
+			return true;
+		}
+
+		bool Key(const std::string*& key)
+		{
+			std::uint64_t id;
+			if (!Varint(id)) return false;
+			if (id < mKeys.size()) {
+				key = &mKeys[static_cast<std::size_t>(id)];
+				return true;
+			}
+			if (id != mKeys.size()) return Fail("键编号跳号");
+			std::string name;
+			if (!String(name)) return false;
+			mKeys.push_back(std::move(name));
+			key = &mKeys.back();
+			return true;
+		}
+
+		std::string_view mBytes;
+		std::size_t mPos = 0;
+		std::vector<std::string> mKeys;   // Key 返回的指针只在紧随的 emplace 前使用，扩容不影响
+		std::string mError;
+		bool mRejected = false;   // 回调主动中止，不是数据损坏
+	};
+
+	/** 校验容器头与校验和，取出载荷；未知版本、截断或校验不符时写 error。 */
+	bool OpenContainer(std::string_view bytes, std::uint16_t& version, std::string_view& payload,
+		std::string& error)
+	{
+		if (!LevelSaveFormat::IsBinary(bytes)) {
+			error = "不是二进制关卡档";
+			return false;
+		}
+		if (bytes.size() < LevelSaveFormat::kHeaderSize) {
+			error = "二进制关卡档头部被截断";
+			return false;
+		}
+		version = static_cast<std::uint16_t>(ReadLittle(bytes, 4, 2));
+		if (version == 0 || version > LevelSaveFormat::kContainerVersion) {
+			error = "不支持的二进制容器版本 " + std::to_string(version);
+			return false;
+		}
+		const std::uint64_t payloadSize = ReadLittle(bytes, 8, 8);
+		if (payloadSize != bytes.size() - LevelSaveFormat::kHeaderSize) {
+			error = "二进制关卡档长度不符（写入中断或文件被截断）";
+			return false;
+		}
+		payload = bytes.substr(LevelSaveFormat::kHeaderSize);
+		if (Fnv1a64(payload) != ReadLittle(bytes, 16, 8)) {
+			error = "二进制关卡档校验失败";
+			return false;
+		}
+		return true;
+	}
+
+	bool DecodePayload(std::string_view payload, nlohmann::json& document, std::string& error)
+	{
+		Decoder decoder(payload);
+		nlohmann::json decoded;
+		if (!decoder.Value(decoded, 0)) {
+			error = decoder.Error();
+			return false;
+		}
+		if (!decoder.AtEnd() || !decoded.is_object()) {
+			error = "二进制关卡档载荷不是单个文档对象";
+			return false;
+		}
+		document = std::move(decoded);
+		return true;
+	}
+}
+
+std::string LevelSaveFormat::Encode(const nlohmann::json& document)
+{
+	std::string out;
+	out.append(kMagic, sizeof(kMagic));
+	WriteLittle(out, kContainerVersion, 2);
+	WriteLittle(out, 0, 2);
+	WriteLittle(out, 0, 8);   // 载荷长度与校验在编码完成后回填
+	WriteLittle(out, 0, 8);
+	Encoder(out).Root(document);
+
+	const std::string_view payload = std::string_view(out).substr(kHeaderSize);
+	std::string header;
+	WriteLittle(header, payload.size(), 8);
+	WriteLittle(header, Fnv1a64(payload), 8);
+	out.replace(8, header.size(), header);
+	return out;
+}
+
+bool LevelSaveFormat::IsBinary(std::string_view bytes)
+{
+	return bytes.size() >= sizeof(kMagic) && std::memcmp(bytes.data(), kMagic, sizeof(kMagic)) == 0;
+}
+
+bool LevelSaveFormat::Decode(std::string_view bytes, nlohmann::json& document, std::string& error)
+{
+	std::uint16_t version = 0;
+	std::string_view payload;
+	return OpenContainer(bytes, version, payload, error) && DecodePayload(payload, document, error);
+}
+
+bool LevelSaveFormat::DecodeStreaming(std::string_view bytes, const StreamCallbacks& callbacks,
+	std::string& error)
+{
+	std::uint16_t version = 0;
+	std::string_view payload;
+	if (!OpenContainer(bytes, version, payload, error)) return false;
+	if (version < 2) {
+		// v1 根对象按键名排序写出，头字段与实体数组交错，只能整树解码后再分发
+		nlohmann::json document;
+		return DecodePayload(payload, document, error) && StreamDocument(document, callbacks, error);
+	}
+
+	Decoder validator(payload);
+	if (!validator.Root(nullptr)) {
+		error = validator.Error();
+		return false;
+	}
+	if (!validator.AtEnd()) {
+		error = "二进制关卡档载荷不是单个文档对象";
+		return false;
+	}
+	Decoder decoder(payload);
+	if (!decoder.Root(&callbacks)) {
+		if (!decoder.Rejected()) error = decoder.Error();
+		return false;
+	}
+	return true;
+}
+
+bool LevelSaveFormat::StreamDocument(nlohmann::json& document, const StreamCallbacks& callbacks,
+	std::string& error)
+{
+	if (!document.is_object()) {
+		error = "关卡文档根节点不是对象";
+		return false;
+	}
+	for (const char* name : kLevelArrayNames) {
+		const auto it = document.find(name);
+		if (it != document.end() && !it->is_array()) {
+			error = std::string(name) + " 不是数组";
+			return false;
+		}
+	}
+
+	std::array<nlohmann::json, static_cast<std::size_t>(LevelArray::Count)> arrays;
+	for (std::size_t i = 0; i < arrays.size(); ++i) {
+		const auto it = document.find(kLevelArrayNames[i]);
+		if (it == document.end()) continue;
+		arrays[i] = std::move(*it);
+		document.erase(it);
+	}
+	if (!callbacks.header(document)) return false;
+	for (std::size_t i = 0; i < arrays.size(); ++i) {
+		for (auto& record : arrays[i]) {
+			if (!callbacks.record(static_cast<LevelArray>(i), record)) return false;
+		}
+		arrays[i] = nlohmann::json();   // 逐个数组释放，后面的实体创建不必与整份文档并存
+	}
+	return true;
+}
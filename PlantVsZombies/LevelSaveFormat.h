@@ -0,0 +1,95 @@
+#pragma once
+#ifndef _LEVEL_SAVE_FORMAT_H
+#define _LEVEL_SAVE_FORMAT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <nlohmann/json.hpp>
+
+/**
+ * 关卡存档的二进制容器：固定 24 字节头 + 正式关卡文档的紧凑编码。
+ *
+ * 头部（小端）：
+ *   [0..4)   魔数 "PVZL"
+ *   [4..6)   容器版本
+ *   [6..8)   保留，写 0
+ *   [8..16)  载荷字节数
+ *   [16..24) 载荷 FNV-1a 64 校验
+ *
+ * 载荷是带类型标签的值树：键名按首次出现编号、之后只写编号，可无损收窄的浮点写 4 字节。
+ * 同构实体上千条时字段名只落盘一次，解码也只需建一次键串。
+ *
+ * 容器 v2 起根对象先写全部头字段，再按 LevelArray 顺序写实体数组，读档可以边解码边建实体
+ * （DecodeStreaming），不必先构建整棵文档树；v1 档仍可读，流式接口对它退回整树解码。
+ *
+ * 容器只负责编码与完整性；载荷仍是带 schemaVersion 的同一份文档，解码后照常交给
+ * SaveSchema::UpgradeLevelDocument / UpgradeLevelRecord，字段迁移规则与 JSON 档完全共用。
+ * JSON 保留为导出/调试格式：读档按内容嗅探，两种文件都能加载。
+ */
+namespace LevelSaveFormat {
+	inline constexpr std::uint16_t kContainerVersion = 2;
+	inline constexpr std::size_t kHeaderSize = 24;
+
+	/** 二进制档扩展名（正式关卡档）；JSON 导出档仍用 .json。 */
+	inline constexpr const char* kBinaryExtension = ".bin";
+
+	/** 编码为完整的二进制档内容（头 + 载荷）。 */
+	std::string Encode(const nlohmann::json& document);
+
+	/** 内容以魔数开头即视为二进制档；其余按 JSON 文本处理。 */
+	bool IsBinary(std::string_view bytes);
+
+	/**
+	 * 校验头部与载荷并解码出文档。
+	 * 魔数不符、未知容器版本、长度截断或校验不符时返回 false 并写 error，不修改 document。
+	 */
+	bool Decode(std::string_view bytes, nlohmann::json& document, std::string& error);
+
+	/** 逐条恢复的实体数组，按读档时的恢复顺序排列（植物先于僵尸，僵尸先于子弹……）。 */
+	enum class LevelArray : std::size_t {
+		Plants,
+		Mowers,
+		Zombies,
+		Bullets,
+		Suns,
+		Trophies,
+		Craters,
+		Cards,
+		Ladders,
+		Count,
+	};
+
+	inline constexpr const char* kLevelArrayNames[] = {
+		"plants", "mowers", "zombies", "bullets", "suns", "trophies", "craters", "cards", "ladders",
+	};
+	static_assert(std::size(kLevelArrayNames) == static_cast<std::size_t>(LevelArray::Count),
+		"每个 LevelArray 都要有对应的字段名");
+
+	/**
+	 * 流式读档回调。任一回调返回 false 即停止解码并返回 false，此时 error 保持为空。
+	 * header：根对象里除实体数组外的全部字段，在第一条记录之前恰好调用一次，可就地做 SaveSchema 升级。
+	 * record：实体记录逐条到达；数组之间按 LevelArray 顺序，数组内按存档顺序。record 可被移走，回调返回后即被复用。
+	 */
+	struct StreamCallbacks {
+		std::function<bool(nlohmann::json& header)> header;
+		std::function<bool(LevelArray array, nlohmann::json& record)> record;
+	};
+
+	/**
+	 * 按 SAX 方式解码二进制档：先校验整份载荷（不建树），再逐条交出记录，峰值内存只有头字段与单条记录。
+	 * 校验在任何回调之前完成，回调开始后不会再因为数据损坏中途失败。
+	 */
+	bool DecodeStreaming(std::string_view bytes, const StreamCallbacks& callbacks, std::string& error);
+
+	/**
+	 * 把已建好的文档树按与 DecodeStreaming 相同的顺序交给回调；JSON 档与内存快照共用同一条恢复路径。
+	 * 实体数组会从 document 中移出。
+	 */
+	bool StreamDocument(nlohmann::json& document, const StreamCallbacks& callbacks, std::string& error);
+}
+
+#endif
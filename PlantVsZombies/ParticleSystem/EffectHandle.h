@@ -0,0 +1,32 @@
+#pragma once
+#ifndef __EFFECT_HANDLE_H__
+#define __EFFECT_HANDLE_H__
+
+#include <cstdint>
+
+/**
+ * 已解析的特效配置 id：ParticleConfigManager 加载 XML 后为每个特效名分配的稠密下标。
+ * 重复加载只追加新名字，已发出的 id 始终有效。默认构造为无效 id。
+ */
+struct EffectId {
+	std::int32_t index = -1;
+
+	bool IsValid() const { return index >= 0; }
+	bool operator==(const EffectId& o) const { return index == o.index; }
+	bool operator!=(const EffectId& o) const { return index != o.index; }
+};
+
+/**
+ * 单个在场特效实例的句柄：槽位 + 代数。实例销毁时槽位代数递增，
+ * 旧句柄随之失效，不会误指到复用该槽位的新实例。默认构造为无效句柄。
+ */
+struct EffectInstanceHandle {
+	std::uint32_t slot = UINT32_MAX;
+	std::uint32_t generation = 0;
+
+	bool IsValid() const { return slot != UINT32_MAX; }
+	bool operator==(const EffectInstanceHandle& o) const { return slot == o.slot && generation == o.generation; }
+	bool operator!=(const EffectInstanceHandle& o) const { return !(*this == o); }
+};
+
+#endif
@@ -0,0 +1,23 @@
+#pragma once
+#ifndef __PARTICLE_BENCHMARK_H__
+#define __PARTICLE_BENCHMARK_H__
+
+class ParticleSystem;
+class ThreadPool;
+
+struct ParticleBenchResult {
+	int effectCount = 0;
+	int liveParticles = 0;       ///< 计时开始时的存活粒子数
+	double serialMsPerStep = 0.0;
+	double parallelMsPerStep = 0.0;
+};
+
+/**
+ * -ParticleBench：轮流发射全部已加载的 XML 特效（运行期时长覆盖为长时循环），
+ * 直到存活粒子达到 targetParticles，然后分别计时 frames 个串行 Step 与并行 Step。
+ * 需在资源与粒子配置加载完成后、进入主循环前调用；结束时清空全部特效。
+ */
+ParticleBenchResult RunParticleBenchmark(ParticleSystem& system, ThreadPool* workers,
+	int targetParticles = 100000, int frames = 300);
+
+#endif
@@ -1,17 +1,128 @@
 #include "ParticleConfig.h"
+#include "ParticleConfigCache.h"
+#include "../FileManager.h"
 #include "../Logger.h"
+#include <algorithm>
+#include <chrono>
 
 ParticleConfigManager::ParticleConfigManager(Graphics* graphics)
 	: m_graphics(graphics)
 	, xmlLoader(std::make_unique<ParticleXMLLoader>()) {
 }
 
-bool ParticleConfigManager::LoadXMLConfigs(const std::string& directory) {
+bool ParticleConfigManager::LoadXMLConfigs(const std::string& directory, const std::string& cachePath) {
 	if (!xmlLoader) {
 		LOG_ERROR("Particle") << "XML加载器未初始化";
 		return false;
 	}
-	return xmlLoader->LoadFromDirectory(directory);
+	const auto start = std::chrono::steady_clock::now();
+
+	// 经构建期烘焙的清单列举（FileManager::ListResourceFiles 经 SDL_RWops 读，APK 可读），
+	// 不再用 std::filesystem，使粒子配置目录在 Android 上也能列举 APK assets。
+	const std::vector<std::string> xmlFiles = FileManager::ListResourceFiles(directory, ".xml");
+	if (xmlFiles.empty()) {
+		LOG_WARN("Particle") << "粒子配置目录为空: " << directory;
+		return false;
+	}
+
+	// 源文件总要读一遍算哈希（统一走 SDL_RWops，Android 可读 APK assets）；省下的是解析
+	std::vector<std::string> sources;
+	sources.reserve(xmlFiles.size());
+	ParticleConfigCache::SourceHasher hasher;
+	for (const std::string& file : xmlFiles) {
+		sources.push_back(FileManager::LoadFileAsString(file));
+		hasher.Add(file, sources.back());
+	}
+	const std::uint64_t sourceHash = hasher.Value();
+
+	bool fromCache = false;
+	if (!cachePath.empty()) {
+		const std::vector<char> blob = FileManager::LoadFileAsBinary(cachePath);
+		std::vector<ParticleEffectConfig> cached;
+		if (!blob.empty() && ParticleConfigCache::Deserialize(blob.data(), blob.size(), sourceHash, cached)) {
+			for (ParticleEffectConfig& config : cached) {
+				xmlLoader->AddEffectConfig(std::move(config));
+			}
+			fromCache = true;
+		}
+	}
+
+	bool success = true;
+	if (!fromCache) {
+		for (size_t i = 0; i < xmlFiles.size(); ++i) {
+			if (sources[i].empty() || !xmlLoader->LoadFromString(sources[i], xmlFiles[i])) {
+				LOG_WARN("Particle") << "加载粒子配置文件失败: " << xmlFiles[i];
+				success = false;
+			}
+		}
+		// 有文件失败时不写缓存：下次启动仍走 XML，修好文件后自然重建
+		if (success && !cachePath.empty()) {
+			WriteCache(cachePath, sourceHash);
+		}
+	}
+	RebuildEffectTable();
+
+	const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+	LOG_INFO("Particle") << "粒子配置加载完成: " << mEffectTable.size() << " 个特效, "
+		<< (fromCache ? "二进制缓存" : "XML") << ", " << elapsed.count() << "ms";
+	return success;
+}
+
+void ParticleConfigManager::WriteCache(const std::string& cachePath, std::uint64_t sourceHash) const {
+	std::vector<std::string> names = xmlLoader->GetAllEffectNames();
+	std::sort(names.begin(), names.end());
+	std::vector<const ParticleEffectConfig*> configs;
+	configs.reserve(names.size());
+	for (const std::string& name : names) {
+		configs.push_back(xmlLoader->GetEffectConfig(name));
+	}
+	const std::string blob = ParticleConfigCache::Serialize(configs, sourceHash);
+
+	const std::string directory = FileManager::GetDirectory(cachePath);
+	if (!directory.empty() && !FileManager::IsDirectory(directory)) {
+		FileManager::CreateDirectory(directory);
+	}
+	// 只读目录（如 APK assets）写不进去不算错误：下次启动继续走 XML
+	if (!FileManager::SaveBinaryFile(cachePath, blob.data(), blob.size())) {
+		LOG_WARN("Particle") << "粒子配置缓存写入失败: " << cachePath;
+	}
+}
+
+void ParticleConfigManager::RebuildEffectTable() {
+	// 新名字排序后追加：同一资源目录下 id 分配与 unordered_map 遍历顺序无关
+	std::vector<std::string> names = xmlLoader->GetAllEffectNames();
+	std::sort(names.begin(), names.end());
+	for (const std::string& name : names) {
+		auto it = mEffectIds.find(name);
+		if (it != mEffectIds.end()) {
+			mEffectTable[it->second.index] = xmlLoader->GetEffectConfig(name);
+			continue;
+		}
+		EffectId id;
+		id.index = static_cast<std::int32_t>(mEffectTable.size());
+		mEffectTable.push_back(xmlLoader->GetEffectConfig(name));
+		mEffectNames.push_back(&mEffectIds.emplace(name, id).first->first);
+	}
+}
+
+EffectId ParticleConfigManager::ResolveEffect(const std::string& name) const {
+	auto it = mEffectIds.find(name);
+	return it != mEffectIds.end() ? it->second : EffectId{};
+}
+
+const ParticleEffectConfig* ParticleConfigManager::GetEffectConfig(EffectId id) const {
+	if (!id.IsValid() || id.index >= static_cast<std::int32_t>(mEffectTable.size())) {
+		return nullptr;
+	}
+	return mEffectTable[id.index];
+}
+
+const std::string& ParticleConfigManager::GetEffectName(EffectId id) const {
+	static const std::string kEmpty;
+	if (!id.IsValid() || id.index >= static_cast<std::int32_t>(mEffectNames.size())) {
+		return kEmpty;
+	}
+	return *mEffectNames[id.index];
 }
 
 const ParticleEffectConfig* ParticleConfigManager::GetEffectConfig(const std::string& name) const {
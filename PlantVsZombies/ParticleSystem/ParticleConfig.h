@@ -2,10 +2,12 @@
 #ifndef __PARTICLE_CONFIG_H__
 #define __PARTICLE_CONFIG_H__
 
+#include "EffectHandle.h"
 #include "ParticleXMLConfig.h"
 #include "ParticleXMLLoader.h"
 #include "../Graphics.h"
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <memory>
 
@@ -16,16 +18,35 @@ private:
 	// XML配置支持
 	std::unique_ptr<ParticleXMLLoader> xmlLoader;
 
+	// 预编译特效表：EffectId.index → 配置/名字。配置指针指向 loader 的 unordered_map 节点，
+	// 同名重载只覆盖值、不搬节点，故加载后长期稳定。
+	std::vector<const ParticleEffectConfig*> mEffectTable;
+	std::vector<const std::string*> mEffectNames;   // 指向 mEffectIds 的键（节点稳定）
+	std::unordered_map<std::string, EffectId> mEffectIds;
+
+	void RebuildEffectTable();
+	void WriteCache(const std::string& cachePath, std::uint64_t sourceHash) const;
+
 public:
 	ParticleConfigManager(Graphics* graphics);
 	~ParticleConfigManager() = default;
 
 	void SetGraphics(Graphics* graphics) { m_graphics = graphics; }
 
-	// XML配置支持
-	bool LoadXMLConfigs(const std::string& directory);
+	/**
+	 * 加载目录下全部粒子 XML。cachePath 非空时先尝试二进制缓存（源 XML 哈希一致才用），
+	 * 否则解析 XML 并重写缓存。
+	 */
+	bool LoadXMLConfigs(const std::string& directory, const std::string& cachePath = "");
 	const ParticleEffectConfig* GetEffectConfig(const std::string& name) const;
 	std::vector<std::string> GetAllXMLEffectNames() const;
+
+	/** 名字 → EffectId；未加载的名字返回无效 id。 */
+	EffectId ResolveEffect(const std::string& name) const;
+	/** O(1) 取配置；无效 id 返回 nullptr。 */
+	const ParticleEffectConfig* GetEffectConfig(EffectId id) const;
+	/** O(1) 取名字；无效 id 返回空串。引用在管理器生命周期内有效。 */
+	const std::string& GetEffectName(EffectId id) const;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,303 @@
+#include "ParticleConfigCache.h"
+#include <cstring>
+#include <type_traits>
+
+namespace {
+	// 小端平台（x86/ARM）原样按字节拷贝标量；缓存只在本机生成、本机读取。
+	class Writer {
+	public:
+		explicit Writer(std::string& out) : mOut(out) {}
+
+		template <typename T>
+		void Pod(T value) {
+			static_assert(std::is_trivially_copyable<T>::value, "Pod 只接受平凡类型");
+			const char* bytes = reinterpret_cast<const char*>(&value);
+			mOut.append(bytes, sizeof(T));
+		}
+
+		void Bool(bool value) { Pod<std::uint8_t>(value ? 1 : 0); }
+
+		void String(const std::string& value) {
+			Pod<std::uint32_t>(static_cast<std::uint32_t>(value.size()));
+			mOut.append(value);
+		}
+
+		void Range(const ValueRange& range) {
+			Pod(range.minValue);
+			Pod(range.maxValue);
+			Bool(range.isRange);
+		}
+
+		void Track(const InterpolationTrack& track) {
+			Bool(track.isConstant);
+			Pod(track.constantValue);
+			Bool(track.isRandomRange);
+			Pod(track.randomMin);
+			Pod(track.randomMax);
+			Pod<std::uint32_t>(static_cast<std::uint32_t>(track.points.size()));
+			for (const InterpolationPoint& point : track.points) {
+				Pod(point.value);
+				Pod(point.time);
+				Pod(point.valueLo);
+				Pod(point.valueHi);
+			}
+		}
+
+		void Fields(const std::vector<ParticleField>& fields) {
+			Pod<std::uint32_t>(static_cast<std::uint32_t>(fields.size()));
+			for (const ParticleField& field : fields) {
+				Pod<std::uint8_t>(static_cast<std::uint8_t>(field.type));
+				Track(field.xTrack);
+				Track(field.yTrack);
+			}
+		}
+
+	private:
+		std::string& mOut;
+	};
+
+	/** 带边界检查的顺序读取；任何越界都会让 ok 置假，之后的读取全部返回默认值。 */
+	class Reader {
+	public:
+		Reader(const char* data, std::size_t size) : mData(data), mSize(size) {}
+
+		bool Ok() const { return mOk; }
+		bool AtEnd() const { return mPos == mSize; }
+
+		template <typename T>
+		T Pod() {
+			static_assert(std::is_trivially_copyable<T>::value, "Pod 只接受平凡类型");
+			T value{};
+			if (!Take(sizeof(T))) return value;
+			std::memcpy(&value, mData + mPos - sizeof(T), sizeof(T));
+			return value;
+		}
+
+		bool Bool() { return Pod<std::uint8_t>() != 0; }
+
+		std::string String() {
+			const std::uint32_t length = Pod<std::uint32_t>();
+			if (!Take(length)) return std::string();
+			return std::string(mData + mPos - length, length);
+		}
+
+		ValueRange Range() {
+			ValueRange range;
+			range.minValue = Pod<float>();
+			range.maxValue = Pod<float>();
+			range.isRange = Bool();
+			return range;
+		}
+
+		InterpolationTrack Track() {
+			InterpolationTrack track;
+			track.isConstant = Bool();
+			track.constantValue = Pod<float>();
+			track.isRandomRange = Bool();
+			track.randomMin = Pod<float>();
+			track.randomMax = Pod<float>();
+			const std::uint32_t count = Count(sizeof(float) * 4);
+			track.points.reserve(count);
+			for (std::uint32_t i = 0; i < count && mOk; ++i) {
+				InterpolationPoint point;
+				point.value = Pod<float>();
+				point.time = Pod<float>();
+				point.valueLo = Pod<float>();
+				point.valueHi = Pod<float>();
+				track.points.push_back(point);
+			}
+			return track;
+		}
+
+		std::vector<ParticleField> Fields() {
+			std::vector<ParticleField> fields;
+			const std::uint32_t count = Count(1);
+			fields.reserve(count);
+			for (std::uint32_t i = 0; i < count && mOk; ++i) {
+				ParticleField field;
+				field.type = static_cast<ParticleFieldType>(Pod<std::uint8_t>());
+				field.xTrack = Track();
+				field.yTrack = Track();
+				fields.push_back(std::move(field));
+			}
+			return fields;
+		}
+
+		/** 读元素个数，并按每个元素的最小字节数拒绝明显超出剩余数据的计数（防损坏文件巨量 reserve）。 */
+		std::uint32_t Count(std::size_t minElementSize) {
+			const std::uint32_t count = Pod<std::uint32_t>();
+			if (mOk && static_cast<std::uint64_t>(count) * minElementSize > mSize - mPos) {
+				mOk = false;
+			}
+			return mOk ? count : 0;
+		}
+
+	private:
+		bool Take(std::size_t bytes) {
+			if (!mOk || bytes > mSize - mPos) {
+				mOk = false;
+				return false;
+			}
+			mPos += bytes;
+			return true;
+		}
+
+		const char* mData;
+		std::size_t mSize;
+		std::size_t mPos = 0;
+		bool mOk = true;
+	};
+
+	void WriteEmitter(Writer& w, const EmitterConfig& config) {
+		w.String(config.name);
+		w.Range(config.spawnMinActive);
+		w.Range(config.spawnMaxLaunched);
+		w.Pod<std::int32_t>(config.spawnRate);
+		w.Range(config.particleDuration);
+		w.Pod(config.systemDuration);
+
+		w.Track(config.particleAlpha);
+		w.Track(config.particleScale);
+		w.Track(config.particleStretch);
+		w.Range(config.particleBrightness);
+		w.Track(config.particleRed);
+		w.Track(config.particleGreen);
+		w.Track(config.particleBlue);
+		w.Track(config.systemAlpha);
+
+		w.Pod<std::uint8_t>(static_cast<std::uint8_t>(config.emitterType));
+		w.Range(config.emitterBoxX);
+		w.Range(config.emitterBoxY);
+		w.Range(config.emitterRadius);
+		w.Pod(config.emitterOffsetX);
+		w.Pod(config.emitterOffsetY);
+
+		w.Range(config.launchSpeed);
+		w.Bool(config.randomLaunchSpin);
+		w.Range(config.particleRotation);
+		w.Bool(config.hasParticleRotation);
+		w.Range(config.particleSpinSpeed);
+		w.Pod(config.particleGravity);
+
+		w.Pod<std::uint32_t>(static_cast<std::uint32_t>(config.imageKeys.size()));
+		for (const std::string& key : config.imageKeys) {
+			w.String(key);
+		}
+		w.Pod<std::int32_t>(config.imageFrames);
+		w.Pod(config.animationRate);
+
+		w.Fields(config.fields);
+		w.Fields(config.systemFields);
+
+		w.Bool(config.fullScreen);
+	}
+
+	void ReadEmitter(Reader& r, EmitterConfig& config) {
+		config.name = r.String();
+		config.spawnMinActive = r.Range();
+		config.spawnMaxLaunched = r.Range();
+		config.spawnRate = r.Pod<std::int32_t>();
+		config.particleDuration = r.Range();
+		config.systemDuration = r.Pod<float>();
+
+		config.particleAlpha = r.Track();
+		config.particleScale = r.Track();
+		config.particleStretch = r.Track();
+		config.particleBrightness = r.Range();
+		config.particleRed = r.Track();
+		config.particleGreen = r.Track();
+		config.particleBlue = r.Track();
+		config.systemAlpha = r.Track();
+
+		config.emitterType = static_cast<EmitterType>(r.Pod<std::uint8_t>());
+		config.emitterBoxX = r.Range();
+		config.emitterBoxY = r.Range();
+		config.emitterRadius = r.Range();
+		config.emitterOffsetX = r.Pod<float>();
+		config.emitterOffsetY = r.Pod<float>();
+
+		config.launchSpeed = r.Range();
+		config.randomLaunchSpin = r.Bool();
+		config.particleRotation = r.Range();
+		config.hasParticleRotation = r.Bool();
+		config.particleSpinSpeed = r.Range();
+		config.particleGravity = r.Pod<float>();
+
+		const std::uint32_t keyCount = r.Count(sizeof(std::uint32_t));
+		config.imageKeys.clear();
+		config.imageKeys.reserve(keyCount);
+		for (std::uint32_t i = 0; i < keyCount && r.Ok(); ++i) {
+			config.imageKeys.push_back(r.String());
+		}
+		config.imageFrames = r.Pod<std::int32_t>();
+		config.animationRate = r.Pod<float>();
+
+		config.fields = r.Fields();
+		config.systemFields = r.Fields();
+
+		config.fullScreen = r.Bool();
+	}
+}
+
+namespace ParticleConfigCache {
+	void SourceHasher::Mix(const void* data, std::size_t size) {
+		const unsigned char* bytes = static_cast<const unsigned char*>(data);
+		for (std::size_t i = 0; i < size; ++i) {
+			mHash ^= bytes[i];
+			mHash *= 0x100000001b3ull;
+		}
+	}
+
+	void SourceHasher::Add(const std::string& path, const std::string& content) {
+		// 长度前缀避免 ("ab","c") 与 ("a","bc") 撞到同一字节流
+		const std::uint64_t pathSize = path.size();
+		const std::uint64_t contentSize = content.size();
+		Mix(&pathSize, sizeof(pathSize));
+		Mix(path.data(), path.size());
+		Mix(&contentSize, sizeof(contentSize));
+		Mix(content.data(), content.size());
+	}
+
+	std::string Serialize(const std::vector<const ParticleEffectConfig*>& effects, std::uint64_t sourceHash) {
+		std::string out;
+		Writer w(out);
+		w.Pod(kMagic);
+		w.Pod(kVersion);
+		w.Pod(sourceHash);
+		w.Pod<std::uint32_t>(static_cast<std::uint32_t>(effects.size()));
+		for (const ParticleEffectConfig* effect : effects) {
+			w.String(effect->name);
+			w.Pod<std::uint32_t>(static_cast<std::uint32_t>(effect->emitters.size()));
+			for (const EmitterConfig& emitter : effect->emitters) {
+				WriteEmitter(w, emitter);
+			}
+		}
+		return out;
+	}
+
+	bool Deserialize(const char* data, std::size_t size, std::uint64_t expectedSourceHash,
+		std::vector<ParticleEffectConfig>& out) {
+		if (!data) return false;
+		Reader r(data, size);
+		if (r.Pod<std::uint32_t>() != kMagic || r.Pod<std::uint32_t>() != kVersion) return false;
+		if (r.Pod<std::uint64_t>() != expectedSourceHash || !r.Ok()) return false;
+
+		std::vector<ParticleEffectConfig> effects;
+		const std::uint32_t effectCount = r.Count(sizeof(std::uint32_t) * 2);
+		effects.reserve(effectCount);
+		for (std::uint32_t i = 0; i < effectCount && r.Ok(); ++i) {
+			ParticleEffectConfig effect(r.String());
+			const std::uint32_t emitterCount = r.Count(sizeof(std::uint32_t));
+			effect.emitters.resize(emitterCount);
+			for (EmitterConfig& emitter : effect.emitters) {
+				if (!r.Ok()) break;
+				ReadEmitter(r, emitter);
+			}
+			effects.push_back(std::move(effect));
+		}
+		if (!r.Ok() || !r.AtEnd()) return false;
+
+		out = std::move(effects);
+		return true;
+	}
+}
@@ -0,0 +1,44 @@
+#pragma once
+#ifndef __PARTICLE_CONFIG_CACHE_H__
+#define __PARTICLE_CONFIG_CACHE_H__
+
+#include "ParticleXMLConfig.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * 粒子配置的二进制缓存：把 ParticleXMLLoader 解析好的全部特效原样写成一块紧凑二进制，
+ * 下次启动一次读入即可还原，跳过 XML 解析与关键帧文本转换。
+ *
+ * 缓存头记录源 XML 的内容哈希；任一源文件增删改都会使哈希不符，调用方回退到 XML 并重写缓存。
+ * 只依赖配置结构本身，不碰文件系统与 SDL，可独立单测。
+ */
+namespace ParticleConfigCache {
+	inline constexpr std::uint32_t kMagic = 0x50434650u;   // "PFCP"
+	/** EmitterConfig 及其子结构增删字段时必须同步 Serialize/Deserialize 并提升版本。 */
+	inline constexpr std::uint32_t kVersion = 1;
+
+	/** 源 XML 的 FNV-1a 64 位哈希；按固定顺序逐个喂入（路径 + 内容）。 */
+	class SourceHasher {
+	public:
+		void Add(const std::string& path, const std::string& content);
+		std::uint64_t Value() const { return mHash; }
+
+	private:
+		void Mix(const void* data, std::size_t size);
+		std::uint64_t mHash = 0xcbf29ce484222325ull;
+	};
+
+	/** 把特效按给定顺序编码为缓存数据块。 */
+	std::string Serialize(const std::vector<const ParticleEffectConfig*>& effects, std::uint64_t sourceHash);
+
+	/**
+	 * 解码缓存数据块。魔数/版本/源哈希不符、数据截断或有多余字节时返回 false，out 不修改。
+	 */
+	bool Deserialize(const char* data, std::size_t size, std::uint64_t expectedSourceHash,
+		std::vector<ParticleEffectConfig>& out);
+}
+
+#endif
@@ -1,5 +1,4 @@
 #include "ParticleEffect.h"
-#include "../DeltaTime.h"
 #include "../GameApp.h"
 #include <algorithm>
 #include <cmath>
@@ -8,11 +7,23 @@ void ParticleEffect::InitializeFromConfig(const ParticleEffectConfig& config, Gr
 	this->graphics = graphics;
 	position = pos;
 	systemTimer = 0.0f;
+	systemDuration = -1.0f;
 	active = true;
+	renderOrder = 0;
+	clipRightX = -1.0f;
 
-	// 为每个发射器配置创建发射器
-	for (const EmitterConfig& emitterConfig : config.emitters) {
-		auto emitter = std::make_unique<ParticleEmitter>(graphics);
+	// 池化复用：同一配置的发射器数量不变，已有发射器对象及其粒子池容量原样沿用
+	if (emitters.size() != config.emitters.size()) {
+		emitters.resize(config.emitters.size());
+	}
+
+	for (size_t i = 0; i < config.emitters.size(); ++i) {
+		const EmitterConfig& emitterConfig = config.emitters[i];
+		if (!emitters[i]) {
+			emitters[i] = std::make_unique<ParticleEmitter>(graphics);
+		}
+		ParticleEmitter& emitter = *emitters[i];
+		emitter.SetGraphics(graphics);
 
 		// 计算发射器位置（基础位置 + 偏移）
 		Vector emitterPos = position;
@@ -20,20 +31,17 @@ void ParticleEffect::InitializeFromConfig(const ParticleEffectConfig& config, Gr
 		emitterPos.y += emitterConfig.emitterOffsetY;
 
 		// 从XML配置初始化发射器
-		emitter->Initialize(emitterConfig, emitterPos);
+		emitter.Initialize(emitterConfig, emitterPos);
 
 		// 设置系统持续时间（使用第一个发射器的系统持续时间）
-		if (emitters.empty() && emitterConfig.systemDuration > 0.0f) {
+		if (i == 0 && emitterConfig.systemDuration > 0.0f) {
 			systemDuration = emitterConfig.systemDuration;
 		}
-
-		emitters.push_back(std::move(emitter));
 	}
 }
 
-void ParticleEffect::Update() {
+void ParticleEffect::UpdateEmission(float deltaTime) {
 	if (active) {
-		float deltaTime = DeltaTime::GetDeltaTime();
 		systemTimer += deltaTime;
 
 		// 检查系统持续时间
@@ -42,9 +50,17 @@ void ParticleEffect::Update() {
 		}
 	}
 
-	// 无论是否活跃，都继续更新发射器，让已有粒子自然消亡
 	for (auto& emitter : emitters) {
-		emitter->Update();
+		emitter->UpdateEmission(deltaTime);
+	}
+}
+
+void ParticleEffect::CollectLiveEmitters(std::vector<ParticleEmitter*>& out) const {
+	// 无论是否活跃都收集，让已有粒子自然消亡
+	for (const auto& emitter : emitters) {
+		if (emitter->GetActiveParticleCount() > 0) {
+			out.push_back(emitter.get());
+		}
 	}
 }
 
@@ -81,6 +97,11 @@ void ParticleEffect::SetSystemDuration(float duration) {
 	}
 }
 
+const std::string& ParticleEffect::GetName() const {
+	static const std::string kUnnamed;
+	return effectName ? *effectName : kUnnamed;
+}
+
 bool ParticleEffect::IsEmitting() const {
 	if (!active) return false;
 	for (const auto& emitter : emitters) {
@@ -2,6 +2,7 @@
 #ifndef __PARTICLE_EFFECT_H__
 #define __PARTICLE_EFFECT_H__
 
+#include "EffectHandle.h"
 #include "ParticleEmitter.h"
 #include "ParticleXMLConfig.h"
 #include "../Game/Definit.h"
@@ -19,17 +20,22 @@ private:
 	float systemDuration = -1.0f;
 	bool active = false;
 	int renderOrder = 0;
-	std::string effectName;
+	EffectId effectId;
+	const std::string* effectName = nullptr;   // 指向 ParticleConfigManager 特效表里的名字，不逐实例拷贝
+	std::uint32_t instanceSlot = UINT32_MAX;  // ParticleSystem 句柄槽位
 	float clipRightX = -1.0f;
 
 public:
 	ParticleEffect() = default;
 	~ParticleEffect() = default;
 
-	// 从XML配置初始化
+	// 从XML配置初始化；对象由 ParticleSystem 池化复用，这里重置全部运行期状态
 	void InitializeFromConfig(const ParticleEffectConfig& config, Graphics* graphics, const Vector& pos);
 
-	void Update();
+	/** 特效计时与各发射器发射（主线程）；粒子推进由 ParticleSystem 统一分发。 */
+	void UpdateEmission(float deltaTime);
+	/** 把仍有存活粒子的发射器追加到 out，供 ParticleSystem 并行推进。 */
+	void CollectLiveEmitters(std::vector<ParticleEmitter*>& out) const;
 	void Draw();
 	/** 停止继续发射，但保留现有粒子更新到自然消亡。 */
 	void Stop();
@@ -51,8 +57,12 @@ public:
 	 */
 	void SetSystemDuration(float duration);
 
-	void SetName(const std::string& name) { effectName = name; }
-	const std::string& GetName() const { return effectName; }
+	/** name 须在特效生命周期内保持有效（由特效表持有）。 */
+	void SetEffect(EffectId id, const std::string* name) { effectId = id; effectName = name; }
+	EffectId GetEffectId() const { return effectId; }
+	const std::string& GetName() const;
+	void SetInstanceSlot(std::uint32_t slot) { instanceSlot = slot; }
+	std::uint32_t GetInstanceSlot() const { return instanceSlot; }
 	/** 负值关闭裁剪；非负值把本特效绘制限制在世界坐标 x<=clipRightX。 */
 	void SetClipRightX(float x) { clipRightX = x; }
 	float GetClipRightX() const { return clipRightX; }
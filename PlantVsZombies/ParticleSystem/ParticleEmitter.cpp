@@ -1,5 +1,4 @@
 #include "ParticleEmitter.h"
-#include "../DeltaTime.h"
 #include "../GameApp.h"
 #include "../Game/Definit.h"
 #include "../GameRandom.h"
@@ -7,24 +6,24 @@
 #include <iostream>
 #include <cmath>
 #include <algorithm>
-#include <glm/gtc/matrix_transform.hpp>
+#include <limits>
 
 namespace {
-	/** 把粒子实际提交的单位四边形矩阵并入本发射器的 AutoTest 包围盒。 */
-	void RecordParticleQuad(ParticleRenderProbe& probe, const glm::mat4& matrix)
+	/** 把粒子实际提交的单位四边形（局部仿射）并入本发射器的 AutoTest 包围盒。 */
+	void RecordParticleQuad(ParticleRenderProbe& probe, const Affine2D& local)
 	{
-		const glm::vec4 corners[4] = {
-			matrix * glm::vec4(0.0f, 0.0f, 0.0f, 1.0f),
-			matrix * glm::vec4(1.0f, 0.0f, 0.0f, 1.0f),
-			matrix * glm::vec4(0.0f, 1.0f, 0.0f, 1.0f),
-			matrix * glm::vec4(1.0f, 1.0f, 0.0f, 1.0f),
+		const glm::vec2 corners[4] = {
+			local.Apply(0.0f, 0.0f),
+			local.Apply(1.0f, 0.0f),
+			local.Apply(0.0f, 1.0f),
+			local.Apply(1.0f, 1.0f),
 		};
 		if (!probe.hasGeometry) {
 			probe.minX = probe.maxX = corners[0].x;
 			probe.minY = probe.maxY = corners[0].y;
 			probe.hasGeometry = true;
 		}
-		for (const glm::vec4& corner : corners) {
+		for (const glm::vec2& corner : corners) {
 			probe.minX = std::min(probe.minX, corner.x);
 			probe.minY = std::min(probe.minY, corner.y);
 			probe.maxX = std::max(probe.maxX, corner.x);
@@ -32,6 +31,37 @@ namespace {
 		}
 		++probe.quadCount;
 	}
+
+	/** 与 Graphics::DrawTextureInstanced 相同的 RGBA8 打包：四舍五入并钳制到 0..255。 */
+	std::uint32_t PackColor(float r, float g, float b, float a)
+	{
+		const auto pack8 = [](float value) {
+			return static_cast<std::uint32_t>(std::clamp(static_cast<int>(value + 0.5f), 0, 255));
+		};
+		return pack8(r) | (pack8(g) << 8) | (pack8(b) << 16) | (pack8(a) << 24);
+	}
+
+	/** 对整列归一化时间求一条曲线；常量曲线退化为填充，避免逐粒子分支。 */
+	void EvaluateTrack(const InterpolationTrack& track, const float* t, float* out, int n,
+		float scale = 1.0f)
+	{
+		if (track.isRandomRange || track.isConstant) {
+			std::fill_n(out, n, track.GetValue(0.0f) * scale);
+			return;
+		}
+		for (int i = 0; i < n; ++i) {
+			out[i] = track.GetValue(t[i]) * scale;
+		}
+	}
+
+	/** xorshift32 → [0,1)；发射器私有状态，worker 并行推进时互不干扰。 */
+	float NextUnitFloat(std::uint32_t& state)
+	{
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return static_cast<float>(state >> 8) * (1.0f / 16777216.0f);
+	}
 }
 
 ParticleEmitter::ParticleEmitter(Graphics* g)
@@ -40,12 +70,16 @@ ParticleEmitter::ParticleEmitter(Graphics* g)
 }
 
 void ParticleEmitter::Initialize(const EmitterConfig& config, const Vector& pos) {
+	// 池化复用时拷贝赋值沿用已有 string/vector 容量，同一配置重复发射不再分配
 	xmlConfig = config;
+	mLastRenderProbe = {};
 	position = pos;
 	active = true;
 	spawnTimer = 0.0f;
 	particlesEmitted = 0;
 	systemTimer = 0.0f;
+	// 种子在主线程从 GameRandom 表现流取，-Seed 下特效抖动仍可复现
+	mShakeRngState = static_cast<std::uint32_t>(GameRandom::VisualRange(1, std::numeric_limits<int>::max()));
 
 	spawnRate = config.spawnRate;
 
@@ -55,7 +89,7 @@ void ParticleEmitter::Initialize(const EmitterConfig& config, const Vector& pos)
 	particlesToEmit = maxLaunched;
 
 	maxParticles = std::max(maxLaunched, minActive);
-	particles.resize(maxParticles);
+	particles.Reserve(maxParticles);
 
 	for (int i = 0; i < minActive; i++) {
 		EmitSingleParticle();
@@ -64,88 +98,96 @@ void ParticleEmitter::Initialize(const EmitterConfig& config, const Vector& pos)
 	activeFields = config.fields;
 }
 
-void ParticleEmitter::Update() {
-	float deltaTime = DeltaTime::GetDeltaTime();
+void ParticleEmitter::Update(float deltaTime) {
+	UpdateEmission(deltaTime);
+	UpdateParticles(deltaTime);
+}
 
-	if (active) {
-		systemTimer += deltaTime;
+void ParticleEmitter::UpdateEmission(float deltaTime) {
+	if (!active) return;
 
-		if (isOneShot && particlesEmitted >= particlesToEmit) {
-			spawnRate = 0;
-			if (GetActiveParticleCount() == 0) {
-				active = false;
-			}
+	systemTimer += deltaTime;
+
+	if (isOneShot && particlesEmitted >= particlesToEmit) {
+		spawnRate = 0;
+		if (GetActiveParticleCount() == 0) {
+			active = false;
 		}
+	}
 
-		if (spawnRate > 0 && (!isOneShot || particlesEmitted < particlesToEmit)) {
-			spawnTimer += deltaTime;
-			float spawnInterval = 1.0f / spawnRate;
-			if (spawnTimer >= spawnInterval) {
-				if (!isOneShot || particlesEmitted < particlesToEmit) {
-					EmitSingleParticle();
-					spawnTimer = 0;
-					particlesEmitted++;
-				}
+	if (spawnRate > 0 && (!isOneShot || particlesEmitted < particlesToEmit)) {
+		spawnTimer += deltaTime;
+		float spawnInterval = 1.0f / spawnRate;
+		if (spawnTimer >= spawnInterval) {
+			if (!isOneShot || particlesEmitted < particlesToEmit) {
+				EmitSingleParticle();
+				spawnTimer = 0;
+				particlesEmitted++;
 			}
 		}
 	}
+}
 
-	for (size_t i = 0; i < particles.size(); i++)
-	{
-		Particle& particle = particles[i];
-		if (particle.active)
-		{
-			float normalizedTime = particle.lifetime / particle.maxLifetime;
-
-			float systemAlphaValue = 1.0f;
-			if (xmlConfig.systemDuration > 0.0f) {
-				float systemNormalizedTime = systemTimer / xmlConfig.systemDuration;
-				systemAlphaValue = xmlConfig.systemAlpha.GetValue(systemNormalizedTime);
-			}
+void ParticleEmitter::UpdateParticles(float deltaTime) {
+	const int n = particles.Count();
+	if (n == 0) return;
 
-			float alpha = xmlConfig.particleAlpha.GetValue(normalizedTime);
-			float scale = xmlConfig.particleScale.isRandomRange
-				? particle.baseScale
-				: xmlConfig.particleScale.GetValue(normalizedTime);
-			float stretch = xmlConfig.particleStretch.GetValue(normalizedTime);
-
-			particle.size = scale;
-			particle.stretch = stretch;
-			particle.color.a = alpha * systemAlphaValue * 255.0f;
-
-			float red = xmlConfig.particleRed.GetValue(normalizedTime);
-			float green = xmlConfig.particleGreen.GetValue(normalizedTime);
-			float blue = xmlConfig.particleBlue.GetValue(normalizedTime);
-			particle.colorMultiplier = glm::vec3(red, green, blue);
-
-			for (const ParticleField& field : activeFields) {
-				if (field.type == ParticleFieldType::POSITION) {
-					// 逐粒子采样：每颗粒子按自己的 fieldRandom 因子在区间内扩散
-					particle.fieldOffset.x = field.xTrack.GetValueRandomized(normalizedTime, particle.fieldRandomX);
-					particle.fieldOffset.y = field.yTrack.GetValueRandomized(normalizedTime, particle.fieldRandomY);
-					continue;
-				}
-
-				float xValue = field.xTrack.GetValue(normalizedTime);
-				float yValue = field.yTrack.GetValue(normalizedTime);
-
-				if (field.type == ParticleFieldType::SHAKE) {
-					particle.shakeOffset.x = GameRandom::Range(-xValue, xValue);
-					particle.shakeOffset.y = GameRandom::Range(-yValue, yValue);
-				}
-				else if (field.type == ParticleFieldType::FRICTION) {
-					particle.velocity.x *= (1.0f - xValue);
-					particle.velocity.y *= (1.0f - yValue);
-				}
-				else if (field.type == ParticleFieldType::ACCELERATION) {
-					particle.velocity.x += xValue * deltaTime;
-					particle.velocity.y += yValue * deltaTime;
-				}
+	// 曲线按"属性优先"逐条扫过整列：同一条轨迹连续求值，分支与关键帧数据都留在缓存里
+	particles.ComputeNormalizedTime();
+	const float* t = particles.normalizedTime.data();
+
+	float systemAlphaValue = 1.0f;
+	if (xmlConfig.systemDuration > 0.0f) {
+		float systemNormalizedTime = systemTimer / xmlConfig.systemDuration;
+		systemAlphaValue = xmlConfig.systemAlpha.GetValue(systemNormalizedTime);
+	}
+
+	EvaluateTrack(xmlConfig.particleAlpha, t, particles.alpha.data(), n, systemAlphaValue * 255.0f);
+	if (xmlConfig.particleScale.isRandomRange) {
+		std::copy_n(particles.baseScale.data(), n, particles.size.data());
+	}
+	else {
+		EvaluateTrack(xmlConfig.particleScale, t, particles.size.data(), n);
+	}
+	EvaluateTrack(xmlConfig.particleStretch, t, particles.stretch.data(), n);
+	EvaluateTrack(xmlConfig.particleRed, t, particles.colorR.data(), n);
+	EvaluateTrack(xmlConfig.particleGreen, t, particles.colorG.data(), n);
+	EvaluateTrack(xmlConfig.particleBlue, t, particles.colorB.data(), n);
+
+	for (const ParticleField& field : activeFields) {
+		if (field.type == ParticleFieldType::POSITION) {
+			// 逐粒子采样：每颗粒子按自己的 fieldRandom 因子在区间内扩散
+			for (int i = 0; i < n; ++i) {
+				particles.fieldOffsetX[i] = field.xTrack.GetValueRandomized(t[i], particles.fieldRandomX[i]);
+				particles.fieldOffsetY[i] = field.yTrack.GetValueRandomized(t[i], particles.fieldRandomY[i]);
 			}
+			continue;
+		}
 
-			particle.Update();
+		for (int i = 0; i < n; ++i) {
+			float xValue = field.xTrack.GetValue(t[i]);
+			float yValue = field.yTrack.GetValue(t[i]);
+
+			if (field.type == ParticleFieldType::SHAKE) {
+				particles.shakeOffsetX[i] = (NextUnitFloat(mShakeRngState) * 2.0f - 1.0f) * xValue;
+				particles.shakeOffsetY[i] = (NextUnitFloat(mShakeRngState) * 2.0f - 1.0f) * yValue;
+			}
+			else if (field.type == ParticleFieldType::FRICTION) {
+				particles.velX[i] *= (1.0f - xValue);
+				particles.velY[i] *= (1.0f - yValue);
+			}
+			else if (field.type == ParticleFieldType::ACCELERATION) {
+				particles.velX[i] += xValue * deltaTime;
+				particles.velY[i] += yValue * deltaTime;
+			}
 		}
 	}
+
+	particles.Integrate(deltaTime, xmlConfig.particleGravity);
+	if (xmlConfig.animationRate > 0.0f) {
+		particles.AdvanceFrames(deltaTime, 1.0f / xmlConfig.animationRate, xmlConfig.imageFrames);
+	}
+	particles.CompactDead();
 }
 
 void ParticleEmitter::EmitParticles(int count) {
@@ -163,65 +205,56 @@ void ParticleEmitter::EmitParticles(int count) {
 }
 
 void ParticleEmitter::EmitSingleParticle() {
-	Particle* particle = GetFreeParticle();
-	if (!particle) return;
-
-	particle->Reset();  // 注意：Reset 已置 active=false
+	if (particles.Full()) return;
 
 	// 先解析纹理，并以其为生成前置条件：
 	// - 无 <Image> 的发射器（如 CrossFade 的 FadeOut 伴随发射器）不产生可绘制粒子；
 	// - 指定了纹理键却未加载成功的同样跳过。
-	// 提前返回（粒子保持 inactive），既省掉后续无意义初始化，
+	// 提前返回（不占池位），既省掉后续无意义初始化，
 	// 也从源头杜绝 Draw 每帧打印"没有图片绘制"。
 	if (xmlConfig.imageKeys.empty()) {
 		return;
 	}
 	ResourceManager& resourceManager = ResourceManager::GetInstance();
-	int randomIndex = GameRandom::Range(0, static_cast<int>(xmlConfig.imageKeys.size()) - 1);
+	int randomIndex = GameRandom::VisualRange(0, static_cast<int>(xmlConfig.imageKeys.size()) - 1);
 	const Texture* texture = resourceManager.GetTexture(xmlConfig.imageKeys[randomIndex]);
 	if (!texture) {
 		return;
 	}
 
-	particle->active = true;
-	particle->texture = texture;
+	const int i = particles.Spawn();
+	particles.texture[i] = texture;
 
-	particle->position = GetSpawnPosition();
+	Vector spawnPos = GetSpawnPosition();
+	particles.posX[i] = spawnPos.x;
+	particles.posY[i] = spawnPos.y;
 
-	particle->maxLifetime = xmlConfig.particleDuration.GetRandomValue();
+	particles.maxLifetime[i] = xmlConfig.particleDuration.GetRandomValue();
 
 	float speed = xmlConfig.launchSpeed.GetRandomValue();
 	float angle = 0.0f;
 	if (xmlConfig.randomLaunchSpin) {
-		angle = GameRandom::Range(0.0f, 360.0f) * (3.14159f / 180.0f);
+		angle = GameRandom::VisualRange(0.0f, 360.0f) * (3.14159f / 180.0f);
 	}
-	particle->velocity = Vector(cosf(angle) * speed, sinf(angle) * speed);
+	particles.velX[i] = cosf(angle) * speed;
+	particles.velY[i] = sinf(angle) * speed;
 
 	// 初始角度与自旋速度分开采样：前者适合斜雨丝等静态朝向，
 	// 后者只负责生命周期内持续旋转，避免用自旋伪装朝向时每帧漂移。
-	particle->rotation = xmlConfig.particleRotation.GetRandomValue();
-	particle->rotationSpeed = xmlConfig.particleSpinSpeed.GetRandomValue();
-
-	particle->gravity = xmlConfig.particleGravity;
-
-	particle->totalFrames = xmlConfig.imageFrames;
-	particle->frameRate = xmlConfig.animationRate;
-	particle->currentFrame = 0;
-	particle->animationTimer = 0.0f;
+	particles.rotation[i] = xmlConfig.particleRotation.GetRandomValue();
+	particles.rotationSpeed[i] = xmlConfig.particleSpinSpeed.GetRandomValue();
 
-	particle->brightness = xmlConfig.particleBrightness.GetRandomValue();
+	particles.brightness[i] = xmlConfig.particleBrightness.GetRandomValue();
 
-	particle->baseScale = xmlConfig.particleScale.SampleConstant();
-	particle->size = xmlConfig.particleScale.isRandomRange
-		? particle->baseScale
+	particles.baseScale[i] = xmlConfig.particleScale.SampleConstant();
+	particles.size[i] = xmlConfig.particleScale.isRandomRange
+		? particles.baseScale[i]
 		: xmlConfig.particleScale.GetValue(0.0f);
 
 	// Position 场逐粒子随机因子：每颗粒子各抽一次、整生命周期保持，
 	// 使其沿 X/Y 区间内的不同"轨道"扩散，瘴气云才会横向铺开而非堆成一坨。
-	particle->fieldRandomX = GameRandom::Range(0.0f, 1.0f);
-	particle->fieldRandomY = GameRandom::Range(0.0f, 1.0f);
-
-	particle->color = glm::vec4(255.0f);
+	particles.fieldRandomX[i] = GameRandom::VisualRange(0.0f, 1.0f);
+	particles.fieldRandomY[i] = GameRandom::VisualRange(0.0f, 1.0f);
 }
 
 Vector ParticleEmitter::GetSpawnPosition() const {
@@ -243,7 +276,7 @@ Vector ParticleEmitter::GetSpawnPosition() const {
 
 	case EmitterType::CIRCLE: {
 		float radius = xmlConfig.emitterRadius.GetRandomValue();
-		float angle = GameRandom::Range(0.0f, 360.0f) * (3.14159f / 180.0f);
+		float angle = GameRandom::VisualRange(0.0f, 360.0f) * (3.14159f / 180.0f);
 		spawnPos.x += cosf(angle) * radius;
 		spawnPos.y += sinf(angle) * radius;
 		break;
@@ -253,116 +286,132 @@ Vector ParticleEmitter::GetSpawnPosition() const {
 	return spawnPos;
 }
 
-Particle* ParticleEmitter::GetFreeParticle() {
-	for (auto& particle : particles) {
-		if (!particle.active)
-			return &particle;
-	}
-	return nullptr;
-}
-
 void ParticleEmitter::Draw() {
 	if (!m_graphics) return;
 	if (GameAPP::mAutoTestMode)
 		mLastRenderProbe = {};
 
-	for (size_t i = 0; i < particles.size(); i++)
+	const int n = particles.Count();
+	if (n == 0) return;
+
+	// 实例路径：整个发射器打包成一段 InstanceRecord，一次并入 reanim 共用的实例 SSBO 队列，
+	// 不再逐粒子走 DrawTextureRegion 的变换栈与 6 顶点展开。-NoInstance / OpenGL 走原批次路径。
+	const bool instanced = m_graphics->IsInstancePathEnabled();
+	const Affine2D& parent = m_graphics->GetCurrentTransform();
+	if (instanced) {
+		mInstanceScratch.resize(n);
+	}
+	int recordCount = 0;
+
+	// 序列帧数与帧率是发射器常量（spawn 时原样拷自 xmlConfig），不再逐粒子存储
+	const int frameCount = std::max(1, xmlConfig.imageFrames);
+	// 同一发射器几乎总是同一张贴图：纹理相关常量按"上一颗粒子的纹理"缓存
+	const Texture* cachedTexture = nullptr;
+	std::uint32_t texSlot = 0;
+	float frameU = 0.0f, baseU = 0.0f, v0 = 0.0f, v1 = 0.0f;
+	float srcW = 0.0f, srcH = 0.0f;
+
+	for (int i = 0; i < n; i++)
 	{
-		Particle& particle = particles[i];
-		if (particle.active)
-		{
-			if (!particle.texture) {
-				continue;
-			}
+		const Texture* texture = particles.texture[i];
+		if (texture != cachedTexture) {
+			cachedTexture = texture;
 			// ImageFrames 序列帧：贴图为横向帧条（如毁灭菇爆炸底座 471x85 = 3 帧 157x85），
-			// UpdateAnimation 按 AnimationRate 循环推进 currentFrame，这里取对应列。
-			// totalFrames<=1 时 frameW 即整图宽，走同一条 DrawTextureRegion 路径。
-			int frameCount = std::max(1, particle.totalFrames);
-			float srcW = static_cast<float>(particle.texture->width) / frameCount;
-			float srcH = static_cast<float>(particle.texture->height);
-			float srcX = srcW * (particle.currentFrame % frameCount);
-			float destW = srcW * particle.size;
-			float destH = srcH * particle.size * particle.stretch;
-
-			float x = particle.position.x + particle.fieldOffset.x + particle.shakeOffset.x - destW * 0.5f;
-			float y = particle.position.y + particle.fieldOffset.y + particle.shakeOffset.y - destH * 0.5f;
-
-			glm::vec4 finalColor = particle.color;
-			finalColor.r *= particle.brightness * particle.colorMultiplier.r;
-			finalColor.g *= particle.brightness * particle.colorMultiplier.g;
-			finalColor.b *= particle.brightness * particle.colorMultiplier.b;
-
-			if (xmlConfig.hasParticleRotation) {
-				// DrawTextureRegion 的兼容旋转路径会先非等比缩放再旋转，使细长贴图的角度
-				// 被长宽比压扁。显式初始朝向改为围绕世界中心先旋转、再绘制拉伸矩形，
-				// 让配置角度就是屏幕上实际角度；未使用新标签的旧特效保持原样。
-				if (GameAPP::mAutoTestMode) {
-					glm::mat4 finalMatrix(1.0f);
-					finalMatrix = glm::translate(finalMatrix,
-						glm::vec3(x + destW * 0.5f, y + destH * 0.5f, 0.0f));
-					finalMatrix = glm::rotate(finalMatrix, glm::radians(particle.rotation),
-						glm::vec3(0.0f, 0.0f, 1.0f));
-					finalMatrix = glm::translate(finalMatrix,
-						glm::vec3(-destW * 0.5f, -destH * 0.5f, 0.0f));
-					finalMatrix = glm::scale(finalMatrix, glm::vec3(destW, destH, 1.0f));
-					RecordParticleQuad(mLastRenderProbe, finalMatrix);
-				}
-				m_graphics->PushTransform();
-				m_graphics->Translate(x + destW * 0.5f, y + destH * 0.5f);
-				m_graphics->Rotate(particle.rotation, 0.0f, 0.0f, 1.0f);
-				m_graphics->DrawTextureRegion(
-					particle.texture,
-					srcX, 0.0f, srcW, srcH,
-					-destW * 0.5f, -destH * 0.5f, destW, destH,
-					0.0f,
-					finalColor
-				);
-				m_graphics->PopTransform();
-			}
-			else {
-				if (GameAPP::mAutoTestMode) {
-					glm::mat4 finalMatrix(1.0f);
-					finalMatrix = glm::translate(finalMatrix, glm::vec3(x, y, 0.0f));
-					finalMatrix = glm::scale(finalMatrix, glm::vec3(destW, destH, 1.0f));
-					if (particle.rotation != 0.0f) {
-						finalMatrix = glm::translate(finalMatrix, glm::vec3(0.5f, 0.5f, 0.0f));
-						finalMatrix = glm::rotate(finalMatrix, glm::radians(particle.rotation),
-							glm::vec3(0.0f, 0.0f, 1.0f));
-						finalMatrix = glm::translate(finalMatrix, glm::vec3(-0.5f, -0.5f, 0.0f));
-					}
-					RecordParticleQuad(mLastRenderProbe, finalMatrix);
-				}
-				m_graphics->DrawTextureRegion(
-					particle.texture,
-					srcX, 0.0f, srcW, srcH,
-					x, y, destW, destH,
-					particle.rotation,
-					finalColor
-				);
-			}
+			// AdvanceFrames 按 AnimationRate 循环推进 currentFrame，这里取对应列。
+			// totalFrames<=1 时 frameW 即整图宽，走同一条路径。
+			srcW = static_cast<float>(texture->width) / frameCount;
+			srcH = static_cast<float>(texture->height);
+			const Texture* bindTex = texture->atlasPage ? texture->atlasPage : texture;
+			texSlot = texture->BindingId() != 0 ? bindTex->BindingId() : 0;
+			frameU = (texture->aU1 - texture->aU0) / frameCount;
+			baseU = texture->aU0;
+			v0 = texture->aV0;
+			v1 = texture->aV1;
 		}
+		const int frame = particles.currentFrame[i] % frameCount;
+		const float destW = srcW * particles.size[i];
+		const float destH = srcH * particles.size[i] * particles.stretch[i];
+
+		const float centerX = particles.posX[i] + particles.fieldOffsetX[i] + particles.shakeOffsetX[i];
+		const float centerY = particles.posY[i] + particles.fieldOffsetY[i] + particles.shakeOffsetY[i];
+		const float x = centerX - destW * 0.5f;
+		const float y = centerY - destH * 0.5f;
+		const float rotation = particles.rotation[i];
+
+		const float tint = 255.0f * particles.brightness[i];
+		const float red = tint * particles.colorR[i];
+		const float green = tint * particles.colorG[i];
+		const float blue = tint * particles.colorB[i];
+		const float alpha = particles.alpha[i];
+
+		// DrawTextureRegion 的兼容旋转路径会先非等比缩放再旋转，使细长贴图的角度
+		// 被长宽比压扁。显式初始朝向改为围绕世界中心先旋转、再绘制拉伸矩形，
+		// 让配置角度就是屏幕上实际角度；未使用新标签的旧特效保持原样。
+		const Affine2D local = xmlConfig.hasParticleRotation
+			? Affine2D::Translation(centerX, centerY)
+				* Affine2D::Rotation(glm::radians(rotation))
+				* Affine2D::Rect(-destW * 0.5f, -destH * 0.5f, destW, destH)
+			: Affine2D::Rect(x, y, destW, destH, rotation);
+		if (GameAPP::mAutoTestMode) {
+			RecordParticleQuad(mLastRenderProbe, local);
+		}
+
+		if (instanced) {
+			if (texSlot == 0) continue;
+			const Affine2D m = parent * local;
+			InstanceRecord& rec = mInstanceScratch[recordCount++];
+			rec.tA = m.a;
+			rec.tB = m.b;
+			rec.tC = m.c;
+			rec.tD = m.d;
+			rec.tx = m.tx;
+			rec.ty = m.ty;
+			rec.u0 = baseU + frameU * frame;
+			rec.v0 = v0;
+			rec.u1 = rec.u0 + frameU;
+			rec.v1 = v1;
+			rec.texSlot = texSlot;
+			// 粒子亮度与 RGB 曲线都不超过 1，钳制到 255 与批次路径的浮点颜色逐像素一致
+			rec.colorRGBA8 = PackColor(red, green, blue, alpha);
+			continue;
+		}
+
+		const float srcX = srcW * frame;
+		const glm::vec4 finalColor(red, green, blue, alpha);
+		if (xmlConfig.hasParticleRotation) {
+			m_graphics->PushTransform();
+			m_graphics->Translate(centerX, centerY);
+			m_graphics->Rotate(rotation, 0.0f, 0.0f, 1.0f);
+			m_graphics->DrawTextureRegion(
+				texture,
+				srcX, 0.0f, srcW, srcH,
+				-destW * 0.5f, -destH * 0.5f, destW, destH,
+				0.0f,
+				finalColor
+			);
+			m_graphics->PopTransform();
+		}
+		else {
+			m_graphics->DrawTextureRegion(
+				texture,
+				srcX, 0.0f, srcW, srcH,
+				x, y, destW, destH,
+				rotation,
+				finalColor
+			);
+		}
+	}
+
+	if (instanced) {
+		m_graphics->AppendInstanceRun(mInstanceScratch.data(), static_cast<size_t>(recordCount),
+			m_graphics->GetBlendMode());
 	}
 }
 
 void ParticleEmitter::Clear() {
-	for (size_t i = 0; i < particles.size(); i++)
-	{
-		particles[i].active = false;
-	}
+	particles.Clear();
 }
 
 bool ParticleEmitter::ShouldDestroy() const {
 	return !active && GetActiveParticleCount() == 0;
 }
-
-int ParticleEmitter::GetActiveParticleCount() const {
-	int count = 0;
-	for (size_t i = 0; i < particles.size(); i++)
-	{
-		if (particles[i].active)
-		{
-			count++;
-		}
-	}
-	return count;
-}
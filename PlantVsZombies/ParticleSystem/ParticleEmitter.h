@@ -2,9 +2,10 @@
 #ifndef __PARTICLE_EMITTER_H__
 #define __PARTICLE_EMITTER_H__
 
-#include "Particle.h"
+#include "ParticlePool.h"
 #include "ParticleXMLConfig.h"
 #include "../Graphics.h"
+#include <cstdint>
 #include <vector>
 
 /**
@@ -23,8 +24,9 @@ struct ParticleRenderProbe {
 class ParticleEmitter {
 private:
 	Graphics* m_graphics = nullptr;
-	std::vector<Particle> particles;
+	ParticlePool particles;
 	ParticleRenderProbe mLastRenderProbe;
+	std::vector<InstanceRecord> mInstanceScratch;   // 实例路径：整段打包后一次提交，跨帧复用 capacity
 
 	Vector position;
 	bool active = false;
@@ -39,6 +41,8 @@ private:
 	EmitterConfig xmlConfig;
 	std::vector<ParticleField> activeFields;
 	float systemTimer = 0.0f;
+	// Shake 场逐帧抖动用的私有随机流：UpdateParticles 可能跑在 worker 上，不能碰 GameRandom
+	std::uint32_t mShakeRngState = 1u;
 
 public:
 	ParticleEmitter(Graphics* g = nullptr);
@@ -58,17 +62,21 @@ public:
 
 	bool IsActive() const { return active; }
 	bool ShouldDestroy() const;
-	int GetActiveParticleCount() const;
+	int GetActiveParticleCount() const { return particles.Count(); }
 	void SetPosition(const Vector& pos) { position = pos; }
 	Vector GetPosition() const { return position; }
 	const ParticleRenderProbe& GetLastRenderProbe() const { return mLastRenderProbe; }
 
-	void Update();
+	/** 串行路径：UpdateEmission + UpdateParticles。 */
+	void Update(float deltaTime);
+	/** 发射计时与新粒子生成；使用 GameRandom 表现流，只能在主线程调用。 */
+	void UpdateEmission(float deltaTime);
+	/** 曲线、场与积分，并剔除到期粒子；只读写本发射器，可在 worker 线程并行调用。 */
+	void UpdateParticles(float deltaTime);
 	void Draw();
 
 private:
 	void EmitSingleParticle();
-	Particle* GetFreeParticle();
 	Vector GetSpawnPosition() const;
 };
 
@@ -0,0 +1,128 @@
+#include "ParticlePool.h"
+#include <algorithm>
+
+void ParticlePool::Reserve(int capacity) {
+	mCapacity = std::max(0, capacity);
+	mCount = 0;
+	const size_t n = static_cast<size_t>(mCapacity);
+	for (std::vector<float>* column : {
+		&posX, &posY, &velX, &velY, &lifetime, &maxLifetime, &rotation, &rotationSpeed,
+		&size, &stretch, &alpha, &colorR, &colorG, &colorB,
+		&brightness, &baseScale, &fieldRandomX, &fieldRandomY,
+		&fieldOffsetX, &fieldOffsetY, &shakeOffsetX, &shakeOffsetY,
+		&animationTimer, &normalizedTime }) {
+		column->assign(n, 0.0f);
+	}
+	currentFrame.assign(n, 0);
+	texture.assign(n, nullptr);
+}
+
+int ParticlePool::Spawn() {
+	if (Full()) return -1;
+	const int i = mCount++;
+	posX[i] = posY[i] = 0.0f;
+	velX[i] = velY[i] = 0.0f;
+	lifetime[i] = 0.0f;
+	maxLifetime[i] = 60.0f;
+	rotation[i] = rotationSpeed[i] = 0.0f;
+	size[i] = stretch[i] = 1.0f;
+	alpha[i] = 255.0f;
+	colorR[i] = colorG[i] = colorB[i] = 1.0f;
+	brightness[i] = baseScale[i] = 1.0f;
+	fieldRandomX[i] = fieldRandomY[i] = 0.5f;
+	fieldOffsetX[i] = fieldOffsetY[i] = 0.0f;
+	shakeOffsetX[i] = shakeOffsetY[i] = 0.0f;
+	animationTimer[i] = 0.0f;
+	currentFrame[i] = 0;
+	texture[i] = nullptr;
+	return i;
+}
+
+void ParticlePool::ComputeNormalizedTime() {
+	const int n = mCount;
+	const float* __restrict life = lifetime.data();
+	const float* __restrict maxLife = maxLifetime.data();
+	float* __restrict t = normalizedTime.data();
+	for (int i = 0; i < n; ++i) {
+		t[i] = life[i] / maxLife[i];
+	}
+}
+
+void ParticlePool::Integrate(float deltaTime, float gravity) {
+	const int n = mCount;
+	const float dv = gravity * deltaTime;
+
+	float* __restrict life = lifetime.data();
+	for (int i = 0; i < n; ++i) {
+		life[i] += deltaTime;
+	}
+
+	float* __restrict px = posX.data();
+	float* __restrict py = posY.data();
+	const float* __restrict vx = velX.data();
+	float* __restrict vy = velY.data();
+	for (int i = 0; i < n; ++i) {
+		vy[i] += dv;
+		px[i] += vx[i] * deltaTime;
+		py[i] += vy[i] * deltaTime;
+	}
+
+	float* __restrict rot = rotation.data();
+	const float* __restrict spin = rotationSpeed.data();
+	for (int i = 0; i < n; ++i) {
+		rot[i] += spin[i] * deltaTime;
+	}
+}
+
+void ParticlePool::AdvanceFrames(float deltaTime, float frameDuration, int totalFrames) {
+	if (totalFrames <= 1 || frameDuration <= 0.0f) return;
+	const int n = mCount;
+	float* __restrict timer = animationTimer.data();
+	int* __restrict frame = currentFrame.data();
+	// 选择代替分支：每帧最多进一格，与旧 UpdateAnimation 一致
+	for (int i = 0; i < n; ++i) {
+		const float t = timer[i] + deltaTime;
+		const bool step = t >= frameDuration;
+		timer[i] = step ? t - frameDuration : t;
+		const int next = frame[i] + (step ? 1 : 0);
+		frame[i] = next >= totalFrames ? next - totalFrames : next;
+	}
+}
+
+int ParticlePool::CompactDead() {
+	const int n = mCount;
+	const float* life = lifetime.data();
+	const float* maxLife = maxLifetime.data();
+
+	// 先找到第一颗死亡粒子；常见帧里没有粒子到期，直接返回
+	int write = 0;
+	while (write < n && life[write] < maxLife[write]) ++write;
+	if (write == n) return 0;
+
+	for (int read = write + 1; read < n; ++read) {
+		if (life[read] < maxLife[read]) {
+			MoveParticle(read, write);
+			++write;
+		}
+	}
+	mCount = write;
+	return n - write;
+}
+
+void ParticlePool::MoveParticle(int from, int to) {
+	posX[to] = posX[from];                 posY[to] = posY[from];
+	velX[to] = velX[from];                 velY[to] = velY[from];
+	lifetime[to] = lifetime[from];         maxLifetime[to] = maxLifetime[from];
+	rotation[to] = rotation[from];         rotationSpeed[to] = rotationSpeed[from];
+	size[to] = size[from];                 stretch[to] = stretch[from];
+	alpha[to] = alpha[from];
+	colorR[to] = colorR[from];             colorG[to] = colorG[from];
+	colorB[to] = colorB[from];
+	brightness[to] = brightness[from];     baseScale[to] = baseScale[from];
+	fieldRandomX[to] = fieldRandomX[from]; fieldRandomY[to] = fieldRandomY[from];
+	fieldOffsetX[to] = fieldOffsetX[from]; fieldOffsetY[to] = fieldOffsetY[from];
+	shakeOffsetX[to] = shakeOffsetX[from]; shakeOffsetY[to] = shakeOffsetY[from];
+	animationTimer[to] = animationTimer[from];
+	currentFrame[to] = currentFrame[from];
+	texture[to] = texture[from];
+}
@@ -0,0 +1,75 @@
+#pragma once
+#ifndef __PARTICLE_POOL_H__
+#define __PARTICLE_POOL_H__
+
+#include <vector>
+
+struct Texture;
+
+/**
+ * 单个发射器的 SoA 粒子存储（替代原 ~150 字节的 AoS Particle）。
+ *
+ * 每个属性一条连续 float 数组，存活粒子始终紧凑占据 [0, Count())：没有 active 标志，
+ * 发射 O(1) 追加到末尾，死亡粒子由 CompactDead 单趟剔除。积分循环只访问所需的几条数组，
+ * 无分支、无别名，编译器可直接向量化（/arch:AVX2 时 8 路）。
+ *
+ * 只依赖自身数组，不读全局状态：不同发射器的池可在 worker 线程上并行推进。
+ */
+class ParticlePool {
+private:
+	int mCount = 0;
+	int mCapacity = 0;
+
+public:
+	// 运动
+	std::vector<float> posX, posY;
+	std::vector<float> velX, velY;
+	std::vector<float> lifetime, maxLifetime;
+	std::vector<float> rotation, rotationSpeed;
+	// 外观（每帧由曲线写入）
+	std::vector<float> size, stretch, alpha;
+	std::vector<float> colorR, colorG, colorB;
+	// spawn 采样、整生命周期保持
+	std::vector<float> brightness, baseScale;
+	std::vector<float> fieldRandomX, fieldRandomY;
+	// 场偏移
+	std::vector<float> fieldOffsetX, fieldOffsetY;
+	std::vector<float> shakeOffsetX, shakeOffsetY;
+	// 序列帧
+	std::vector<float> animationTimer;
+	std::vector<int> currentFrame;
+	std::vector<const Texture*> texture;
+	// 更新期暂存：lifetime / maxLifetime，不参与压缩
+	std::vector<float> normalizedTime;
+
+	/** 设定容量并分配全部数组；清空现有粒子。容量不超过已有分配时不重新分配（池化复用）。 */
+	void Reserve(int capacity);
+
+	int Count() const { return mCount; }
+	int Capacity() const { return mCapacity; }
+	bool Full() const { return mCount >= mCapacity; }
+	void Clear() { mCount = 0; }
+
+	/** 在末尾追加一颗默认值粒子，返回其下标；已满返回 -1。 */
+	int Spawn();
+
+	/** 写入 normalizedTime[i] = lifetime / maxLifetime。 */
+	void ComputeNormalizedTime();
+
+	/**
+	 * 寿命、重力、速度→位置、自旋一次积分。到期粒子照常被推进，随后由 CompactDead 剔除，
+	 * 对绘制结果与"到期即不再移动"的旧逻辑等价。
+	 */
+	void Integrate(float deltaTime, float gravity);
+
+	/** 序列帧推进；frameDuration<=0 或 totalFrames<=1 时不做任何事。 */
+	void AdvanceFrames(float deltaTime, float frameDuration, int totalFrames);
+
+	/** 剔除 lifetime >= maxLifetime 的粒子，保持存活粒子相对顺序（即绘制顺序）。返回剔除数。 */
+	int CompactDead();
+
+private:
+	void MoveParticle(int from, int to);
+};
+
+#endif
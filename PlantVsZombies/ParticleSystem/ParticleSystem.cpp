@@ -1,5 +1,9 @@
 #include "ParticleSystem.h"
+#include "../DeltaTime.h"
 #include "../Logger.h"
+#include "../Game/ThreadPool.h"
+#include <algorithm>
+#include <thread>
 
 std::unique_ptr<ParticleSystem> g_particleSystem = nullptr;
 
@@ -12,82 +16,268 @@ ParticleSystem::~ParticleSystem() {
 	ClearAll();
 }
 
-void ParticleSystem::UpdateAll() {
+void ParticleSystem::UpdateAll(ThreadPool* workers) {
+	// 发射器每次推进至多补发一颗，合并后的大步长只会让快进时的粒子变稀，寿命仍按总时长老化
+	mDeferredDeltaTime += DeltaTime::GetDeltaTime();
+	if (DeltaTime::IsIntermediateStep()) return;
+	const float deltaTime = mDeferredDeltaTime;
+	mDeferredDeltaTime = 0.0f;
+	Step(deltaTime, workers);
+}
+
+void ParticleSystem::Step(float deltaTime, ThreadPool* workers) {
 	CleanupInactiveEffects();
 
-	for (auto& effect : effects) {
-		effect->Update();
+	mLiveEmitters.clear();
+	for (RenderBucket& bucket : mBuckets) {
+		for (ParticleEffect* effect : bucket.effects) {
+			effect->UpdateEmission(deltaTime);
+			effect->CollectLiveEmitters(mLiveEmitters);
+		}
+	}
+
+	int liveParticles = 0;
+	for (const ParticleEmitter* emitter : mLiveEmitters) {
+		liveParticles += emitter->GetActiveParticleCount();
 	}
+
+	int numWorkers = static_cast<int>(std::thread::hardware_concurrency());
+	numWorkers = std::min(numWorkers, static_cast<int>(mLiveEmitters.size()));
+	if (!workers || numWorkers < 2 || liveParticles < PARALLEL_PARTICLE_THRESHOLD) {
+		for (ParticleEmitter* emitter : mLiveEmitters) {
+			emitter->UpdateParticles(deltaTime);
+		}
+		return;
+	}
+
+	// 发射器粒子量差异很大（一场雨上千、一次命中十几颗）：按粒子数降序后轮转分给 worker，
+	// 避免连续切块把几个大发射器压到同一个线程上。
+	std::sort(mLiveEmitters.begin(), mLiveEmitters.end(),
+		[](const ParticleEmitter* a, const ParticleEmitter* b) {
+			return a->GetActiveParticleCount() > b->GetActiveParticleCount();
+		});
+	const int emitterCount = static_cast<int>(mLiveEmitters.size());
+	workers->Dispatch(numWorkers, [this, deltaTime, numWorkers, emitterCount](int start, int end) {
+		for (int w = start; w < end; ++w) {
+			for (int i = w; i < emitterCount; i += numWorkers) {
+				mLiveEmitters[i]->UpdateParticles(deltaTime);
+			}
+		}
+	});
+}
+
+int ParticleSystem::GetTotalActiveParticleCount() const {
+	int count = 0;
+	for (const RenderBucket& bucket : mBuckets) {
+		for (const ParticleEffect* effect : bucket.effects) {
+			count += effect->GetActiveParticleCount();
+		}
+	}
+	return count;
 }
 
 void ParticleSystem::DrawBelow(int order) {
-	for (auto& effect : effects) {
-		if (effect->GetRenderOrder() < order) {
+	for (RenderBucket& bucket : mBuckets) {
+		if (bucket.renderOrder >= order) break;
+		for (ParticleEffect* effect : bucket.effects) {
 			effect->Draw();
 		}
 	}
 }
 
 void ParticleSystem::DrawFrom(int order) {
-	for (auto& effect : effects) {
-		if (effect->GetRenderOrder() >= order) {
+	auto it = std::lower_bound(mBuckets.begin(), mBuckets.end(), order,
+		[](const RenderBucket& bucket, int value) { return bucket.renderOrder < value; });
+	for (; it != mBuckets.end(); ++it) {
+		for (ParticleEffect* effect : it->effects) {
 			effect->Draw();
 		}
 	}
 }
 
 void ParticleSystem::ClearAll() {
-	effects.clear();
+	for (RenderBucket& bucket : mBuckets) {
+		for (ParticleEffect* effect : bucket.effects) {
+			RecycleEffect(effect);
+		}
+		bucket.effects.clear();
+	}
+	mDeferredDeltaTime = 0.0f;
 }
 
-bool ParticleSystem::LoadXMLConfigs(const std::string& directory) {
-	return configManager.LoadXMLConfigs(directory);
+std::vector<const ParticleEffect*> ParticleSystem::GetEffectsForTesting() const {
+	std::vector<const ParticleEffect*> out;
+	for (const RenderBucket& bucket : mBuckets) {
+		out.insert(out.end(), bucket.effects.begin(), bucket.effects.end());
+	}
+	return out;
+}
+
+bool ParticleSystem::LoadXMLConfigs(const std::string& directory, const std::string& cachePath) {
+	return configManager.LoadXMLConfigs(directory, cachePath);
 }
 
-void ParticleSystem::EmitEffect(const std::string& effectName, const Vector& position,
+EffectId ParticleSystem::ResolveEffect(const std::string& effectName) const {
+	const EffectId id = configManager.ResolveEffect(effectName);
+	if (!id.IsValid()) {
+		LOG_ERROR("Particle") << "找不到粒子特效配置: " << effectName;
+	}
+	return id;
+}
+
+EffectInstanceHandle ParticleSystem::EmitEffect(EffectId effectId, const Vector& position,
 	int renderOrder, float durationOverride, float clipRightX) {
-	const ParticleEffectConfig* config = configManager.GetEffectConfig(effectName);
+	const ParticleEffectConfig* config = configManager.GetEffectConfig(effectId);
 	if (!config) {
-		LOG_ERROR("Particle") << "找不到粒子特效配置: " << effectName;
-		return;
+		return {};
 	}
 
-	auto effect = std::make_unique<ParticleEffect>();
+	ParticleEffect* effect = AcquireEffect(effectId);
 	effect->InitializeFromConfig(*config, m_graphics, position);
-	effect->SetName(effectName);
+	effect->SetEffect(effectId, &configManager.GetEffectName(effectId));
 	effect->SetRenderOrder(renderOrder);
 	effect->SetSystemDuration(durationOverride);
 	effect->SetClipRightX(clipRightX);
-	effects.push_back(std::move(effect));
+	GetBucket(renderOrder).effects.push_back(effect);
+	return AcquireInstanceSlot(*effect);
 }
 
-void ParticleSystem::StopEffect(const std::string& effectName) {
-	for (auto& effect : effects) {
-		if (effect->GetName() == effectName) effect->Stop();
+void ParticleSystem::StopEffect(EffectId effectId) {
+	for (RenderBucket& bucket : mBuckets) {
+		for (ParticleEffect* effect : bucket.effects) {
+			if (effect->GetEffectId() == effectId) effect->Stop();
+		}
 	}
 }
 
-bool ParticleSystem::IsEffectEmitting(const std::string& effectName) const {
-	for (const auto& effect : effects) {
-		if (effect->GetName() == effectName && effect->IsEmitting()) return true;
+bool ParticleSystem::IsEffectEmitting(EffectId effectId) const {
+	for (const RenderBucket& bucket : mBuckets) {
+		for (const ParticleEffect* effect : bucket.effects) {
+			if (effect->GetEffectId() == effectId && effect->IsEmitting()) return true;
+		}
 	}
 	return false;
 }
 
-int ParticleSystem::GetEffectActiveParticleCount(const std::string& effectName) const {
+int ParticleSystem::GetEffectActiveParticleCount(EffectId effectId) const {
 	int count = 0;
-	for (const auto& effect : effects) {
-		if (effect->GetName() == effectName) count += effect->GetActiveParticleCount();
+	for (const RenderBucket& bucket : mBuckets) {
+		for (const ParticleEffect* effect : bucket.effects) {
+			if (effect->GetEffectId() == effectId) count += effect->GetActiveParticleCount();
+		}
 	}
 	return count;
 }
 
+ParticleEffect* ParticleSystem::FindInstance(EffectInstanceHandle handle) {
+	if (handle.slot >= mInstanceSlots.size()) return nullptr;
+	const InstanceSlot& slot = mInstanceSlots[handle.slot];
+	return slot.generation == handle.generation ? slot.effect : nullptr;
+}
+
+const ParticleEffect* ParticleSystem::FindInstance(EffectInstanceHandle handle) const {
+	if (handle.slot >= mInstanceSlots.size()) return nullptr;
+	const InstanceSlot& slot = mInstanceSlots[handle.slot];
+	return slot.generation == handle.generation ? slot.effect : nullptr;
+}
+
+void ParticleSystem::StopInstance(EffectInstanceHandle handle) {
+	if (ParticleEffect* effect = FindInstance(handle)) effect->Stop();
+}
+
+bool ParticleSystem::IsInstanceEmitting(EffectInstanceHandle handle) const {
+	const ParticleEffect* effect = FindInstance(handle);
+	return effect && effect->IsEmitting();
+}
+
+int ParticleSystem::GetInstanceActiveParticleCount(EffectInstanceHandle handle) const {
+	const ParticleEffect* effect = FindInstance(handle);
+	return effect ? effect->GetActiveParticleCount() : 0;
+}
+
+EffectInstanceHandle ParticleSystem::EmitEffect(const std::string& effectName, const Vector& position,
+	int renderOrder, float durationOverride, float clipRightX) {
+	return EmitEffect(ResolveEffect(effectName), position, renderOrder, durationOverride, clipRightX);
+}
+
+void ParticleSystem::StopEffect(const std::string& effectName) {
+	StopEffect(configManager.ResolveEffect(effectName));
+}
+
+bool ParticleSystem::IsEffectEmitting(const std::string& effectName) const {
+	return IsEffectEmitting(configManager.ResolveEffect(effectName));
+}
+
+int ParticleSystem::GetEffectActiveParticleCount(const std::string& effectName) const {
+	return GetEffectActiveParticleCount(configManager.ResolveEffect(effectName));
+}
+
+EffectInstanceHandle ParticleSystem::AcquireInstanceSlot(ParticleEffect& effect) {
+	std::uint32_t slot;
+	if (!mFreeInstanceSlots.empty()) {
+		slot = mFreeInstanceSlots.back();
+		mFreeInstanceSlots.pop_back();
+	}
+	else {
+		slot = static_cast<std::uint32_t>(mInstanceSlots.size());
+		mInstanceSlots.emplace_back();
+	}
+	mInstanceSlots[slot].effect = &effect;
+	effect.SetInstanceSlot(slot);
+	return EffectInstanceHandle{ slot, mInstanceSlots[slot].generation };
+}
+
+void ParticleSystem::ReleaseInstanceSlot(ParticleEffect& effect) {
+	const std::uint32_t slot = effect.GetInstanceSlot();
+	if (slot >= mInstanceSlots.size()) return;
+	mInstanceSlots[slot].effect = nullptr;
+	++mInstanceSlots[slot].generation;
+	mFreeInstanceSlots.push_back(slot);
+	effect.SetInstanceSlot(UINT32_MAX);
+}
+
+ParticleSystem::RenderBucket& ParticleSystem::GetBucket(int renderOrder) {
+	auto it = std::lower_bound(mBuckets.begin(), mBuckets.end(), renderOrder,
+		[](const RenderBucket& bucket, int value) { return bucket.renderOrder < value; });
+	if (it == mBuckets.end() || it->renderOrder != renderOrder) {
+		RenderBucket bucket;
+		bucket.renderOrder = renderOrder;
+		it = mBuckets.insert(it, std::move(bucket));
+	}
+	return *it;
+}
+
+ParticleEffect* ParticleSystem::AcquireEffect(EffectId effectId) {
+	const size_t index = static_cast<size_t>(effectId.index);
+	if (index < mFreeEffects.size() && !mFreeEffects[index].empty()) {
+		ParticleEffect* effect = mFreeEffects[index].back();
+		mFreeEffects[index].pop_back();
+		return effect;
+	}
+	mEffectStorage.push_back(std::make_unique<ParticleEffect>());
+	return mEffectStorage.back().get();
+}
+
+void ParticleSystem::RecycleEffect(ParticleEffect* effect) {
+	ReleaseInstanceSlot(*effect);
+	const size_t index = static_cast<size_t>(effect->GetEffectId().index);
+	if (index >= mFreeEffects.size()) {
+		mFreeEffects.resize(index + 1);
+	}
+	mFreeEffects[index].push_back(effect);
+}
+
 void ParticleSystem::CleanupInactiveEffects() {
-	effects.erase(
-		std::remove_if(effects.begin(), effects.end(),
-			[](const std::unique_ptr<ParticleEffect>& effect) {
-				return effect->ShouldDestroy();
-			}),
-		effects.end()
-	);
+	for (RenderBucket& bucket : mBuckets) {
+		std::vector<ParticleEffect*>& list = bucket.effects;
+		for (size_t i = 0; i < list.size();) {
+			if (!list[i]->ShouldDestroy()) {
+				++i;
+				continue;
+			}
+			RecycleEffect(list[i]);
+			list[i] = list.back();
+			list.pop_back();
+		}
+	}
 }
@@ -10,11 +10,36 @@
 #include <vector>
 #include <memory>
 
+class ThreadPool;
+
 class ParticleSystem {
 private:
-	std::vector<std::unique_ptr<ParticleEffect>> effects;
+	// 在场特效按 renderOrder 升序分桶；桶内无序，回收时与桶尾交换后弹出。
+	// 桶只增不删（渲染层种类很少），DrawBelow/DrawFrom 只访问相关区间的桶。
+	struct RenderBucket {
+		int renderOrder = 0;
+		std::vector<ParticleEffect*> effects;
+	};
+	std::vector<RenderBucket> mBuckets;
+	// 特效对象池：mEffectStorage 持有全部创建过的特效；回收后按 EffectId 挂到空闲表，
+	// 同一配置再次发射时复用原对象及其发射器/粒子池容量，稳态下不再分配。
+	std::vector<std::unique_ptr<ParticleEffect>> mEffectStorage;
+	std::vector<std::vector<ParticleEffect*>> mFreeEffects;
 	Graphics* m_graphics = nullptr;
 	ParticleConfigManager configManager;
+	std::vector<ParticleEmitter*> mLiveEmitters;   // 本帧待推进的发射器，跨帧复用 capacity
+	float mDeferredDeltaTime = 0.0f;               // 快进中间步攒下、留待呈现步一次推进的时间
+
+	// 实例句柄槽位表：slot → 在场特效；特效销毁时代数递增使旧句柄失效
+	struct InstanceSlot {
+		ParticleEffect* effect = nullptr;
+		std::uint32_t generation = 0;
+	};
+	std::vector<InstanceSlot> mInstanceSlots;
+	std::vector<std::uint32_t> mFreeInstanceSlots;
+
+	// 存活粒子总数达到此量级才支付线程池调度成本
+	static constexpr int PARALLEL_PARTICLE_THRESHOLD = 4096;
 
 public:
 	explicit ParticleSystem(Graphics* graphics);
@@ -23,33 +48,70 @@ public:
 	ParticleSystem(const ParticleSystem&) = delete;
 	ParticleSystem& operator=(const ParticleSystem&) = delete;
 
-	void UpdateAll();
+	/**
+	 * 每逻辑步推进全部特效。发射在主线程串行（依赖 GameRandom 表现流），随后各发射器的
+	 * 曲线/积分/压缩彼此独立，粒子量足够时在 workers 上按发射器并行；workers 为空则串行。
+	 * 快进中间步只累计时间，到呈现步再以累计步长推进一次。
+	 */
+	void UpdateAll(ThreadPool* workers = nullptr);
+	/** 同 UpdateAll，但显式给定步长；供 -ParticleBench 在主循环外计时。 */
+	void Step(float deltaTime, ThreadPool* workers);
+	/** 当前全部特效的存活粒子总数。 */
+	int GetTotalActiveParticleCount() const;
 	// 绘制 renderOrder < order 的特效（战场层；由 GameObjectManager overlay 前 hook 调用）
 	void DrawBelow(int order);
 	// 绘制 renderOrder >= order 的特效（顶层；由场景命令槽调用）
 	void DrawFrom(int order);
 	void ClearAll();
 
-	bool LoadXMLConfigs(const std::string& directory);
+	/** cachePath 为二进制配置缓存位置，空串表示不用缓存。 */
+	bool LoadXMLConfigs(const std::string& directory, const std::string& cachePath = "");
+	std::vector<std::string> GetAllEffectNames() const { return configManager.GetAllXMLEffectNames(); }
+
+	/** 名字 → EffectId，热路径调用点解析一次后缓存；未知名字记错误日志并返回无效 id。 */
+	EffectId ResolveEffect(const std::string& effectName) const;
 	/**
 	 * 发射粒子；clipRightX>=0 时把该特效裁到世界坐标右边界，适合会被实体阻断的横向喷雾。
+	 * 返回本实例句柄，可 O(1) 停止/查询；无效 id 不发射并返回无效句柄。
 	 */
-	void EmitEffect(const std::string& effectName, const Vector& position,
+	EffectInstanceHandle EmitEffect(EffectId effect, const Vector& position,
+		int renderOrder = LAYER_EFFECTS_WORLD, float durationOverride = -1.0f,
+		float clipRightX = -1.0f);
+	/** 停止全部该配置的特效继续发射；已生成粒子仍按各自寿命自然收尾。 */
+	void StopEffect(EffectId effect);
+	/** 查询该配置是否至少有一个实例的发射器仍在工作。 */
+	bool IsEffectEmitting(EffectId effect) const;
+	/** 返回该配置全部实例当前存活粒子总数。 */
+	int GetEffectActiveParticleCount(EffectId effect) const;
+
+	/** 句柄对应的实例；已销毁或无效返回 nullptr。 */
+	ParticleEffect* FindInstance(EffectInstanceHandle handle);
+	const ParticleEffect* FindInstance(EffectInstanceHandle handle) const;
+	/** 只停止这一个实例；句柄失效时无操作。 */
+	void StopInstance(EffectInstanceHandle handle);
+	bool IsInstanceEmitting(EffectInstanceHandle handle) const;
+	int GetInstanceActiveParticleCount(EffectInstanceHandle handle) const;
+
+	// 字符串版本：脚本、AutoTest 与低频调用点的薄封装，内部先解析成 EffectId
+	EffectInstanceHandle EmitEffect(const std::string& effectName, const Vector& position,
 		int renderOrder = LAYER_EFFECTS_WORLD, float durationOverride = -1.0f,
 		float clipRightX = -1.0f);
-	/** 停止全部同名特效继续发射；已生成粒子仍按各自寿命自然收尾。 */
 	void StopEffect(const std::string& effectName);
-	/** 查询同名特效是否至少有一个发射器仍在工作。 */
 	bool IsEffectEmitting(const std::string& effectName) const;
-	/** 返回全部同名特效当前存活粒子总数，供 AutoTest 和问题诊断使用。 */
 	int GetEffectActiveParticleCount(const std::string& effectName) const;
-	/** 只读暴露当前特效实例，供 AutoTest 导出最终绘制语义。 */
-	const std::vector<std::unique_ptr<ParticleEffect>>& GetEffectsForTesting() const {
-		return effects;
-	}
+	/** 按绘制顺序收集当前在场特效，供 AutoTest 导出最终绘制语义。 */
+	std::vector<const ParticleEffect*> GetEffectsForTesting() const;
 
 private:
 	void CleanupInactiveEffects();
+	/** 取 renderOrder 对应的桶，没有则按序插入。 */
+	RenderBucket& GetBucket(int renderOrder);
+	/** 从空闲表取该配置的特效对象，没有则新建。 */
+	ParticleEffect* AcquireEffect(EffectId effectId);
+	/** 释放句柄槽位并把特效挂回空闲表；调用方负责把它移出桶。 */
+	void RecycleEffect(ParticleEffect* effect);
+	EffectInstanceHandle AcquireInstanceSlot(ParticleEffect& effect);
+	void ReleaseInstanceSlot(ParticleEffect& effect);
 };
 
 extern std::unique_ptr<ParticleSystem> g_particleSystem;
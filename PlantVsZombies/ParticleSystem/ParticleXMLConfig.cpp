@@ -83,7 +83,7 @@ float InterpolationTrack::GetValueRandomized(float normalizedTime, float randomF
 
 float InterpolationTrack::SampleConstant() const {
 	if (isRandomRange) {
-		return GameRandom::Range(randomMin, randomMax);
+		return GameRandom::VisualRange(randomMin, randomMax);
 	}
 	if (isConstant) {
 		return constantValue;
@@ -95,7 +95,7 @@ float ValueRange::GetRandomValue() const {
 	if (!isRange) {
 		return minValue;
 	}
-	return GameRandom::Range(minValue, maxValue);
+	return GameRandom::VisualRange(minValue, maxValue);
 }
 
 EmitterConfig::EmitterConfig() {
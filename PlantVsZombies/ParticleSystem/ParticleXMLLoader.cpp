@@ -1,36 +1,15 @@
 #include "ParticleXMLLoader.h"
-#include "../FileManager.h"
 #include "../Logger.h"
 #include <sstream>
 #include <algorithm>
 #include <cctype>
 
-bool ParticleXMLLoader::LoadFromDirectory(const std::string& directory) {
-	// 经构建期烘焙的清单列举（FileManager::ListResourceFiles 经 SDL_RWops 读，APK 可读），
-	// 不再用 std::filesystem，使粒子配置目录在 Android 上也能列举 APK assets。
-	std::vector<std::string> xmlFiles = FileManager::ListResourceFiles(directory, ".xml");
-
-	if (xmlFiles.empty()) {
-		LOG_WARN("Particle") << "粒子配置目录为空: " << directory;
-		return false;
-	}
-
-	bool success = true;
-	for (const std::string& file : xmlFiles) {
-		if (!LoadFromFile(file)) {
-			LOG_WARN("Particle") << "加载粒子配置文件失败: " << file;
-			success = false;
-		}
-	}
-	LOG_DEBUG("Particle") << "粒子XML配置加载完成: " << effectConfigs.size() << " 个特效";
-	return success;
-}
-
-bool ParticleXMLLoader::LoadFromFile(const std::string& filePath) {
+bool ParticleXMLLoader::LoadFromString(const std::string& xmlText, const std::string& sourceName) {
 	pugi::xml_document doc;
-	// 统一走 SDL_RWops(FileManager)，使粒子配置在 Android 也能从 APK assets 读取。
-	if (!FileManager::LoadXMLFile(filePath, doc)) {
-		LOG_ERROR("Particle") << "加载粒子XML文件失败: " << filePath;
+	pugi::xml_parse_result result = doc.load_buffer(xmlText.data(), xmlText.size(),
+		pugi::parse_default, pugi::encoding_utf8);
+	if (!result) {
+		LOG_ERROR("Particle") << "解析粒子XML失败: " << sourceName << ", " << result.description();
 		return false;
 	}
 
@@ -42,14 +21,14 @@ bool ParticleXMLLoader::LoadFromFile(const std::string& filePath) {
 	}
 
 	if (emitters.empty()) {
-		LOG_WARN("Particle") << "XML文件中没有找到发射器: " << filePath;
+		LOG_WARN("Particle") << "XML文件中没有找到发射器: " << sourceName;
 		return false;
 	}
 
 	// 使用第一个发射器的名称作为特效名称
 	std::string effectName = emitters[0].name;
 	if (effectName.empty()) {
-		LOG_WARN("Particle") << "发射器没有名称: " << filePath;
+		LOG_WARN("Particle") << "发射器没有名称: " << sourceName;
 		return false;
 	}
 
@@ -63,6 +42,11 @@ bool ParticleXMLLoader::LoadFromFile(const std::string& filePath) {
 	return true;
 }
 
+void ParticleXMLLoader::AddEffectConfig(ParticleEffectConfig config) {
+	std::string name = config.name;
+	effectConfigs[name] = std::move(config);
+}
+
 const ParticleEffectConfig* ParticleXMLLoader::GetEffectConfig(const std::string& name) const {
 	auto it = effectConfigs.find(name);
 	if (it != effectConfigs.end()) {
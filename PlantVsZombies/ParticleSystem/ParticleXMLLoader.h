@@ -16,11 +16,12 @@ public:
 	ParticleXMLLoader() = default;
 	~ParticleXMLLoader() = default;
 
-	// 从目录加载所有XML文件
-	bool LoadFromDirectory(const std::string& directory);
+	// 解析单个粒子 XML 文件的内容；sourceName 只用于日志。
+	// 文件读取由 ParticleConfigManager 负责（同一份内容还要参与缓存哈希），本类不碰文件系统。
+	bool LoadFromString(const std::string& xmlText, const std::string& sourceName);
 
-	// 从单个文件加载
-	bool LoadFromFile(const std::string& filePath);
+	// 直接登记已解析好的特效（二进制缓存路径）；同名覆盖
+	void AddEffectConfig(ParticleEffectConfig config);
 
 	// 获取特效配置
 	const ParticleEffectConfig* GetEffectConfig(const std::string& name) const;
@@ -42,6 +42,14 @@ public:
 		mFlushVerts += verts;
 	}
 
+	// 诊断：FlushBatch 可选重排（-BatchReorder）前后的状态段数。段数即该批的 draw 次数，
+	// before-after 就是重排省下的提交；未开启重排时两项都为 0。
+	void CountBatchSegments(size_t before, size_t after) {
+		if (!g_ProfileEnabled) return;
+		mBatchSegBeforeAccum += before;
+		mBatchSegAfterAccum += after;
+	}
+
 	// 诊断：每次 GetOrCreateTextTexture 调用记一次（miss=true 表示走了 TTF 光栅化+GPU 上传）。
 	// 用于把 7.Draw_replay 的串行成本拆成「整串→纹理缓存 thrash」与「逐行 draw call 地板」。
 	void CountText(bool miss) {
@@ -50,6 +58,13 @@ public:
 		if (miss) mTextMissAccum++;
 	}
 
+	// 诊断：文字纹理缓存满载后 CLOCK 淘汰一个条目记一次。textEvict 持续接近 textRaster(miss)
+	// = 工作集超过容量，每次未命中都在挤掉别的文字。
+	void CountTextEvict() {
+		if (!g_ProfileEnabled) return;
+		mTextEvictAccum++;
+	}
+
 	// 诊断：BuildGlyphAtlas 每次全量重建记一次。正常应为 0/frame（图集建好后永久命中）；
 	// 持续 >0 = 重建循环（建失败 textureID 保持 0 → 每次 DrawGlyphRun 都重建，TTF 全字集
 	// 光栅化 + 建/销毁 GPU 纹理，约 1ms/次，是 Draw_replay 串行尖峰的头号嫌疑）。
@@ -83,6 +98,14 @@ public:
 		mSweepHitAccum += hit;
 	}
 
+	// 诊断：reanim 实例化路径的视口剔除。culled=整棵 Animator 树因世界包围盒落在相机外被跳过，
+	// emitted=实际生成 InstanceRecord 的根对象。由 Graphics::EndFrame 汇总全部 worker 后每帧调用一次。
+	void CountReanimCull(size_t culled, size_t emitted) {
+		if (!g_ProfileEnabled) return;
+		mReanimCulledAccum += culled;
+		mReanimEmittedAccum += emitted;
+	}
+
 	// 每帧调用一次（主循环末尾）。每 kReportFrames 帧打印一次平均值。
 	void EndFrame() {
 		if (!g_ProfileEnabled) return;
@@ -116,8 +139,12 @@ public:
 		}
 		// 诊断计数（每帧均值）：textRaster(miss) 高 → 缓存被击穿；flushBatch 高 → 逐行 draw call 地板。
 		std::printf("  %-20s : %7.1f /frame\n", "textDraw(lines)", mTextTotalAccum * inv);
+		std::printf("  %-20s : %7.1f /frame\n", "textCache(hit)", (mTextTotalAccum - mTextMissAccum) * inv);
 		std::printf("  %-20s : %7.1f /frame\n", "textRaster(miss)", mTextMissAccum * inv);
+		std::printf("  %-20s : %7.1f /frame\n", "textEvict", mTextEvictAccum * inv);
 		std::printf("  %-20s : %7.1f /frame\n", "flushBatch", static_cast<double>(mFlushCountAccum) * inv);
+		std::printf("  %-20s : %7.1f /frame\n", "batchSegs(order)", static_cast<double>(mBatchSegBeforeAccum) * inv);
+		std::printf("  %-20s : %7.1f /frame\n", "batchSegs(reorder)", static_cast<double>(mBatchSegAfterAccum) * inv);
 		// 字形图集诊断：glyphAtlasBuild>0 = 图集每帧重建循环；glyphFb(build)>0 = 建失败回退整串
 		// DrawText；glyphFb(missing)>0 = 图集健在但缺字形回退。三者全 0 才说明血量走的是图集快路径。
 		std::printf("  %-20s : %7.1f /frame\n", "glyphRun(lines)", static_cast<double>(mGlyphLineAccum) * inv);
@@ -130,6 +157,9 @@ public:
 		std::printf("  %-20s : %12.0f /frame\n", "sweepReject", static_cast<double>(mSweepRejectAccum) * inv);
 		std::printf("  %-20s : %12.0f /frame\n", "sweepCheck", static_cast<double>(mSweepCheckAccum) * inv);
 		std::printf("  %-20s : %12.0f /frame\n", "sweepHit", static_cast<double>(mSweepHitAccum) * inv);
+		// reanim 视口剔除：culled 高而 emitted 低 = 大量对象在屏幕外，剔除正在省 instance 写入。
+		std::printf("  %-20s : %7.1f /frame\n", "reanimCulled", static_cast<double>(mReanimCulledAccum) * inv);
+		std::printf("  %-20s : %7.1f /frame\n", "reanimEmitted", static_cast<double>(mReanimEmittedAccum) * inv);
 		std::printf("============================================\n");
 
 		mAccum.clear();
@@ -138,8 +168,11 @@ public:
 		mFrameAccum = 0.0;
 		mFlushCountAccum = 0;
 		mFlushVertsAccum = 0;
+		mBatchSegBeforeAccum = 0;
+		mBatchSegAfterAccum = 0;
 		mTextMissAccum = 0;
 		mTextTotalAccum = 0;
+		mTextEvictAccum = 0;
 		mGlyphLineAccum = 0;
 		mGlyphBuildAccum = 0;
 		mGlyphFbBuildAccum = 0;
@@ -148,6 +181,8 @@ public:
 		mSweepRejectAccum = 0;
 		mSweepCheckAccum = 0;
 		mSweepHitAccum = 0;
+		mReanimCulledAccum = 0;
+		mReanimEmittedAccum = 0;
 		mFrames = 0;
 	}
 
@@ -164,8 +199,11 @@ private:
 	size_t mFlushVerts = 0;
 	size_t mFlushCountAccum = 0;
 	size_t mFlushVertsAccum = 0;
+	size_t mBatchSegBeforeAccum = 0; // 诊断：窗口内重排前 FlushBatch 状态段总数
+	size_t mBatchSegAfterAccum = 0;  // 诊断：窗口内重排后 FlushBatch 状态段总数
 	size_t mTextMissAccum = 0;    // 诊断：窗口内文字缓存未命中(光栅化)总次数
 	size_t mTextTotalAccum = 0;   // 诊断：窗口内文字绘制(行)总次数
+	size_t mTextEvictAccum = 0;   // 诊断：窗口内文字纹理缓存淘汰次数
 	size_t mGlyphLineAccum = 0;   // 诊断：窗口内 DrawGlyphRun 快路径绘制行数
 	size_t mGlyphBuildAccum = 0;  // 诊断：窗口内 BuildGlyphAtlas 全量重建次数
 	size_t mGlyphFbBuildAccum = 0;// 诊断：窗口内 DrawGlyphRun 因图集建失败回退 DrawText 次数
@@ -174,6 +212,8 @@ private:
 	size_t mSweepRejectAccum = 0; // 诊断：窗口内被 CanCollide 拒绝的迭代次数
 	size_t mSweepCheckAccum = 0;  // 诊断：窗口内真正做 AABB 检测的次数
 	size_t mSweepHitAccum = 0;    // 诊断：窗口内检出的碰撞对数
+	size_t mReanimCulledAccum = 0;  // 诊断：窗口内被视口剔除的 reanim 根对象数
+	size_t mReanimEmittedAccum = 0; // 诊断：窗口内实际提交的 reanim 根对象数
 };
 
 // RAII 计时：作用域结束时把耗时累加到对应名字
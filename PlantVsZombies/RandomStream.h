@@ -0,0 +1,90 @@
+#pragma once
+#ifndef _RANDOM_STREAM_H
+#define _RANDOM_STREAM_H
+#include <cstdint>
+
+/**
+ * 计数器随机流：第 n 个输出只是 (key, n) 的哈希，不依赖任何共享引擎状态。
+ *
+ * key 由根种子、棋盘帧、用途域与实体 id 派生（见 Derive），所以同一实体在同一帧
+ * 拿到的序列与它被哪个 worker、以什么顺序更新无关——并行阶段各自构造、各自消费即可，
+ * 不需要加锁，也不需要把随机调用挪回串行阶段。
+ *
+ * 输出函数为 SplitMix64 的终混；不是密码学随机，只用于玩法与视觉抖动。
+ */
+class RandomStream {
+public:
+	RandomStream() = default;
+	explicit RandomStream(uint64_t key) : mKey(key) {}
+
+	// 按 (根种子, 帧, 用途域, 实体 id) 派生一条流；任一分量不同，序列即不相关
+	static RandomStream Derive(uint64_t root, uint64_t frame, uint64_t domain, uint64_t id) {
+		uint64_t key = Mix(root + kGolden);
+		key = Mix(key ^ (frame + 0x632BE59BD9B4E019ull));
+		key = Mix(key ^ (domain * 0xD6E8FEB86659FD93ull));
+		key = Mix(key ^ (id + 0x8CB92BA72F3D8DD7ull));
+		return RandomStream(key);
+	}
+
+	// 第 counter 个原始输出；NextU64 等价于 At(key, counter++)
+	static uint64_t At(uint64_t key, uint64_t counter) {
+		return Mix(key + (counter + 1) * kGolden);
+	}
+
+	uint64_t NextU64() {
+		return At(mKey, mCounter++);
+	}
+
+	uint32_t NextU32() {
+		return static_cast<uint32_t>(NextU64() >> 32);
+	}
+
+	// [0.0, 1.0) 随机浮点数（取高 24 位，恰好填满 float 尾数）
+	float Value() {
+		return static_cast<float>(NextU64() >> 40) * (1.0f / 16777216.0f);
+	}
+
+	// [min, max) 随机浮点数
+	float Range(float min, float max) {
+		return min + (max - min) * Value();
+	}
+
+	// [min, max] 随机整数 包含min max；max<=min 时返回 min
+	int Range(int min, int max) {
+		if (max <= min) return min;
+		const uint64_t span = static_cast<uint64_t>(static_cast<int64_t>(max) - min) + 1;
+		return static_cast<int>(min + static_cast<int64_t>((NextU32() * span) >> 32));
+	}
+
+	// 随机布尔值（指定概率）
+	bool Chance(float probability = 0.5f) {
+		return Value() < probability;
+	}
+
+	uint64_t GetKey() const { return mKey; }
+	uint64_t GetCounter() const { return mCounter; }
+
+private:
+	static constexpr uint64_t kGolden = 0x9E3779B97F4A7C15ull;
+
+	static uint64_t Mix(uint64_t z) {
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+		return z ^ (z >> 31);
+	}
+
+	uint64_t mKey = 0;
+	uint64_t mCounter = 0;
+};
+
+// 流的用途域：同一实体 id 在不同用途下互不相关。新增用途只在末尾追加，旧值不可复用。
+enum class RandomDomain : uint64_t {
+	GENERAL = 0,
+	PLANT = 1,
+	ZOMBIE = 2,
+	BULLET = 3,
+	ANIMATION = 4,
+	PARTICLE = 5,
+};
+
+#endif
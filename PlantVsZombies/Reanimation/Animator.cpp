@@ -3,6 +3,7 @@
 #include "../GameApp.h"
 #include "../ResourceManager.h"
 #include "../Logger.h"
+#include "../Game/AnimationSystem.h"
 #include <algorithm>
 #include <cmath>
 #include <glm/glm.hpp>
@@ -42,6 +43,7 @@ Animator::Animator(std::shared_ptr<Reanimation> reanim) {
 }
 
 Animator::~Animator() {
+	if (mSystem) mSystem->Unregister(*this);
 	Die();
 }
 
@@ -67,6 +69,7 @@ void Animator::Init(std::shared_ptr<Reanimation> reanim) {
 		mExtraInfos.clear();
 		mSparseTrackStates.clear();
 		mFrameEvents.clear();
+		mCullBoundsDirty = true;
 		for (int i = 0; i < reanim->GetTrackCount(); i++) {
 			auto track = reanim->GetTrack(i);
 			if (track) {
@@ -129,11 +132,16 @@ void Animator::ProcessFrameEventRange(
 }
 
 bool Animator::PlayTrack(const std::string& trackName, float speed, float blendTime) {
-	auto range = GetTrackRange(trackName);
-	if (range.first == -1 || range.second == -1) {
-		LOG_ERROR("Reanim") << "动画轨道不存在或为空: " << trackName;
+	return PlayTrack(TrackHandle(trackName), speed, blendTime);
+}
+
+bool Animator::PlayTrack(const TrackHandle& track, float speed, float blendTime) {
+	const ReanimTrackGroup* group = FindTrackGroup(track);
+	if (!group || group->mRangeBegin == -1 || group->mRangeEnd == -1) {
+		LOG_ERROR("Reanim") << "动画轨道不存在或为空: " << track.GetName();
 		return false;
 	}
+	const std::pair<int, int> range{ group->mRangeBegin, group->mRangeEnd };
 
 	// 保存当前帧用于过渡
 	mFrameIndexBlendBuffer = static_cast<int>(mFrameIndexNow);
@@ -157,19 +165,25 @@ bool Animator::PlayTrack(const std::string& trackName, float speed, float blendT
 
 	mIsPlaying = true;
 	mPlayingState = PlayState::PLAY_REPEAT;
-	mCurrentTrackName = &InternRuntimeString(trackName);
+	mCurrentTrackName = track.GetInternedName();
 
 	return true;
 }
 
 bool Animator::PlayTrackOnce(const std::string& trackName, const std::string& returnTrack,
 	float speed, float blendTime, float returnSpeed, float returnTrackBlendTime) {
-	if (!PlayTrack(trackName, speed, blendTime)) {
+	return PlayTrackOnce(TrackHandle(trackName), TrackHandle(returnTrack),
+		speed, blendTime, returnSpeed, returnTrackBlendTime);
+}
+
+bool Animator::PlayTrackOnce(const TrackHandle& track, const TrackHandle& returnTrack,
+	float speed, float blendTime, float returnSpeed, float returnTrackBlendTime) {
+	if (!PlayTrack(track, speed, blendTime)) {
 		return false;
 	}
 
 	mPlayingState = PlayState::PLAY_ONCE_TO;
-	mTargetTrack = &InternRuntimeString(returnTrack);
+	mTargetTrack = returnTrack.GetInternedName();
 	mTargetTrackSpeed = returnSpeed;   // 回切时用，0=回落 base（保持旧行为）
 	mTargetTrackBlendTime = returnTrackBlendTime;
 
@@ -202,6 +216,10 @@ void Animator::Stop() {
 }
 
 void Animator::Update() {
+	Advance(nullptr);
+}
+
+void Animator::Advance(std::vector<DeferredEvent>* outBuf) {
 	if (!mIsPlaying || !mReanim) return;
 
 	float deltaTime = DeltaTime::GetDeltaTime();
@@ -248,14 +266,14 @@ void Animator::Update() {
 
 	if (newInt >= oldInt) {
 		// 正常前进或不变
-		ProcessFrameEventRange(oldInt + 1, newInt, nullptr);
+		ProcessFrameEventRange(oldInt + 1, newInt, outBuf);
 	}
 	else {
 		// 发生了回绕（循环播放）
 		int endInt = static_cast<int>(mFrameIndexEnd);
-		ProcessFrameEventRange(oldInt + 1, endInt, nullptr);
+		ProcessFrameEventRange(oldInt + 1, endInt, outBuf);
 		int beginInt = static_cast<int>(mFrameIndexBegin);
-		ProcessFrameEventRange(beginInt, newInt, nullptr);
+		ProcessFrameEventRange(beginInt, newInt, outBuf);
 	}
 
 	// 更新混合计时器
@@ -268,73 +286,7 @@ void Animator::Update() {
 		for (auto& weakChild : sparse.mAttachedReanims) {
 			auto child = weakChild.lock();
 			if (child) {
-				child->Update();
-			}
-		}
-	}
-}
-
-void Animator::UpdateParallelDeferred(std::vector<DeferredEvent>& outBuf) {
-	if (!mIsPlaying || !mReanim) return;
-
-	float deltaTime = DeltaTime::GetDeltaTime();
-	float oldFrame = mFrameIndexNow;
-
-	float frameAdvance = deltaTime * mFPS * EffectiveSpeed();
-	mFrameIndexNow += frameAdvance;
-
-	bool reachedEnd = mFrameIndexNow >= mFrameIndexEnd;
-	if (reachedEnd) {
-		switch (mPlayingState) {
-		case PlayState::PLAY_REPEAT:
-			mFrameIndexNow = mFrameIndexBegin;
-			break;
-		case PlayState::PLAY_ONCE:
-			mFrameIndexNow = mFrameIndexEnd;
-			mIsPlaying = false;
-			break;
-		case PlayState::PLAY_ONCE_TO:
-			mFrameIndexNow = mFrameIndexEnd;
-			mIsPlaying = false;
-			if (!mTargetTrack->empty()) {
-				PlayTrack(*mTargetTrack, mTargetTrackSpeed, mTargetTrackBlendTime);
-			}
-			mTargetTrack = &InternRuntimeString("");
-			mTargetTrackSpeed = 0.0f;
-			mTargetTrackBlendTime = 0.5f;
-			break;
-		case PlayState::PLAY_NONE:
-			mFrameIndexNow = mFrameIndexEnd;
-			mIsPlaying = false;
-			break;
-		}
-	}
-
-	mFrameIndexNow = std::clamp(mFrameIndexNow, mFrameIndexBegin, mFrameIndexEnd);
-
-	int oldInt = static_cast<int>(oldFrame);
-	int newInt = static_cast<int>(mFrameIndexNow);
-
-	if (newInt >= oldInt) {
-		ProcessFrameEventRange(oldInt + 1, newInt, &outBuf);
-	}
-	else {
-		int endInt = static_cast<int>(mFrameIndexEnd);
-		ProcessFrameEventRange(oldInt + 1, endInt, &outBuf);
-		int beginInt = static_cast<int>(mFrameIndexBegin);
-		ProcessFrameEventRange(beginInt, newInt, &outBuf);
-	}
-
-	if (mReanimBlendCounter > 0) {
-		mReanimBlendCounter -= deltaTime;
-		if (mReanimBlendCounter < 0) mReanimBlendCounter = 0;
-	}
-
-	for (auto& sparse : mSparseTrackStates) {
-		for (auto& weakChild : sparse.mAttachedReanims) {
-			auto child = weakChild.lock();
-			if (child) {
-				child->UpdateParallelDeferred(outBuf);
+				child->Advance(outBuf);
 			}
 		}
 	}
@@ -355,14 +307,115 @@ void Animator::Draw(Graphics* g, float baseX, float baseY, float Scale) {
 		gActiveRenderProbe = &mLastRenderProbe;
 	}
 
-	// 保存当前变换栈，确保不叠加额外变换
-	g->PushTransform(glm::mat4(1.0f));
-	DrawInternal(g, baseX, baseY, Scale);
-	g->PopTransform();
+	// 实例化路径先按整棵附件树的保守世界包围盒做视口剔除：屏幕外对象连插值三角都不算。
+	// -NoInstance 慢路径保持不剔除，作为视觉 A/B 基线。
+	bool culled = false;
+	if (g->IsInstancePathEnabled()) {
+		const ReanimBounds world = ComputeWorldCullBounds(baseX, baseY, Scale);
+		culled = world.valid
+			&& !g->IsWorldRectVisible(world.minX, world.minY, world.maxX, world.maxY);
+		g->CountReanimCull(culled);
+	}
+
+	if (!culled) {
+		// 保存当前变换栈，确保不叠加额外变换
+		g->PushTransform(Affine2D::Identity());
+		DrawInternal(g, baseX, baseY, Scale);
+		g->PopTransform();
+	}
 	if (GameAPP::mAutoTestMode)
 		gActiveRenderProbe = previousProbe;
 }
 
+void Animator::RefreshCullLocalBounds() {
+	mCullBoundsDirty = false;
+	const ReanimBoundsTable& table = mReanim->GetBoundsTable();
+	mCullLocalBounds = table.localBounds;
+
+	// 共享表只覆盖原始贴图；这里补上实例级覆盖。隐藏轨道同样计入，
+	// 让 SetTrackVisible 这类高频开关不必使缓存失效（只会多画，不会漏画）。
+	const int trackCount = static_cast<int>(std::min(table.tracks.size(), mExtraInfos.size()));
+	for (int i = 0; i < trackCount; ++i) {
+		const ReanimTrackBounds& track = table.tracks[i];
+		if (!track.origin.valid) continue;
+		const TrackExtraInfo& extra = mExtraInfos[i];
+		const float minX = track.origin.minX + extra.mOffsetX;
+		const float minY = track.origin.minY + extra.mOffsetY;
+		const float maxX = track.origin.maxX + extra.mOffsetX;
+		const float maxY = track.origin.maxY + extra.mOffsetY;
+
+		float extent = track.maxExtent;
+		if (extra.mImage) {
+			extent = std::max(extent, track.maxScale
+				* (static_cast<float>(extra.mImage->width) + static_cast<float>(extra.mImage->height)));
+		}
+		if (extent > 0.0f && (extra.mImage || extra.mOffsetX != 0.0f || extra.mOffsetY != 0.0f)) {
+			mCullLocalBounds.Union(minX - extent, minY - extent, maxX + extent, maxY + extent);
+		}
+
+		const SparseTrackState* sparse = FindSparseTrackState(i);
+		if (sparse && sparse->mFollowerImage) {
+			const Texture* image = sparse->mFollowerImage;
+			const float reach = track.maxScale * (std::abs(sparse->mFollowerOffsetX)
+				+ std::abs(sparse->mFollowerOffsetY)
+				+ std::abs(sparse->mFollowerScaleX) * static_cast<float>(image->width)
+				+ std::abs(sparse->mFollowerScaleY) * static_cast<float>(image->height));
+			mCullLocalBounds.Union(minX - reach, minY - reach, maxX + reach, maxY + reach);
+		}
+	}
+}
+
+ReanimBounds Animator::ComputeWorldCullBounds(float baseX, float baseY, float Scale) {
+	ReanimBounds world;
+	if (!mReanim) return world;
+	if (mCullBoundsDirty) RefreshCullLocalBounds();
+
+	// 局部 → 世界：平移缩放、绕 pivot 镜像、再套世界绘制缩放。每轴都是单调仿射，端点映射后取 min/max 即可。
+	auto toWorldX = [&](float x) {
+		float wx = mFlipX ? baseX + (2.0f * mFlipPivotX - x) * Scale : baseX + x * Scale;
+		return mRenderPivotX + (wx - mRenderPivotX) * mRenderScaleX;
+	};
+	auto toWorldY = [&](float y) {
+		const float wy = baseY + y * Scale;
+		return mRenderPivotY + (wy - mRenderPivotY) * mRenderScaleY;
+	};
+	if (mCullLocalBounds.valid) {
+		const float x0 = toWorldX(mCullLocalBounds.minX);
+		const float x1 = toWorldX(mCullLocalBounds.maxX);
+		const float y0 = toWorldY(mCullLocalBounds.minY);
+		const float y1 = toWorldY(mCullLocalBounds.maxY);
+		world.Union(std::min(x0, x1), std::min(y0, y1), std::max(x0, x1), std::max(y0, y1));
+	}
+
+	// 附件按 DrawInternalInstanced 的公式定位：锚点 = base + (轨道原点 + 偏移 + M·childLocal)·Scale，
+	// 子级以 Scale=1 绘制。子级世界包围盒随锚点逐轴平移，取锚点范围两端的并集即覆盖全部可能位置。
+	const ReanimBoundsTable& table = mReanim->GetBoundsTable();
+	for (const SparseTrackState& sparse : mSparseTrackStates) {
+		if (sparse.mAttachedReanims.empty()) continue;
+		if (sparse.mTrackIndex < 0 || sparse.mTrackIndex >= static_cast<int>(table.tracks.size())) continue;
+		const ReanimTrackBounds& track = table.tracks[sparse.mTrackIndex];
+		if (!track.origin.valid) continue;
+		const TrackExtraInfo* extra = sparse.mTrackIndex < static_cast<int>(mExtraInfos.size())
+			? &mExtraInfos[sparse.mTrackIndex] : nullptr;
+		const float offsetX = extra ? extra->mOffsetX : 0.0f;
+		const float offsetY = extra ? extra->mOffsetY : 0.0f;
+
+		for (const auto& weakChild : sparse.mAttachedReanims) {
+			auto child = weakChild.lock();
+			if (!child || !child->mReanim) continue;
+			const float reach = track.maxScale
+				* (std::abs(child->mLocalPosX) + std::abs(child->mLocalPosY));
+			const float ax0 = baseX + (track.origin.minX + offsetX - reach) * Scale;
+			const float ax1 = baseX + (track.origin.maxX + offsetX + reach) * Scale;
+			const float ay0 = baseY + (track.origin.minY + offsetY - reach) * Scale;
+			const float ay1 = baseY + (track.origin.maxY + offsetY + reach) * Scale;
+			world.Union(child->ComputeWorldCullBounds(std::min(ax0, ax1), std::min(ay0, ay1), 1.0f));
+			world.Union(child->ComputeWorldCullBounds(std::max(ax0, ax1), std::max(ay0, ay1), 1.0f));
+		}
+	}
+	return world;
+}
+
 namespace {
 	// Pack RGBA8 with r=lsb, a=msb — matches reanim_inst.vert.glsl unpack convention.
 	inline uint32_t PackRGBA8(uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
@@ -839,34 +892,44 @@ void Animator::EnableOverlayEffect(bool enable) {
 }
 
 void Animator::SetTrackVisible(const std::string& trackName, bool visible) {
-	for (auto& extra : GetTrackExtrasByName(trackName)) {
-		extra->mVisible = visible;
+	SetTrackVisible(TrackHandle(trackName), visible);
+}
+
+void Animator::SetTrackVisible(const TrackHandle& track, bool visible) {
+	for (const int trackIndex : GetTrackIndices(track)) {
+		mExtraInfos[trackIndex].mVisible = visible;
 	}
 }
 
 void Animator::SetTrackGlowOverride(const std::string& trackName, bool enable) {
-	for (auto& extra : GetTrackExtrasByName(trackName)) {
-		extra->mHasGlowOverride = true;
-		extra->mGlowOverrideEnabled = enable;
+	for (const int trackIndex : GetTrackIndices(TrackHandle(trackName))) {
+		mExtraInfos[trackIndex].mHasGlowOverride = true;
+		mExtraInfos[trackIndex].mGlowOverrideEnabled = enable;
 	}
 }
 
 void Animator::SetTrackImage(const std::string& trackName, const Texture* image) {
-	for (auto& extra : GetTrackExtrasByName(trackName)) {
-		extra->mImage = image;
+	SetTrackImage(TrackHandle(trackName), image);
+}
+
+void Animator::SetTrackImage(const TrackHandle& track, const Texture* image) {
+	for (const int trackIndex : GetTrackIndices(track)) {
+		mExtraInfos[trackIndex].mImage = image;
 	}
+	mCullBoundsDirty = true;
 }
 
 void Animator::SetTrackOffset(const std::string& trackName, float x, float y) {
-	for (auto& extra : GetTrackExtrasByName(trackName)) {
-		extra->mOffsetX = x;
-		extra->mOffsetY = y;
+	for (const int trackIndex : GetTrackIndices(TrackHandle(trackName))) {
+		mExtraInfos[trackIndex].mOffsetX = x;
+		mExtraInfos[trackIndex].mOffsetY = y;
 	}
+	mCullBoundsDirty = true;
 }
 
 void Animator::SetTrackFollowerImage(const std::string& trackName, const Texture* image,
 	float offsetX, float offsetY, float scaleX, float scaleY, bool drawAfterAllTracks) {
-	for (const int trackIndex : GetTrackIndicesByName(trackName)) {
+	for (const int trackIndex : GetTrackIndices(TrackHandle(trackName))) {
 		SparseTrackState* existing = FindSparseTrackState(trackIndex);
 		if (!image && !existing) continue;
 		SparseTrackState& sparse = existing ? *existing : GetOrCreateSparseTrackState(trackIndex);
@@ -878,10 +941,11 @@ void Animator::SetTrackFollowerImage(const std::string& trackName, const Texture
 		sparse.mFollowerDrawAfterAllTracks = drawAfterAllTracks;
 		if (!image) sparse.mFollowerVisible = false;
 	}
+	mCullBoundsDirty = true;
 }
 
 void Animator::SetTrackFollowerVisible(const std::string& trackName, bool visible) {
-	for (const int trackIndex : GetTrackIndicesByName(trackName)) {
+	for (const int trackIndex : GetTrackIndices(TrackHandle(trackName))) {
 		SparseTrackState* sparse = FindSparseTrackState(trackIndex);
 		if (sparse) sparse->mFollowerVisible = visible && sparse->mFollowerImage;
 	}
@@ -951,7 +1015,7 @@ bool Animator::AttachAnimator(const std::string& trackName, std::shared_ptr<Anim
 		return false;
 	}
 
-	auto trackIndices = GetTrackIndicesByName(trackName);
+	const std::vector<int>& trackIndices = GetTrackIndices(TrackHandle(trackName));
 	if (trackIndices.empty()) {
 		return false;
 	}
@@ -978,7 +1042,7 @@ bool Animator::AttachAnimator(const std::string& trackName, std::shared_ptr<Anim
 }
 
 void Animator::DetachAnimator(const std::string& trackName, std::shared_ptr<Animator> child) {
-	for (const int trackIndex : GetTrackIndicesByName(trackName)) {
+	for (const int trackIndex : GetTrackIndices(TrackHandle(trackName))) {
 		auto* sparse = FindSparseTrackState(trackIndex);
 		if (!sparse) continue;
 		auto& vec = sparse->mAttachedReanims;
@@ -1003,42 +1067,16 @@ std::pair<int, int> Animator::GetTrackRange(const std::string& trackName) {
 		return { -1, -1 };
 	}
 
-	TrackInfo* track = mReanim->GetTrack(trackName);
-	if (!track || track->mFrames.empty()) {
+	const ReanimTrackGroup* group = FindTrackGroup(TrackHandle(trackName));
+	if (!group) {
 		LOG_DEBUG("Reanim") << "GetTrackRange: track '" << trackName << "' not found or empty";
 		return { -1, -1 };
 	}
-
-	int totalFrames = static_cast<int>(track->mFrames.size());
-
-	int start = -1;
-	for (int i = 0; i < totalFrames; ++i) {
-		if (track->mFrames[i].f == 0) {
-			start = i;
-			break;
-		}
-	}
-
-	if (start == -1) {
+	// 帧范围在加载期按首个同名轨道预先划分好，这里只取表。
+	if (group->mRangeBegin == -1) {
 		LOG_DEBUG("Reanim") << "GetTrackRange: no f=0 frames, returning invalid.";
-		return { -1, -1 };
-	}
-
-	int end = start;
-	for (int i = start + 1; i < totalFrames; ++i) {
-		if (track->mFrames[i].f == 0) {
-			end = i;
-		}
-		else if (track->mFrames[i].f == -1) {
-			break;
-		}
-		else {
-			LOG_DEBUG("Reanim") << "GetTrackRange: unexpected f=" << track->mFrames[i].f << " at " << i << ", stopping.";
-			break;
-		}
 	}
-
-	return { start, end };
+	return { group->mRangeBegin, group->mRangeEnd };
 }
 
 void Animator::SetFrameRange(int frameBegin, int frameEnd) {
@@ -1060,9 +1098,13 @@ void Animator::SetFrameRangeToDefault() {
 }
 
 float Animator::GetTrackVelocity(const std::string& trackName) const {
-	int index = GetFirstTrackIndexByName(trackName);
-	if (index < 0) return 0.0f;
-	return GetTrackVelocity(index);
+	return GetTrackVelocity(TrackHandle(trackName));
+}
+
+float Animator::GetTrackVelocity(const TrackHandle& track) const {
+	const ReanimTrackGroup* group = FindTrackGroup(track);
+	if (!group) return 0.0f;
+	return GetTrackVelocity(group->mIndices.front());
 }
 
 float Animator::GetTrackVelocity(int trackIndex) const {
@@ -1129,25 +1171,28 @@ void Animator::SetExtraSpeedMultiplier(float mul) {
 }
 
 std::vector<TrackInfo*> Animator::GetTracksByName(const std::string& trackName) const {
-	std::vector<TrackInfo*> result;
-	if (!mReanim) return result;
+	return GetTracksByName(TrackHandle(trackName));
+}
 
-	for (int i = 0; i < mReanim->GetTrackCount(); i++) {
-		auto track = mReanim->GetTrack(i);
-		if (track && track->mTrackName == trackName) {
-			result.push_back(track);
-		}
+std::vector<TrackInfo*> Animator::GetTracksByName(const TrackHandle& track) const {
+	std::vector<TrackInfo*> result;
+	for (const int trackIndex : GetTrackIndices(track)) {
+		result.push_back(mReanim->GetTrack(trackIndex));
 	}
 	return result;
 }
 
 Vector Animator::GetTrackPosition(const std::string& trackName) const {
-	auto tracks = GetTracksByName(trackName);
-	for (auto track : tracks) {
-		if (!track->mFrames.empty()) {
+	return GetTrackPosition(TrackHandle(trackName));
+}
+
+Vector Animator::GetTrackPosition(const TrackHandle& track) const {
+	for (const int trackIndex : GetTrackIndices(track)) {
+		const TrackInfo* info = mReanim->GetTrack(trackIndex);
+		if (!info->mFrames.empty()) {
 			int frameIndex = static_cast<int>(mFrameIndexNow);
-			if (frameIndex < static_cast<int>(track->mFrames.size())) {
-				return Vector(track->mFrames[frameIndex].x, track->mFrames[frameIndex].y);
+			if (frameIndex < static_cast<int>(info->mFrames.size())) {
+				return Vector(info->mFrames[frameIndex].x, info->mFrames[frameIndex].y);
 			}
 		}
 	}
@@ -1155,12 +1200,12 @@ Vector Animator::GetTrackPosition(const std::string& trackName) const {
 }
 
 float Animator::GetTrackRotation(const std::string& trackName) const {
-	auto tracks = GetTracksByName(trackName);
-	for (auto track : tracks) {
-		if (!track->mFrames.empty()) {
+	for (const int trackIndex : GetTrackIndices(TrackHandle(trackName))) {
+		const TrackInfo* info = mReanim->GetTrack(trackIndex);
+		if (!info->mFrames.empty()) {
 			int frameIndex = static_cast<int>(mFrameIndexNow);
-			if (frameIndex < static_cast<int>(track->mFrames.size())) {
-				return track->mFrames[frameIndex].kx;
+			if (frameIndex < static_cast<int>(info->mFrames.size())) {
+				return info->mFrames[frameIndex].kx;
 			}
 		}
 	}
@@ -1231,25 +1276,14 @@ TrackFrameTransform Animator::GetInterpolatedTransform(int trackIndex, float ble
 	return result;
 }
 
-std::vector<TrackExtraInfo*> Animator::GetTrackExtrasByName(const std::string& trackName) {
-	std::vector<TrackExtraInfo*> result;
-	for (int i = 0; i < static_cast<int>(mExtraInfos.size()); i++) {
-		auto track = mReanim->GetTrack(i);
-		if (track && track->mTrackName == trackName) {
-			result.push_back(&mExtraInfos[i]);
-		}
-	}
-	return result;
+const ReanimTrackGroup* Animator::FindTrackGroup(const TrackHandle& track) const {
+	return mReanim ? mReanim->FindTrackGroup(track) : nullptr;
 }
 
-std::vector<int> Animator::GetTrackIndicesByName(const std::string& trackName) const {
-	std::vector<int> result;
-	if (!mReanim) return result;
-	for (int i = 0; i < static_cast<int>(mReanim->GetTrackCount()); ++i) {
-		const auto track = mReanim->GetTrack(i);
-		if (track && track->mTrackName == trackName) result.push_back(i);
-	}
-	return result;
+const std::vector<int>& Animator::GetTrackIndices(const TrackHandle& track) const {
+	static const std::vector<int> kNoTracks;
+	const ReanimTrackGroup* group = FindTrackGroup(track);
+	return group ? group->mIndices : kNoTracks;
 }
 
 Animator::SparseTrackState* Animator::FindSparseTrackState(int trackIndex) {
@@ -1281,6 +1315,10 @@ bool Animator::HasTrack(const std::string& trackName) const {
 	return GetFirstTrackIndexByName(trackName) >= 0;
 }
 
+bool Animator::HasTrack(const TrackHandle& track) const {
+	return FindTrackGroup(track) != nullptr;
+}
+
 // 颜色混合函数
 int ColorComponentMultiply(int theColor1, int theColor2) {
 	return std::clamp(theColor1 * theColor2 / 255, 0, 255);
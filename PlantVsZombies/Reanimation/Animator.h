@@ -4,6 +4,7 @@
 
 #include "ReanimTypes.h"
 #include "Reanimation.h"
+#include "TrackHandle.h"
 #include "../InternedString.h"
 #include "../Graphics.h"
 #include "../Game/DeferredEvent.h"
@@ -14,6 +15,8 @@
 #include <glm/glm.hpp>
 #include <iostream>
 
+class AnimationSystem;
+
 /**
  * @brief 颜色分量乘法 (通道值范围 0-255)
  * @param theColor1 颜色1分量
@@ -63,6 +66,8 @@ private:
 	float mRenderPivotX = 0.0f;               ///< 最终世界绘制缩放的 X 锚点
 	float mRenderPivotY = 0.0f;               ///< 最终世界绘制缩放的 Y 锚点
 	AnimatorRenderProbe mLastRenderProbe;      ///< 最近一次根 Draw 的最终世界几何，供 AutoTest 只读取证
+	ReanimBounds mCullLocalBounds;             ///< 自身轨道（不含附件）的局部保守包围盒缓存，视口剔除用
+	bool mCullBoundsDirty = true;              ///< 换图/轨道偏移/跟随贴图变化后置位，下次 Draw 惰性重算
 
 	// 过渡动画相关
 	float mReanimBlendCounter = -1.0f;        ///< 混合计数器，>0 时进行混合
@@ -106,6 +111,18 @@ private:
 	};
 	std::vector<FrameEvent> mFrameEvents;  ///< 按帧号排序的小事件表；连续存储避免逐事件哈希节点
 
+	// AnimationSystem 登记状态：稠密数组下标与本帧是否已被批量推进
+	friend class AnimationSystem;
+	AnimationSystem* mSystem = nullptr;        ///< 登记所在系统；nullptr=未登记，由宿主串行 Update 推进
+	int mSystemSlot = -1;                      ///< 在 AnimationSystem 稠密数组中的下标
+	bool mBatchAdvanced = false;               ///< 批量推进后置位，宿主串行 Update 通过 ConsumeBatchAdvance 取走
+
+	/**
+	 * @brief 推进一帧的唯一实现 (帧前进、回切、事件触发、混合计时、子动画递归)
+	 * @param outBuf nullptr=帧事件当场回调；非空=拷贝入缓冲，worker 线程安全且不调用任何 callback
+	 */
+	void Advance(std::vector<DeferredEvent>* outBuf);
+
 	void AddFrameEventInternal(
 		int frameIndex, InlineFrameCallback callback, bool persistent);
 	void ProcessFrameEventsAt(int frameIndex, std::vector<DeferredEvent>* outBuf);
@@ -180,6 +197,8 @@ public:
 	 * @return 是否成功
 	 */
 	bool PlayTrack(const std::string& trackName, float speed = 0.0f, float blendTime = 0);
+	/** 句柄版本：帧范围取自加载期分组表，不做字符串查找；热路径用 static 句柄调用。 */
+	bool PlayTrack(const TrackHandle& track, float speed = 0.0f, float blendTime = 0);
 
 	/**
 	 * @brief 播放指定轨道动画一次，播放完后可切换回另一轨道
@@ -197,6 +216,16 @@ public:
 		float blendTime = 0,
 		float returnSpeed = 0.0f,
 		float returnTrackBlendTime = 0.5f);
+	/** 句柄版本的 PlayTrackOnce；returnTrack 为空句柄表示播完即停。 */
+	bool PlayTrackOnce(const TrackHandle& track,
+		const TrackHandle& returnTrack = TrackHandle(),
+		float speed = 0.0f,
+		float blendTime = 0,
+		float returnSpeed = 0.0f,
+		float returnTrackBlendTime = 0.5f);
+
+	/** 当前是否正在播放该轨道；只比较驻留指针。 */
+	bool IsPlayingTrack(const TrackHandle& track) const { return mCurrentTrackName == track.GetInternedName(); }
 
 
 	// ---------- 轨道范围控制 ----------
@@ -231,6 +260,7 @@ public:
 	 * @param image 纹理指针，nullptr 表示恢复默认
 	 */
 	void SetTrackImage(const std::string& trackName, const Texture* image);
+	void SetTrackImage(const TrackHandle& track, const Texture* image);
 
 	/**
 	 * @brief 设置指定轨道叠加在 reanim 原始变换上的绘制偏移。
@@ -262,6 +292,7 @@ public:
 	 * @param visible true=显示，false=隐藏
 	 */
 	void SetTrackVisible(const std::string& trackName, bool visible);
+	void SetTrackVisible(const TrackHandle& track, bool visible);
 
 	/**
 	 * @brief 让指定轨道独立决定是否高亮，不再继承 Animator 整体高亮开关。
@@ -380,6 +411,7 @@ public:
 	 * @return 速度值 (像素/秒？实际为帧间位移乘以速度倍率)
 	 */
 	float GetTrackVelocity(const std::string& trackName) const;
+	float GetTrackVelocity(const TrackHandle& track) const;
 
 	/**
 	 * @brief 通过轨道索引获取运动速度 (跳过字符串查找，用于热路径)
@@ -415,6 +447,7 @@ public:
 	 * @return 是否存在某个track，true=存在，false=不存在
 	 */
 	bool HasTrack(const std::string& trackName) const;
+	bool HasTrack(const TrackHandle& track) const;
 
 	// ---------- 透明度和颜色控制 ----------
 	/**
@@ -461,11 +494,14 @@ public:
 	void Update();
 
 	/**
-	 * @brief 阶段二并行段：完整推进帧 + 计时器 + 子节点递归；遇到帧事件 = 拷贝 callback 入 outBuf。
-	 *        对象本地、worker 线程安全；不调用任何 callback。
-	 *        前置：本 Animator 与其子 Animator 树不被其他线程并发访问（Task 1 audit PASS）。
+	 * @brief 取走"本帧已由 AnimationSystem 批量推进"标记。
+	 * @return true 表示帧事件已入队由 GOM drain，宿主串行 Update 不应再调用 Update()
 	 */
-	void UpdateParallelDeferred(std::vector<DeferredEvent>& outBuf);
+	bool ConsumeBatchAdvance() {
+		const bool advanced = mBatchAdvanced;
+		mBatchAdvanced = false;
+		return advanced;
+	}
 
 	/**
 	 * @brief 绘制动画 (现场计算变换并提交，递归绘制子动画)
@@ -499,6 +535,7 @@ public:
 	 * @return 指针数组
 	 */
 	std::vector<TrackInfo*> GetTracksByName(const std::string& trackName) const;
+	std::vector<TrackInfo*> GetTracksByName(const TrackHandle& track) const;
 
 	/**
 	 * @brief 获取轨道当前帧的位置
@@ -506,6 +543,7 @@ public:
 	 * @return 位置向量 (x,y)
 	 */
 	Vector GetTrackPosition(const std::string& trackName) const;
+	Vector GetTrackPosition(const TrackHandle& track) const;
 
 	/**
 	 * @brief 获取轨道当前帧的旋转角度 (kx)
@@ -582,14 +620,10 @@ private:
 	 */
 	TrackFrameTransform GetInterpolatedTransform(int trackIndex, float blendRatio) const;
 
-	/**
-	 * @brief 根据轨道名获取所有 TrackExtraInfo 指针
-	 * @param trackName 轨道名
-	 * @return 指针数组
-	 */
-	std::vector<TrackExtraInfo*> GetTrackExtrasByName(const std::string& trackName);
-	/** 返回全部同名轨道索引，以保持旧接口对重复轨道名的广播语义。 */
-	std::vector<int> GetTrackIndicesByName(const std::string& trackName) const;
+	/** 按句柄取当前 reanim 类型的同名轨道分组；不存在时返回 nullptr。 */
+	const ReanimTrackGroup* FindTrackGroup(const TrackHandle& track) const;
+	/** 返回全部同名轨道索引（引用分组表，不分配），保持旧接口对重复轨道名的广播语义。 */
+	const std::vector<int>& GetTrackIndices(const TrackHandle& track) const;
 	/** 查询已存在的轨道冷状态；不会在读取路径产生分配。 */
 	SparseTrackState* FindSparseTrackState(int trackIndex);
 	const SparseTrackState* FindSparseTrackState(int trackIndex) const;
@@ -615,6 +649,13 @@ private:
 	void DrawInternalInstanced(Graphics* g, float baseX, float baseY, float Scale) const;
 	/** 返回指定轨道合并整体开关与独立覆盖后的实际高亮状态。 */
 	bool IsGlowEffectEnabledForTrack(int trackIndex) const;
+	/** 在共享剔除表基础上并入运行时换图、轨道偏移与跟随贴图，刷新 mCullLocalBounds。 */
+	void RefreshCullLocalBounds();
+	/**
+	 * @brief 整棵附件树在给定基准下的世界空间保守包围盒，与 DrawInternalInstanced 的定位公式一致。
+	 * @return valid=false 表示没有任何可绘制贴图
+	 */
+	ReanimBounds ComputeWorldCullBounds(float baseX, float baseY, float Scale);
 	/** 把世界绘制缩放烘进实例化快路径的 2x3 仿射记录。 */
 	void ApplyRenderScale(InstanceRecord& record) const;
 	/** 把世界绘制缩放烘进慢路径的 4x4 仿射矩阵。 */
@@ -2,11 +2,16 @@
 #include "../ResourceManager.h"
 #include "../FileManager.h"
 #include "../Logger.h"
+#include "../InternedString.h"
 #include <glm/glm.hpp>
+#include <algorithm>
+#include <cmath>
 
 Reanimation::Reanimation() {
 	mTracks = std::make_shared<std::vector<TrackInfo>>();
 	mFirstTrackIndices = std::make_shared<std::unordered_map<std::string, int>>();
+	mBoundsTable = std::make_shared<ReanimBoundsTable>();
+	mTrackGroups = std::make_shared<std::unordered_map<const std::string*, ReanimTrackGroup>>();
 }
 
 Reanimation::~Reanimation() {
@@ -15,6 +20,8 @@ Reanimation::~Reanimation() {
 bool Reanimation::LoadFromFile(const std::string& filePath) {
 	mTracks->clear();
 	mFirstTrackIndices->clear();
+	*mBoundsTable = ReanimBoundsTable{};
+	mTrackGroups->clear();
 	mIsLoaded = false;
 
 	// 加载xml
@@ -184,9 +191,20 @@ bool Reanimation::LoadFromFile(const std::string& filePath) {
 			const int trackIndex = static_cast<int>(mTracks->size());
 			mTracks->push_back(track);
 			mFirstTrackIndices->try_emplace(track.mTrackName, trackIndex);
+
+			const std::string* internedName = &InternRuntimeString(track.mTrackName);
+			ReanimTrackGroup& group = (*mTrackGroups)[internedName];
+			if (group.mIndices.empty()) {
+				group.mName = internedName;
+				const auto range = ComputeTrackRange(mTracks->back());
+				group.mRangeBegin = range.first;
+				group.mRangeEnd = range.second;
+			}
+			group.mIndices.push_back(trackIndex);
 		}
 	}
 
+	BuildBoundsTable();
 	mIsLoaded = true;
 
 	LOG_DEBUG("Reanim") << "成功加载reanim: " << filePath << "   Track数量: " << mTracks->size() << "   总帧数" << GetTotalFrames();
@@ -194,6 +212,39 @@ bool Reanimation::LoadFromFile(const std::string& filePath) {
 	return true;
 }
 
+void Reanimation::BuildBoundsTable() {
+	ReanimBoundsTable& table = *mBoundsTable;
+	table.tracks.assign(mTracks->size(), ReanimTrackBounds{});
+	table.localBounds = ReanimBounds{};
+
+	for (size_t i = 0; i < mTracks->size(); ++i) {
+		const TrackInfo& track = (*mTracks)[i];
+		ReanimTrackBounds& bounds = table.tracks[i];
+		float maxAbsSx = 0.0f;
+		float maxAbsSy = 0.0f;
+		float maxW = 0.0f;
+		float maxH = 0.0f;
+		for (const TrackFrameTransform& frame : track.mFrames) {
+			bounds.origin.Union(frame.x, frame.y, frame.x, frame.y);
+			maxAbsSx = std::max(maxAbsSx, std::abs(frame.sx));
+			maxAbsSy = std::max(maxAbsSy, std::abs(frame.sy));
+			if (frame.image) {
+				maxW = std::max(maxW, static_cast<float>(frame.image->width));
+				maxH = std::max(maxH, static_cast<float>(frame.image->height));
+			}
+		}
+		bounds.maxScale = std::max(maxAbsSx, maxAbsSy);
+		// 插值帧可能把 A 帧的缩放配上 B 帧的贴图，两项分别取全轨道最大值才保守。
+		bounds.maxExtent = maxAbsSx * maxW + maxAbsSy * maxH;
+		if (bounds.origin.valid && bounds.maxExtent > 0.0f) {
+			table.localBounds.Union(bounds.origin.minX - bounds.maxExtent,
+				bounds.origin.minY - bounds.maxExtent,
+				bounds.origin.maxX + bounds.maxExtent,
+				bounds.origin.maxY + bounds.maxExtent);
+		}
+	}
+}
+
 TrackInfo* Reanimation::GetTrack(int index) {
 	if (!mTracks || index < 0 || index >= static_cast<int>(mTracks->size())) {
 		return nullptr;
@@ -211,6 +262,32 @@ int Reanimation::GetFirstTrackIndex(const std::string& trackName) const {
 	return it != mFirstTrackIndices->end() ? it->second : -1;
 }
 
+const ReanimTrackGroup* Reanimation::FindTrackGroup(const TrackHandle& track) const {
+	const auto it = mTrackGroups->find(track.GetInternedName());
+	return it != mTrackGroups->end() ? &it->second : nullptr;
+}
+
+std::pair<int, int> Reanimation::ComputeTrackRange(const TrackInfo& track) {
+	const int totalFrames = static_cast<int>(track.mFrames.size());
+
+	int start = -1;
+	for (int i = 0; i < totalFrames; ++i) {
+		if (track.mFrames[i].f == 0) {
+			start = i;
+			break;
+		}
+	}
+	if (start == -1) return { -1, -1 };
+
+	// 片段在首个 f=-1 分隔帧处结束；其他非零标志同样视为片段终止。
+	int end = start;
+	for (int i = start + 1; i < totalFrames; ++i) {
+		if (track.mFrames[i].f != 0) break;
+		end = i;
+	}
+	return { start, end };
+}
+
 int Reanimation::GetTotalFrames() const {
 	if (!mTracks || mTracks->empty()) return 0;
 	return static_cast<int>((*mTracks)[0].mFrames.size());
@@ -3,6 +3,7 @@
 #define _REANIMATION_H
 
 #include "ReanimTypes.h"
+#include "TrackHandle.h"
 #include <memory>
 #include <set>
 #include <unordered_map>
@@ -11,9 +12,64 @@
 constexpr float REANIM_MISSING_FIELD_FLOAT = -1024;
 constexpr int REANIM_MISSING_FIELD_INT = -1024;
 
+/** 轴对齐包围盒；valid=false 表示空集，Union 时直接取另一方。 */
+struct ReanimBounds {
+	bool valid = false;
+	float minX = 0.0f;
+	float minY = 0.0f;
+	float maxX = 0.0f;
+	float maxY = 0.0f;
+
+	void Union(float x0, float y0, float x1, float y1) {
+		if (!valid) {
+			minX = x0; minY = y0; maxX = x1; maxY = y1;
+			valid = true;
+			return;
+		}
+		if (x0 < minX) minX = x0;
+		if (y0 < minY) minY = y0;
+		if (x1 > maxX) maxX = x1;
+		if (y1 > maxY) maxY = y1;
+	}
+	void Union(const ReanimBounds& other) {
+		if (other.valid) Union(other.minX, other.minY, other.maxX, other.maxY);
+	}
+};
+
+/**
+ * 单轨道在全部关键帧上的保守几何范围（动画局部像素），加载期算一次。
+ * 帧间插值与 blend 都是关键帧的凸组合，故任意插值时刻的轨道原点落在 origin 内，
+ * 且 2x2 仿射两列的模分别 ≤ maxAbsSx / maxAbsSy——与 kx/ky 旋转无关。
+ */
+struct ReanimTrackBounds {
+	ReanimBounds origin;        ///< 轨道原点 (x, y) 的关键帧包围盒
+	float maxScale = 0.0f;      ///< max(|sx|, |sy|)，界定附件/跟随贴图局部偏移的最大伸长
+	float maxExtent = 0.0f;     ///< 自带贴图四边形任一顶点离原点的最大距离（无贴图为 0）
+};
+
+/** 同一资源全部实例共享的视口剔除表。 */
+struct ReanimBoundsTable {
+	std::vector<ReanimTrackBounds> tracks;  ///< 与 mTracks 一一对应
+	ReanimBounds localBounds;               ///< 全部自带贴图轨道的并集；不含运行时换图/跟随贴图/附件
+};
+
+/** 同名轨道分组：加载期按驻留名建表，供 TrackHandle 免字符串查找。 */
+struct ReanimTrackGroup {
+	const std::string* mName = nullptr;   ///< 驻留名
+	std::vector<int> mIndices;            ///< 全部同名轨道索引（升序），保持旧接口对重复轨道名的广播语义
+	int mRangeBegin = -1;                 ///< 首个同名轨道按 f==0 划分的帧范围；-1 表示无可播放片段
+	int mRangeEnd = -1;
+};
+
 class Reanimation {
 private:
 	std::shared_ptr<std::unordered_map<std::string, int>> mFirstTrackIndices;
+	std::shared_ptr<ReanimBoundsTable> mBoundsTable;
+	/** 以驻留名地址为键（指针哈希），同一资源的全部实例共享。 */
+	std::shared_ptr<std::unordered_map<const std::string*, ReanimTrackGroup>> mTrackGroups;
+
+	/** LoadFromFile 收尾：由已解析的关键帧生成视口剔除表。 */
+	void BuildBoundsTable();
 
 public:
 	float mFPS = 12.0f;
@@ -35,6 +91,12 @@ public:
 	TrackInfo* GetTrack(const std::string& trackName);
 	/** 返回第一个同名轨道的索引；索引表由同一资源的全部实例共享。 */
 	int GetFirstTrackIndex(const std::string& trackName) const;
+	/** 查找句柄对应的同名轨道分组；本类型不存在该轨道时返回 nullptr。 */
+	const ReanimTrackGroup* FindTrackGroup(const TrackHandle& track) const;
+	/** 轨道按 f==0 划分的首段连续帧范围，{-1,-1} 表示没有可播放片段。 */
+	static std::pair<int, int> ComputeTrackRange(const TrackInfo& track);
+	/** 加载期生成的保守包围盒表；Animator 据此在实例化前做视口剔除。 */
+	const ReanimBoundsTable& GetBoundsTable() const { return *mBoundsTable; }
 
 	// 鑾峰彇鎬诲抚鏁?
 	int GetTotalFrames() const;
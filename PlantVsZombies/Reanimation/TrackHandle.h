@@ -0,0 +1,33 @@
+#pragma once
+#ifndef _TRACK_HANDLE_H
+#define _TRACK_HANDLE_H
+
+#include "../InternedString.h"
+#include <string>
+
+/**
+ * 轨道名句柄：构造时驻留一次名字，之后的比较与查表都只用驻留指针。
+ *
+ * 句柄不绑定 reanim 类型：在任意类型上按驻留指针查该类型加载期建好的轨道分组表，
+ * 不做字符串哈希/比较。句柄不可变，共用表见 TrackNames.h，可供 worker 线程并发读取。
+ */
+class TrackHandle {
+public:
+	TrackHandle() : mName(&InternRuntimeString("")) {}
+	explicit TrackHandle(const std::string& name) : mName(&InternRuntimeString(name)) {}
+	explicit TrackHandle(const char* name) : TrackHandle(std::string(name ? name : "")) {}
+
+	/** 驻留后的轨道名；与 Animator::GetCurrentTrackName 返回的是同一对象。 */
+	const std::string& GetName() const { return *mName; }
+	const std::string* GetInternedName() const { return mName; }
+	bool IsEmpty() const { return mName->empty(); }
+
+	/** 同名即相等。 */
+	bool operator==(const TrackHandle& other) const { return mName == other.mName; }
+	bool operator!=(const TrackHandle& other) const { return mName != other.mName; }
+
+private:
+	const std::string* mName;                    ///< 驻留名，进程期地址稳定
+};
+
+#endif
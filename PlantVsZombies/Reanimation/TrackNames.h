@@ -0,0 +1,48 @@
+#pragma once
+#ifndef _TRACK_NAMES_H
+#define _TRACK_NAMES_H
+
+#include "TrackHandle.h"
+
+/**
+ * 植物/僵尸逐帧播放或比较的轨道句柄，全进程共用一份。
+ *
+ * 同名轨道在各 reanim 类型里各有分组，句柄按驻留指针查对应类型加载期建好的分组表，
+ * 所以一份句柄即可用于所有类型。新的逐帧轨道名加在这里，不要在各 .cpp 里另建句柄表。
+ */
+struct TrackNames {
+	TrackHandle attract{ "anim_attract" };
+	TrackHandle block{ "anim_block" };
+	TrackHandle charge{ "anim_charge" };
+	TrackHandle death{ "anim_death" };
+	TrackHandle explode{ "anim_explode" };
+	TrackHandle grow{ "anim_grow" };
+	TrackHandle hold{ "anim_hold" };
+	TrackHandle idle{ "anim_idle" };
+	TrackHandle idleHigh{ "anim_idlehigh" };
+	TrackHandle land{ "anim_land" };
+	TrackHandle lower{ "anim_lower" };
+	TrackHandle nonactiveIdle2{ "anim_nonactive_idle2" };
+	TrackHandle ride{ "anim_ride" };
+	TrackHandle rise{ "anim_rise" };
+	TrackHandle scared{ "anim_scared" };
+	TrackHandle scaredIdle{ "anim_scaredidle" };
+	TrackHandle shooting{ "anim_shooting" };
+	TrackHandle shootingHigh{ "anim_shootinghigh" };
+	TrackHandle smash{ "anim_smash" };
+	TrackHandle swim{ "anim_swim" };
+	TrackHandle throwing{ "anim_throw" };
+	TrackHandle thrown{ "anim_thrown" };
+	TrackHandle unarmedIdle{ "anim_unarmed_idle" };
+	TrackHandle walk{ "anim_walk" };
+	TrackHandle waterDeath{ "anim_waterdeath" };
+};
+
+/** 首次调用时驻留全部名字；inline 函数内的 static 跨翻译单元只有一份，worker 可并发读取。 */
+inline const TrackNames& Tracks()
+{
+	static const TrackNames tracks;
+	return tracks;
+}
+
+#endif
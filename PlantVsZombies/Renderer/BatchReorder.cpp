@@ -0,0 +1,108 @@
+#include "BatchReorder.h"
+#include <algorithm>
+#include <limits>
+
+namespace pvz {
+
+	namespace {
+		struct Bounds {
+			float minX, minY, maxX, maxY;
+		};
+
+		struct Group {
+			std::uint32_t texture;
+			std::uint32_t blend;
+			Bounds bounds;          ///< 组内全部图元包围盒的并集
+			std::uint32_t head;     ///< 组内首个图元（经 next 链表保持原相对顺序）
+			std::uint32_t tail;
+		};
+
+		constexpr std::uint32_t kNoPrimitive = std::numeric_limits<std::uint32_t>::max();
+
+		// NaN / 反向包围盒视为覆盖全屏：它会挡住所有跨越，只会少合并，不会画错。
+		Bounds SanitizedBounds(const BatchPrimitive& p) {
+			if (p.minX <= p.maxX && p.minY <= p.maxY) {
+				return Bounds{ p.minX, p.minY, p.maxX, p.maxY };
+			}
+			constexpr float kInf = std::numeric_limits<float>::infinity();
+			return Bounds{ -kInf, -kInf, kInf, kInf };
+		}
+
+		// 边相接不算相交：光栅化的 top-left 规则保证共享边上的像素只归一侧。
+		bool Overlaps(const Bounds& a, const Bounds& b) {
+			const bool separated = a.maxX <= b.minX || b.maxX <= a.minX
+				|| a.maxY <= b.minY || b.maxY <= a.minY;
+			return !separated;
+		}
+
+		bool SameKey(const BatchPrimitive& a, const BatchPrimitive& b) {
+			return a.texture == b.texture && a.blend == b.blend;
+		}
+	}
+
+	std::size_t CountBatchSegments(const std::vector<BatchPrimitive>& prims,
+		const std::vector<std::uint32_t>& order) {
+		const std::size_t n = order.empty() ? prims.size() : order.size();
+		if (n == 0) return 0;
+		std::size_t segments = 1;
+		const BatchPrimitive* prev = &prims[order.empty() ? 0 : order[0]];
+		for (std::size_t i = 1; i < n; ++i) {
+			const BatchPrimitive* cur = &prims[order.empty() ? i : order[i]];
+			if (!SameKey(*prev, *cur)) ++segments;
+			prev = cur;
+		}
+		return segments;
+	}
+
+	void ReorderBatchPrimitives(const std::vector<BatchPrimitive>& prims,
+		std::vector<std::uint32_t>& outOrder, BatchReorderStats* stats) {
+		const std::uint32_t count = static_cast<std::uint32_t>(prims.size());
+		outOrder.clear();
+		outOrder.reserve(count);
+
+		std::vector<Group> groups;
+		std::vector<std::uint32_t> next(count, kNoPrimitive);
+		groups.reserve(16);
+
+		for (std::uint32_t i = 0; i < count; ++i) {
+			const BatchPrimitive& prim = prims[i];
+			const Bounds bounds = SanitizedBounds(prim);
+
+			// 从最新的组往回找同键组；途经异键组只要有一个相交就说明不能越过它。
+			Group* target = nullptr;
+			const std::size_t lookback = std::min(groups.size(), kMaxLookbackGroups);
+			for (std::size_t k = 0; k < lookback; ++k) {
+				Group& g = groups[groups.size() - 1 - k];
+				if (g.texture == prim.texture && g.blend == prim.blend) {
+					target = &g;
+					break;
+				}
+				if (Overlaps(g.bounds, bounds)) break;
+			}
+
+			if (!target) {
+				groups.push_back(Group{ prim.texture, prim.blend, bounds, i, i });
+				continue;
+			}
+			next[target->tail] = i;
+			target->tail = i;
+			target->bounds.minX = std::min(target->bounds.minX, bounds.minX);
+			target->bounds.minY = std::min(target->bounds.minY, bounds.minY);
+			target->bounds.maxX = std::max(target->bounds.maxX, bounds.maxX);
+			target->bounds.maxY = std::max(target->bounds.maxY, bounds.maxY);
+		}
+
+		for (const Group& g : groups) {
+			for (std::uint32_t p = g.head; p != kNoPrimitive; p = next[p]) {
+				outOrder.push_back(p);
+			}
+		}
+
+		if (stats) {
+			stats->segmentsBefore = CountBatchSegments(prims, {});
+			// 组按键合并后相邻组仍可能同键（中间组被回溯上限挡住时），按实际顺序再数一次。
+			stats->segmentsAfter = CountBatchSegments(prims, outOrder);
+		}
+	}
+
+}
@@ -0,0 +1,51 @@
+#pragma once
+#ifndef _BATCH_REORDER_H
+#define _BATCH_REORDER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace pvz {
+
+	/**
+	 * 批次里的一个可独立移动的图元（quad 或三角形）：状态键 + 屏幕包围盒。
+	 * texture 只在后端按纹理切段时参与分组（OpenGL）；Vulkan bindless 下传 0 即可。
+	 */
+	struct BatchPrimitive {
+		std::uint32_t texture = 0;
+		std::uint32_t blend = 0;
+		float minX = 0.0f, minY = 0.0f;
+		float maxX = 0.0f, maxY = 0.0f;
+	};
+
+	struct BatchReorderStats {
+		std::size_t segmentsBefore = 0;   ///< 原顺序下的状态段数（= 提交次数）
+		std::size_t segmentsAfter = 0;    ///< 重排后的状态段数
+	};
+
+	/**
+	 * @brief 在 z 安全窗口内按 (texture, blend) 聚合图元，输出新的绘制顺序。
+	 *
+	 * 贪心插入：每个图元向前找最近的同键分组，途经的异键分组都不能与它的包围盒相交
+	 * （相交即存在绘制顺序依赖，停止回溯另起新组）。因此任意两个相交图元的相对顺序保持不变，
+	 * 画面与原顺序逐像素一致；不相交图元之间的顺序无关紧要。回溯最多 kMaxLookbackGroups 组，
+	 * 最坏 O(n·k)。组内保持原相对顺序。
+	 *
+	 * @param prims    原顺序图元
+	 * @param outOrder 输出：新顺序下的原图元下标（大小 = prims.size()）
+	 * @param stats    可选：重排前后的段数
+	 */
+	void ReorderBatchPrimitives(const std::vector<BatchPrimitive>& prims,
+		std::vector<std::uint32_t>& outOrder, BatchReorderStats* stats = nullptr);
+
+	/** 按给定顺序统计相邻状态键变化形成的段数；order 为空时按原顺序。 */
+	std::size_t CountBatchSegments(const std::vector<BatchPrimitive>& prims,
+		const std::vector<std::uint32_t>& order);
+
+	/** 单次重排允许回溯的分组数上限，控制最坏复杂度。 */
+	constexpr std::size_t kMaxLookbackGroups = 16;
+
+}
+
+#endif
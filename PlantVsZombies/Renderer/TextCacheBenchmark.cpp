@@ -0,0 +1,188 @@
+#include "TextCacheBenchmark.h"
+#include "../Logger.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <list>
+#include <random>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace pvz {
+
+	namespace {
+		constexpr int kZombieCount = 120;        // 生存模式后期同屏僵尸量级
+		constexpr int kCardCount = 10;
+		constexpr int kPopupFrames = 40;         // 伤害数字停留帧数
+		constexpr int kPhysSizeHud = 18;
+		constexpr int kPhysSizeHp = 14;
+
+		struct HudText {
+			std::string text;
+			const char* fontKey = "";
+			FontFaceId font;
+			int physSize = 0;
+			std::uint32_t color = 0;
+		};
+
+		struct Popup {
+			int damage = 0;
+			int framesLeft = 0;
+		};
+
+		/** 生成 frames 帧的 HUD 文字流，按帧顺序扁平存放。 */
+		void BuildWorkload(int frames, std::vector<HudText>& texts)
+		{
+			std::mt19937 rng(20261019u);
+			std::uniform_real_distribution<float> chance(0.0f, 1.0f);
+			std::uniform_int_distribution<int> spawnHp(270, 1800);
+
+			const FontFaceId fzcq{ 0 };
+			const FontFaceId fzjz{ 1 };
+			const std::uint32_t kGold = 0xFF62BADFu;
+			const std::uint32_t kBlack = 0xFF000000u;
+			const std::uint32_t kWhite = 0xFFFFFFFFu;
+			const std::uint32_t kLightBlue = 0xFFFFD8ADu;
+
+			std::vector<int> hp(kZombieCount);
+			for (int& value : hp) value = spawnHp(rng);
+			std::vector<Popup> popups;
+			int sun = 50;
+			int wave = 1;
+			int cardFuel[kCardCount] = {};
+
+			char buffer[64];
+			auto push = [&](const char* text, const char* fontKey, FontFaceId font, int physSize, std::uint32_t color) {
+				texts.push_back(HudText{ text, fontKey, font, physSize, color });
+			};
+
+			for (int frame = 0; frame < frames; ++frame) {
+				if (frame % 30 == 0) sun += 25;
+				if (frame % 1800 == 1799) ++wave;
+				for (int c = 0; c < kCardCount; ++c) {
+					if ((frame + c * 17) % 120 == 0) cardFuel[c] = (cardFuel[c] + 1) % 6;
+				}
+
+				// 常驻 HUD：关卡名与天气行都画阴影 + 正文两遍
+				std::snprintf(buffer, sizeof(buffer), "生存模式（困难） 第 %d 轮", wave);
+				push(buffer, "FZCQ", fzcq, kPhysSizeHud, kBlack);
+				push(buffer, "FZCQ", fzcq, kPhysSizeHud, kGold);
+				for (const char* line : { "当前：晴 · 风力 2 级", "预报：雾 · 12 秒后", "风向：东 → 西" }) {
+					push(line, "FZCQ", fzcq, kPhysSizeHud, kBlack);
+					push(line, "FZCQ", fzcq, kPhysSizeHud, kWhite);
+				}
+				std::snprintf(buffer, sizeof(buffer), "%d", sun);
+				push(buffer, "FZCQ", fzcq, kPhysSizeHud, kBlack);
+				for (int c = 0; c < kCardCount; ++c) {
+					std::snprintf(buffer, sizeof(buffer), "燃料 %d/5", cardFuel[c]);
+					push(buffer, "FZCQ", fzcq, 12, kWhite);
+				}
+
+				// 僵尸血量：随机掉血，归零后按生存模式刷新补位
+				for (int z = 0; z < kZombieCount; ++z) {
+					if (chance(rng) < 0.08f) {
+						const int damage = chance(rng) < 0.2f ? 40 : 20;
+						hp[z] -= damage;
+						popups.push_back(Popup{ damage, kPopupFrames });
+						if (hp[z] <= 0) hp[z] = spawnHp(rng);
+					}
+					std::snprintf(buffer, sizeof(buffer), "%d", hp[z]);
+					push(buffer, "FZJZ", fzjz, kPhysSizeHp, kLightBlue);
+				}
+				for (Popup& popup : popups) {
+					std::snprintf(buffer, sizeof(buffer), "-%d", popup.damage);
+					push(buffer, "FZJZ", fzjz, kPhysSizeHp, kWhite);
+					--popup.framesLeft;
+				}
+				popups.erase(std::remove_if(popups.begin(), popups.end(),
+					[](const Popup& p) { return p.framesLeft <= 0; }), popups.end());
+			}
+		}
+
+		/** 原 Graphics 文字缓存的簿记：拼字符串键 + unordered_map + std::list LRU（槽位代替纹理）。 */
+		class ListLruCache {
+		public:
+			explicit ListLruCache(std::uint32_t capacity) : mCapacity(capacity) {}
+
+			void Lookup(const HudText& t, TextCacheStats& stats) {
+				std::stringstream ss;
+				ss << t.text << "|" << t.fontKey << "|" << t.physSize << "|"
+					<< (t.color & 0xFF) << "," << ((t.color >> 8) & 0xFF) << ","
+					<< ((t.color >> 16) & 0xFF) << "," << (t.color >> 24);
+				std::string key = ss.str();
+
+				auto it = mMap.find(key);
+				if (it != mMap.end()) {
+					++stats.hits;
+					mOrder.erase(it->second.second);
+					mOrder.push_front(key);
+					it->second.second = mOrder.begin();
+					return;
+				}
+				++stats.misses;
+				if (mMap.size() >= mCapacity) {
+					mMap.erase(mOrder.back());
+					mOrder.pop_back();
+					++stats.evictions;
+				}
+				mOrder.push_front(key);
+				mMap[key] = { 0, mOrder.begin() };
+			}
+
+		private:
+			std::uint32_t mCapacity;
+			std::list<std::string> mOrder;
+			std::unordered_map<std::string, std::pair<int, std::list<std::string>::iterator>> mMap;
+		};
+
+		template <typename LookupFn>
+		double TimeLookups(const std::vector<HudText>& texts, LookupFn&& lookup)
+		{
+			const auto start = std::chrono::steady_clock::now();
+			for (const HudText& t : texts) lookup(t);
+			const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+			return texts.empty() ? 0.0 : elapsed.count() / static_cast<double>(texts.size());
+		}
+	}
+
+	TextCacheBenchResult RunTextCacheBenchmark(int frames, std::uint32_t capacity)
+	{
+		TextCacheBenchResult result;
+		std::vector<HudText> texts;
+		BuildWorkload(frames, texts);
+		result.frames = frames;
+		result.lookupsPerFrame = frames > 0 ? static_cast<int>(texts.size() / frames) : 0;
+
+		ListLruCache listLru(capacity);
+		result.listLruNsPerLookup = TimeLookups(texts, [&](const HudText& t) {
+			listLru.Lookup(t, result.listLru);
+		});
+
+		TextCacheIndex index(capacity);
+		result.clockNsPerLookup = TimeLookups(texts, [&](const HudText& t) {
+			const TextCacheKey key = MakeTextCacheKey(t.text, t.font, t.physSize, t.color);
+			if (index.Find(key) == TextCacheIndex::kNoSlot) {
+				bool evicted = false;
+				index.Insert(key, evicted);
+			}
+		});
+		result.clock = index.Stats();
+
+		auto hitRate = [](const TextCacheStats& s) {
+			const std::uint64_t total = s.hits + s.misses;
+			return total > 0 ? 100.0 * static_cast<double>(s.hits) / static_cast<double>(total) : 0.0;
+		};
+		LOG_WARN("TextCacheBench") << "frames=" << frames << " lookups/frame=" << result.lookupsPerFrame
+			<< " capacity=" << capacity;
+		LOG_WARN("TextCacheBench") << "list-LRU: " << result.listLruNsPerLookup << "ns/lookup"
+			<< " hit=" << hitRate(result.listLru) << "% miss=" << result.listLru.misses
+			<< " evict=" << result.listLru.evictions;
+		LOG_WARN("TextCacheBench") << "CLOCK:    " << result.clockNsPerLookup << "ns/lookup"
+			<< " hit=" << hitRate(result.clock) << "% miss=" << result.clock.misses
+			<< " evict=" << result.clock.evictions;
+		return result;
+	}
+}
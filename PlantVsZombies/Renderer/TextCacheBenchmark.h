@@ -0,0 +1,26 @@
+#pragma once
+#ifndef _TEXT_CACHE_BENCHMARK_H
+#define _TEXT_CACHE_BENCHMARK_H
+
+#include "TextCacheIndex.h"
+
+namespace pvz {
+
+	struct TextCacheBenchResult {
+		int frames = 0;
+		int lookupsPerFrame = 0;
+		double listLruNsPerLookup = 0.0;   ///< 旧实现：stringstream 拼键 + unordered_map + std::list LRU
+		double clockNsPerLookup = 0.0;     ///< 新实现：哈希键 + 开放寻址 + CLOCK
+		TextCacheStats listLru;
+		TextCacheStats clock;
+	};
+
+	/**
+	 * -TextCacheBench：回放合成的生存模式 HUD 文字流（阳光/波次/天气/卡槽标签 + 持续跳动的
+	 * 僵尸血量与伤害数字），分别走旧 LRU 与新 CLOCK 两套缓存簿记并计时。只测键构造与查找/淘汰，
+	 * 不光栅化、不建纹理；两者容量都取 capacity。结果经 LOG_WARN 打印。
+	 */
+	TextCacheBenchResult RunTextCacheBenchmark(int frames = 3600, std::uint32_t capacity = 1024);
+}
+
+#endif
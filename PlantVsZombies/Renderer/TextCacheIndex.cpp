@@ -0,0 +1,116 @@
+#include "TextCacheIndex.h"
+
+#include <algorithm>
+
+namespace pvz {
+
+	namespace {
+		std::uint64_t MixBits(std::uint64_t x) {
+			// splitmix64 终混：让低位（桶下标）也受全部输入位影响
+			x ^= x >> 30;
+			x *= 0xbf58476d1ce4e5b9ull;
+			x ^= x >> 27;
+			x *= 0x94d049bb133111ebull;
+			x ^= x >> 31;
+			return x;
+		}
+	}
+
+	TextCacheKey MakeTextCacheKey(std::string_view text, FontFaceId font, int physSize, std::uint32_t colorRGBA8) {
+		std::uint64_t hash = 0xcbf29ce484222325ull;
+		for (const char ch : text) {
+			hash ^= static_cast<unsigned char>(ch);
+			hash *= 0x100000001b3ull;
+		}
+		TextCacheKey key;
+		key.textSize = static_cast<std::uint32_t>(text.size());
+		key.colorRGBA8 = colorRGBA8;
+		key.font = font.index;
+		key.physSize = static_cast<std::uint16_t>(physSize);
+		const std::uint64_t attributes = (static_cast<std::uint64_t>(key.font) << 48)
+			^ (static_cast<std::uint64_t>(key.physSize) << 32) ^ colorRGBA8;
+		key.hash = MixBits(hash ^ MixBits(attributes + key.textSize));
+		return key;
+	}
+
+	TextCacheIndex::TextCacheIndex(std::uint32_t capacity) {
+		capacity = std::max<std::uint32_t>(capacity, 1);
+		mKeys.resize(capacity);
+		mReferenced.assign(capacity, 0);
+		std::uint32_t buckets = 2;
+		while (buckets < capacity * 2) buckets <<= 1;
+		mBuckets.assign(buckets, kNoSlot);
+		mBucketMask = buckets - 1;
+	}
+
+	std::uint32_t TextCacheIndex::ProbeBucket(const TextCacheKey& key) const {
+		std::uint32_t bucket = static_cast<std::uint32_t>(key.hash) & mBucketMask;
+		while (mBuckets[bucket] != kNoSlot && !(mKeys[mBuckets[bucket]] == key)) {
+			bucket = (bucket + 1) & mBucketMask;
+		}
+		return bucket;
+	}
+
+	std::uint32_t TextCacheIndex::Find(const TextCacheKey& key) {
+		const std::uint32_t slot = mBuckets[ProbeBucket(key)];
+		if (slot == kNoSlot) {
+			++mStats.misses;
+			return kNoSlot;
+		}
+		mReferenced[slot] = 1;
+		++mStats.hits;
+		return slot;
+	}
+
+	void TextCacheIndex::EraseBucket(std::uint32_t bucket) {
+		// 后移回填：把后续探测链上"理想位置不在 (bucket, j] 区间内"的条目挪进空洞，保持链连续
+		mBuckets[bucket] = kNoSlot;
+		std::uint32_t j = bucket;
+		for (;;) {
+			j = (j + 1) & mBucketMask;
+			const std::uint32_t slot = mBuckets[j];
+			if (slot == kNoSlot) return;
+			const std::uint32_t home = static_cast<std::uint32_t>(mKeys[slot].hash) & mBucketMask;
+			const bool homeInGap = bucket <= j
+				? (home > bucket && home <= j)
+				: (home > bucket || home <= j);
+			if (homeInGap) continue;
+			mBuckets[bucket] = slot;
+			mBuckets[j] = kNoSlot;
+			bucket = j;
+		}
+	}
+
+	std::uint32_t TextCacheIndex::Insert(const TextCacheKey& key, bool& evicted) {
+		evicted = false;
+		std::uint32_t slot;
+		if (mSize < Capacity()) {
+			slot = mSize++;
+		}
+		else {
+			// CLOCK：跳过并清除引用位，遇到第一个未被引用的槽位即淘汰
+			while (mReferenced[mHand]) {
+				mReferenced[mHand] = 0;
+				mHand = (mHand + 1) % Capacity();
+			}
+			slot = mHand;
+			mHand = (mHand + 1) % Capacity();
+			EraseBucket(ProbeBucket(mKeys[slot]));
+			evicted = true;
+			++mStats.evictions;
+		}
+		mKeys[slot] = key;
+		// 新条目不带引用位：只出现一帧的文字（跳动的伤害数字）在下一圈就被淘汰，
+		// 被再次命中过的常驻 HUD 文字则能多撑一圈。
+		mReferenced[slot] = 0;
+		mBuckets[ProbeBucket(key)] = slot;
+		return slot;
+	}
+
+	void TextCacheIndex::Clear() {
+		std::fill(mBuckets.begin(), mBuckets.end(), kNoSlot);
+		std::fill(mReferenced.begin(), mReferenced.end(), 0);
+		mSize = 0;
+		mHand = 0;
+	}
+}
@@ -0,0 +1,80 @@
+#pragma once
+#ifndef _TEXT_CACHE_INDEX_H
+#define _TEXT_CACHE_INDEX_H
+
+#include "TextRecord.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace pvz {
+
+	/**
+	 * 文字纹理缓存键。hash 覆盖全部字段（含文字字节），其余字段只用于命中时的廉价复核：
+	 * 误判需要同字体/字号/颜色/长度下的 64 位哈希碰撞。
+	 */
+	struct TextCacheKey {
+		std::uint64_t hash = 0;
+		std::uint32_t textSize = 0;
+		std::uint32_t colorRGBA8 = 0;
+		std::uint16_t font = UINT16_MAX;
+		std::uint16_t physSize = 0;
+
+		bool operator==(const TextCacheKey& o) const {
+			return hash == o.hash && textSize == o.textSize && colorRGBA8 == o.colorRGBA8
+				&& font == o.font && physSize == o.physSize;
+		}
+	};
+
+	/** 由 (字体 id, 光栅字号, 打包颜色, 文字) 构造缓存键；不分配。 */
+	TextCacheKey MakeTextCacheKey(std::string_view text, FontFaceId font, int physSize, std::uint32_t colorRGBA8);
+
+	struct TextCacheStats {
+		std::uint64_t hits = 0;
+		std::uint64_t misses = 0;
+		std::uint64_t evictions = 0;
+	};
+
+	/**
+	 * @brief 定容文字缓存的键 → 槽位索引。开放寻址（线性探测，删除用后移回填，无墓碑），
+	 *        满载时按 CLOCK 淘汰：命中只置引用位，不移动任何节点、不分配。
+	 *        槽位里的纹理由调用方按下标自管（Graphics 的 m_textCacheEntries）。
+	 */
+	class TextCacheIndex {
+	public:
+		static constexpr std::uint32_t kNoSlot = UINT32_MAX;
+
+		explicit TextCacheIndex(std::uint32_t capacity);
+
+		/** 查找；命中返回槽位并置引用位，未命中返回 kNoSlot。两者都计入统计。 */
+		std::uint32_t Find(const TextCacheKey& key);
+		/**
+		 * 插入一个 Find 未命中的键，返回分给它的槽位。满载时 CLOCK 指针淘汰一个槽位，
+		 * evicted 置真——调用方须先释放该槽位里原有的纹理再写入新条目。
+		 */
+		std::uint32_t Insert(const TextCacheKey& key, bool& evicted);
+		/** 清空全部条目（统计保留）。调用方负责先释放各槽位的纹理。 */
+		void Clear();
+
+		std::uint32_t Size() const { return mSize; }
+		std::uint32_t Capacity() const { return static_cast<std::uint32_t>(mKeys.size()); }
+		const TextCacheStats& Stats() const { return mStats; }
+
+	private:
+		/** 返回存放 key 的桶，或探测链上第一个空桶。 */
+		std::uint32_t ProbeBucket(const TextCacheKey& key) const;
+		void EraseBucket(std::uint32_t bucket);
+
+		std::vector<TextCacheKey> mKeys;          // 按槽位
+		std::vector<std::uint8_t> mReferenced;    // 按槽位：CLOCK 引用位
+		std::vector<std::uint32_t> mBuckets;      // 哈希桶 → 槽位（kNoSlot = 空），长度为 2 的幂且 ≥ 2×容量
+		std::uint32_t mBucketMask = 0;
+		std::uint32_t mSize = 0;
+		std::uint32_t mHand = 0;
+		TextCacheStats mStats;
+	};
+}
+
+#endif
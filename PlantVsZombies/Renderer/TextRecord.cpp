@@ -0,0 +1,52 @@
+#include "TextRecord.h"
+
+#include <algorithm>
+
+namespace pvz {
+
+	FontFaceId FontFaceRegistry::Find(std::string_view key) const {
+		const std::uint16_t count = mCount.load(std::memory_order_acquire);
+		for (std::uint16_t i = 0; i < count; ++i) {
+			if (mKeys[i] == key) return FontFaceId{ i };
+		}
+		return FontFaceId{};
+	}
+
+	FontFaceId FontFaceRegistry::Intern(std::string_view key) {
+		const FontFaceId found = Find(key);
+		if (found.IsValid()) return found;
+
+		std::lock_guard<std::mutex> lock(mInternMutex);
+		// 持锁复查：另一线程可能刚登记了同一个名字
+		const std::uint16_t count = mCount.load(std::memory_order_relaxed);
+		for (std::uint16_t i = 0; i < count; ++i) {
+			if (mKeys[i] == key) return FontFaceId{ i };
+		}
+		if (count >= kMaxFaces) return FontFaceId{};
+		mKeys[count] = std::string(key);
+		mCount.store(static_cast<std::uint16_t>(count + 1), std::memory_order_release);
+		return FontFaceId{ count };
+	}
+
+	const std::string& FontFaceRegistry::Key(FontFaceId id) const {
+		static const std::string kEmpty;
+		if (!id.IsValid() || id.index >= Count()) return kEmpty;
+		return mKeys[id.index];
+	}
+
+	TextSpan TextArena::Append(std::string_view text) {
+		const std::size_t needed = mUsed + text.size();
+		if (needed > mBytes.size()) {
+			// 几何扩容：一帧内反复追加也只分配 O(log n) 次，之后各帧复用
+			mBytes.resize(std::max<std::size_t>({ needed, mBytes.size() * 2, 1024 }));
+		}
+		TextSpan span;
+		span.offset = static_cast<std::uint32_t>(mUsed);
+		span.size = static_cast<std::uint32_t>(text.size());
+		if (!text.empty()) {
+			std::copy(text.begin(), text.end(), mBytes.begin() + mUsed);
+		}
+		mUsed = needed;
+		return span;
+	}
+}
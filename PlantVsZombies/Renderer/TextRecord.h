@@ -0,0 +1,76 @@
+#pragma once
+#ifndef _TEXT_RECORD_H
+#define _TEXT_RECORD_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace pvz {
+
+	/**
+	 * 字体键名（ResourceManager 的 fontKey）驻留后的小整数 id。
+	 * 录制命令与字形图集都按 id 索引，热路径不再携带或拼接字体名字符串。
+	 */
+	struct FontFaceId {
+		std::uint16_t index = UINT16_MAX;
+
+		bool IsValid() const { return index != UINT16_MAX; }
+		bool operator==(const FontFaceId& o) const { return index == o.index; }
+		bool operator!=(const FontFaceId& o) const { return index != o.index; }
+	};
+
+	/**
+	 * @brief 字体键名驻留表。已登记的条目只追加、不修改：Find 在任何线程无锁只读，
+	 *        Intern 首次见到新名字时加锁追加（整个进程只发生字体种类数次）。
+	 */
+	class FontFaceRegistry {
+	public:
+		static constexpr std::uint16_t kMaxFaces = 64;
+
+		/** 名字 → id，未登记则登记；线程安全。表满时返回无效 id。 */
+		FontFaceId Intern(std::string_view key);
+		/** 只查不登记；未登记返回无效 id。无锁，可在 worker 并发调用。 */
+		FontFaceId Find(std::string_view key) const;
+		/** id → 名字；无效 id 返回空串。引用在注册表生命周期内有效。 */
+		const std::string& Key(FontFaceId id) const;
+		std::uint16_t Count() const { return mCount.load(std::memory_order_acquire); }
+
+	private:
+		std::array<std::string, kMaxFaces> mKeys;
+		std::atomic<std::uint16_t> mCount{ 0 };   // release 发布：[0,count) 的 mKeys 已写完
+		std::mutex mInternMutex;
+	};
+
+	/** TextArena 内一段字节：偏移 + 长度。arena 扩容不会使其失效（不存指针）。 */
+	struct TextSpan {
+		std::uint32_t offset = 0;
+		std::uint32_t size = 0;
+	};
+
+	/**
+	 * @brief 每个 worker 一份的文字字节 bump arena，每帧 Reset。
+	 *        只在本帧用量超过历史峰值时扩容，稳态下录制文字零堆分配。
+	 */
+	class TextArena {
+	public:
+		TextSpan Append(std::string_view text);
+		std::string_view View(TextSpan span) const {
+			return std::string_view(mBytes.data() + span.offset, span.size);
+		}
+		void Reset() { mUsed = 0; }
+		std::size_t Used() const { return mUsed; }
+		std::size_t Capacity() const { return mBytes.size(); }
+
+	private:
+		std::vector<char> mBytes;
+		std::size_t mUsed = 0;
+	};
+}
+
+#endif
@@ -372,6 +372,12 @@ namespace ResourceKeys
 	namespace Particles
 	{
 		RKEY(PARTICLE_WINDSTREAK);
+		RKEY(PARTICLE_WHITEPIXEL);			// 雨场雨丝：1×1 白图按寿命拉伸旋转
+		RKEY(PARTICLE_RAIN_SPLASH1);		// 雨场地面水花四帧，逐落点随机一张
+		RKEY(PARTICLE_RAIN_SPLASH2);
+		RKEY(PARTICLE_RAIN_SPLASH3);
+		RKEY(PARTICLE_RAIN_SPLASH4);
+		RKEY(PARTICLE_RAIN_CIRCLE);			// 雨场地面扩散圆圈
 		RKEY(PARTICLE_HEALERPLUS);
 		RKEY(PARTICLE_HEALERHALO);
 		inline const std::string PARTICLE_ZOMBIE_HEAD = "PARTICLE_ZOMBIEHEAD";
@@ -76,7 +76,7 @@ namespace {
 
 	/** 在副本上按文档类型执行迁移，全部成功后才提交，避免失败留下半迁移文档。 */
 	bool UpgradeDocument(nlohmann::json& document, int currentVersion,
-		const char* documentName, DocumentKind kind, std::string& error)
+		const char* documentName, DocumentKind kind, int& fromVersion, std::string& error)
 	{
 		error.clear();
 		int version = 0;
@@ -84,6 +84,12 @@ namespace {
 			documentName, version, error)) {
 			return false;
 		}
+		fromVersion = version;
+
+		// 当前版本无需迁移：直接返回，免去对大存档整棵文档的深拷贝
+		if (version == currentVersion) {
+			return true;
+		}
 
 		nlohmann::json upgraded = document;
 		while (version < currentVersion) {
@@ -149,13 +155,47 @@ namespace {
 bool SaveSchema::UpgradePlayerDocument(
 	nlohmann::json& document, std::string& error)
 {
+	int fromVersion = 0;
 	return UpgradeDocument(document, kCurrentPlayerVersion,
-		"玩家", DocumentKind::Player, error);
+		"玩家", DocumentKind::Player, fromVersion, error);
 }
 
 bool SaveSchema::UpgradeLevelDocument(
 	nlohmann::json& document, std::string& error)
 {
-	return UpgradeDocument(document, kCurrentLevelVersion,
-		"关卡", DocumentKind::Level, error);
+	int fromVersion = 0;
+	return UpgradeLevelDocument(document, fromVersion, error);
+}
+
+bool SaveSchema::UpgradeLevelDocument(
+	nlohmann::json& document, int& fromVersion, std::string& error)
+{
+	int version = 0;
+	if (!UpgradeDocument(document, kCurrentLevelVersion,
+		"关卡", DocumentKind::Level, version, error)) {
+		return false;
+	}
+	fromVersion = version;
+	return true;
+}
+
+void SaveSchema::UpgradeLevelRecord(
+	LevelSaveFormat::LevelArray array, nlohmann::json& record, int fromVersion)
+{
+	// 当前版本的档每条记录都走这里，先返回，不做任何拷贝
+	if (fromVersion >= kCurrentLevelVersion || !record.is_object()) return;
+
+	static_cast<void>(array);
+	for (int version = std::max(fromVersion, 0); version < kCurrentLevelVersion; ++version) {
+		switch (version) {
+		case 0:
+		case 1:
+		case 2:
+			// 关卡 v1~v3 只改头字段（版本入口、雾势字段与雾势枚举），实体记录结构未变。
+			// 以后改记录结构时在对应版本下按 array 改写 record，版本号与头部迁移链共用。
+			break;
+		default:
+			break;
+		}
+	}
 }
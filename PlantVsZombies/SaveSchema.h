@@ -1,8 +1,13 @@
 #pragma once
 
 #include <nlohmann/json_fwd.hpp>
+#include <cstddef>
 #include <string>
 
+namespace LevelSaveFormat {
+	enum class LevelArray : std::size_t;
+}
+
 namespace SaveSchema {
 	inline constexpr int kCurrentPlayerVersion = 4;
 	inline constexpr int kCurrentLevelVersion = 3;
@@ -16,6 +21,17 @@ namespace SaveSchema {
 	/**
 	 * 将关卡快照事务式升级到当前结构。
 	 * 迁移保留旧字段的玩法语义；枚举扩展等结构变化会显式重映射旧值。
+	 * 流式读档只把头字段（不含实体数组）交给本函数，实体记录的迁移见 UpgradeLevelRecord。
 	 */
 	bool UpgradeLevelDocument(nlohmann::json& document, std::string& error);
+
+	/** 同上，并把升级前的版本写入 fromVersion（缺 schemaVersion 记 0），供逐条记录迁移使用；失败时不写。 */
+	bool UpgradeLevelDocument(nlohmann::json& document, int& fromVersion, std::string& error);
+
+	/**
+	 * 把一条实体记录从 fromVersion 迁移到当前结构，读档逐条恢复前调用。
+	 * fromVersion 必须是同一份档的头部经 UpgradeLevelDocument 校验过的原始版本，所以本函数不会失败；
+	 * 已是当前版本或记录不是对象时原样返回。
+	 */
+	void UpgradeLevelRecord(LevelSaveFormat::LevelArray array, nlohmann::json& record, int fromVersion);
 }
@@ -2,10 +2,12 @@
 #include "./CrashHandler.h"
 #include "./GameRandom.h"
 #include "./GameApp.h"
+#include "./DeltaTime.h"
 #include "GameMonitor.h"
 #include "Logger.h"
 #include "./Profiler.h"
 #include "./Game/AutoTest/TestDriver.h"
+#include "./Game/AutoTest/Replay.h"
 #include <SDL2/SDL.h>
 #include <algorithm>
 #include <cctype>
@@ -24,6 +26,8 @@ int main(int argc, char** argv)
 
 	// 检查命令行参数
 	std::string autoTestScript;
+	std::string recordReplayPath;
+	std::string replayPath;
 	bool invalidRendererArgument = false;
 	for (int i = 1; i < argc; ++i)
 	{
@@ -58,6 +62,36 @@ int main(int argc, char** argv)
 			GameAPP::mDisableInstancePath = true;
 			LOG_WARN("Main") << "GPU Instance Path 已禁用 (A/B baseline). 可能会消除部分兼容性问题.";
 		}
+		else if (arg == "-BatchReorder" || arg == "-batchreorder")
+		{
+			GameAPP::mBatchReorder = true;
+			LOG_WARN("Main") << "批次重排已启用 (-BatchReorder). 配合 -Profile 查看 batchSegs 前后对比.";
+		}
+		else if (arg == "-ParticleBench" || arg == "-particlebench")
+		{
+			GameAPP::mParticleBench = true;
+			LOG_WARN("Main") << "粒子基准模式 (-ParticleBench): 加载资源后计时 10 万粒子串行/并行更新并退出.";
+		}
+		else if (arg == "-TextCacheBench" || arg == "-textcachebench")
+		{
+			GameAPP::mTextCacheBench = true;
+			LOG_WARN("Main") << "文字缓存基准模式 (-TextCacheBench): 回放生存模式 HUD 文字流，对比 LRU/CLOCK 命中率与查找耗时后退出.";
+		}
+		else if (arg == "-RainBench" || arg == "-rainbench")
+		{
+			GameAPP::mRainBench = true;
+			LOG_WARN("Main") << "雨场基准模式 (-RainBench): 暴风雨之夜 + 大波僵尸背景下对比旧粒子雨与雨场更新开销后退出.";
+		}
+		else if (arg == "-LevelSaveBench" || arg == "-levelsavebench")
+		{
+			GameAPP::mLevelSaveBench = true;
+			LOG_WARN("Main") << "关卡存档基准模式 (-LevelSaveBench): 5000 僵尸合成关卡对比 JSON 与二进制存读档耗时和体积后退出.";
+		}
+		else if (arg == "-LevelSaveJson" || arg == "-levelsavejson")
+		{
+			GameAPP::mLevelSaveJson = true;
+			LOG_WARN("Main") << "关卡存档以可读 JSON 导出 (-LevelSaveJson)，读档仍兼容二进制档.";
+		}
 		else if (arg == "-Vulkan12" || arg == "-vulkan12")
 		{
 			GameAPP::mForceVulkan12 = true;
@@ -95,6 +129,34 @@ int main(int argc, char** argv)
 			autoTestScript = argv[++i];
 			GameAPP::mAutoTestMode = true;
 		}
+		else if ((arg == "-Turbo" || arg == "-turbo") && i + 1 < argc)
+		{
+			// 只认完整的 2/4/8/max；"0"、"foo" 之类不得落成 0（不限速），一律保持关闭
+			const std::string value = argv[++i];
+			const int factor = value == "2" ? 2 : value == "4" ? 4 : value == "8" ? 8
+				: value == "max" ? 0 : 1;
+			if (factor == 1) {
+				LOG_WARN("Main") << "-Turbo 参数无效，已忽略: " << value << "（可用 2/4/8/max）";
+			}
+			else {
+				DeltaTime::SetTurbo(factor);
+				LOG_WARN("Main") << "快进模式 (-Turbo " << value << "): 每个渲染帧多跑逻辑步，中间步跳过粒子与一次性音效.";
+			}
+		}
+		else if (arg == "-NoInterpolation" || arg == "-nointerpolation")
+		{
+			DeltaTime::SetInterpolation(false);
+			LOG_WARN("Main") << "渲染插值已关闭 (-NoInterpolation): 每帧直接绘制最后一个逻辑步的状态.";
+		}
+		else if ((arg == "-RecordReplay" || arg == "-recordreplay") && i + 1 < argc)
+		{
+			recordReplayPath = argv[++i];
+		}
+		else if ((arg == "-Replay" || arg == "-replay") && i + 1 < argc)
+		{
+			replayPath = argv[++i];
+			LOG_WARN("Main") << "无渲染回放模式 (-Replay): 按录制的逻辑步满速重放，输出逐步耗时与末步状态哈希后退出.";
+		}
 		else if (arg == "-AutoTestLoadSave" || arg == "-autotestloadsave")
 		{
 			GameAPP::mAutoTestLoadSave = true;
@@ -118,18 +180,46 @@ int main(int argc, char** argv)
 		GameAPP::mAutoTestLoadSave = false;
 	}
 
-	if (GameAPP::mAutoTestMode) {
+	if (!replayPath.empty()) {
+		// 回放自带种子、模式与命令流，脚本和再录制都无意义
+		if (GameAPP::mAutoTestMode || !recordReplayPath.empty()) {
+			LOG_WARN("Main") << "-Replay 模式下忽略 -AutoTest / -RecordReplay。";
+			GameAPP::mAutoTestMode = false;
+			GameAPP::mAutoTestLoadSave = false;
+			recordReplayPath.clear();
+		}
+		if (!ReplayPlayer::GetInstance().Load(replayPath)) {
+			CrashHandler::Cleanup();
+			return 101;   // 回放解析失败
+		}
+	}
+
+	// 截图比对要求同一逻辑步画出同一帧，不能随墙钟余量漂移
+	if (GameAPP::mAutoTestMode || GameAPP::mReplayPlayback) {
+		DeltaTime::SetInterpolation(false);
+	}
+
+	if (GameAPP::mAutoTestMode && !GameAPP::mReplayPlayback) {
 		if (!TestDriver::GetInstance().LoadScript(autoTestScript)) {
 			CrashHandler::Cleanup();
 			return 100;   // 脚本解析失败
 		}
 	}
 
+	// 放在 -Seed 与 -AutoTest 之后：头行记录最终生效的根种子和录制模式
+	if (!recordReplayPath.empty() && !ReplayRecorder::GetInstance().Open(recordReplayPath, autoTestScript)) {
+		CrashHandler::Cleanup();
+		return 101;
+	}
+
 	int result = GameAPP::GetInstance().Run();
 
 	if (GameAPP::mAutoTestMode && result == 0) {
 		result = TestDriver::GetInstance().ExitCode();
 	}
+	if (GameAPP::mReplayPlayback && result == 0) {
+		result = ReplayPlayer::GetInstance().ExitCode();
+	}
 
 	CrashHandler::Cleanup();
 
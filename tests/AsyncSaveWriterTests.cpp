@@ -0,0 +1,143 @@
+#include "AsyncSaveWriter.h"
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+namespace {
+	void Require(bool condition, const std::string& message)
+	{
+		if (!condition) throw std::runtime_error(message);
+	}
+
+	// 路径一律按 UTF-8 传递，与存档代码同口径（临时目录可能含非 ASCII 用户名）
+	std::string ReadAll(const std::string& path)
+	{
+		std::ifstream file(std::filesystem::u8path(path), std::ios::binary);
+		return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	}
+
+	std::filesystem::path MakeScratchDir()
+	{
+		const auto dir = std::filesystem::temp_directory_path() / "pvz_async_save_writer_tests";
+		std::filesystem::remove_all(dir);
+		std::filesystem::create_directories(dir);
+		return dir;
+	}
+
+	bool Exists(const std::string& path)
+	{
+		return std::filesystem::exists(std::filesystem::u8path(path));
+	}
+
+	void TestAtomicWriteReplacesWholeFile(const std::filesystem::path& dir)
+	{
+		const auto path = (dir / "level1_data.bin").u8string();
+		std::string error;
+		Require(WriteFileAtomic(path, "old save, rather long", error), "first write succeeds: " + error);
+		// 模拟上次写入途中被杀：残留的半截临时文件不影响下一次写入
+		std::ofstream(std::filesystem::u8path(path + ".tmp")) << "half";
+		Require(WriteFileAtomic(path, "new", error), "overwrite succeeds: " + error);
+		Require(ReadAll(path) == "new", "target holds exactly the new bytes");
+		Require(!Exists(path + ".tmp"), "temporary file is renamed away");
+
+		const auto missing = dir / "no_such_dir" / "level2_data.bin";
+		Require(!WriteFileAtomic(missing.u8string(), "x", error), "unwritable target reports failure");
+		Require(!error.empty(), "failure carries a reason");
+	}
+
+	void TestQueuedSavesCoalesceAndFlush(const std::filesystem::path& dir)
+	{
+		const auto path = (dir / "level3_data.bin").u8string();
+		const auto other = (dir / "level4_data.bin").u8string();
+		std::promise<void> release;
+		std::shared_future<void> gate = release.get_future().share();
+		std::atomic<int> encodes{ 0 };
+		std::atomic<bool> committed{ false };
+
+		AsyncSaveWriter writer;
+		// 第一个任务卡在编码里，后续同路径的提交只能排队，从而必然被顶替
+		writer.Submit(other, [gate, &encodes]() { gate.wait(); ++encodes; return std::string("other"); });
+		for (int i = 0; i < 50; ++i) {
+			writer.Submit(path, [i, &encodes]() { ++encodes; return "save " + std::to_string(i); },
+				[&committed]() { committed = true; });
+		}
+		Require(!writer.IsIdle(), "writer is busy while the first job is blocked");
+		release.set_value();
+		writer.Flush();
+
+		Require(writer.IsIdle(), "flush returns only once the queue is drained");
+		Require(encodes == 2, "queued saves for one path collapse into the newest");
+		Require(ReadAll(path) == "save 49", "the newest queued save wins");
+		Require(ReadAll(other) == "other", "other paths are written independently");
+		Require(committed, "commit callback runs after the rename");
+		Require(writer.GetFailureCount() == 0, "no failures on the happy path");
+	}
+
+	void TestFailedEncodeKeepsOldSave(const std::filesystem::path& dir)
+	{
+		const auto path = (dir / "level5_data.bin").u8string();
+		std::string error;
+		Require(WriteFileAtomic(path, "intact", error), "seed write succeeds");
+
+		AsyncSaveWriter writer;
+		bool committed = false;
+		writer.Submit(path, []() -> std::string { throw std::runtime_error("board vanished"); },
+			[&committed]() { committed = true; });
+		writer.Flush();
+		Require(writer.GetFailureCount() == 1, "encode exception is counted as a failure");
+		Require(!committed, "commit callback is skipped on failure");
+		Require(ReadAll(path) == "intact", "existing save survives a failed write");
+		Require(!Exists(path + ".tmp"), "failed write leaves no temporary file");
+	}
+
+	void TestCancelDropsPendingWrite(const std::filesystem::path& dir)
+	{
+		const auto path = (dir / "level6_data.bin").u8string();
+		const auto blocker = (dir / "blocker.bin").u8string();
+		std::promise<void> release;
+		std::shared_future<void> gate = release.get_future().share();
+
+		AsyncSaveWriter writer;
+		writer.Submit(blocker, [gate]() { gate.wait(); return std::string("b"); });
+		writer.Submit(path, []() { return std::string("resurrected"); });
+		writer.Cancel(path);
+		release.set_value();
+		writer.Flush();
+		Require(!Exists(path), "cancelled save never reaches the disk");
+	}
+
+	void TestDestructorFinishesQueuedWrites(const std::filesystem::path& dir)
+	{
+		const auto path = (dir / "level7_data.bin").u8string();
+		{
+			AsyncSaveWriter writer;
+			writer.Submit(path, []() { return std::string("on exit"); });
+		}
+		Require(ReadAll(path) == "on exit", "shutting down still writes the last save");
+	}
+}
+
+int main()
+{
+	try {
+		const auto dir = MakeScratchDir();
+		TestAtomicWriteReplacesWholeFile(dir);
+		TestQueuedSavesCoalesceAndFlush(dir);
+		TestFailedEncodeKeepsOldSave(dir);
+		TestCancelDropsPendingWrite(dir);
+		TestDestructorFinishesQueuedWrites(dir);
+		std::filesystem::remove_all(dir);
+		std::cout << "AsyncSaveWriterTests passed\n";
+		return 0;
+	}
+	catch (const std::exception& error) {
+		std::cerr << "AsyncSaveWriterTests failed: " << error.what() << '\n';
+		return 1;
+	}
+}
@@ -0,0 +1,153 @@
+#include "Renderer/BatchReorder.h"
+
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+	using pvz::BatchPrimitive;
+
+	void Require(bool condition, const std::string& message)
+	{
+		if (!condition) throw std::runtime_error(message);
+	}
+
+	BatchPrimitive MakeQuad(std::uint32_t texture, std::uint32_t blend, float x, float y)
+	{
+		BatchPrimitive prim;
+		prim.texture = texture;
+		prim.blend = blend;
+		prim.minX = x;
+		prim.minY = y;
+		prim.maxX = x + 10.0f;
+		prim.maxY = y + 10.0f;
+		return prim;
+	}
+
+	std::size_t PositionOf(const std::vector<std::uint32_t>& order, std::uint32_t prim)
+	{
+		for (std::size_t i = 0; i < order.size(); ++i) {
+			if (order[i] == prim) return i;
+		}
+		throw std::runtime_error("primitive missing from reorder output");
+	}
+
+	// 任意两个相交图元的相对顺序必须与原顺序一致，否则画面会变。
+	void RequireOverlapOrderPreserved(const std::vector<BatchPrimitive>& prims,
+		const std::vector<std::uint32_t>& order)
+	{
+		Require(order.size() == prims.size(), "reorder must keep every primitive exactly once");
+		for (std::uint32_t a = 0; a < prims.size(); ++a) {
+			for (std::uint32_t b = a + 1; b < prims.size(); ++b) {
+				const bool separated = prims[a].maxX <= prims[b].minX || prims[b].maxX <= prims[a].minX
+					|| prims[a].maxY <= prims[b].minY || prims[b].maxY <= prims[a].minY;
+				if (separated) continue;
+				Require(PositionOf(order, a) < PositionOf(order, b),
+					"overlapping primitives " + std::to_string(a) + "/" + std::to_string(b)
+					+ " must keep their draw order");
+			}
+		}
+	}
+
+	void TestDisjointAlternatingBlendCollapses()
+	{
+		// Alpha / Add 交替、彼此不相交：应合并成两段。
+		std::vector<BatchPrimitive> prims;
+		for (int i = 0; i < 8; ++i) {
+			prims.push_back(MakeQuad(0, static_cast<std::uint32_t>(i % 2), i * 20.0f, 0.0f));
+		}
+		std::vector<std::uint32_t> order;
+		pvz::BatchReorderStats stats;
+		pvz::ReorderBatchPrimitives(prims, order, &stats);
+		Require(stats.segmentsBefore == 8, "alternating blend starts with one segment per quad");
+		Require(stats.segmentsAfter == 2, "disjoint quads must collapse into one segment per blend");
+		RequireOverlapOrderPreserved(prims, order);
+	}
+
+	void TestOverlapBlocksReorder()
+	{
+		// 发光 quad 叠在本体上，后一本体又叠在发光 quad 上：不能越过，段数不变。
+		const std::vector<BatchPrimitive> prims = {
+			MakeQuad(0, 0, 0.0f, 0.0f),
+			MakeQuad(0, 1, 5.0f, 0.0f),
+			MakeQuad(0, 0, 8.0f, 0.0f),
+		};
+		std::vector<std::uint32_t> order;
+		pvz::BatchReorderStats stats;
+		pvz::ReorderBatchPrimitives(prims, order, &stats);
+		Require(stats.segmentsAfter == stats.segmentsBefore, "overlapping chain must not be regrouped");
+		Require(order == std::vector<std::uint32_t>({ 0, 1, 2 }), "overlapping chain keeps record order");
+	}
+
+	void TestTextureKeySplitsGroups()
+	{
+		// 同 blend 不同纹理（OpenGL 语义）按纹理聚合；相交的同纹理对保持次序。
+		const std::vector<BatchPrimitive> prims = {
+			MakeQuad(1, 0, 0.0f, 0.0f),
+			MakeQuad(2, 0, 50.0f, 0.0f),
+			MakeQuad(1, 0, 100.0f, 0.0f),
+			MakeQuad(2, 0, 55.0f, 5.0f),
+		};
+		std::vector<std::uint32_t> order;
+		pvz::BatchReorderStats stats;
+		pvz::ReorderBatchPrimitives(prims, order, &stats);
+		Require(stats.segmentsBefore == 4, "texture changes count as segment breaks");
+		Require(stats.segmentsAfter == 2, "disjoint texture runs must merge per texture");
+		RequireOverlapOrderPreserved(prims, order);
+	}
+
+	void TestInvalidBoundsActAsBarrier()
+	{
+		BatchPrimitive broken = MakeQuad(0, 1, 0.0f, 0.0f);
+		broken.minX = std::nanf("");
+		const std::vector<BatchPrimitive> prims = {
+			MakeQuad(0, 0, 0.0f, 0.0f),
+			broken,
+			MakeQuad(0, 0, 500.0f, 500.0f),
+		};
+		std::vector<std::uint32_t> order;
+		pvz::ReorderBatchPrimitives(prims, order);
+		Require(order == std::vector<std::uint32_t>({ 0, 1, 2 }),
+			"a primitive with invalid bounds must not be crossed");
+	}
+
+	void TestRandomizedSceneKeepsOverlapOrder()
+	{
+		// 固定种子 LCG 生成密集场景，验证重排从不交换相交图元。
+		std::uint32_t state = 0x2545F491u;
+		auto next = [&state]() {
+			state = state * 1664525u + 1013904223u;
+			return state >> 8;
+		};
+		std::vector<BatchPrimitive> prims;
+		for (int i = 0; i < 400; ++i) {
+			const float x = static_cast<float>(next() % 780);
+			const float y = static_cast<float>(next() % 580);
+			prims.push_back(MakeQuad(next() % 3, next() % 2, x, y));
+		}
+		std::vector<std::uint32_t> order;
+		pvz::BatchReorderStats stats;
+		pvz::ReorderBatchPrimitives(prims, order, &stats);
+		Require(stats.segmentsAfter <= stats.segmentsBefore, "reorder must never add segments");
+		RequireOverlapOrderPreserved(prims, order);
+	}
+}
+
+int main()
+{
+	try {
+		TestDisjointAlternatingBlendCollapses();
+		TestOverlapBlocksReorder();
+		TestTextureKeySplitsGroups();
+		TestInvalidBoundsActAsBarrier();
+		TestRandomizedSceneKeepsOverlapOrder();
+		std::cout << "BatchReorderTests passed\n";
+		return 0;
+	}
+	catch (const std::exception& error) {
+		std::cerr << "BatchReorderTests failed: " << error.what() << '\n';
+		return 1;
+	}
+}
@@ -0,0 +1,196 @@
+#include "Game/FogCellField.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+	constexpr int kColumns = 9;
+	constexpr int kRows = 7;              // 泳池六行 + 底部收边
+	constexpr float kStep = 1.0f / 60.0f;
+
+	void Require(bool condition, const std::string& message)
+	{
+		if (!condition) throw std::runtime_error(message);
+	}
+
+	/** 与 Board::UpdateFogCellAlpha 相同的增量路径：目标表按输入缓存，已就位格与整帧就位都跳过。 */
+	struct IncrementalFog {
+		std::vector<float> alpha = std::vector<float>(kColumns * kRows, 0.0f);
+		std::vector<float> targets;
+		FogTargetInputs inputs;
+		bool targetsValid = false;
+		int unsettled = 0;
+
+		void Step(const FogTargetInputs& next, float deltaTime, bool snapToTarget)
+		{
+			if (!targetsValid || next != inputs) {
+				inputs = next;
+				targetsValid = true;
+				FogCellField::BuildTargets(next, kColumns, kRows, targets);
+				unsettled = kColumns * kRows;
+			}
+			if (unsettled > 0) {
+				unsettled = FogCellField::StepTowardTargets(targets, alpha, deltaTime, snapToTarget);
+			}
+		}
+
+		/** 读档/换关：alpha 清零并作废目标表，与 Board::RestoreFogState 一致。 */
+		void Reset()
+		{
+			alpha.assign(alpha.size(), 0.0f);
+			targetsValid = false;
+		}
+	};
+
+	/** 逐帧驱动一条输入轨迹；增量与对照两份 alpha 每帧须逐位相同。 */
+	struct TraceRunner {
+		IncrementalFog incremental;
+		std::vector<float> reference = std::vector<float>(kColumns * kRows, 0.0f);
+		int ticks = 0;
+		int skippedTicks = 0;   // 增量路径整帧未遍历逐格的帧数
+
+		void Tick(const FogTargetInputs& inputs, float deltaTime, bool snapToTarget = false)
+		{
+			const bool idle = incremental.targetsValid && inputs == incremental.inputs
+				&& incremental.unsettled == 0;
+			FogCellField::StepReference(inputs, kColumns, kRows, reference, deltaTime, snapToTarget);
+			incremental.Step(inputs, deltaTime, snapToTarget);
+			if (idle) ++skippedTicks;
+			++ticks;
+			Require(std::memcmp(incremental.alpha.data(), reference.data(),
+				reference.size() * sizeof(float)) == 0,
+				"incremental fog alpha diverged from the reference at tick " + std::to_string(ticks));
+		}
+
+		void Run(const FogTargetInputs& inputs, float seconds, float deltaTime = kStep)
+		{
+			const int frames = static_cast<int>(std::lround(seconds / deltaTime));
+			for (int i = 0; i < frames; ++i) Tick(inputs, deltaTime);
+		}
+
+		void Reload(const FogTargetInputs& inputs)
+		{
+			incremental.Reset();
+			reference.assign(reference.size(), 0.0f);
+			Tick(inputs, 0.0f, true);
+		}
+	};
+
+	FogTargetInputs Lit(FogTargetInputs inputs, int row, int column, int gear)
+	{
+		inputs.planternRow = row;
+		inputs.planternColumn = column;
+		inputs.planternGear = gear;
+		return inputs;
+	}
+
+	void TestMaskMatchesShape()
+	{
+		const int radius = FogCellField::kPlanternMaskRadius;
+		for (int gear = 0; gear < 4; ++gear) {
+			for (int y = -radius - 1; y <= radius + 1; ++y) {
+				for (int x = -radius - 1; x <= radius + 1; ++x) {
+					const float shape = std::abs(x) > radius || std::abs(y) > radius
+						? 0.0f : FogCellField::EvaluatePlanternShape(gear, x, y);
+					Require(FogCellField::GetPlanternIllumination(gear, x, y) == shape,
+						"precomputed mask matches the shape definition");
+				}
+			}
+			Require(FogCellField::EvaluatePlanternShape(gear, radius, 0) == 0.0f
+				&& FogCellField::EvaluatePlanternShape(gear, 0, radius) == 0.0f,
+				"no gear lights the mask border");
+		}
+		Require(FogCellField::GetPlanternIllumination(7, 0, 0) == 0.0f, "unknown gear lights nothing");
+	}
+
+	/** 迷雾关卡的典型一局：雾线推进、大雾、挡位切换、台风驱散与回流、燃料耗尽、铲除与读档。 */
+	void TestGameplayTraceMatchesReference()
+	{
+		TraceRunner runner;
+		FogTargetInputs fog;
+		fog.leftColumn = 5;
+
+		runner.Run(fog, 3.0f);
+		Require(runner.incremental.unsettled == 0, "fog settles after filling");
+		runner.Run(fog, 1.0f);
+		Require(runner.skippedTicks >= 59, "settled fog with unchanged inputs skips whole ticks");
+
+		fog.leftColumn = 3;                       // 雾势升级：雾线向房屋推进
+		runner.Run(fog, 2.0f);
+		fog.dense = true;
+		runner.Run(fog, 1.0f);
+
+		for (int gear = 1; gear <= 3; ++gear) {   // 路灯花逐档加亮
+			runner.Run(Lit(fog, 2, 4, gear), 1.5f);
+		}
+		runner.Run(Lit(fog, 2, 4, 1), 1.0f);      // 降档：被照亮的格重新回雾
+
+		// 台风：驱散比例逐帧变化，目标表每帧重算
+		for (int i = 0; i < 90; ++i) {
+			fog.dispersal = std::min(0.42f, fog.dispersal + 0.28f * kStep);
+			runner.Tick(Lit(fog, 2, 4, 3), kStep);
+		}
+		for (int i = 0; i < 120; ++i) {
+			fog.dispersal = std::max(0.0f, fog.dispersal - 0.06f * kStep);
+			runner.Tick(Lit(fog, 2, 4, 3), kStep);
+		}
+
+		runner.Run(fog, 1.0f);                    // 燃料耗尽：照明熄灭
+		runner.Run(Lit(fog, 5, 8, 3), 1.0f);      // 换到边角格：模板被棋盘边界裁切
+		runner.Run(Lit(fog, 0, 0, 2), 1.0f);
+		runner.Run(fog, 0.5f);                    // 铲除
+
+		runner.Reload(Lit(fog, 3, 6, 2));         // 读档：清零后直接对齐终态
+		Require(runner.incremental.unsettled == 0, "snap leaves every cell on its target");
+		runner.Run(Lit(fog, 3, 6, 2), 0.5f);
+	}
+
+	/** 加速与卡顿时单帧 deltaTime 放大，单步即可越过目标；两条路径仍须逐位一致。 */
+	void TestLargeStepsMatchReference()
+	{
+		TraceRunner runner;
+		FogTargetInputs fog;
+		fog.leftColumn = 2;
+		fog.dense = true;
+		for (const float deltaTime : { kStep * 2.0f, kStep * 8.0f, 0.25f, 1.0f }) {
+			runner.Run(Lit(fog, 1, 3, 3), 2.0f, deltaTime);
+			fog.dispersal = fog.dispersal > 0.0f ? 0.0f : 0.3f;
+			runner.Run(fog, 2.0f, deltaTime);
+		}
+	}
+
+	/** 驱散比例取 (0,1) 内的大量取值，覆盖 visibility 乘法的舍入差异。 */
+	void TestDispersalSweepMatchesReference()
+	{
+		TraceRunner runner;
+		FogTargetInputs fog;
+		fog.leftColumn = 1;
+		for (int i = 0; i <= 500; ++i) {
+			fog.dispersal = static_cast<float>(i) / 500.0f;
+			fog.dense = (i / 50) % 2 == 1;
+			runner.Tick(Lit(fog, i % kRows, i % kColumns, i % 4), kStep);
+		}
+	}
+}
+
+int main()
+{
+	try {
+		TestMaskMatchesShape();
+		TestGameplayTraceMatchesReference();
+		TestLargeStepsMatchReference();
+		TestDispersalSweepMatchesReference();
+		std::cout << "FogCellFieldTests passed\n";
+		return 0;
+	}
+	catch (const std::exception& error) {
+		std::cerr << "FogCellFieldTests failed: " << error.what() << '\n';
+		return 1;
+	}
+}
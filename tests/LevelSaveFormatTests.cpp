@@ -0,0 +1,321 @@
+#include "LevelSaveFormat.h"
+#include "LevelSaveBenchmark.h"
+#include "SaveSchema.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <string>
+
+// 全局 operator new 记账：块头记下大小，统计存活字节与峰值，用来比较整树解码与流式解码的内存峰值。
+namespace {
+	constexpr std::size_t kBlockPrefix = alignof(std::max_align_t);
+	std::atomic<std::size_t> gLiveBytes{ 0 };
+	std::atomic<std::size_t> gPeakBytes{ 0 };
+}
+
+void* operator new(std::size_t size)
+{
+	void* raw = std::malloc(size + kBlockPrefix);
+	if (!raw) throw std::bad_alloc();
+	*static_cast<std::size_t*>(raw) = size;
+	const std::size_t live = gLiveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+	std::size_t peak = gPeakBytes.load(std::memory_order_relaxed);
+	while (live > peak && !gPeakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {}
+	return static_cast<char*>(raw) + kBlockPrefix;
+}
+
+void operator delete(void* p) noexcept
+{
+	if (!p) return;
+	char* raw = static_cast<char*>(p) - kBlockPrefix;
+	gLiveBytes.fetch_sub(*reinterpret_cast<std::size_t*>(raw), std::memory_order_relaxed);
+	std::free(raw);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+	operator delete(p);
+}
+
+namespace {
+	void Require(bool condition, const std::string& message)
+	{
+		if (!condition) throw std::runtime_error(message);
+	}
+
+	nlohmann::json Decoded(const std::string& bytes)
+	{
+		nlohmann::json document;
+		std::string error;
+		Require(LevelSaveFormat::Decode(bytes, document, error), "encoded level decodes: " + error);
+		return document;
+	}
+
+	/** 把流式回调交出的头部与记录拼回一份文档，同时检查回调顺序约定。 */
+	struct Reassembler {
+		nlohmann::json document;
+		bool headerSeen = false;
+		bool orderOk = true;
+		int lastArray = -1;
+
+		LevelSaveFormat::StreamCallbacks Callbacks()
+		{
+			return {
+				[this](nlohmann::json& header) {
+					orderOk = orderOk && !headerSeen;
+					headerSeen = true;
+					document = std::move(header);
+					return true;
+				},
+				[this](LevelSaveFormat::LevelArray array, nlohmann::json& record) {
+					const int index = static_cast<int>(array);
+					orderOk = orderOk && headerSeen && index >= lastArray;
+					lastArray = index;
+					document[LevelSaveFormat::kLevelArrayNames[index]].push_back(record);
+					return true;
+				},
+			};
+		}
+
+		/** 空数组不产生记录；按原文档补回，便于逐值比较。 */
+		const nlohmann::json& Completed(const nlohmann::json& original)
+		{
+			for (const char* name : LevelSaveFormat::kLevelArrayNames) {
+				if (original.contains(name) && !document.contains(name)) {
+					document[name] = nlohmann::json::array();
+				}
+			}
+			return document;
+		}
+	};
+
+	void TestRoundTripKeepsEveryValue()
+	{
+		const nlohmann::json document = {
+			{ "schemaVersion", SaveSchema::kCurrentLevelVersion },
+			{ "sun", 9000 },
+			{ "negative", -123456789012345ll },
+			{ "huge", std::numeric_limits<std::uint64_t>::max() },
+			{ "frame", 0.25f },
+			{ "precise", 0.1 },
+			{ "name", "anim_walk" },
+			{ "empty", "" },
+			{ "flag", true },
+			{ "nothing", nullptr },
+			{ "zombies", { { { "x", 412.5f }, { "row", 2 } }, { { "x", 96.0f }, { "row", 4 } } } },
+			{ "nested", { { "deeper", { { "list", { 1, 2, 3 } } } } } },
+		};
+		const std::string bytes = LevelSaveFormat::Encode(document);
+		Require(LevelSaveFormat::IsBinary(bytes), "encoded level carries the magic");
+		Require(Decoded(bytes) == document, "every value survives the round trip");
+		Require(Decoded(bytes)["precise"].get<double>() == 0.1, "doubles that do not fit a float stay exact");
+
+		const nlohmann::json synthetic = MakeSyntheticLevelDocument(300, 20);
+		const std::string large = LevelSaveFormat::Encode(synthetic);
+		Require(Decoded(large) == synthetic, "a large synthetic board survives the round trip");
+		Require(large.size() * 4 < synthetic.dump(4).size(), "repeated entity keys are stored once");
+	}
+
+	void TestDamagedFilesAreRejected()
+	{
+		const nlohmann::json document = { { "schemaVersion", 3 }, { "sun", 50 } };
+		const std::string bytes = LevelSaveFormat::Encode(document);
+		nlohmann::json out = { { "untouched", true } };
+		std::string error;
+
+		Require(!LevelSaveFormat::IsBinary("{\"sun\":50}"), "JSON text is not mistaken for a binary save");
+		Require(!LevelSaveFormat::Decode(bytes.substr(0, bytes.size() - 1), out, error), "truncated file is rejected");
+		Require(!LevelSaveFormat::Decode(bytes.substr(0, 10), out, error), "truncated header is rejected");
+
+		std::string flipped = bytes;
+		flipped.back() ^= 0x01;
+		Require(!LevelSaveFormat::Decode(flipped, out, error), "checksum catches a flipped byte");
+
+		std::string future = bytes;
+		future[4] = static_cast<char>(LevelSaveFormat::kContainerVersion + 1);
+		Require(!LevelSaveFormat::Decode(future, out, error), "unknown container version is rejected");
+		Require(out == nlohmann::json({ { "untouched", true } }), "failed decodes leave the output alone");
+
+		bool called = false;
+		const LevelSaveFormat::StreamCallbacks callbacks{
+			[&called](nlohmann::json&) { called = true; return true; },
+			[&called](LevelSaveFormat::LevelArray, nlohmann::json&) { called = true; return true; },
+		};
+		Require(!LevelSaveFormat::DecodeStreaming(flipped, callbacks, error), "streaming also checks the checksum");
+		Require(!LevelSaveFormat::DecodeStreaming(bytes.substr(0, bytes.size() - 1), callbacks, error),
+			"streaming rejects a truncated file");
+		Require(!called, "damaged files are rejected before any callback runs");
+	}
+
+	void TestStreamingRestoresTheSameRecords()
+	{
+		nlohmann::json synthetic = MakeSyntheticLevelDocument(800, 30);
+		synthetic["suns"] = { { { "x", 10.0f }, { "y", 20.0f }, { "small", true } } };
+		synthetic["ladders"] = { { { "row", 1 }, { "column", 4 }, { "style", 1 } } };
+		const std::string bytes = LevelSaveFormat::Encode(synthetic);
+		std::string error;
+
+		Reassembler streamed;
+		Require(LevelSaveFormat::DecodeStreaming(bytes, streamed.Callbacks(), error), "streaming decode succeeds: " + error);
+		Require(streamed.orderOk, "header arrives once before records, arrays in restore order");
+		Require(streamed.Completed(synthetic) == synthetic, "streamed header and records rebuild the original document");
+
+		nlohmann::json dom = Decoded(bytes);
+		Reassembler fromDom;
+		Require(LevelSaveFormat::StreamDocument(dom, fromDom.Callbacks(), error), "DOM documents stream too: " + error);
+		Require(fromDom.orderOk && fromDom.Completed(synthetic) == synthetic, "DOM and streaming paths deliver identical records");
+
+		// v1 容器按键名排序写根对象，流式接口退回整树解码，交出的内容不变
+		std::string legacy = bytes;
+		legacy[4] = 1;
+		Reassembler fromLegacy;
+		Require(LevelSaveFormat::DecodeStreaming(legacy, fromLegacy.Callbacks(), error), "v1 containers still stream: " + error);
+		Require(fromLegacy.orderOk && fromLegacy.Completed(synthetic) == synthetic, "v1 fallback delivers the same records");
+
+		int records = 0;
+		const LevelSaveFormat::StreamCallbacks rejectHeader{
+			[](nlohmann::json&) { return false; },
+			[&records](LevelSaveFormat::LevelArray, nlohmann::json&) { ++records; return true; },
+		};
+		error.clear();
+		Require(!LevelSaveFormat::DecodeStreaming(bytes, rejectHeader, error), "a rejected header stops the load");
+		Require(error.empty() && records == 0, "rejection is not reported as damage and creates nothing");
+	}
+
+	void TestStreamingLowersPeakMemory()
+	{
+		const std::string bytes = LevelSaveFormat::Encode(MakeSyntheticLevelDocument(5000, 45));
+		std::string error;
+		std::size_t records = 0;
+		const LevelSaveFormat::StreamCallbacks callbacks{
+			[&error](nlohmann::json& header) { return SaveSchema::UpgradeLevelDocument(header, error); },
+			[&records](LevelSaveFormat::LevelArray, nlohmann::json&) { ++records; return true; },
+		};
+
+		// 整树路径：先解码出完整文档再逐条分发，即 JSON 档与旧实现的读档形状
+		std::size_t baseline = gLiveBytes.load();
+		gPeakBytes.store(baseline);
+		{
+			nlohmann::json document;
+			Require(LevelSaveFormat::Decode(bytes, document, error), "DOM decode succeeds: " + error);
+			Require(LevelSaveFormat::StreamDocument(document, callbacks, error), "DOM dispatch succeeds: " + error);
+		}
+		const std::size_t domPeak = gPeakBytes.load() - baseline;
+		const std::size_t domRecords = records;
+
+		records = 0;
+		baseline = gLiveBytes.load();
+		gPeakBytes.store(baseline);
+		Require(LevelSaveFormat::DecodeStreaming(bytes, callbacks, error), "streaming decode succeeds: " + error);
+		const std::size_t streamPeak = gPeakBytes.load() - baseline;
+
+		Require(records == domRecords && records == 5045, "both paths deliver every record");
+		Require(streamPeak * 8 < domPeak, "streaming peak (" + std::to_string(streamPeak)
+			+ " bytes) is far below the DOM peak (" + std::to_string(domPeak) + " bytes)");
+	}
+
+	void TestSchemaUpgradeStillApplies()
+	{
+		// 旧版文档以二进制容器保存后，读回仍走同一条字段迁移链
+		nlohmann::json legacy = { { "schemaVersion", 2 }, { "fogWeatherIntensity", 0 } };
+		nlohmann::json document = Decoded(LevelSaveFormat::Encode(legacy));
+		std::string error;
+		Require(SaveSchema::UpgradeLevelDocument(document, error), "decoded legacy level upgrades: " + error);
+		Require(document["schemaVersion"] == SaveSchema::kCurrentLevelVersion, "upgrade reaches the current version");
+		Require(document["fogWeatherIntensity"] == 1, "legacy fog intensity is remapped as for JSON saves");
+
+		// 流式读档只升级头部：关卡迁移只触及头字段，实体记录原样交出
+		legacy["zombies"] = { { { "type", 0 }, { "row", 1 }, { "x", 500.0f } } };
+		int zombies = 0;
+		nlohmann::json upgradedHeader;
+		const LevelSaveFormat::StreamCallbacks callbacks{
+			[&](nlohmann::json& header) {
+				if (!SaveSchema::UpgradeLevelDocument(header, error)) return false;
+				upgradedHeader = header;
+				return true;
+			},
+			[&zombies](LevelSaveFormat::LevelArray array, nlohmann::json&) {
+				zombies += array == LevelSaveFormat::LevelArray::Zombies;
+				return true;
+			},
+		};
+		Require(LevelSaveFormat::DecodeStreaming(LevelSaveFormat::Encode(legacy), callbacks, error),
+			"streamed legacy level upgrades: " + error);
+		Require(upgradedHeader["fogWeatherIntensity"] == 1, "streamed header gets the same fog remap");
+		Require(zombies == 1, "records still arrive after an upgraded header");
+	}
+
+	void TestRecordUpgradeUsesHeaderVersion()
+	{
+		// 读档路径的形状：头部升级时记下原始版本，每条记录按它调用 UpgradeLevelRecord
+		nlohmann::json legacy = MakeSyntheticLevelDocument(40, 6);
+		legacy["schemaVersion"] = 2;
+		legacy["fogWeatherIntensity"] = 0;
+		std::string error;
+		int fromVersion = -1;
+		int records = 0;
+		bool recordsUnchanged = true;
+		const LevelSaveFormat::StreamCallbacks callbacks{
+			[&](nlohmann::json& header) { return SaveSchema::UpgradeLevelDocument(header, fromVersion, error); },
+			[&](LevelSaveFormat::LevelArray array, nlohmann::json& record) {
+				const nlohmann::json original = record;
+				SaveSchema::UpgradeLevelRecord(array, record, fromVersion);
+				recordsUnchanged = recordsUnchanged && record == original;
+				++records;
+				return true;
+			},
+		};
+		Require(LevelSaveFormat::DecodeStreaming(LevelSaveFormat::Encode(legacy), callbacks, error),
+			"legacy level streams through the record hook: " + error);
+		Require(fromVersion == 2, "header reports the version it was saved with, not the upgraded one");
+		Require(records == 46, "every record passes through the hook");
+		Require(recordsUnchanged, "v2 records need no rewrite: level migrations so far only touch the header");
+
+		// 缺 schemaVersion 的最旧档记为 0，当前版本档记为当前版本
+		nlohmann::json unversioned = { { "fogWeatherIntensity", 1 } };
+		Require(SaveSchema::UpgradeLevelDocument(unversioned, fromVersion, error) && fromVersion == 0,
+			"a document without schemaVersion starts from version 0");
+		nlohmann::json current = { { "schemaVersion", SaveSchema::kCurrentLevelVersion } };
+		Require(SaveSchema::UpgradeLevelDocument(current, fromVersion, error)
+			&& fromVersion == SaveSchema::kCurrentLevelVersion, "current documents report the current version");
+
+		// 拒绝加载的档不改写 fromVersion，记录也就不会按未知版本迁移
+		nlohmann::json future = { { "schemaVersion", SaveSchema::kCurrentLevelVersion + 1 } };
+		fromVersion = 7;
+		Require(!SaveSchema::UpgradeLevelDocument(future, fromVersion, error) && fromVersion == 7,
+			"a rejected header leaves fromVersion untouched");
+
+		// 非对象记录与最旧版本都不会抛异常
+		nlohmann::json scalar = 5;
+		SaveSchema::UpgradeLevelRecord(LevelSaveFormat::LevelArray::Zombies, scalar, 0);
+		Require(scalar == 5, "non-object records are left alone");
+		nlohmann::json zombie = { { "type", 0 }, { "row", 1 }, { "x", 500.0f } };
+		const nlohmann::json zombieBefore = zombie;
+		SaveSchema::UpgradeLevelRecord(LevelSaveFormat::LevelArray::Zombies, zombie, 0);
+		Require(zombie == zombieBefore, "a v0 record walks the whole chain unchanged");
+	}
+}
+
+int main()
+{
+	try {
+		TestRoundTripKeepsEveryValue();
+		TestDamagedFilesAreRejected();
+		TestStreamingRestoresTheSameRecords();
+		TestStreamingLowersPeakMemory();
+		TestSchemaUpgradeStillApplies();
+		TestRecordUpgradeUsesHeaderVersion();
+		std::cout << "LevelSaveFormatTests passed\n";
+		return 0;
+	}
+	catch (const std::exception& error) {
+		std::cerr << "LevelSaveFormatTests failed: " << error.what() << '\n';
+		return 1;
+	}
+}
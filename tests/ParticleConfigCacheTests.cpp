@@ -0,0 +1,281 @@
+#include "ParticleSystem/ParticleConfigCache.h"
+#include "ParticleSystem/ParticleXMLLoader.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+	void Require(bool condition, const std::string& message)
+	{
+		if (!condition) throw std::runtime_error(message);
+	}
+
+	// 覆盖缓存需要编码的全部字段形态：随机区间、带/不带时间的关键帧、关键帧区间、
+	// 缓动关键字、多纹理、各类场、SystemField、显式初始角度与全屏标记。
+	const char* const kGloomXml = R"(<Emitter>
+  <Name>GloomCloud</Name>
+  <EmitterOffsetX>20</EmitterOffsetX>
+  <EmitterOffsetY>-2.5</EmitterOffsetY>
+  <EmitterType>Circle</EmitterType>
+  <EmitterRadius>[2 8]</EmitterRadius>
+  <SpawnMinActive>5</SpawnMinActive>
+  <SpawnMaxLaunched>[4 6]</SpawnMaxLaunched>
+  <ParticleAlpha>.9,80 0</ParticleAlpha>
+  <ParticleScale>[.7 1.1]</ParticleScale>
+  <ParticleDuration>[.28 .36]</ParticleDuration>
+  <SystemDuration>.38</SystemDuration>
+  <Image>IMAGE_PUFFSHROOM_PUFF1</Image>
+  <Field><FieldType>Position</FieldType><X>[0 6] [18 34]</X><Y>[-5 5] [-13 13]</Y></Field>
+  <Field><FieldType>Shake</FieldType><X>1 0</X><Y>1 0</Y></Field>
+</Emitter>
+<Emitter>
+  <Name>Gloom_South</Name>
+  <EmitterOffsetY>14</EmitterOffsetY>
+  <EmitterRadius>[2 8]</EmitterRadius>
+  <ParticleAlpha>.3,0 [.4 1.0],10 [.4 1.0],70 0,100</ParticleAlpha>
+  <ParticleScale>0 EaseOut 1.2</ParticleScale>
+  <Image>IMAGE_PUFFSHROOM_PUFF1</Image>
+  <Field><FieldType>Friction</FieldType><X>.1</X><Y>.1</Y></Field>
+</Emitter>)";
+
+	const char* const kRainXml = R"(<Emitter>
+  <Name>RainTest</Name>
+  <SpawnRate>120</SpawnRate>
+  <SpawnMinActive>0</SpawnMinActive>
+  <SpawnMaxLaunched>400</SpawnMaxLaunched>
+  <ParticleDuration>1.5</ParticleDuration>
+  <EmitterType>Box</EmitterType>
+  <EmitterBoxX>[-50 850]</EmitterBoxX>
+  <EmitterBoxY>[-20 0]</EmitterBoxY>
+  <LaunchSpeed>[300 360]</LaunchSpeed>
+  <RandomLaunchSpin>true</RandomLaunchSpin>
+  <ParticleRotation>[70 75]</ParticleRotation>
+  <ParticleSpinSpeed>[-5 5]</ParticleSpinSpeed>
+  <ParticleGravity>250</ParticleGravity>
+  <ParticleStretch>2.5</ParticleStretch>
+  <ParticleBrightness>[.8 1]</ParticleBrightness>
+  <ParticleRed>1 .6</ParticleRed>
+  <ParticleGreen>1</ParticleGreen>
+  <ParticleBlue>.8,50 1</ParticleBlue>
+  <SystemAlpha>0 1,10 1,90 0</SystemAlpha>
+  <Image>IMAGE_RAIN_A, IMAGE_RAIN_B ,IMAGE_RAIN_C</Image>
+  <ImageFrames>3</ImageFrames>
+  <AnimationRate>8</AnimationRate>
+  <FullScreen>true</FullScreen>
+  <Field><FieldType>Acceleration</FieldType><X>-20</X><Y>40</Y></Field>
+  <SystemField><FieldType>SystemPosition</FieldType><X>0 30</X><Y>0</Y></SystemField>
+</Emitter>)";
+
+	void RequireSameRange(const ValueRange& a, const ValueRange& b, const std::string& what)
+	{
+		Require(a.minValue == b.minValue && a.maxValue == b.maxValue && a.isRange == b.isRange,
+			what + ": ValueRange mismatch");
+	}
+
+	void RequireSameTrack(const InterpolationTrack& a, const InterpolationTrack& b, const std::string& what)
+	{
+		Require(a.isConstant == b.isConstant && a.constantValue == b.constantValue
+			&& a.isRandomRange == b.isRandomRange
+			&& a.randomMin == b.randomMin && a.randomMax == b.randomMax,
+			what + ": track header mismatch");
+		Require(a.points.size() == b.points.size(), what + ": track point count mismatch");
+		for (size_t i = 0; i < a.points.size(); ++i) {
+			const InterpolationPoint& p = a.points[i];
+			const InterpolationPoint& q = b.points[i];
+			Require(p.value == q.value && p.time == q.time && p.valueLo == q.valueLo && p.valueHi == q.valueHi,
+				what + ": track point mismatch");
+		}
+	}
+
+	void RequireSameFields(const std::vector<ParticleField>& a, const std::vector<ParticleField>& b,
+		const std::string& what)
+	{
+		Require(a.size() == b.size(), what + ": field count mismatch");
+		for (size_t i = 0; i < a.size(); ++i) {
+			Require(a[i].type == b[i].type, what + ": field type mismatch");
+			RequireSameTrack(a[i].xTrack, b[i].xTrack, what + ".x");
+			RequireSameTrack(a[i].yTrack, b[i].yTrack, what + ".y");
+		}
+	}
+
+	void RequireSameEmitter(const EmitterConfig& a, const EmitterConfig& b)
+	{
+		const std::string& n = a.name;
+		Require(a.name == b.name, "emitter name mismatch: " + a.name + " vs " + b.name);
+		RequireSameRange(a.spawnMinActive, b.spawnMinActive, n + ".spawnMinActive");
+		RequireSameRange(a.spawnMaxLaunched, b.spawnMaxLaunched, n + ".spawnMaxLaunched");
+		Require(a.spawnRate == b.spawnRate, n + ": spawnRate mismatch");
+		RequireSameRange(a.particleDuration, b.particleDuration, n + ".particleDuration");
+		Require(a.systemDuration == b.systemDuration, n + ": systemDuration mismatch");
+
+		RequireSameTrack(a.particleAlpha, b.particleAlpha, n + ".particleAlpha");
+		RequireSameTrack(a.particleScale, b.particleScale, n + ".particleScale");
+		RequireSameTrack(a.particleStretch, b.particleStretch, n + ".particleStretch");
+		RequireSameRange(a.particleBrightness, b.particleBrightness, n + ".particleBrightness");
+		RequireSameTrack(a.particleRed, b.particleRed, n + ".particleRed");
+		RequireSameTrack(a.particleGreen, b.particleGreen, n + ".particleGreen");
+		RequireSameTrack(a.particleBlue, b.particleBlue, n + ".particleBlue");
+		RequireSameTrack(a.systemAlpha, b.systemAlpha, n + ".systemAlpha");
+
+		Require(a.emitterType == b.emitterType, n + ": emitterType mismatch");
+		RequireSameRange(a.emitterBoxX, b.emitterBoxX, n + ".emitterBoxX");
+		RequireSameRange(a.emitterBoxY, b.emitterBoxY, n + ".emitterBoxY");
+		RequireSameRange(a.emitterRadius, b.emitterRadius, n + ".emitterRadius");
+		Require(a.emitterOffsetX == b.emitterOffsetX && a.emitterOffsetY == b.emitterOffsetY,
+			n + ": emitter offset mismatch");
+
+		RequireSameRange(a.launchSpeed, b.launchSpeed, n + ".launchSpeed");
+		Require(a.randomLaunchSpin == b.randomLaunchSpin, n + ": randomLaunchSpin mismatch");
+		RequireSameRange(a.particleRotation, b.particleRotation, n + ".particleRotation");
+		Require(a.hasParticleRotation == b.hasParticleRotation, n + ": hasParticleRotation mismatch");
+		RequireSameRange(a.particleSpinSpeed, b.particleSpinSpeed, n + ".particleSpinSpeed");
+		Require(a.particleGravity == b.particleGravity, n + ": particleGravity mismatch");
+
+		Require(a.imageKeys == b.imageKeys, n + ": imageKeys mismatch");
+		Require(a.imageFrames == b.imageFrames, n + ": imageFrames mismatch");
+		Require(a.animationRate == b.animationRate, n + ": animationRate mismatch");
+
+		RequireSameFields(a.fields, b.fields, n + ".fields");
+		RequireSameFields(a.systemFields, b.systemFields, n + ".systemFields");
+		Require(a.fullScreen == b.fullScreen, n + ": fullScreen mismatch");
+	}
+
+	/** 按名字排序收集 loader 里的全部特效（与运行时写缓存的顺序一致）。 */
+	std::vector<const ParticleEffectConfig*> SortedConfigs(const ParticleXMLLoader& loader)
+	{
+		std::vector<std::string> names = loader.GetAllEffectNames();
+		std::sort(names.begin(), names.end());
+		std::vector<const ParticleEffectConfig*> configs;
+		for (const std::string& name : names) {
+			configs.push_back(loader.GetEffectConfig(name));
+		}
+		return configs;
+	}
+
+	/** XML 解析结果 → 缓存 → 还原，逐字段比较两边的配置。 */
+	void RequireRoundTrip(const ParticleXMLLoader& loader, std::uint64_t sourceHash)
+	{
+		const std::vector<const ParticleEffectConfig*> fromXml = SortedConfigs(loader);
+		const std::string blob = ParticleConfigCache::Serialize(fromXml, sourceHash);
+
+		std::vector<ParticleEffectConfig> fromCache;
+		Require(ParticleConfigCache::Deserialize(blob.data(), blob.size(), sourceHash, fromCache),
+			"cache written from XML must load back");
+		Require(fromCache.size() == fromXml.size(), "effect count mismatch after round trip");
+		for (size_t i = 0; i < fromCache.size(); ++i) {
+			Require(fromCache[i].name == fromXml[i]->name, "effect name mismatch after round trip");
+			Require(fromCache[i].emitters.size() == fromXml[i]->emitters.size(), "emitter count mismatch");
+			for (size_t e = 0; e < fromCache[i].emitters.size(); ++e) {
+				RequireSameEmitter(fromXml[i]->emitters[e], fromCache[i].emitters[e]);
+			}
+		}
+	}
+
+	void TestEmbeddedConfigsRoundTrip()
+	{
+		ParticleXMLLoader loader;
+		Require(loader.LoadFromString(kGloomXml, "GloomCloud.xml"), "GloomCloud xml must parse");
+		Require(loader.LoadFromString(kRainXml, "RainTest.xml"), "RainTest xml must parse");
+
+		ParticleConfigCache::SourceHasher hasher;
+		hasher.Add("GloomCloud.xml", kGloomXml);
+		hasher.Add("RainTest.xml", kRainXml);
+		RequireRoundTrip(loader, hasher.Value());
+
+		// 样例确实触及了需要编码的分支，否则上面的比较形同虚设
+		const ParticleEffectConfig* rain = loader.GetEffectConfig("RainTest");
+		Require(rain && rain->emitters[0].imageKeys.size() == 3, "image key list should be split");
+		Require(rain->emitters[0].hasParticleRotation, "explicit rotation should be flagged");
+		Require(rain->emitters[0].systemFields.size() == 1, "system field should be parsed");
+		const ParticleEffectConfig* gloom = loader.GetEffectConfig("GloomCloud");
+		Require(gloom && gloom->emitters.size() == 2, "multi-emitter file should keep both emitters");
+		Require(gloom->emitters[1].particleAlpha.points.size() == 4, "ranged keyframes should survive");
+	}
+
+	void TestRejectsStaleOrDamagedCache()
+	{
+		ParticleXMLLoader loader;
+		Require(loader.LoadFromString(kRainXml, "RainTest.xml"), "RainTest xml must parse");
+		const std::vector<const ParticleEffectConfig*> configs = SortedConfigs(loader);
+
+		ParticleConfigCache::SourceHasher hasher;
+		hasher.Add("RainTest.xml", kRainXml);
+		const std::uint64_t hash = hasher.Value();
+		const std::string blob = ParticleConfigCache::Serialize(configs, hash);
+
+		std::vector<ParticleEffectConfig> out(1);
+		out[0].name = "untouched";
+		Require(!ParticleConfigCache::Deserialize(blob.data(), blob.size(), hash + 1, out),
+			"cache keyed by another source hash must be rejected");
+		Require(!ParticleConfigCache::Deserialize(blob.data(), blob.size() - 1, hash, out),
+			"truncated cache must be rejected");
+		const std::string padded = blob + '\0';
+		Require(!ParticleConfigCache::Deserialize(padded.data(), padded.size(), hash, out),
+			"cache with trailing bytes must be rejected");
+		std::string wrongVersion = blob;
+		wrongVersion[4] = static_cast<char>(wrongVersion[4] + 1);
+		Require(!ParticleConfigCache::Deserialize(wrongVersion.data(), wrongVersion.size(), hash, out),
+			"cache from another format version must be rejected");
+		Require(out.size() == 1 && out[0].name == "untouched", "rejected cache must not touch output");
+
+		// 任一源文件改一个字节都要换哈希
+		std::string edited = kRainXml;
+		edited[edited.find("120")] = '2';
+		ParticleConfigCache::SourceHasher editedHasher;
+		editedHasher.Add("RainTest.xml", edited);
+		Require(editedHasher.Value() != hash, "editing a source file must change the hash");
+		ParticleConfigCache::SourceHasher renamedHasher;
+		renamedHasher.Add("RainTest2.xml", kRainXml);
+		Require(renamedHasher.Value() != hash, "renaming a source file must change the hash");
+	}
+
+	/** 构建产物里的真实特效目录（ctest 传入）；目录不存在时跳过。 */
+	void TestShippedConfigsRoundTrip(const std::filesystem::path& directory)
+	{
+		std::error_code error;
+		if (directory.empty() || !std::filesystem::is_directory(directory, error)) {
+			std::cout << "ParticleConfigCacheTests: shipped config directory not found, skipped\n";
+			return;
+		}
+
+		std::vector<std::filesystem::path> files;
+		for (const auto& entry : std::filesystem::directory_iterator(directory)) {
+			if (entry.path().extension() == ".xml") files.push_back(entry.path());
+		}
+		std::sort(files.begin(), files.end());
+		Require(!files.empty(), "shipped config directory has no xml");
+
+		ParticleXMLLoader loader;
+		ParticleConfigCache::SourceHasher hasher;
+		for (const auto& file : files) {
+			std::ifstream in(file, std::ios::binary);
+			std::ostringstream text;
+			text << in.rdbuf();
+			const std::string content = text.str();
+			Require(loader.LoadFromString(content, file.string()), "shipped xml must parse: " + file.string());
+			hasher.Add(file.generic_string(), content);
+		}
+		RequireRoundTrip(loader, hasher.Value());
+	}
+}
+
+int main(int argc, char** argv)
+{
+	try {
+		TestEmbeddedConfigsRoundTrip();
+		TestRejectsStaleOrDamagedCache();
+		TestShippedConfigsRoundTrip(argc > 1 ? std::filesystem::path(argv[1]) : std::filesystem::path());
+		std::cout << "ParticleConfigCacheTests passed\n";
+		return 0;
+	}
+	catch (const std::exception& error) {
+		std::cerr << "ParticleConfigCacheTests failed: " << error.what() << '\n';
+		return 1;
+	}
+}
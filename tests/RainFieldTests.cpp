@@ -0,0 +1,146 @@
+#include "Game/RainField.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+namespace {
+	constexpr float kStep = 1.0f / 60.0f;
+
+	void Require(bool condition, const std::string& message)
+	{
+		if (!condition) throw std::runtime_error(message);
+	}
+
+	void Run(RainField& field, float seconds)
+	{
+		const int frames = static_cast<int>(std::lround(seconds / kStep));
+		for (int i = 0; i < frames; ++i) field.Update(kStep);
+	}
+
+	void TestCapacityScalesWithIntensity()
+	{
+		RainField light;
+		light.SetWeather(RainIntensity::LIGHT, WindDirection::NONE);
+		RainField heavy;
+		heavy.SetWeather(RainIntensity::HEAVY, WindDirection::NONE);
+		Require(light.GetCapacity() < heavy.GetCapacity(), "heavy rain holds more drops than light rain");
+		Require(heavy.GetCapacity() <= RainField::kMaxDrops, "capacity fits the fixed storage");
+
+		int peak = 0;
+		for (int i = 0; i < 600; ++i) {
+			heavy.Update(kStep);
+			peak = std::max(peak, heavy.GetDropCount());
+		}
+		Require(peak <= heavy.GetCapacity(), "drop count never exceeds the intensity capacity");
+	}
+
+	/** 60 帧稳态雨丝数应与原 Rain*.xml 发射器一致：每帧至多一条，稳态 = 实际生成速率 × 平均寿命。 */
+	void TestDensityMatchesLegacyEmitters()
+	{
+		struct Case {
+			RainIntensity intensity;
+			float expectedDrops;
+			const char* name;
+		};
+		const Case cases[] = {
+			{ RainIntensity::LIGHT, 60.0f * 1.025f, "light" },                    // SpawnRate 80 → 每帧一条
+			{ RainIntensity::MEDIUM, 60.0f * 0.81f, "medium" },                   // SpawnRate 60 → 每帧一条
+			{ RainIntensity::HEAVY, 60.0f * 0.625f + 30.0f * 0.44f, "heavy" },    // 70 → 每帧一条；34 → 隔帧一条
+		};
+		for (const Case& c : cases) {
+			RainField field;
+			field.SetWeather(c.intensity, WindDirection::NONE);
+			Run(field, 3.0f);
+			double total = 0.0;
+			const int frames = 600;
+			for (int i = 0; i < frames; ++i) {
+				field.Update(kStep);
+				total += field.GetDropCount();
+			}
+			const float average = static_cast<float>(total / frames);
+			Require(std::fabs(average - c.expectedDrops) <= c.expectedDrops * 0.1f,
+				std::string(c.name) + " rain density matches the old emitter (got "
+				+ std::to_string(average) + ")");
+			Require(field.GetDropCount() < field.GetCapacity() / 2, "capacity is only a ceiling");
+		}
+	}
+
+	void TestWindChangeSteersWithoutRestart()
+	{
+		RainField field;
+		field.SetWeather(RainIntensity::HEAVY, WindDirection::TOWARD_HOUSE);
+		Run(field, 2.0f);
+		Require(field.GetLayerDriftX(0) < 0.0f, "wind toward the house drifts left");
+		const int before = field.GetDropCount();
+
+		field.SetWeather(RainIntensity::HEAVY, WindDirection::TOWARD_FRONT);
+		field.Update(kStep);
+		Require(field.GetDropCount() >= before - 16, "wind flip keeps in-flight drops");
+		Run(field, 1.5f);
+		Require(field.GetLayerDriftX(0) > 0.0f, "drift eases to the new direction");
+		Require(field.GetLayerSin(0) < 0.0f, "drops lean the other way after the flip");
+	}
+
+	void TestClearLetsDropsFinish()
+	{
+		RainField field;
+		field.SetWeather(RainIntensity::MEDIUM, WindDirection::NONE);
+		Run(field, 2.0f);
+		field.SetWeather(RainIntensity::CLEAR, WindDirection::NONE);
+		Require(!field.IsSpawning(), "clear weather stops spawning");
+		Require(field.GetDropCount() > 0, "clear does not wipe in-flight drops");
+		Run(field, 1.2f);
+		Require(field.GetDropCount() == 0, "every drop expires within its lifetime");
+	}
+
+	void TestAlphaStaysInCurve()
+	{
+		RainField field;
+		field.SetWeather(RainIntensity::HEAVY, WindDirection::NONE);
+		for (int frame = 0; frame < 240; ++frame) {
+			field.Update(kStep);
+			const RainField::Drops& drops = field.GetDrops();
+			for (int i = 0; i < drops.count; ++i) {
+				Require(drops.alpha[i] >= 0.0f && drops.alpha[i] <= drops.alphaPeak[i] + 0.01f,
+					"drop alpha stays within [0, peak]");
+			}
+		}
+	}
+
+	void TestSplashesRecycleOldest()
+	{
+		RainField field;
+		for (int i = 0; i < RainField::kMaxSplashes + 10; ++i) {
+			field.AddSplash(static_cast<float>(i), 300.0f);
+			field.Update(0.001f);
+		}
+		Require(field.GetSplashCount() == RainField::kMaxSplashes, "splash storage is bounded");
+		const RainField::Splashes& splashes = field.GetSplashes();
+		const auto newestX = std::find(splashes.posX.begin(), splashes.posX.begin() + splashes.count,
+			static_cast<float>(RainField::kMaxSplashes + 9));
+		Require(newestX != splashes.posX.begin() + splashes.count, "newest splash replaces the oldest");
+		Run(field, RainField::kSplashLifetime + 0.05f);
+		Require(field.GetSplashCount() == 0, "splashes expire after the ripple lifetime");
+	}
+}
+
+int main()
+{
+	try {
+		TestCapacityScalesWithIntensity();
+		TestDensityMatchesLegacyEmitters();
+		TestWindChangeSteersWithoutRestart();
+		TestClearLetsDropsFinish();
+		TestAlphaStaysInCurve();
+		TestSplashesRecycleOldest();
+		std::cout << "RainFieldTests passed\n";
+		return 0;
+	}
+	catch (const std::exception& error) {
+		std::cerr << "RainFieldTests failed: " << error.what() << '\n';
+		return 1;
+	}
+}
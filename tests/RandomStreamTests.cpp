@@ -0,0 +1,166 @@
+#include "GameRandom.h"
+#include "Game/ThreadPool.h"
+
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+	struct FakeZombie {
+		int id = 0;
+		float x = 0.0f;
+		int hp = 0;
+		uint64_t checksum = 0;
+	};
+
+	void Require(bool condition, const std::string& message)
+	{
+		if (!condition) throw std::runtime_error(message);
+	}
+
+	// 每帧对每个实体消费一段随机数，且每个实体的消耗量本身也是随机的
+	void StepZombie(FakeZombie& zombie)
+	{
+		RandomStream rng = GameRandom::Stream(RandomDomain::ZOMBIE, static_cast<uint64_t>(zombie.id));
+		zombie.x -= rng.Range(0.2f, 0.6f);
+		const int rolls = rng.Range(0, 4);
+		for (int i = 0; i < rolls; ++i) {
+			if (rng.Chance(0.25f)) zombie.hp -= rng.Range(1, 20);
+			zombie.checksum = zombie.checksum * 31u + rng.NextU64();
+		}
+	}
+
+	std::vector<FakeZombie> Simulate(uint64_t seed, int workers, int frames)
+	{
+		GameRandom::SetSeed(seed);
+		std::vector<FakeZombie> zombies(257);
+		for (int i = 0; i < static_cast<int>(zombies.size()); ++i) {
+			zombies[i].id = 1000 + i * 7;
+			zombies[i].x = 900.0f;
+			zombies[i].hp = 270;
+		}
+
+		ThreadPool pool(workers);
+		const int total = static_cast<int>(zombies.size());
+		for (int frame = 1; frame <= frames; ++frame) {
+			GameRandom::SetStreamFrame(static_cast<uint64_t>(frame));
+			pool.Dispatch(total, [&zombies](int start, int end) {
+				for (int i = start; i < end; ++i) StepZombie(zombies[i]);
+				});
+			// 串行阶段照常用全局引擎：与并行流互不干扰
+			(void)GameRandom::Value();
+		}
+		return zombies;
+	}
+
+	bool SameRun(const std::vector<FakeZombie>& a, const std::vector<FakeZombie>& b)
+	{
+		if (a.size() != b.size()) return false;
+		for (size_t i = 0; i < a.size(); ++i) {
+			if (a[i].x != b[i].x || a[i].hp != b[i].hp || a[i].checksum != b[i].checksum) return false;
+		}
+		return true;
+	}
+
+	void TestWorkerCountDoesNotChangeResults()
+	{
+		const std::vector<FakeZombie> serial = Simulate(20261019u, 1, 120);
+		for (int workers : { 2, 3, 4, 8, 16 }) {
+			Require(SameRun(serial, Simulate(20261019u, workers, 120)),
+				"same seed gives identical runs with " + std::to_string(workers) + " workers");
+		}
+		Require(!SameRun(serial, Simulate(20261020u, 4, 120)), "a different seed changes the run");
+	}
+
+	void TestStreamsAreKeyedByEveryComponent()
+	{
+		GameRandom::SetSeed(7u);
+		GameRandom::SetStreamFrame(10u);
+		const uint64_t base = GameRandom::Stream(RandomDomain::PLANT, 3u).NextU64();
+		Require(GameRandom::Stream(RandomDomain::PLANT, 3u).NextU64() == base, "stream is a pure function of its key");
+		Require(GameRandom::Stream(RandomDomain::PLANT, 4u).NextU64() != base, "entity id changes the stream");
+		Require(GameRandom::Stream(RandomDomain::ZOMBIE, 3u).NextU64() != base, "domain changes the stream");
+		GameRandom::SetStreamFrame(11u);
+		Require(GameRandom::Stream(RandomDomain::PLANT, 3u).NextU64() != base, "board frame changes the stream");
+		Require(GameRandom::GetSeed() == 7u, "GetSeed reports the root seed");
+
+		RandomStream stream(0x1234u);
+		for (uint64_t n = 0; n < 8; ++n) {
+			Require(stream.NextU64() == RandomStream::At(0x1234u, n), "the n-th output only depends on (key, n)");
+		}
+	}
+
+	// 快进跳过的粒子发射只消耗表现流，模拟用的全局序列不受影响
+	void TestVisualDrawsDoNotShiftSimulation()
+	{
+		GameRandom::SetSeed(42u);
+		const int a = GameRandom::Range(0, 1000000);
+		const float b = GameRandom::Value();
+
+		GameRandom::SetSeed(42u);
+		for (int i = 0; i < 37; ++i) (void)GameRandom::VisualRange(0.0f, 360.0f);
+		Require(GameRandom::Range(0, 1000000) == a, "visual draws leave the simulation engine alone");
+		(void)GameRandom::VisualRange(0, 3);
+		Require(GameRandom::Value() == b, "interleaved visual draws leave the simulation engine alone");
+
+		GameRandom::SetSeed(42u);
+		const float visual = GameRandom::VisualRange(0.0f, 1.0f);
+		GameRandom::SetSeed(42u);
+		Require(GameRandom::VisualRange(0.0f, 1.0f) == visual, "the visual engine is reseeded with the root seed");
+	}
+
+	void TestCapturedStateReplaysTheSameSequence()
+	{
+		GameRandom::SetSeed(7u);
+		GameRandom::SetStreamFrame(12u);
+		(void)GameRandom::Gaussian();
+		const GameRandom::State state = GameRandom::CaptureState();
+		const int a = GameRandom::Range(0, 1000000);
+		const float g = GameRandom::Gaussian();
+		const float v = GameRandom::VisualRange(0.0f, 1.0f);
+
+		GameRandom::SetSeed(99u);
+		GameRandom::SetStreamFrame(0u);
+		GameRandom::RestoreState(state);
+		Require(GameRandom::GetSeed() == 7u && GameRandom::GetStreamFrame() == 12u, "root seed and frame are restored");
+		Require(GameRandom::Range(0, 1000000) == a, "simulation engine resumes from the captured point");
+		Require(GameRandom::Gaussian() == g, "the cached half of a normal pair is restored too");
+		Require(GameRandom::VisualRange(0.0f, 1.0f) == v, "visual engine resumes from the captured point");
+	}
+
+	void TestRangesStayInBounds()
+	{
+		RandomStream stream = RandomStream::Derive(1u, 2u, 3u, 4u);
+		bool sawMin = false;
+		bool sawMax = false;
+		for (int i = 0; i < 20000; ++i) {
+			const int value = stream.Range(-3, 3);
+			Require(value >= -3 && value <= 3, "integer range is inclusive and bounded");
+			sawMin = sawMin || value == -3;
+			sawMax = sawMax || value == 3;
+			const float unit = stream.Value();
+			Require(unit >= 0.0f && unit < 1.0f, "Value stays in [0, 1)");
+		}
+		Require(sawMin && sawMax, "integer range reaches both ends");
+		Require(stream.Range(5, 5) == 5 && stream.Range(5, 2) == 5, "degenerate ranges return min");
+	}
+}
+
+int main()
+{
+	try {
+		TestWorkerCountDoesNotChangeResults();
+		TestStreamsAreKeyedByEveryComponent();
+		TestVisualDrawsDoNotShiftSimulation();
+		TestCapturedStateReplaysTheSameSequence();
+		TestRangesStayInBounds();
+		std::cout << "RandomStreamTests passed\n";
+		return 0;
+	}
+	catch (const std::exception& error) {
+		std::cerr << "RandomStreamTests failed: " << error.what() << '\n';
+		return 1;
+	}
+}
@@ -0,0 +1,111 @@
+#include "Game/RenderInterpolation.h"
+
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+namespace {
+	constexpr float kPi = 3.14159265358979f;
+	constexpr float kEpsilon = 1e-4f;
+
+	void Require(bool condition, const std::string& message)
+	{
+		if (!condition) throw std::runtime_error(message);
+	}
+
+	bool Near(float a, float b)
+	{
+		return std::fabs(a - b) <= kEpsilon;
+	}
+
+	void TestLerpAngleTakesShortestArc()
+	{
+		using RenderInterpolation::LerpAngle;
+		Require(Near(LerpAngle(0.0f, 1.0f, 0.5f), 0.5f), "plain lerp inside (-pi, pi)");
+		Require(Near(LerpAngle(1.0f, 1.0f, 0.3f), 1.0f), "equal angles stay put");
+
+		// 170° → -170° 走 20° 的短弧穿过 ±180°，中点是 180° 而不是 0°
+		const float from = kPi * 170.0f / 180.0f;
+		const float to = -kPi * 170.0f / 180.0f;
+		const float mid = LerpAngle(from, to, 0.5f);
+		Require(Near(std::fabs(mid), kPi), "crossing +pi goes through pi, not through 0");
+		Require(Near(LerpAngle(to, from, 0.5f), -kPi), "crossing -pi goes through -pi");
+		Require(Near(LerpAngle(from, to, 1.0f) - from, kPi * 20.0f / 180.0f),
+			"alpha 1 lands on the target modulo a full turn");
+
+		// 逻辑旋转已累计多圈时同样只补最短差值
+		Require(Near(LerpAngle(4.0f * kPi, 4.0f * kPi + 0.2f, 0.5f), 4.0f * kPi + 0.1f),
+			"accumulated turns do not unwind");
+		Require(Near(LerpAngle(0.1f, 0.1f + 2.0f * kPi, 0.5f), 0.1f), "a full turn is no motion");
+	}
+
+	void TestInterpolateSkipsStillAndTeleport()
+	{
+		RenderInterpolation::Entry entry;
+		const RenderInterpolation::Pose still{ 10.0f, 20.0f, 1.0f, 0.0f };
+		Require(!RenderInterpolation::Interpolate(still, still, 0.5f, entry), "unchanged pose is not rewritten");
+
+		const RenderInterpolation::Pose jumped{ 10.0f + RenderInterpolation::kMaxInterpolatedDistance + 1.0f,
+			20.0f, 1.0f, 0.0f };
+		Require(!RenderInterpolation::Interpolate(still, jumped, 0.5f, entry), "teleport is drawn without a trail");
+
+		const RenderInterpolation::Pose moved{ 30.0f, 10.0f, 2.0f, 0.4f };
+		Require(RenderInterpolation::Interpolate(still, moved, 0.25f, entry), "small move is interpolated");
+		Require(Near(entry.render.x, 15.0f) && Near(entry.render.y, 17.5f), "position lerps by alpha");
+		Require(Near(entry.render.scale, 1.25f) && Near(entry.render.rotation, 0.1f), "scale and rotation lerp");
+		Require(entry.logic.x == moved.x && entry.logic.rotation == moved.rotation, "logic values are kept");
+	}
+
+	void TestRestoreKeepsDrawWrites()
+	{
+		RenderInterpolation::Entry entry;
+		const RenderInterpolation::Pose previous{ 0.0f, 0.0f, 1.0f, 0.0f };
+		const RenderInterpolation::Pose current{ 20.0f, 0.0f, 1.5f, 0.2f };
+		Require(RenderInterpolation::Interpolate(previous, current, 0.5f, entry), "entry is produced");
+
+		// Draw 未改写：全部回到逻辑值
+		RenderInterpolation::Pose restored = RenderInterpolation::Restore(entry, entry.render);
+		Require(restored.x == current.x && restored.y == current.y
+			&& restored.scale == current.scale && restored.rotation == current.rotation,
+			"untouched transform returns to its logic values");
+
+		// Draw 把位置对齐到宿主：位置保留 Draw 的写入，缩放/旋转仍还原
+		RenderInterpolation::Pose afterDraw = entry.render;
+		afterDraw.x = 123.0f;
+		afterDraw.y = 45.0f;
+		restored = RenderInterpolation::Restore(entry, afterDraw);
+		Require(restored.x == 123.0f && restored.y == 45.0f, "draw-time position write survives");
+		Require(restored.scale == current.scale && restored.rotation == current.rotation,
+			"untouched components still restore");
+
+		// 只改了 y：位置按整体判断，x/y 都保留 Draw 的结果，不拼出一半插值一半逻辑的坐标
+		afterDraw = entry.render;
+		afterDraw.y = 7.0f;
+		restored = RenderInterpolation::Restore(entry, afterDraw);
+		Require(restored.x == entry.render.x && restored.y == 7.0f, "position is restored as a whole");
+
+		// Draw 改写缩放与旋转
+		afterDraw = entry.render;
+		afterDraw.scale = 3.0f;
+		afterDraw.rotation = -1.0f;
+		restored = RenderInterpolation::Restore(entry, afterDraw);
+		Require(restored.x == current.x && restored.y == current.y, "position restores independently");
+		Require(restored.scale == 3.0f && restored.rotation == -1.0f, "draw-time scale and rotation survive");
+	}
+}
+
+int main()
+{
+	try {
+		TestLerpAngleTakesShortestArc();
+		TestInterpolateSkipsStillAndTeleport();
+		TestRestoreKeepsDrawWrites();
+		std::cout << "RenderInterpolationTests passed\n";
+		return 0;
+	}
+	catch (const std::exception& error) {
+		std::cerr << "RenderInterpolationTests failed: " << error.what() << '\n';
+		return 1;
+	}
+}
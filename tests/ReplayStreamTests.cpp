@@ -0,0 +1,122 @@
+#include "Game/AutoTest/ReplayStream.h"
+
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+	void Require(bool condition, const std::string& message)
+	{
+		if (!condition) throw std::runtime_error(message);
+	}
+
+	std::string MakeReplay(bool withFooter)
+	{
+		ReplayHeader header;
+		header.version = ReplayStream::kVersion;
+		header.seed = 18446744073709551557ull;
+		header.autoTest = true;
+		header.source = "autotest/scripts/stress_healer_monte_carlo.json";
+
+		std::ostringstream out;
+		out << ReplayStream::HeaderLine(header) << '\n';
+		out << ReplayStream::EntryLine({ 1, ReplayEntryKind::COMMAND, { { "op", "goto_level" }, { "level", 1 } } }) << '\n';
+		out << ReplayStream::EntryLine({ 3, ReplayEntryKind::INPUT, { { "type", "motion" }, { "x", 412.5 }, { "y", 96.0 } } }) << '\n';
+		out << ReplayStream::EntryLine({ 3, ReplayEntryKind::INPUT, { { "type", "down" }, { "button", 1 } } }) << '\n';
+		out << ReplayStream::EntryLine({ 3, ReplayEntryKind::COMMAND, { { "op", "set_sun" }, { "value", 9000 } } }) << '\n';
+		if (withFooter) {
+			ReplayFooter footer;
+			footer.finalTick = 5230;
+			footer.hasStateHash = true;
+			footer.stateHash = 0x00ab00000000cd01ull;
+			footer.level = 1;
+			footer.cards = { "PLANT_SUNFLOWER", "PLANT_PEASHOOTER" };
+			out << ReplayStream::FooterLine(footer) << '\n';
+		}
+		return out.str();
+	}
+
+	bool ParseText(const std::string& text, ReplayStream& stream, std::string& error)
+	{
+		std::istringstream input(text);
+		return stream.Parse(input, error);
+	}
+
+	void TestRoundTrip()
+	{
+		ReplayStream stream;
+		std::string error;
+		Require(ParseText(MakeReplay(true), stream, error), "written replay parses back: " + error);
+		Require(stream.GetHeader().seed == 18446744073709551557ull, "64-bit seed survives the round trip");
+		Require(stream.GetHeader().autoTest, "recording mode is kept");
+		Require(stream.GetEntries().size() == 4, "every entry is kept");
+		Require(stream.GetEntries()[1].kind == ReplayEntryKind::INPUT
+			&& stream.GetEntries()[1].payload.value("x", 0.0) == 412.5, "input payload keeps logical coordinates");
+		Require(stream.GetEntries()[3].kind == ReplayEntryKind::COMMAND
+			&& stream.GetEntries()[3].tick == 3, "commands keep their tick");
+
+		const ReplayFooter& footer = stream.GetFooter();
+		Require(footer.present && footer.finalTick == 5230, "footer carries the final tick");
+		Require(footer.hasStateHash && footer.stateHash == 0x00ab00000000cd01ull, "state hash survives as hex");
+		Require(footer.cards.size() == 2 && footer.cards[1] == "PLANT_PEASHOOTER", "card selection keeps its order");
+
+		Require(ParseText(MakeReplay(false), stream, error), "a replay cut off before the footer still parses");
+		Require(!stream.GetFooter().present, "missing footer is reported");
+	}
+
+	void TestMalformedStreams()
+	{
+		ReplayStream stream;
+		std::string error;
+		Require(!ParseText("", stream, error), "empty file is rejected");
+		Require(!ParseText("{\"replay\":99,\"seed\":1}\n", stream, error), "unknown version is rejected");
+		Require(!ParseText("{\"t\":1,\"cmd\":{}}\n", stream, error), "entries before the header are rejected");
+
+		const std::string header = "{\"replay\":1,\"seed\":1}\n";
+		Require(!ParseText(header + "{\"t\":5,\"in\":{}}\n{\"t\":4,\"in\":{}}\n", stream, error), "ticks never go backwards");
+		Require(!ParseText(header + "{\"t\":0,\"in\":{}}\n", stream, error), "ticks start at 1");
+		Require(!ParseText(header + "{\"t\":2,\"other\":{}}\n", stream, error), "entries are either input or command");
+		Require(!ParseText(header + "{\"t\":9,\"in\":{}}\n{\"end\":8}\n", stream, error), "final tick covers every entry");
+		Require(!ParseText(header + "{\"end\":8,\"hash\":\"XYZ\"}\n", stream, error), "hash must be lowercase hex");
+		Require(!ParseText(header + "{\"end\":8}\n{\"t\":9,\"in\":{}}\n", stream, error), "nothing follows the footer");
+		Require(ParseText(header + "\r\n{\"end\":8}\r\n", stream, error), "CRLF line endings are accepted: " + error);
+	}
+
+	void TestTimingSummary()
+	{
+		std::vector<double> stepMs(200, 1.0);
+		stepMs[49] = 9.0;    // tick 50
+		stepMs[149] = 9.0;   // tick 150
+		stepMs[99] = 4.0;    // tick 100
+		stepMs[0] = 2.0;
+		const ReplayTimingSummary summary = SummarizeReplayTiming(stepMs, 3);
+		Require(summary.ticks == 200, "every step is counted");
+		Require(summary.totalMs == 220.0, "total adds every step");
+		Require(summary.p50Ms == 1.0, "p50 is the nearest-rank median");
+		Require(summary.p99Ms == 4.0 && summary.maxMs == 9.0, "p99 is the nearest rank below the two worst spikes");
+		Require(summary.slowest.size() == 3, "slowest list is capped");
+		Require(summary.slowest[0].first == 50 && summary.slowest[1].first == 150, "ties keep the earlier tick first");
+		Require(summary.slowest[2].first == 100 && summary.slowest[2].second == 4.0, "slowest is sorted by cost");
+
+		const ReplayTimingSummary empty = SummarizeReplayTiming({}, 3);
+		Require(empty.ticks == 0 && empty.slowest.empty(), "an empty run summarizes to zeros");
+		Require(ReplayTimingToJson(summary)["slowest"][0]["tick"] == 50, "report lists the slowest ticks");
+	}
+}
+
+int main()
+{
+	try {
+		TestRoundTrip();
+		TestMalformedStreams();
+		TestTimingSummary();
+		std::cout << "ReplayStreamTests passed\n";
+		return 0;
+	}
+	catch (const std::exception& error) {
+		std::cerr << "ReplayStreamTests failed: " << error.what() << '\n';
+		return 1;
+	}
+}
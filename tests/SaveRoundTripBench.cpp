@@ -0,0 +1,273 @@
+#include "LevelSaveBenchmark.h"
+#include "LevelSaveFormat.h"
+#include "SaveSchema.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// 存档往返基准：不启动游戏、不读写磁盘，只测 CPU 侧的序列化、反序列化与 SaveSchema 迁移。
+// 每个用例（文档类型 × 规模 × 新旧版本 × 格式）分段取中位耗时，结果以一份 JSON 输出到 stdout，
+// 便于对比不同提交的数据。磁盘 IO 在内的整段读写耗时见游戏内 -LevelSaveBench。
+//
+// 用法：SaveRoundTripBench [--quick] [--repeats N] [--out 路径]
+//   --quick 只跑最小规模、每段 1 次，供 ctest 确认基准本身可运行且往返结果正确。
+namespace {
+	using Clock = std::chrono::steady_clock;
+
+	struct Options {
+		bool quick = false;
+		int repeats = 7;
+		std::string outPath;
+	};
+
+	struct LevelSize {
+		const char* name;
+		int zombies;
+		int plants;
+	};
+
+	struct PlayerSize {
+		const char* name;
+		int cards;
+		int rememberedCards;
+	};
+
+	double ElapsedMs(Clock::time_point start)
+	{
+		return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+	}
+
+	double Median(std::vector<double> samples)
+	{
+		if (samples.empty()) return 0.0;
+		std::sort(samples.begin(), samples.end());
+		return samples[samples.size() / 2];
+	}
+
+	/** 运行 repeats 次并取中位耗时；prepare 在计时外执行，用来重置被上一轮改写的输入。 */
+	double TimeMedian(int repeats, const std::function<void()>& prepare, const std::function<void()>& body)
+	{
+		std::vector<double> samples;
+		samples.reserve(static_cast<std::size_t>(repeats));
+		for (int i = 0; i < repeats; ++i) {
+			if (prepare) prepare();
+			const auto start = Clock::now();
+			body();
+			samples.push_back(ElapsedMs(start));
+		}
+		return Median(std::move(samples));
+	}
+
+	/** 字段与 SavePlayerInfo 一致的当前版本玩家档；cards/rememberedCards 控制两个数组的长度。 */
+	nlohmann::json MakeSyntheticPlayerDocument(int cards, int rememberedCards)
+	{
+		nlohmann::json j;
+		j["schemaVersion"] = SaveSchema::kCurrentPlayerVersion;
+		j["vsync"] = true;
+		j["fullscreen"] = false;
+		j["difficulty"] = 3;
+		j["adventureLevel"] = 31;
+		j["encounteredEliteDancer"] = true;
+		j["developerSelectedLevel"] = 12;
+		j["developerSelectedZombie"] = "ZOMBIE_NORMAL";
+		j["showPlantHP"] = false;
+		j["showZombieHP"] = true;
+		j["autoCollected"] = true;
+		j["enableMonteCarloAI"] = true;
+		j["advancedPauseEnabled"] = false;
+		j["openingTyphoonProtectionEnabled"] = true;
+		nlohmann::json remembered = nlohmann::json::array();
+		for (int i = 0; i < rememberedCards; ++i) {
+			remembered.push_back("PLANT_SYNTHETIC_" + std::to_string(i));
+		}
+		j["lastSelectedCards"] = std::move(remembered);
+		j["soundVolume"] = 0.8f;
+		j["musicVolume"] = 0.6f;
+		nlohmann::json haveCards = nlohmann::json::array();
+		for (int i = 0; i < cards; ++i) haveCards.push_back(i);
+		j["havecards"] = std::move(haveCards);
+		return j;
+	}
+
+	/** 去掉版本号与后续版本新增的字段，得到会走完整迁移链的 v0 玩家档。 */
+	nlohmann::json MakeLegacyPlayerDocument(nlohmann::json document)
+	{
+		document.erase("schemaVersion");
+		document.erase("advancedPauseEnabled");
+		document.erase("lastSelectedCards");
+		return document;
+	}
+
+	/** v0 关卡档：无版本号，雾势仍是旧的 CLEAR/DENSE 二态，迁移链会逐级重映射。 */
+	nlohmann::json MakeLegacyLevelDocument(nlohmann::json document)
+	{
+		document.erase("schemaVersion");
+		document["fogWeatherIntensity"] = 0;
+		document["forecastFogWeatherIntensity"] = 1;
+		document["actualForecastFogWeatherIntensity"] = 0;
+		return document;
+	}
+
+	using Upgrade = bool (*)(nlohmann::json&, std::string&);
+
+	/**
+	 * 单个用例：serialize → deserialize → migrate 分段计时；binary 关卡档另测正式读档用的流式路径。
+	 * expected 是在内存里直接升级 source 的结果，读回并迁移后的文档必须与它逐值相等。
+	 */
+	nlohmann::json RunCase(const char* kind, const char* size, bool legacy, bool binary,
+		const nlohmann::json& source, Upgrade upgrade, int repeats)
+	{
+		std::string error;
+		nlohmann::json expected = source;
+		if (!upgrade(expected, error)) throw std::runtime_error(std::string("synthetic document rejected: ") + error);
+
+		std::string bytes;
+		const double serializeMs = TimeMedian(repeats, nullptr, [&] {
+			bytes = binary ? LevelSaveFormat::Encode(source) : source.dump(4);
+		});
+
+		nlohmann::json loaded;
+		bool decodeOk = true;
+		const double deserializeMs = TimeMedian(repeats, [&] { loaded = nlohmann::json(); }, [&] {
+			if (binary) {
+				decodeOk = LevelSaveFormat::Decode(bytes, loaded, error) && decodeOk;
+			}
+			else {
+				loaded = nlohmann::json::parse(bytes, nullptr, false);
+				decodeOk = !loaded.is_discarded() && decodeOk;
+			}
+		});
+
+		// 迁移会原地改写文档：每轮先在计时外还原成刚读回的样子
+		const nlohmann::json decoded = loaded;
+		bool migrateOk = true;
+		const double migrateMs = TimeMedian(repeats, [&] { loaded = decoded; }, [&] {
+			migrateOk = upgrade(loaded, error) && migrateOk;
+		});
+
+		nlohmann::json result = {
+			{ "kind", kind },
+			{ "size", size },
+			{ "vintage", legacy ? "legacy" : "current" },
+			{ "format", binary ? "binary" : "json" },
+			{ "bytes", bytes.size() },
+			{ "serializeMs", serializeMs },
+			{ "deserializeMs", deserializeMs },
+			{ "migrateMs", migrateMs },
+			{ "loadMs", deserializeMs + migrateMs },
+		};
+
+		bool streamOk = true;
+		if (binary) {
+			std::size_t records = 0;
+			const LevelSaveFormat::StreamCallbacks callbacks{
+				[&](nlohmann::json& header) { return upgrade(header, error); },
+				[&records](LevelSaveFormat::LevelArray, nlohmann::json&) { ++records; return true; },
+			};
+			result["streamLoadMs"] = TimeMedian(repeats, [&records] { records = 0; }, [&] {
+				streamOk = LevelSaveFormat::DecodeStreaming(bytes, callbacks, error) && streamOk;
+			});
+			result["streamRecords"] = records;
+		}
+
+		result["roundTripOk"] = decodeOk && migrateOk && streamOk && loaded == expected;
+		return result;
+	}
+
+	bool ParseOptions(int argc, char** argv, Options& options)
+	{
+		for (int i = 1; i < argc; ++i) {
+			const std::string arg = argv[i];
+			if (arg == "--quick") {
+				options.quick = true;
+			}
+			else if (arg == "--repeats" && i + 1 < argc) {
+				options.repeats = std::max(1, std::atoi(argv[++i]));
+			}
+			else if (arg == "--out" && i + 1 < argc) {
+				options.outPath = argv[++i];
+			}
+			else {
+				std::cerr << "usage: SaveRoundTripBench [--quick] [--repeats N] [--out path]\n";
+				return false;
+			}
+		}
+		if (options.quick) options.repeats = 1;
+		return true;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	Options options;
+	if (!ParseOptions(argc, argv, options)) return 2;
+
+	try {
+		const std::vector<PlayerSize> playerSizes = options.quick
+			? std::vector<PlayerSize>{ { "new", 5, 0 } }
+			: std::vector<PlayerSize>{ { "new", 5, 0 }, { "full", 120, 64 } };
+		const std::vector<LevelSize> levelSizes = options.quick
+			? std::vector<LevelSize>{ { "small", 20, 10 } }
+			: std::vector<LevelSize>{ { "small", 20, 10 }, { "medium", 500, 45 }, { "large", 5000, 45 } };
+
+		nlohmann::json results = nlohmann::json::array();
+		for (const PlayerSize& size : playerSizes) {
+			const nlohmann::json current = MakeSyntheticPlayerDocument(size.cards, size.rememberedCards);
+			// 玩家档只有 JSON 一种落盘格式
+			results.push_back(RunCase("player", size.name, false, false,
+				current, &SaveSchema::UpgradePlayerDocument, options.repeats));
+			results.push_back(RunCase("player", size.name, true, false,
+				MakeLegacyPlayerDocument(current), &SaveSchema::UpgradePlayerDocument, options.repeats));
+		}
+		for (const LevelSize& size : levelSizes) {
+			const nlohmann::json current = MakeSyntheticLevelDocument(size.zombies, size.plants);
+			const nlohmann::json legacy = MakeLegacyLevelDocument(current);
+			for (const bool binary : { false, true }) {
+				results.push_back(RunCase("level", size.name, false, binary,
+					current, &SaveSchema::UpgradeLevelDocument, options.repeats));
+				results.push_back(RunCase("level", size.name, true, binary,
+					legacy, &SaveSchema::UpgradeLevelDocument, options.repeats));
+			}
+		}
+
+		bool allOk = true;
+		for (const auto& result : results) allOk = allOk && result["roundTripOk"].get<bool>();
+
+		const nlohmann::json report = {
+			{ "benchmark", "save-round-trip" },
+			{ "playerSchemaVersion", SaveSchema::kCurrentPlayerVersion },
+			{ "levelSchemaVersion", SaveSchema::kCurrentLevelVersion },
+			{ "levelContainerVersion", LevelSaveFormat::kContainerVersion },
+			{ "repeats", options.repeats },
+			{ "results", results },
+		};
+		const std::string text = report.dump(2);
+		std::cout << text << '\n';
+		if (!options.outPath.empty()) {
+			std::ofstream file(options.outPath, std::ios::binary | std::ios::trunc);
+			file << text << '\n';
+			if (!file) {
+				std::cerr << "SaveRoundTripBench: cannot write " << options.outPath << '\n';
+				return 1;
+			}
+		}
+		if (!allOk) {
+			std::cerr << "SaveRoundTripBench failed: a round trip did not reproduce the upgraded document\n";
+			return 1;
+		}
+		return 0;
+	}
+	catch (const std::exception& error) {
+		std::cerr << "SaveRoundTripBench failed: " << error.what() << '\n';
+		return 1;
+	}
+}
@@ -0,0 +1,135 @@
+#include "Game/StateHash.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+	struct FakeEntity {
+		int id = 0;
+		int row = 0;
+		int hp = 0;
+		float x = 0.0f;
+		float y = 0.0f;
+	};
+
+	void Require(bool condition, const std::string& message)
+	{
+		if (!condition) throw std::runtime_error(message);
+	}
+
+	void Append(StateHashAccumulator& hash, const FakeEntity& entity)
+	{
+		hash.BeginEntity(7u);
+		hash.Add(entity.id, entity.row);
+		hash.Add(entity.hp, 0);
+		hash.Add(entity.x, entity.y);
+		hash.EndEntity();
+	}
+
+	uint64_t HashAll(const std::vector<FakeEntity>& entities)
+	{
+		StateHashAccumulator hash;
+		for (const FakeEntity& entity : entities) Append(hash, entity);
+		return hash.Value();
+	}
+
+	std::vector<FakeEntity> MakeEntities(int count)
+	{
+		std::vector<FakeEntity> entities;
+		for (int i = 0; i < count; ++i) {
+			entities.push_back({ i + 1, i % 5, 270 - i, 900.0f - static_cast<float>(i) * 0.25f, 80.0f + i % 5 * 100.0f });
+		}
+		return entities;
+	}
+
+	void TestOrderAndChunkingDoNotMatter()
+	{
+		std::vector<FakeEntity> entities = MakeEntities(500);
+		const uint64_t expected = HashAll(entities);
+		std::reverse(entities.begin(), entities.end());
+		Require(HashAll(entities) == expected, "traversal order does not change the hash");
+
+		for (int workers : { 2, 3, 7, 16 }) {
+			const int total = static_cast<int>(entities.size());
+			const int chunk = (total + workers - 1) / workers;
+			StateHashAccumulator merged;
+			for (int begin = 0; begin < total; begin += chunk) {
+				StateHashAccumulator part;
+				for (int i = begin; i < std::min(total, begin + chunk); ++i) Append(part, entities[i]);
+				merged.Merge(part);
+			}
+			Require(merged.Value() == expected, "per-worker partial sums merge to the serial hash");
+			Require(merged.Count() == total, "merged count covers every entity");
+		}
+	}
+
+	void TestSingleFieldChangesAreVisible()
+	{
+		const std::vector<FakeEntity> entities = MakeEntities(64);
+		const uint64_t expected = HashAll(entities);
+
+		std::vector<FakeEntity> changed = entities;
+		changed[40].x = std::nextafter(changed[40].x, 0.0f);
+		Require(HashAll(changed) != expected, "one ulp of position drift changes the hash");
+
+		changed = entities;
+		changed[3].hp -= 1;
+		Require(HashAll(changed) != expected, "one point of damage changes the hash");
+
+		changed = entities;
+		std::swap(changed[5].hp, changed[6].hp);
+		Require(HashAll(changed) != expected, "fields stay bound to their entity");
+
+		changed = entities;
+		changed.push_back(changed.back());
+		changed.push_back(changed.back());
+		Require(HashAll(changed) != expected, "duplicate entities do not cancel out");
+
+		FakeEntity zero;
+		FakeEntity negativeZero;
+		negativeZero.x = -0.0f;
+		Require(HashAll({ zero }) != HashAll({ negativeZero }), "float fields compare bit for bit");
+	}
+
+	void TestCombinedAndFormat()
+	{
+		BoardStateHash a;
+		a.boardFrame = 120;
+		a.plants = 1;
+		a.zombies = 2;
+		BoardStateHash swapped = a;
+		std::swap(swapped.plants, swapped.zombies);
+		Require(a.Combined() != swapped.Combined(), "domains are combined in a fixed order");
+		BoardStateHash later = a;
+		later.boardFrame = 121;
+		Require(a.Combined() != later.Combined(), "board frame is part of the combined hash");
+
+		StateHashAccumulator summed;
+		summed.AddSummed(StateHashMix(0x0000000100000002ull), 1);
+		StateHashAccumulator empty;
+		Require(summed.Value() != empty.Value(), "externally summed members are counted");
+
+		Require(FormatStateHash(0x00ab00000000cd01ull) == "00ab00000000cd01", "hex keeps leading zeros");
+		Require(FormatStateHash(~0ull) == "ffffffffffffffff", "hex covers the full 64 bits");
+	}
+}
+
+int main()
+{
+	try {
+		TestOrderAndChunkingDoNotMatter();
+		TestSingleFieldChangesAreVisible();
+		TestCombinedAndFormat();
+		std::cout << "StateHashTests passed\n";
+		return 0;
+	}
+	catch (const std::exception& error) {
+		std::cerr << "StateHashTests failed: " << error.what() << '\n';
+		return 1;
+	}
+}
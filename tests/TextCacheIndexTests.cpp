@@ -0,0 +1,99 @@
+#include "Renderer/TextCacheIndex.h"
+
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+	using pvz::FontFaceId;
+	using pvz::MakeTextCacheKey;
+	using pvz::TextCacheIndex;
+	using pvz::TextCacheKey;
+
+	void Require(bool condition, const std::string& message)
+	{
+		if (!condition) throw std::runtime_error(message);
+	}
+
+	TextCacheKey Key(const std::string& text, std::uint16_t font = 0, int physSize = 14, std::uint32_t color = 0xFFFFFFFFu)
+	{
+		return MakeTextCacheKey(text, FontFaceId{ font }, physSize, color);
+	}
+
+	void TestKeyCoversEveryField()
+	{
+		const TextCacheKey base = Key("1200");
+		Require(base == Key("1200"), "same inputs give the same key");
+		Require(!(base == Key("1201")), "text is part of the key");
+		Require(!(base == Key("1200", 1)), "font is part of the key");
+		Require(!(base == Key("1200", 0, 28)), "raster size is part of the key");
+		Require(!(base == Key("1200", 0, 14, 0xFF000000u)), "color is part of the key");
+	}
+
+	void TestHitsAndMissesAreCounted()
+	{
+		TextCacheIndex index(8);
+		Require(index.Find(Key("50")) == TextCacheIndex::kNoSlot, "empty index misses");
+		bool evicted = true;
+		const std::uint32_t slot = index.Insert(Key("50"), evicted);
+		Require(!evicted, "insert below capacity does not evict");
+		Require(index.Find(Key("50")) == slot, "inserted key resolves to its slot");
+		Require(index.Stats().hits == 1 && index.Stats().misses == 1, "hit/miss counters");
+
+		index.Clear();
+		Require(index.Size() == 0 && index.Find(Key("50")) == TextCacheIndex::kNoSlot, "clear drops every entry");
+	}
+
+	void TestClockKeepsReferencedEntries()
+	{
+		TextCacheIndex index(4);
+		bool evicted = false;
+		for (const char* text : { "hud", "a", "b", "c" }) index.Insert(Key(text), evicted);
+		index.Find(Key("hud"));   // 常驻 HUD 文字被再次命中
+
+		const std::uint32_t slot = index.Insert(Key("d"), evicted);
+		Require(evicted && index.Stats().evictions == 1, "full index evicts on insert");
+		Require(index.Find(Key("hud")) != TextCacheIndex::kNoSlot, "referenced entry survives one sweep");
+		Require(index.Find(Key("a")) == TextCacheIndex::kNoSlot, "first unreferenced entry is the victim");
+		Require(index.Find(Key("d")) == slot, "new key takes the victim's slot");
+	}
+
+	void TestEvictionKeepsProbeChainsIntact()
+	{
+		// 小容量 + 大量不同键：反复淘汰会触发后移回填，任一存活键必须仍可查到且槽位一致
+		TextCacheIndex index(48);
+		std::vector<TextCacheKey> slotKeys(48);
+		std::mt19937 rng(7u);
+		for (int i = 0; i < 100000; ++i) {
+			const TextCacheKey key = Key(std::to_string(rng() % 400));
+			std::uint32_t slot = index.Find(key);
+			if (slot == TextCacheIndex::kNoSlot) {
+				bool evicted = false;
+				slot = index.Insert(key, evicted);
+				slotKeys[slot] = key;
+			}
+			Require(slotKeys[slot] == key, "lookup returned a slot holding another key");
+		}
+		for (std::uint32_t slot = 0; slot < index.Size(); ++slot) {
+			Require(index.Find(slotKeys[slot]) == slot, "every resident key must stay reachable");
+		}
+	}
+}
+
+int main()
+{
+	try {
+		TestKeyCoversEveryField();
+		TestHitsAndMissesAreCounted();
+		TestClockKeepsReferencedEntries();
+		TestEvictionKeepsProbeChainsIntact();
+		std::cout << "TextCacheIndexTests passed\n";
+		return 0;
+	}
+	catch (const std::exception& error) {
+		std::cerr << "TextCacheIndexTests failed: " << error.what() << '\n';
+		return 1;
+	}
+}
@@ -0,0 +1,198 @@
+#include "Renderer/TextRecord.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// 全局 operator new 计数：录制稳态下必须为 0。
+namespace {
+	std::atomic<std::size_t> gAllocationCount{ 0 };
+}
+
+void* operator new(std::size_t size)
+{
+	gAllocationCount.fetch_add(1, std::memory_order_relaxed);
+	if (void* p = std::malloc(size ? size : 1)) return p;
+	throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+	std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+	std::free(p);
+}
+
+namespace {
+	using pvz::FontFaceId;
+	using pvz::FontFaceRegistry;
+	using pvz::TextArena;
+	using pvz::TextSpan;
+
+	void Require(bool condition, const std::string& message)
+	{
+		if (!condition) throw std::runtime_error(message);
+	}
+
+	// 与 Graphics.h 的 DeferredTextCmd 相同的录制载荷形状（去掉颜色/裁剪等纯标量字段）
+	struct RecordedText {
+		TextSpan text;
+		FontFaceId font;
+		int fontSize = 0;
+		float x = 0.0f;
+		float y = 0.0f;
+	};
+
+	struct WorkerLike {
+		TextArena arena;
+		std::vector<RecordedText> cmds;
+
+		void Reset()
+		{
+			arena.Reset();
+			cmds.clear();
+		}
+	};
+
+	/** 生存模式 HUD 一帧的典型录制：伤害数字、血量标签、阳光/波次文字。 */
+	void RecordHudFrame(WorkerLike& worker, FontFaceRegistry& fonts, int frame)
+	{
+		char buffer[32];
+		for (int i = 0; i < 400; ++i) {
+			const int damage = (frame * 37 + i * 13) % 1800;
+			const int length = std::snprintf(buffer, sizeof(buffer), "%d", damage);
+			RecordedText cmd;
+			cmd.text = worker.arena.Append(std::string_view(buffer, static_cast<std::size_t>(length)));
+			cmd.font = fonts.Intern("ContinuumBold");
+			cmd.fontSize = 14;
+			cmd.x = static_cast<float>(i);
+			worker.cmds.push_back(cmd);
+		}
+		for (int i = 0; i < 60; ++i) {
+			const int length = std::snprintf(buffer, sizeof(buffer), "HP %d/%d", 270 - i, 270);
+			RecordedText cmd;
+			cmd.text = worker.arena.Append(std::string_view(buffer, static_cast<std::size_t>(length)));
+			cmd.font = fonts.Intern("HouseofTerror");
+			cmd.fontSize = 12;
+			worker.cmds.push_back(cmd);
+		}
+		RecordedText wave;
+		wave.text = worker.arena.Append("第 12 轮 · 最后一波");
+		wave.font = fonts.Intern("FZCQ");
+		wave.fontSize = 24;
+		worker.cmds.push_back(wave);
+	}
+
+	void TestSteadyStateRecordDoesNotAllocate()
+	{
+		FontFaceRegistry fonts;
+		WorkerLike worker;
+		worker.cmds.reserve(16);   // 故意偏小：扩容只应发生在热身帧
+
+		// 热身两帧：字体首次驻留、arena 与命令数组扩到峰值
+		for (int frame = 0; frame < 2; ++frame) {
+			worker.Reset();
+			RecordHudFrame(worker, fonts, frame);
+		}
+
+		const std::size_t before = gAllocationCount.load();
+		for (int frame = 2; frame < 200; ++frame) {
+			worker.Reset();
+			RecordHudFrame(worker, fonts, frame);
+		}
+		const std::size_t allocations = gAllocationCount.load() - before;
+		Require(allocations == 0,
+			"steady-state text record allocated " + std::to_string(allocations) + " times");
+
+		// 回读：arena 扩容后 span 仍指向正确字节
+		Require(worker.arena.View(worker.cmds.back().text) == "第 12 轮 · 最后一波", "wave text must read back");
+		char expected[32];
+		const int length = std::snprintf(expected, sizeof(expected), "%d", (199 * 37 + 5 * 13) % 1800);
+		Require(worker.arena.View(worker.cmds[5].text) == std::string_view(expected, length),
+			"damage text must read back");
+		Require(fonts.Key(worker.cmds.back().font) == "FZCQ", "font id must map back to its key");
+		Require(fonts.Count() == 3, "each font key is interned once");
+	}
+
+	void TestArenaSpansSurviveGrowth()
+	{
+		TextArena arena;
+		std::vector<TextSpan> spans;
+		std::vector<std::string> texts;
+		for (int i = 0; i < 5000; ++i) {
+			texts.push_back(std::string(static_cast<std::size_t>(i % 23), static_cast<char>('a' + i % 26)));
+			spans.push_back(arena.Append(texts.back()));
+		}
+		for (std::size_t i = 0; i < spans.size(); ++i) {
+			Require(arena.View(spans[i]) == texts[i], "span must survive arena growth");
+		}
+		const std::size_t capacity = arena.Capacity();
+		arena.Reset();
+		Require(arena.Used() == 0 && arena.Capacity() == capacity, "reset keeps capacity");
+		Require(arena.View(arena.Append("")).empty(), "empty text gives an empty span");
+	}
+
+	void TestRegistryIsConsistentAcrossThreads()
+	{
+		FontFaceRegistry fonts;
+		Require(!fonts.Find("ContinuumBold").IsValid(), "unknown font must not resolve");
+		Require(fonts.Key(FontFaceId{}).empty(), "invalid id maps to an empty key");
+
+		const char* const keys[] = { "ContinuumBold", "HouseofTerror", "FZCQ", "DwarvenTodcraft" };
+		std::vector<std::vector<FontFaceId>> results(8);
+		std::vector<std::thread> threads;
+		for (std::size_t t = 0; t < results.size(); ++t) {
+			threads.emplace_back([&, t]() {
+				for (int round = 0; round < 1000; ++round) {
+					for (std::size_t k = 0; k < 4; ++k) {
+						const FontFaceId id = fonts.Intern(keys[(k + t) % 4]);
+						if (round == 0) results[t].push_back(id);
+					}
+				}
+			});
+		}
+		for (std::thread& thread : threads) thread.join();
+
+		Require(fonts.Count() == 4, "concurrent interning must not duplicate keys");
+		for (std::size_t t = 0; t < results.size(); ++t) {
+			for (std::size_t k = 0; k < 4; ++k) {
+				Require(fonts.Key(results[t][k]) == keys[(k + t) % 4], "every thread sees the same id per key");
+			}
+		}
+	}
+
+	void TestRegistryRefusesOverflow()
+	{
+		FontFaceRegistry fonts;
+		for (int i = 0; i < FontFaceRegistry::kMaxFaces; ++i) {
+			Require(fonts.Intern("font" + std::to_string(i)).IsValid(), "registry should accept up to kMaxFaces");
+		}
+		Require(!fonts.Intern("one-too-many").IsValid(), "full registry returns an invalid id");
+		Require(fonts.Intern("font0").index == 0, "existing keys still resolve when full");
+	}
+}
+
+int main()
+{
+	try {
+		TestSteadyStateRecordDoesNotAllocate();
+		TestArenaSpansSurviveGrowth();
+		TestRegistryIsConsistentAcrossThreads();
+		TestRegistryRefusesOverflow();
+		std::cout << "TextRecordTests passed\n";
+		return 0;
+	}
+	catch (const std::exception& error) {
+		std::cerr << "TextRecordTests failed: " << error.what() << '\n';
+		return 1;
+	}
+}